@@ -177,6 +177,20 @@ def register_callback_classes(out, callbacks):
                                                      "(python using callbacks defined in C++) not implemented.")
 
 
+def _is_callback_scalar_param(param, param_ctype):
+    """
+    Return True if the argument is passed by value to
+    ns3::CallbackImpl::operator(), i.e. it is a reference or a scalar
+    (pointer, arithmetic or enum) type, like in ns3::CallbackArgTraits.
+    """
+    if str(param_ctype).rstrip().endswith(('*', '&')):
+        return True
+    for cls in type(param).__mro__:
+        if cls.__module__.split('.')[-1] in ('inttype', 'booltype', 'floattype'):
+            return True
+    return False
+
+
 def generate_callback_classes(module, callbacks):
     out = module.after_forward_declarations
     for callback_impl_num, template_parameters in enumerate(callbacks):
@@ -241,6 +255,10 @@ public:
                 kwargs = {}
             try:
                 param = Parameter.new(str(param_ctype), arg_name, **kwargs)
+                if not _is_callback_scalar_param(param, param_ctype):
+                    # ns3::CallbackArgTraits passes the other arguments of
+                    # CallbackImpl::operator() by const reference
+                    param = Parameter.new('%s const &' % param_ctype, arg_name)
                 cpp_class = getattr(param, "cpp_class", None)
                 if isinstance(cpp_class, cppclass.CppClass):
                     # check if the "helper class" can be constructed
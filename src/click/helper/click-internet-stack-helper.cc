@@ -22,6 +22,7 @@
 
 #ifdef NS3_CLICK
 
+#include "ns3/abort.h"
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/object.h"
@@ -407,6 +408,8 @@ ClickInternetStackHelper::EnableAsciiIpv4Internal (
   uint32_t interface,
   bool explicitFilename)
 {
+  NS_ABORT_MSG_IF (stream != 0 && stream->GetTraceFormat () != OutputStreamWrapper::TEXT,
+                   "ClickInternetStackHelper::EnableAsciiIpv4Internal(): only text streams are supported");
   if (!m_ipv4Enabled)
     {
       NS_LOG_INFO ("Call to enable Ipv4 ascii tracing but Ipv4 not enabled");
@@ -29,6 +29,7 @@
 #include "attribute-helper.h"
 #include "simple-ref-count.h"
 #include <typeinfo>
+#include <type_traits>
 
 /**
  * \file
@@ -99,6 +100,27 @@ struct CallbackTraits<T *>
   }
 };
 
+/**
+ * \ingroup callbackimpl
+ *
+ * Trait class giving the type with which an argument is passed through
+ * the layers of a Callback, down to the function called.
+ *
+ * The scalar types and the references are passed as they are; the other
+ * types, such as Ptr<const Packet>, are passed by const reference, so
+ * that they are only copied once, if the function called takes them by
+ * value, rather than once per layer.
+ *
+ * \tparam T \explicit The type of the argument.
+ */
+template <typename T>
+struct CallbackArgTraits
+{
+  /** The type with which the argument is passed. */
+  typedef typename std::conditional<std::is_scalar<T>::value || std::is_reference<T>::value,
+                                    T, const T &>::type Type;
+};
+
 /**
  * \ingroup callbackimpl
  * Abstract base class for CallbackImpl
@@ -196,7 +218,7 @@ class CallbackImpl<R,T1,empty,empty,empty,empty,empty,empty,empty,empty> : publi
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1) = 0;        //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -218,7 +240,8 @@ class CallbackImpl<R,T1,T2,empty,empty,empty,empty,empty,empty,empty> : public C
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1, T2) = 0;    //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type,
+                        typename CallbackArgTraits<T2>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -241,7 +264,9 @@ class CallbackImpl<R,T1,T2,T3,empty,empty,empty,empty,empty,empty> : public Call
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1, T2, T3) = 0;  //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type,
+                        typename CallbackArgTraits<T2>::Type,
+                        typename CallbackArgTraits<T3>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -265,7 +290,10 @@ class CallbackImpl<R,T1,T2,T3,T4,empty,empty,empty,empty,empty> : public Callbac
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1, T2, T3, T4) = 0;  //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type,
+                        typename CallbackArgTraits<T2>::Type,
+                        typename CallbackArgTraits<T3>::Type,
+                        typename CallbackArgTraits<T4>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -290,7 +318,11 @@ class CallbackImpl<R,T1,T2,T3,T4,T5,empty,empty,empty,empty> : public CallbackIm
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1, T2, T3, T4, T5) = 0;  //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type,
+                        typename CallbackArgTraits<T2>::Type,
+                        typename CallbackArgTraits<T3>::Type,
+                        typename CallbackArgTraits<T4>::Type,
+                        typename CallbackArgTraits<T5>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -316,7 +348,12 @@ class CallbackImpl<R,T1,T2,T3,T4,T5,T6,empty,empty,empty> : public CallbackImplB
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1, T2, T3, T4, T5, T6) = 0;  //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type,
+                        typename CallbackArgTraits<T2>::Type,
+                        typename CallbackArgTraits<T3>::Type,
+                        typename CallbackArgTraits<T4>::Type,
+                        typename CallbackArgTraits<T5>::Type,
+                        typename CallbackArgTraits<T6>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -343,7 +380,13 @@ class CallbackImpl<R,T1,T2,T3,T4,T5,T6,T7,empty,empty> : public CallbackImplBase
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1, T2, T3, T4, T5, T6, T7) = 0;  //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type,
+                        typename CallbackArgTraits<T2>::Type,
+                        typename CallbackArgTraits<T3>::Type,
+                        typename CallbackArgTraits<T4>::Type,
+                        typename CallbackArgTraits<T5>::Type,
+                        typename CallbackArgTraits<T6>::Type,
+                        typename CallbackArgTraits<T7>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -371,7 +414,14 @@ class CallbackImpl<R,T1,T2,T3,T4,T5,T6,T7,T8,empty> : public CallbackImplBase
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1, T2, T3, T4, T5, T6, T7, T8) = 0;  //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type,
+                        typename CallbackArgTraits<T2>::Type,
+                        typename CallbackArgTraits<T3>::Type,
+                        typename CallbackArgTraits<T4>::Type,
+                        typename CallbackArgTraits<T5>::Type,
+                        typename CallbackArgTraits<T6>::Type,
+                        typename CallbackArgTraits<T7>::Type,
+                        typename CallbackArgTraits<T8>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -400,7 +450,15 @@ class CallbackImpl : public CallbackImplBase
 public:
   virtual ~CallbackImpl ()
   {}
-  virtual R operator() (T1, T2, T3, T4, T5, T6, T7, T8, T9) = 0;  //!< \return Callback value
+  virtual R operator() (typename CallbackArgTraits<T1>::Type,
+                        typename CallbackArgTraits<T2>::Type,
+                        typename CallbackArgTraits<T3>::Type,
+                        typename CallbackArgTraits<T4>::Type,
+                        typename CallbackArgTraits<T5>::Type,
+                        typename CallbackArgTraits<T6>::Type,
+                        typename CallbackArgTraits<T7>::Type,
+                        typename CallbackArgTraits<T8>::Type,
+                        typename CallbackArgTraits<T9>::Type) = 0;  //!< \return Callback value
   virtual std::string GetTypeid (void) const
   {
     return DoGetTypeid ();
@@ -458,7 +516,7 @@ public:
    * \param [in] a1 First argument
    * \return Callback value
    */
-  R operator() (T1 a1)
+  R operator() (typename CallbackArgTraits<T1>::Type a1)
   {
     return m_functor (a1);
   }
@@ -467,7 +525,7 @@ public:
    * \param [in] a2 Second argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,typename CallbackArgTraits<T2>::Type a2)
   {
     return m_functor (a1,a2);
   }
@@ -477,7 +535,9 @@ public:
    * \param [in] a3 Third argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3)
   {
     return m_functor (a1,a2,a3);
   }
@@ -488,7 +548,10 @@ public:
    * \param [in] a4 Fourth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4)
   {
     return m_functor (a1,a2,a3,a4);
   }
@@ -500,7 +563,11 @@ public:
    * \param [in] a5 Fifth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5)
   {
     return m_functor (a1,a2,a3,a4,a5);
   }
@@ -513,7 +580,12 @@ public:
    * \param [in] a6 Sixth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6)
   {
     return m_functor (a1,a2,a3,a4,a5,a6);
   }
@@ -527,7 +599,13 @@ public:
    * \param [in] a7 Seventh argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7)
   {
     return m_functor (a1,a2,a3,a4,a5,a6,a7);
   }
@@ -542,7 +620,14 @@ public:
    * \param [in] a8 eighth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7,
+                typename CallbackArgTraits<T8>::Type a8)
   {
     return m_functor (a1,a2,a3,a4,a5,a6,a7,a8);
   }
@@ -558,7 +643,15 @@ public:
    * \param [in] a9 ninth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8,T9 a9)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7,
+                typename CallbackArgTraits<T8>::Type a8,
+                typename CallbackArgTraits<T9>::Type a9)
   {
     return m_functor (a1,a2,a3,a4,a5,a6,a7,a8,a9);
   }
@@ -622,7 +715,7 @@ public:
    * \param [in] a1 First argument
    * \return Callback value
    */
-  R operator() (T1 a1)
+  R operator() (typename CallbackArgTraits<T1>::Type a1)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1);
   }
@@ -631,7 +724,7 @@ public:
    * \param [in] a2 Second argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,typename CallbackArgTraits<T2>::Type a2)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1, a2);
   }
@@ -641,7 +734,9 @@ public:
    * \param [in] a3 Third argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1, a2, a3);
   }
@@ -652,7 +747,10 @@ public:
    * \param [in] a4 Fourth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1, a2, a3, a4);
   }
@@ -664,7 +762,11 @@ public:
    * \param [in] a5 Fifth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1, a2, a3, a4, a5);
   }
@@ -677,7 +779,12 @@ public:
    * \param [in] a6 Sixth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1, a2, a3, a4, a5, a6);
   }
@@ -691,7 +798,13 @@ public:
    * \param [in] a7 Seventh argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1, a2, a3, a4, a5, a6, a7);
   }
@@ -706,7 +819,14 @@ public:
    * \param [in] a8 Eighth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7,
+                typename CallbackArgTraits<T8>::Type a8)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1, a2, a3, a4, a5, a6, a7, a8);
   }
@@ -722,7 +842,15 @@ public:
    * \param [in] a9 Ninth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8, T9 a9)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7,
+                typename CallbackArgTraits<T8>::Type a8,
+                typename CallbackArgTraits<T9>::Type a9)
   {
     return ((CallbackTraits<OBJ_PTR>::GetReference (m_objPtr)).*m_memPtr)(a1, a2, a3, a4, a5, a6, a7, a8, a9);
   }
@@ -792,7 +920,7 @@ public:
    * \param [in] a1 First argument
    * \return Callback value
    */
-  R operator() (T1 a1)
+  R operator() (typename CallbackArgTraits<T1>::Type a1)
   {
     return m_functor (m_a,a1);
   }
@@ -801,7 +929,7 @@ public:
    * \param [in] a2 Second argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,typename CallbackArgTraits<T2>::Type a2)
   {
     return m_functor (m_a,a1,a2);
   }
@@ -811,7 +939,9 @@ public:
    * \param [in] a3 Third argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3)
   {
     return m_functor (m_a,a1,a2,a3);
   }
@@ -822,7 +952,10 @@ public:
    * \param [in] a4 Fourth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4)
   {
     return m_functor (m_a,a1,a2,a3,a4);
   }
@@ -834,7 +967,11 @@ public:
    * \param [in] a5 Fifth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5)
   {
     return m_functor (m_a,a1,a2,a3,a4,a5);
   }
@@ -847,7 +984,12 @@ public:
    * \param [in] a6 Sixth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6)
   {
     return m_functor (m_a,a1,a2,a3,a4,a5,a6);
   }
@@ -861,7 +1003,13 @@ public:
    * \param [in] a7 Seventh argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7)
   {
     return m_functor (m_a,a1,a2,a3,a4,a5,a6,a7);
   }
@@ -876,7 +1024,14 @@ public:
    * \param [in] a8 Eighth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7,
+                typename CallbackArgTraits<T8>::Type a8)
   {
     return m_functor (m_a,a1,a2,a3,a4,a5,a6,a7,a8);
   }
@@ -950,7 +1105,7 @@ public:
    * \param [in] a1 First argument
    * \return Callback value
    */
-  R operator() (T1 a1)
+  R operator() (typename CallbackArgTraits<T1>::Type a1)
   {
     return m_functor (m_a1,m_a2,a1);
   }
@@ -959,7 +1114,7 @@ public:
    * \param [in] a2 Second argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,typename CallbackArgTraits<T2>::Type a2)
   {
     return m_functor (m_a1,m_a2,a1,a2);
   }
@@ -969,7 +1124,9 @@ public:
    * \param [in] a3 Third argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3)
   {
     return m_functor (m_a1,m_a2,a1,a2,a3);
   }
@@ -980,7 +1137,10 @@ public:
    * \param [in] a4 Fourth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4)
   {
     return m_functor (m_a1,m_a2,a1,a2,a3,a4);
   }
@@ -992,7 +1152,11 @@ public:
    * \param [in] a5 Fifth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5)
   {
     return m_functor (m_a1,m_a2,a1,a2,a3,a4,a5);
   }
@@ -1005,7 +1169,12 @@ public:
    * \param [in] a6 Sixth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6)
   {
     return m_functor (m_a1,m_a2,a1,a2,a3,a4,a5,a6);
   }
@@ -1019,7 +1188,13 @@ public:
    * \param [in] a7 Seventh argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7)
   {
     return m_functor (m_a1,m_a2,a1,a2,a3,a4,a5,a6,a7);
   }
@@ -1098,7 +1273,7 @@ public:
    * \param [in] a1 First argument
    * \return Callback value
    */
-  R operator() (T1 a1)
+  R operator() (typename CallbackArgTraits<T1>::Type a1)
   {
     return m_functor (m_a1,m_a2,m_a3,a1);
   }
@@ -1107,7 +1282,7 @@ public:
    * \param [in] a2 Second argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,typename CallbackArgTraits<T2>::Type a2)
   {
     return m_functor (m_a1,m_a2,m_a3,a1,a2);
   }
@@ -1117,7 +1292,9 @@ public:
    * \param [in] a3 Third argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3)
   {
     return m_functor (m_a1,m_a2,m_a3,a1,a2,a3);
   }
@@ -1128,7 +1305,10 @@ public:
    * \param [in] a4 Fourth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4)
   {
     return m_functor (m_a1,m_a2,m_a3,a1,a2,a3,a4);
   }
@@ -1140,7 +1320,11 @@ public:
    * \param [in] a5 Fifth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5)
   {
     return m_functor (m_a1,m_a2,m_a3,a1,a2,a3,a4,a5);
   }
@@ -1153,7 +1337,12 @@ public:
    * \param [in] a6 Sixth argument
    * \return Callback value
    */
-  R operator() (T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6)
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6)
   {
     return m_functor (m_a1,m_a2,m_a3,a1,a2,a3,a4,a5,a6);
   }
@@ -1406,7 +1595,7 @@ public:
    * \param [in] a1 First argument
    * \return Callback value
    */
-  R operator() (T1 a1) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1) const
   {
     return (*(DoPeekImpl ()))(a1);
   }
@@ -1415,7 +1604,8 @@ public:
    * \param [in] a2 Second argument
    * \return Callback value
    */
-  R operator() (T1 a1, T2 a2) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2) const
   {
     return (*(DoPeekImpl ()))(a1,a2);
   }
@@ -1425,7 +1615,9 @@ public:
    * \param [in] a3 Third argument
    * \return Callback value
    */
-  R operator() (T1 a1, T2 a2, T3 a3) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3) const
   {
     return (*(DoPeekImpl ()))(a1,a2,a3);
   }
@@ -1436,7 +1628,10 @@ public:
    * \param [in] a4 Fourth argument
    * \return Callback value
    */
-  R operator() (T1 a1, T2 a2, T3 a3, T4 a4) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4) const
   {
     return (*(DoPeekImpl ()))(a1,a2,a3,a4);
   }
@@ -1448,7 +1643,11 @@ public:
    * \param [in] a5 Fifth argument
    * \return Callback value
    */
-  R operator() (T1 a1, T2 a2, T3 a3, T4 a4,T5 a5) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5) const
   {
     return (*(DoPeekImpl ()))(a1,a2,a3,a4,a5);
   }
@@ -1461,7 +1660,12 @@ public:
    * \param [in] a6 Sixth argument
    * \return Callback value
    */
-  R operator() (T1 a1, T2 a2, T3 a3, T4 a4,T5 a5,T6 a6) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6) const
   {
     return (*(DoPeekImpl ()))(a1,a2,a3,a4,a5,a6);
   }
@@ -1475,7 +1679,13 @@ public:
    * \param [in] a7 Seventh argument
    * \return Callback value
    */
-  R operator() (T1 a1, T2 a2, T3 a3, T4 a4,T5 a5,T6 a6,T7 a7) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7) const
   {
     return (*(DoPeekImpl ()))(a1,a2,a3,a4,a5,a6,a7);
   }
@@ -1490,7 +1700,14 @@ public:
    * \param [in] a8 Eighth argument
    * \return Callback value
    */
-  R operator() (T1 a1, T2 a2, T3 a3, T4 a4,T5 a5,T6 a6,T7 a7,T8 a8) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7,
+                typename CallbackArgTraits<T8>::Type a8) const
   {
     return (*(DoPeekImpl ()))(a1,a2,a3,a4,a5,a6,a7,a8);
   }
@@ -1506,7 +1723,15 @@ public:
    * \param [in] a9 Ninth argument
    * \return Callback value
    */
-  R operator() (T1 a1, T2 a2, T3 a3, T4 a4,T5 a5,T6 a6,T7 a7,T8 a8, T9 a9) const
+  R operator() (typename CallbackArgTraits<T1>::Type a1,
+                typename CallbackArgTraits<T2>::Type a2,
+                typename CallbackArgTraits<T3>::Type a3,
+                typename CallbackArgTraits<T4>::Type a4,
+                typename CallbackArgTraits<T5>::Type a5,
+                typename CallbackArgTraits<T6>::Type a6,
+                typename CallbackArgTraits<T7>::Type a7,
+                typename CallbackArgTraits<T8>::Type a8,
+                typename CallbackArgTraits<T9>::Type a9) const
   {
     return (*(DoPeekImpl ()))(a1,a2,a3,a4,a5,a6,a7,a8,a9);
   }
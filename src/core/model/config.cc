@@ -25,7 +25,11 @@
 #include "names.h"
 #include "pointer.h"
 #include "log.h"
+#include "type-id.h"
+#include "callback.h"
 
+#include <cstdlib>
+#include <map>
 #include <sstream>
 
 /**
@@ -296,142 +300,261 @@ ArrayMatcher::StringToUint32 (std::string str, uint32_t *value) const
 
 /**
  * \ingroup config-impl
- * Abstract class to parse Config paths into object references.
+ * The parsed elements of a CompiledPath, and the attributes matching them.
  */
-class Resolver
+class CompiledPathImpl
 {
 public:
   /**
-   * Construct from a base Config path.
-   *
-   * \param [in] path The Config path.
+   * Constructor.
+   * \param [in] path The path, with a leading and a trailing '/'.
    */
-  Resolver (std::string path);
-  /** Destructor. */
-  virtual ~Resolver ();
+  CompiledPathImpl (std::string path);
 
   /**
-   * Parse the stored Config path into an object reference,
-   * beginning at the indicated root object.
-   *
-   * \param [in] root The object corresponding to the current position in
-   *                  in the Config path.
+   * \returns The number of elements of the path.
    */
-  void Resolve (Ptr<Object> root);
+  std::size_t GetN (void) const;
+  /**
+   * Find the objects matching the first elements of the path.
+   * \param [in] n The number of elements to match.
+   * \returns The matching objects.
+   */
+  MatchContainer Lookup (std::size_t n) const;
 
 private:
-  /** Ensure the Config path starts and ends with a '/'. */
-  void Canonicalize (void);
+  /** A parsed element of the path. */
+  struct Element
+  {
+    std::string name;   //!< The element, as written in the path
+    bool isIndex;       //!< Whether the element is a single index
+    std::size_t index;  //!< The index, if the element is a single index
+    bool hasTid;        //!< Whether the element is a GetObject with a known TypeId
+    TypeId tid;         //!< The TypeId of the GetObject element
+  };
+  /** An attribute matching an element, which leads to other objects. */
+  struct Attribute
+  {
+    std::string name;                         //!< The attribute name
+    Ptr<const AttributeAccessor> accessor;    //!< The attribute accessor
+    bool gettable;                            //!< Whether the attribute can be read
+    const ObjectPtrContainerAccessor *container; //!< The container accessor, 0 for a pointer
+  };
+  /** The attributes matching an element, by type of object. */
+  typedef std::map<TypeId, std::vector<Attribute> > AttributeCache;
+  /** The state of a resolution. */
+  struct Resolution;
+
   /**
-   * Parse the next element in the Config path.
-   *
-   * \param [in] path The remaining portion of the Config path.
-   * \param [in] root The object corresponding to the current position
-   *                  in the Config path.
+   * Get the attributes of a type of object matching an element.
+   * \param [in] i The index of the element.
+   * \param [in] tid The type of the object.
+   * \returns The attributes, pointers or containers of objects.
    */
-  void DoResolve (std::string path, Ptr<Object> root);
+  const std::vector<Attribute> & GetAttributes (std::size_t i, TypeId tid) const;
   /**
-   * Parse an index on the Config path.
-   *
-   * \param [in] path The remaining Config path.
-   * \param [in,out] vector The resulting list of matching objects.
+   * Match the next element of the path.
+   * \param [in] root The object matched by the previous elements, 0 at
+   *             the root of the "/Names" namespace.
+   * \param [in] i The index of the element.
+   * \param [in,out] resolution The state of the resolution.
    */
-  void DoArrayResolve (std::string path, const ObjectPtrContainerValue &vector);
+  void DoResolve (Ptr<Object> root, std::size_t i, Resolution &resolution) const;
   /**
-   * Handle one object found on the path.
-   *
-   * \param [in] object The current object on the Config path.
+   * Match the index element following a container attribute.
+   * \param [in] root The object with the container attribute.
+   * \param [in] attribute The container attribute.
+   * \param [in] i The index of the index element.
+   * \param [in,out] resolution The state of the resolution.
    */
-  void DoResolveOne (Ptr<Object> object);
+  void DoArrayResolve (Ptr<Object> root, const Attribute &attribute,
+                       std::size_t i, Resolution &resolution) const;
+
+  std::vector<Element> m_elements;        //!< The elements of the path
+  mutable std::vector<AttributeCache> m_attributes; //!< The attributes matching each element
+};
+
+/**
+ * \ingroup config-impl
+ * The state of the resolution of a CompiledPath.
+ */
+struct CompiledPathImpl::Resolution
+{
+  /** The number of elements to match. */
+  std::size_t n;
+  /** Current list of path tokens. */
+  std::vector<std::string> workStack;
+  /** The objects found. */
+  std::vector<Ptr<Object> > objects;
+  /** The matching paths of the objects found. */
+  std::vector<std::string> contexts;
+
   /**
    * Get the current Config path.
    *
    * \returns The current Config path.
    */
-  std::string GetResolvedPath (void) const;
-  /**
-   * Handle one found object.
-   *
-   * \param [in] object The found object.
-   * \param [in] path The matching Config path context.
-   */
-  virtual void DoOne (Ptr<Object> object, std::string path) = 0;
-
-  /** Current list of path tokens. */
-  std::vector<std::string> m_workStack;
-  /** The Config path. */
-  std::string m_path;
-
-};  // class Resolver
-
-Resolver::Resolver (std::string path)
-  : m_path (path)
+  std::string GetResolvedPath (void) const
+  {
+    std::string fullPath = "/";
+    for (std::vector<std::string>::const_iterator i = workStack.begin (); i != workStack.end (); i++)
+      {
+        fullPath += *i + "/";
+      }
+    return fullPath;
+  }
+};
+
+CompiledPathImpl::CompiledPathImpl (std::string path)
 {
   NS_LOG_FUNCTION (this << path);
-  Canonicalize ();
+  std::string::size_type start = 1;
+  std::string::size_type next;
+  while ((next = path.find ("/", start)) != std::string::npos)
+    {
+      Element element;
+      element.name = path.substr (start, next - start);
+      element.isIndex = !element.name.empty () && element.name.size () < 10
+        && element.name.find_first_not_of ("0123456789") == std::string::npos;
+      element.index = element.isIndex ? std::strtoul (element.name.c_str (), 0, 10) : 0;
+      element.hasTid = element.name.find ("$") == 0
+        && TypeId::LookupByNameFailSafe (element.name.substr (1), &element.tid);
+      m_elements.push_back (element);
+      start = next + 1;
+    }
+  m_attributes.resize (m_elements.size ());
 }
-Resolver::~Resolver ()
+
+std::size_t
+CompiledPathImpl::GetN (void) const
 {
-  NS_LOG_FUNCTION (this);
+  return m_elements.size ();
 }
-void
-Resolver::Canonicalize (void)
+
+CompiledPath::CompiledPath (std::string path)
+  : m_path (path)
 {
-  NS_LOG_FUNCTION (this);
+  NS_LOG_FUNCTION (this << path);
+
+  // The leaf is the attribute or trace source name, after the last '/'
+  std::string::size_type slash = path.find_last_of ("/");
+  if (slash != std::string::npos)
+    {
+      m_leaf = path.substr (slash + 1, path.size () - (slash + 1));
+    }
 
   // ensure that we start and end with a '/'
-  std::string::size_type tmp = m_path.find ("/");
-  if (tmp != 0)
+  std::string canonical = path;
+  if (canonical.find ("/") != 0)
     {
-      // no slash at start
-      m_path = "/" + m_path;
+      canonical = "/" + canonical;
     }
-  tmp = m_path.find_last_of ("/");
-  if (tmp != (m_path.size () - 1))
+  if (canonical.find_last_of ("/") != canonical.size () - 1)
     {
-      // no slash at end
-      m_path = m_path + "/";
+      canonical = canonical + "/";
     }
+  m_impl = new CompiledPathImpl (canonical);
+
+  // The leaf parent is the path without the leaf, or the whole path if it
+  // ends with a '/'
+  m_nLeafParent = m_impl->GetN ();
+  if (slash != std::string::npos && !m_leaf.empty ())
+    {
+      m_nLeafParent--;
+    }
+  NS_LOG_DEBUG ("path=" << path << " elements=" << m_impl->GetN () << " leaf=" << m_leaf);
 }
 
-void
-Resolver::Resolve (Ptr<Object> root)
+CompiledPath::~CompiledPath ()
 {
-  NS_LOG_FUNCTION (this << root);
-
-  DoResolve (m_path, root);
+  NS_LOG_FUNCTION (this);
+  delete m_impl;
+  m_impl = 0;
 }
 
 std::string
-Resolver::GetResolvedPath (void) const
+CompiledPath::GetPath (void) const
 {
-  NS_LOG_FUNCTION (this);
+  return m_path;
+}
 
-  std::string fullPath = "/";
-  for (std::vector<std::string>::const_iterator i = m_workStack.begin (); i != m_workStack.end (); i++)
+const std::vector<CompiledPathImpl::Attribute> &
+CompiledPathImpl::GetAttributes (std::size_t i, TypeId tid) const
+{
+  AttributeCache::const_iterator it = m_attributes[i].find (tid);
+  if (it != m_attributes[i].end ())
     {
-      fullPath += *i + "/";
+      return it->second;
+    }
+  const std::string &item = m_elements[i].name;
+  std::vector<Attribute> &attributes = m_attributes[i][tid];
+  TypeId nextTid = tid;
+  do
+    {
+      tid = nextTid;
+      for (uint32_t j = 0; j < tid.GetAttributeN (); j++)
+        {
+          struct TypeId::AttributeInformation info = tid.GetAttribute (j);
+          if (info.name != item && item != "*")
+            {
+              continue;
+            }
+          Attribute attribute;
+          attribute.name = info.name;
+          attribute.accessor = info.accessor;
+          attribute.gettable = (info.flags & TypeId::ATTR_GET) && info.accessor->HasGetter ();
+          attribute.container = 0;
+          if (dynamic_cast<const PointerChecker *> (PeekPointer (info.checker)) != 0)
+            {
+              attributes.push_back (attribute);
+            }
+          else if (dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker)) != 0)
+            {
+              attribute.container = dynamic_cast<const ObjectPtrContainerAccessor *> (PeekPointer (info.accessor));
+              NS_ASSERT (attribute.container != 0);
+              attributes.push_back (attribute);
+            }
+          // this could be anything else and we don't know what to do with it.
+          // So, we just ignore it.
+        }
+      nextTid = tid.GetParent ();
     }
-  return fullPath;
+  while (nextTid != tid);
+  return attributes;
 }
 
-void
-Resolver::DoResolveOne (Ptr<Object> object)
+MatchContainer
+CompiledPathImpl::Lookup (std::size_t n) const
 {
-  NS_LOG_FUNCTION (this << object);
+  NS_LOG_FUNCTION (this << n);
+  Resolution resolution;
+  resolution.n = n;
+  for (std::size_t i = 0; i < GetRootNamespaceObjectN (); i++)
+    {
+      DoResolve (GetRootNamespaceObject (i), 0, resolution);
+    }
 
-  NS_LOG_DEBUG ("resolved=" << GetResolvedPath ());
-  DoOne (object, GetResolvedPath ());
+  //
+  // See if we can do something with the object name service.  Starting with
+  // the root pointer zeroed indicates to the resolver that it should start
+  // looking at the root of the "/Names" namespace during this go.
+  //
+  DoResolve (0, 0, resolution);
+
+  std::string path = "/";
+  for (std::size_t i = 0; i < n; i++)
+    {
+      path += m_elements[i].name + "/";
+    }
+  return MatchContainer (resolution.objects, resolution.contexts, path);
 }
 
 void
-Resolver::DoResolve (std::string path, Ptr<Object> root)
+CompiledPathImpl::DoResolve (Ptr<Object> root, std::size_t i, Resolution &resolution) const
 {
-  NS_LOG_FUNCTION (this << path << root);
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
+  NS_LOG_FUNCTION (this << root << i);
 
-  if (next == std::string::npos)
+  if (i == resolution.n)
     {
       //
       // If root is zero, we're beginning to see if we can use the object name
@@ -443,12 +566,13 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
       //
       if (root)
         {
-          DoResolveOne (root);
+          NS_LOG_DEBUG ("resolved=" << resolution.GetResolvedPath ());
+          resolution.objects.push_back (root);
+          resolution.contexts.push_back (resolution.GetResolvedPath ());
         }
       return;
     }
-  std::string item = path.substr (1, next - 1);
-  std::string pathLeft = path.substr (next, path.size () - next);
+  const Element &element = m_elements[i];
 
   //
   // If root is zero, we're beginning to see if we can use the object name
@@ -457,16 +581,12 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   // the root of the "/Names" namespace, so we just ignore it and move on to
   // the next segment.
   //
-  if (root == 0)
+  if (root == 0 && element.name.compare (0, 5, "Names") == 0)
     {
-      std::string::size_type offset = path.find ("/Names");
-      if (offset == 0)
-        {
-          m_workStack.push_back (item);
-          DoResolve (pathLeft, root);
-          m_workStack.pop_back ();
-          return;
-        }
+      resolution.workStack.push_back (element.name);
+      DoResolve (root, i + 1, resolution);
+      resolution.workStack.pop_back ();
+      return;
     }
 
   //
@@ -475,13 +595,13 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   // zero, this means to look in the root of the "/Names" name space, otherwise
   // it refers to a name space context (level).
   //
-  Ptr<Object> namedObject = Names::Find<Object> (root, item);
+  Ptr<Object> namedObject = Names::Find<Object> (root, element.name);
   if (namedObject)
     {
-      NS_LOG_DEBUG ("Name system resolved item = " << item << " to " << namedObject);
-      m_workStack.push_back (item);
-      DoResolve (pathLeft, namedObject);
-      m_workStack.pop_back ();
+      NS_LOG_DEBUG ("Name system resolved item = " << element.name << " to " << namedObject);
+      resolution.workStack.push_back (element.name);
+      DoResolve (namedObject, i + 1, resolution);
+      resolution.workStack.pop_back ();
       return;
     }
 
@@ -496,106 +616,93 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
     {
       return;
     }
-  std::string::size_type dollarPos = item.find ("$");
-  if (dollarPos == 0)
+  if (element.name.find ("$") == 0)
     {
       // This is a call to GetObject
-      std::string tidString = item.substr (1, item.size () - 1);
-      NS_LOG_DEBUG ("GetObject=" << tidString << " on path=" << GetResolvedPath ());
-      TypeId tid = TypeId::LookupByName (tidString);
+      NS_LOG_DEBUG ("GetObject=" << element.name << " on path=" << resolution.GetResolvedPath ());
+      TypeId tid = element.hasTid ? element.tid : TypeId::LookupByName (element.name.substr (1));
       Ptr<Object> object = root->GetObject<Object> (tid);
       if (object == 0)
         {
-          NS_LOG_DEBUG ("GetObject (" << tidString << ") failed on path=" << GetResolvedPath ());
+          NS_LOG_DEBUG ("GetObject (" << element.name << ") failed on path=" << resolution.GetResolvedPath ());
           return;
         }
-      m_workStack.push_back (item);
-      DoResolve (pathLeft, object);
-      m_workStack.pop_back ();
+      resolution.workStack.push_back (element.name);
+      DoResolve (object, i + 1, resolution);
+      resolution.workStack.pop_back ();
+      return;
     }
-  else
-    {
-      // this is a normal attribute.
-      TypeId tid;
-      TypeId nextTid = root->GetInstanceTypeId ();
-      bool foundMatch = false;
 
-      do
+  // this is a normal attribute.
+  const std::vector<Attribute> &attributes = GetAttributes (i, root->GetInstanceTypeId ());
+  for (std::vector<Attribute>::const_iterator it = attributes.begin (); it != attributes.end (); it++)
+    {
+      if (it->container == 0)
         {
-          tid = nextTid;
-
-          for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+          NS_LOG_DEBUG ("GetAttribute(ptr)=" << it->name << " on path=" << resolution.GetResolvedPath ());
+          PointerValue pValue;
+          if (it->gettable)
             {
-              struct TypeId::AttributeInformation info;
-              info = tid.GetAttribute (i);
-              if (info.name != item && item != "*")
-                {
-                  continue;
-                }
-              // attempt to cast to a pointer checker.
-              const PointerChecker *pChecker = dynamic_cast<const PointerChecker *> (PeekPointer (info.checker));
-              if (pChecker != 0)
-                {
-                  NS_LOG_DEBUG ("GetAttribute(ptr)=" << info.name << " on path=" << GetResolvedPath ());
-                  PointerValue pValue;
-                  root->GetAttribute (info.name, pValue);
-                  Ptr<Object> object = pValue.Get<Object> ();
-                  if (object == 0)
-                    {
-                      NS_LOG_ERROR ("Requested object name=\"" << item <<
-                                    "\" exists on path=\"" << GetResolvedPath () << "\""
-                                    " but is null.");
-                      continue;
-                    }
-                  foundMatch = true;
-                  m_workStack.push_back (info.name);
-                  DoResolve (pathLeft, object);
-                  m_workStack.pop_back ();
-                }
-              // attempt to cast to an object vector.
-              const ObjectPtrContainerChecker *vectorChecker =
-                dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker));
-              if (vectorChecker != 0)
-                {
-                  NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath () << pathLeft);
-                  foundMatch = true;
-                  ObjectPtrContainerValue vector;
-                  root->GetAttribute (info.name, vector);
-                  m_workStack.push_back (info.name);
-                  DoArrayResolve (pathLeft, vector);
-                  m_workStack.pop_back ();
-                }
-              // this could be anything else and we don't know what to do with it.
-              // So, we just ignore it.
+              it->accessor->Get (PeekPointer (root), pValue);
             }
-
-          nextTid = tid.GetParent ();
+          else
+            {
+              root->GetAttribute (it->name, pValue);
+            }
+          Ptr<Object> object = pValue.Get<Object> ();
+          if (object == 0)
+            {
+              NS_LOG_ERROR ("Requested object name=\"" << element.name <<
+                            "\" exists on path=\"" << resolution.GetResolvedPath () << "\""
+                            " but is null.");
+              continue;
+            }
+          resolution.workStack.push_back (it->name);
+          DoResolve (object, i + 1, resolution);
+          resolution.workStack.pop_back ();
         }
-      while (nextTid != tid);
-
-      if (!foundMatch)
+      else
         {
-          NS_LOG_DEBUG ("Requested item=" << item << " does not exist on path=" << GetResolvedPath ());
-          return;
+          NS_LOG_DEBUG ("GetAttribute(vector)=" << it->name << " on path=" << resolution.GetResolvedPath ());
+          resolution.workStack.push_back (it->name);
+          DoArrayResolve (root, *it, i + 1, resolution);
+          resolution.workStack.pop_back ();
         }
     }
+  if (attributes.empty ())
+    {
+      NS_LOG_DEBUG ("Requested item=" << element.name << " does not exist on path=" << resolution.GetResolvedPath ());
+    }
 }
 
 void
-Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &container)
+CompiledPathImpl::DoArrayResolve (Ptr<Object> root, const Attribute &attribute,
+                                  std::size_t i, Resolution &resolution) const
 {
-  NS_LOG_FUNCTION (this << path << &container);
-  NS_ASSERT (path != "");
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
-  if (next == std::string::npos)
+  NS_LOG_FUNCTION (this << root << attribute.name << i);
+  if (i == resolution.n)
+    {
+      return;
+    }
+  const Element &element = m_elements[i];
+  if (element.isIndex && attribute.gettable)
     {
+      // Get the object directly, rather than the whole container
+      Ptr<Object> object = attribute.container->Find (PeekPointer (root), element.index);
+      if (object != 0)
+        {
+          std::ostringstream oss;
+          oss << element.index;
+          resolution.workStack.push_back (oss.str ());
+          DoResolve (object, i + 1, resolution);
+          resolution.workStack.pop_back ();
+        }
       return;
     }
-  std::string item = path.substr (1, next - 1);
-  std::string pathLeft = path.substr (next, path.size () - next);
 
-  ArrayMatcher matcher = ArrayMatcher (item);
+  ObjectPtrContainerValue container;
+  root->GetAttribute (attribute.name, container);
+  ArrayMatcher matcher = ArrayMatcher (element.name);
   ObjectPtrContainerValue::Iterator it;
   for (it = container.Begin (); it != container.End (); ++it)
     {
@@ -603,13 +710,110 @@ Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &conta
         {
           std::ostringstream oss;
           oss << (*it).first;
-          m_workStack.push_back (oss.str ());
-          DoResolve (pathLeft, (*it).second);
-          m_workStack.pop_back ();
+          resolution.workStack.push_back (oss.str ());
+          DoResolve ((*it).second, i + 1, resolution);
+          resolution.workStack.pop_back ();
         }
     }
 }
 
+MatchContainer
+CompiledPath::LookupMatches (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_impl->Lookup (m_impl->GetN ());
+}
+
+void
+CompiledPath::Set (const AttributeValue &value) const
+{
+  NS_LOG_FUNCTION (this << &value);
+  m_impl->Lookup (m_nLeafParent).Set (m_leaf, value);
+}
+
+bool
+CompiledPath::SetFailSafe (const AttributeValue &value) const
+{
+  NS_LOG_FUNCTION (this << &value);
+  return m_impl->Lookup (m_nLeafParent).SetFailSafe (m_leaf, value);
+}
+
+void
+CompiledPath::Connect (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  if (!ConnectFailSafe (cb))
+    {
+      NS_FATAL_ERROR ("Could not connect callback to " << m_path);
+    }
+}
+
+bool
+CompiledPath::ConnectFailSafe (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  return m_impl->Lookup (m_nLeafParent).ConnectFailSafe (m_leaf, cb);
+}
+
+void
+CompiledPath::ConnectWithoutContext (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  if (!ConnectWithoutContextFailSafe (cb))
+    {
+      NS_FATAL_ERROR ("Could not connect callback to " << m_path);
+    }
+}
+
+bool
+CompiledPath::ConnectWithoutContextFailSafe (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  return m_impl->Lookup (m_nLeafParent).ConnectWithoutContextFailSafe (m_leaf, cb);
+}
+
+void
+CompiledPath::Disconnect (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  MatchContainer container = m_impl->Lookup (m_nLeafParent);
+  if (container.GetN () == 0)
+    {
+      NS_LOG_WARN ("Failed to disconnect " << m_leaf << ", no object matches " << container.GetPath ());
+    }
+  container.Disconnect (m_leaf, cb);
+}
+
+void
+CompiledPath::DisconnectWithoutContext (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  MatchContainer container = m_impl->Lookup (m_nLeafParent);
+  if (container.GetN () == 0)
+    {
+      NS_LOG_WARN ("Failed to disconnect " << m_leaf << ", no object matches " << container.GetPath ());
+    }
+  container.DisconnectWithoutContext (m_leaf, cb);
+}
+
+std::size_t
+CompiledPath::ConnectAll (SinkFactory sinks) const
+{
+  NS_LOG_FUNCTION (this << &sinks);
+  MatchContainer container = m_impl->Lookup (m_nLeafParent);
+  std::size_t connected = 0;
+  for (std::size_t i = 0; i < container.GetN (); i++)
+    {
+      std::string path = container.GetMatchedPath (i) + m_leaf;
+      if (container.Get (i)->TraceConnectWithoutContext (m_leaf, sinks (path)))
+        {
+          connected++;
+        }
+    }
+  NS_LOG_DEBUG ("connected " << connected << " trace sources to " << m_path);
+  return connected;
+}
+
 /**
  * \ingroup config-impl
  * Config system implementation class.
@@ -751,34 +955,7 @@ MatchContainer
 ConfigImpl::LookupMatches (std::string path)
 {
   NS_LOG_FUNCTION (this << path);
-  class LookupMatchesResolver : public Resolver
-  {
-public:
-    LookupMatchesResolver (std::string path)
-      : Resolver (path)
-    {
-    }
-    virtual void DoOne (Ptr<Object> object, std::string path)
-    {
-      m_objects.push_back (object);
-      m_contexts.push_back (path);
-    }
-    std::vector<Ptr<Object> > m_objects;
-    std::vector<std::string> m_contexts;
-  } resolver = LookupMatchesResolver (path);
-  for (Roots::const_iterator i = m_roots.begin (); i != m_roots.end (); i++)
-    {
-      resolver.Resolve (*i);
-    }
-
-  //
-  // See if we can do something with the object name service.  Starting with
-  // the root pointer zeroed indicates to the resolver that it should start
-  // looking at the root of the "/Names" namespace during this go.
-  //
-  resolver.Resolve (0);
-
-  return MatchContainer (resolver.m_objects, resolver.m_contexts, path);
+  return CompiledPath (path).LookupMatches ();
 }
 
 void
@@ -935,6 +1112,12 @@ Disconnect (std::string path, const CallbackBase &cb)
   NS_LOG_FUNCTION (path << &cb);
   ConfigImpl::Get ()->Disconnect (path, cb);
 }
+std::size_t
+ConnectAll (std::string path, CompiledPath::SinkFactory sinks)
+{
+  NS_LOG_FUNCTION (path << &sinks);
+  return CompiledPath (path).ConnectAll (sinks);
+}
 MatchContainer LookupMatches (std::string path)
 {
   NS_LOG_FUNCTION (path);
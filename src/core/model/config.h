@@ -21,6 +21,7 @@
 #define CONFIG_H
 
 #include "ptr.h"
+#include "non-copyable.h"
 #include <string>
 #include <vector>
 
@@ -35,6 +36,10 @@ namespace ns3 {
 class AttributeValue;
 class Object;
 class CallbackBase;
+class empty;
+template <typename R, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7, typename T8, typename T9>
+class Callback;
 
 /**
  * \ingroup core
@@ -306,6 +311,114 @@ private:
   std::string m_path;
 };
 
+class CompiledPathImpl;
+
+/**
+ * \ingroup config
+ * \brief A Config path, parsed once to be resolved many times.
+ *
+ * The functions of the Config namespace parse their path at each call.
+ * A CompiledPath keeps the parsed elements of its path, the TypeId of its
+ * GetObject elements, and the attributes matching its elements in each
+ * type of object met, so that the objects matching the path are found
+ * again without parsing nor searching the attributes.  The objects of an
+ * ObjectVector or ObjectMap attribute are reached directly when the path
+ * gives their index.
+ *
+ * The objects are looked up each time the path is resolved: the same
+ * CompiledPath can be used before and after objects are added.
+ */
+class CompiledPath : private NonCopyable
+{
+public:
+  /**
+   * \brief Function giving the sink to connect to each trace source matched
+   * by ConnectAll.
+   *
+   * The argument is the matching path of the trace source, and the result
+   * is the sink, which is connected without context.
+   */
+  typedef Callback<CallbackBase, std::string,
+                   empty, empty, empty, empty, empty, empty, empty, empty> SinkFactory;
+
+  /**
+   * Constructor.
+   * \param [in] path The path, as given to the functions of the Config
+   *             namespace.
+   */
+  CompiledPath (std::string path);
+  /** Destructor. */
+  ~CompiledPath ();
+
+  /**
+   * \returns The path.
+   */
+  std::string GetPath (void) const;
+
+  /**
+   * \returns A container which contains all the objects which match the
+   *          path.
+   * \see Config::LookupMatches
+   */
+  MatchContainer LookupMatches (void) const;
+  /**
+   * \param [in] value The value to set in all the attributes matching the path.
+   * \see Config::Set
+   */
+  void Set (const AttributeValue &value) const;
+  /**
+   * \param [in] value The value to set in all the attributes matching the path.
+   * \returns \c true if any matching attributes could be set.
+   * \see Config::SetFailSafe
+   */
+  bool SetFailSafe (const AttributeValue &value) const;
+  /**
+   * \param [in] cb The callback to connect to the matching trace sources.
+   * \see Config::Connect
+   */
+  void Connect (const CallbackBase &cb) const;
+  /**
+   * \param [in] cb The callback to connect to the matching trace sources.
+   * \returns \c true if any trace sources could be connected.
+   * \see Config::ConnectFailSafe
+   */
+  bool ConnectFailSafe (const CallbackBase &cb) const;
+  /**
+   * \param [in] cb The callback to connect to the matching trace sources.
+   * \see Config::ConnectWithoutContext
+   */
+  void ConnectWithoutContext (const CallbackBase &cb) const;
+  /**
+   * \param [in] cb The callback to connect to the matching trace sources.
+   * \returns \c true if any trace sources could be connected.
+   * \see Config::ConnectWithoutContextFailSafe
+   */
+  bool ConnectWithoutContextFailSafe (const CallbackBase &cb) const;
+  /**
+   * \param [in] cb The callback to disconnect from the matching trace sources.
+   * \see Config::Disconnect
+   */
+  void Disconnect (const CallbackBase &cb) const;
+  /**
+   * \param [in] cb The callback to disconnect from the matching trace sources.
+   * \see Config::DisconnectWithoutContext
+   */
+  void DisconnectWithoutContext (const CallbackBase &cb) const;
+  /**
+   * \param [in] sinks The function giving the sink of each matching trace
+   *             source.
+   * \returns The number of trace sources connected.
+   * \see Config::ConnectAll
+   */
+  std::size_t ConnectAll (SinkFactory sinks) const;
+
+private:
+  std::string m_path;                     //!< The path
+  std::string m_leaf;                     //!< The attribute or trace source name
+  std::size_t m_nLeafParent;              //!< The number of elements before the leaf
+  CompiledPathImpl *m_impl;               //!< The parsed elements and the attributes found
+};
+
 /**
  * \ingroup config
  * \param [in] path The path to perform a match against
@@ -314,6 +427,21 @@ private:
  */
 MatchContainer LookupMatches (std::string path);
 
+/**
+ * \ingroup config
+ * \param [in] path A path to match trace sources, usually with wildcards.
+ * \param [in] sinks The function giving the sink of each matching trace
+ *             source, from its matching path.
+ * \returns The number of trace sources connected.
+ *
+ * This function finds all the trace sources which match the input path
+ * in one traversal, and connects to each of them, without context, the
+ * sink given for its path.  It replaces the loops connecting a sink
+ * bound to each node with a path per node, which resolve the path once
+ * per node.
+ */
+std::size_t ConnectAll (std::string path, CompiledPath::SinkFactory sinks);
+
 /**
  * \ingroup config
  * \param [in] obj A new root object
@@ -19,7 +19,13 @@
  */
 
 #include "event-impl.h"
+#include "boolean.h"
+#include "global-value.h"
 #include "log.h"
+#include "unused.h"
+
+#include <atomic>
+#include <new>
 
 /**
  * \file
@@ -31,6 +37,223 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("EventImpl");
 
+/**
+ * \ingroup events
+ * Unnamed namespace for the EventImpl free lists.
+ */
+namespace {
+
+/** Number of bytes between two event size classes. */
+const std::size_t EVENT_POOL_GRANULARITY = 16;
+/** Number of event size classes; larger events are never pooled. */
+const std::size_t EVENT_POOL_CLASSES = 16;
+
+/** A released event, linked in a free list. */
+struct EventPoolBlock
+{
+  EventPoolBlock *next;      //!< Next released event of the same size class.
+};
+
+/**
+ * The free lists of one thread.
+ *
+ * This is trivially destructible, so it remains usable until the thread
+ * exits, even after EventPoolGuard has released its content.
+ */
+struct EventPoolFreeLists
+{
+  EventPoolBlock *head[EVENT_POOL_CLASSES];  //!< Free list per size class.
+  bool registered;           //!< Has the EventPoolGuard been created.
+  bool finalized;            //!< Has the thread started exiting.
+};
+
+/** The free lists of the current thread. */
+thread_local EventPoolFreeLists g_eventFreeLists;
+
+/** Value of g_eventPoolEnabled before the EventPool global value is read. */
+const int EVENT_POOL_UNKNOWN = -1;
+/**
+ * Is the event pool enabled: 0 or 1, or EVENT_POOL_UNKNOWN until the
+ * EventPool global value is read, or EventImpl::SetPoolEnabled called.
+ */
+std::atomic<int> g_eventPoolEnabled (EVENT_POOL_UNKNOWN);
+/** Number of events allocated from the system allocator while pooling. */
+std::atomic<uint64_t> g_eventsAllocated (0);
+/** Number of events served from the free lists. */
+std::atomic<uint64_t> g_eventsRecycled (0);
+
+/** Release the free lists of the current thread to the system allocator. */
+void
+FlushEventFreeLists (void)
+{
+  for (std::size_t i = 0; i < EVENT_POOL_CLASSES; ++i)
+    {
+      EventPoolBlock *block = g_eventFreeLists.head[i];
+      while (block != 0)
+        {
+          EventPoolBlock *next = block->next;
+          ::operator delete (block);
+          block = next;
+        }
+      g_eventFreeLists.head[i] = 0;
+    }
+}
+
+/** Release the free lists when the owning thread exits. */
+struct EventPoolGuard
+{
+  ~EventPoolGuard ()
+  {
+    FlushEventFreeLists ();
+    g_eventFreeLists.finalized = true;
+  }
+};
+
+/** The guard of the current thread, created on first release. */
+thread_local EventPoolGuard g_eventPoolGuard;
+
+/**
+ * Get the size class of an event.
+ * \param [in] size The size of the event.
+ * \returns The size class.
+ */
+inline std::size_t
+EventSizeClass (std::size_t size)
+{
+  return (size - 1) / EVENT_POOL_GRANULARITY;
+}
+
+}  // unnamed namespace
+
+/**
+ * \ingroup events
+ * \anchor GlobalValueEventPool
+ * Recycle the released events on per-thread free lists, instead of
+ * returning them to the system allocator.
+ *
+ * This is read when the first event is allocated or released, and again
+ * when Simulator::Run starts, so that a value set by Config::SetGlobal
+ * or CommandLine::Parse after the first events were scheduled still
+ * applies to the simulation.  EventImpl::SetPoolEnabled sets it, and
+ * applies it at once.  It is accessible as "--EventPool" from CommandLine.
+ */
+static GlobalValue g_eventPool ("EventPool",
+                                "Recycle released events on per-thread free lists "
+                                "instead of returning them to the system allocator.",
+                                BooleanValue (false),
+                                MakeBooleanChecker ());
+
+/**
+ * \ingroup events
+ * \returns \c true if the event pool is enabled.
+ */
+static inline bool
+EventPoolEnabled (void)
+{
+  int enabled = g_eventPoolEnabled.load (std::memory_order_relaxed);
+  if (enabled == EVENT_POOL_UNKNOWN)
+    {
+      BooleanValue value;
+      g_eventPool.GetValue (value);
+      int expected = EVENT_POOL_UNKNOWN;
+      g_eventPoolEnabled.compare_exchange_strong (expected, value.Get () ? 1 : 0,
+                                                  std::memory_order_relaxed);
+      enabled = g_eventPoolEnabled.load (std::memory_order_relaxed);
+    }
+  return enabled == 1;
+}
+
+void *
+EventImpl::operator new (std::size_t size)
+{
+  std::size_t sizeClass = EventSizeClass (size);
+  if (sizeClass >= EVENT_POOL_CLASSES)
+    {
+      return ::operator new (size);
+    }
+  if (EventPoolEnabled ())
+    {
+      EventPoolBlock *block = g_eventFreeLists.head[sizeClass];
+      if (block != 0)
+        {
+          g_eventFreeLists.head[sizeClass] = block->next;
+          g_eventsRecycled.fetch_add (1, std::memory_order_relaxed);
+          return block;
+        }
+      g_eventsAllocated.fetch_add (1, std::memory_order_relaxed);
+    }
+  // Always round up to the size class, so that any event can later be
+  // recycled, even if the pool was disabled when it was allocated.
+  return ::operator new ((sizeClass + 1) * EVENT_POOL_GRANULARITY);
+}
+
+void
+EventImpl::operator delete (void *p, std::size_t size)
+{
+  std::size_t sizeClass = EventSizeClass (size);
+  if (sizeClass < EVENT_POOL_CLASSES
+      && EventPoolEnabled ()
+      && !g_eventFreeLists.finalized)
+    {
+      if (!g_eventFreeLists.registered)
+        {
+          // Odr-use the guard so that its destructor runs at thread exit.
+          EventPoolGuard *guard = &g_eventPoolGuard;
+          NS_UNUSED (guard);
+          g_eventFreeLists.registered = true;
+        }
+      EventPoolBlock *block = static_cast<EventPoolBlock *> (p);
+      block->next = g_eventFreeLists.head[sizeClass];
+      g_eventFreeLists.head[sizeClass] = block;
+      return;
+    }
+  ::operator delete (p);
+}
+
+void
+EventImpl::SetPoolEnabled (bool enable)
+{
+  NS_LOG_FUNCTION (enable);
+  g_eventPool.SetValue (BooleanValue (enable));
+  g_eventPoolEnabled.store (enable ? 1 : 0, std::memory_order_relaxed);
+  if (!enable)
+    {
+      FlushEventFreeLists ();
+    }
+}
+
+void
+EventImpl::UpdatePoolEnabled (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  BooleanValue value;
+  g_eventPool.GetValue (value);
+  int enabled = value.Get () ? 1 : 0;
+  if (g_eventPoolEnabled.exchange (enabled, std::memory_order_relaxed) == 1
+      && enabled == 0)
+    {
+      FlushEventFreeLists ();
+    }
+}
+
+bool
+EventImpl::IsPoolEnabled (void)
+{
+  return EventPoolEnabled ();
+}
+
+uint64_t
+EventImpl::GetAllocatedCount (void)
+{
+  return g_eventsAllocated.load (std::memory_order_relaxed);
+}
+
+uint64_t
+EventImpl::GetRecycledCount (void)
+{
+  return g_eventsRecycled.load (std::memory_order_relaxed);
+}
+
 EventImpl::~EventImpl ()
 {
   NS_LOG_FUNCTION (this);
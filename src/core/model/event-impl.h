@@ -21,6 +21,7 @@
 #define EVENT_IMPL_H
 
 #include <stdint.h>
+#include <cstddef>
 #include "simple-ref-count.h"
 
 /**
@@ -40,6 +41,14 @@ namespace ns3 {
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * All subclasses are allocated through EventImpl::operator new.
+ * When the event pool is enabled (see the \ref GlobalValueEventPool
+ * "EventPool" global value) released events are kept on per-thread
+ * free lists, one per 16-byte size class, and reused by the next allocation of
+ * the same class, instead of going back to the system allocator.
+ * This covers the MakeEvent() templates with up to six bound arguments
+ * of usual size; larger events always use the system allocator.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -66,6 +75,46 @@ public:
    */
   bool IsCancelled (void);
 
+  /**
+   * Allocate memory for an event.
+   * \param [in] size The size of the event.
+   * \returns The allocated memory.
+   */
+  static void * operator new (std::size_t size);
+  /**
+   * Release the memory of an event.
+   * \param [in] p The memory to release.
+   * \param [in] size The size of the event.
+   */
+  static void operator delete (void *p, std::size_t size);
+
+  /**
+   * Enable or disable the recycling of released events.
+   *
+   * This sets the EventPool global value, and applies it at once.
+   * Disabling the pool releases the free lists of the calling thread.
+   * \param [in] enable \c true to recycle events.
+   */
+  static void SetPoolEnabled (bool enable);
+  /**
+   * Read the EventPool global value again.  Simulator::Run calls this,
+   * so that the value set before the simulation starts applies, even if
+   * events were already scheduled.
+   */
+  static void UpdatePoolEnabled (void);
+  /**
+   * \returns \c true if released events are recycled.
+   */
+  static bool IsPoolEnabled (void);
+  /**
+   * \returns The number of events allocated from the system allocator.
+   */
+  static uint64_t GetAllocatedCount (void);
+  /**
+   * \returns The number of events served from the free lists.
+   */
+  static uint64_t GetRecycledCount (void);
+
 protected:
   /**
    * Implementation for Invoke().
@@ -0,0 +1,453 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ladder-scheduler.h"
+#include "event-impl.h"
+#include "type-id.h"
+#include "uinteger.h"
+#include "assert.h"
+#include "log.h"
+#include <algorithm>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class implementation.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (LadderScheduler);
+
+TypeId
+LadderScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LadderScheduler")
+    .SetParent<Scheduler> ()
+    .SetGroupName ("Core")
+    .AddConstructor<LadderScheduler> ()
+    .AddAttribute ("Threshold",
+                   "Largest number of events in a bucket which is sorted "
+                   "directly into the bottom list instead of being spread "
+                   "over a new rung.",
+                   TypeId::ATTR_CONSTRUCT,
+                   UintegerValue (50),
+                   MakeUintegerAccessor (&LadderScheduler::m_threshold),
+                   MakeUintegerChecker<uint32_t> (1))
+  ;
+  return tid;
+}
+
+LadderScheduler::LadderScheduler ()
+  : m_topMin (UINT64_MAX),
+    m_topMax (0),
+    m_topStart (0),
+    m_nRungs (0),
+    m_qSize (0),
+    m_threshold (50),
+    m_freeNodes (0)
+{
+  NS_LOG_FUNCTION (this);
+  m_top.head = m_top.tail = 0;
+  m_top.size = 0;
+  m_bottom = m_top;
+}
+
+LadderScheduler::~LadderScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+  for (std::vector<Node *>::iterator i = m_chunks.begin (); i != m_chunks.end (); ++i)
+    {
+      delete [] *i;
+    }
+  m_chunks.clear ();
+  m_freeNodes = 0;
+}
+
+LadderScheduler::Node *
+LadderScheduler::AllocateNode (const Scheduler::Event &ev)
+{
+  if (m_freeNodes == 0)
+    {
+      NS_LOG_LOGIC ("growing node pool by " << CHUNK_SIZE);
+      Node *chunk = new Node [CHUNK_SIZE];
+      m_chunks.push_back (chunk);
+      for (uint32_t i = 0; i < CHUNK_SIZE - 1; ++i)
+        {
+          chunk[i].next = &chunk[i + 1];
+        }
+      chunk[CHUNK_SIZE - 1].next = 0;
+      m_freeNodes = chunk;
+    }
+  Node *node = m_freeNodes;
+  m_freeNodes = node->next;
+  node->ev = ev;
+  return node;
+}
+
+void
+LadderScheduler::FreeNode (Node *node)
+{
+  node->next = m_freeNodes;
+  m_freeNodes = node;
+}
+
+void
+LadderScheduler::Append (List &list, Node *node)
+{
+  node->next = 0;
+  node->prev = list.tail;
+  if (list.tail != 0)
+    {
+      list.tail->next = node;
+    }
+  else
+    {
+      list.head = node;
+    }
+  list.tail = node;
+  list.size++;
+}
+
+void
+LadderScheduler::Unlink (List &list, Node *node)
+{
+  if (node->prev != 0)
+    {
+      node->prev->next = node->next;
+    }
+  else
+    {
+      list.head = node->next;
+    }
+  if (node->next != 0)
+    {
+      node->next->prev = node->prev;
+    }
+  else
+    {
+      list.tail = node->prev;
+    }
+  list.size--;
+}
+
+void
+LadderScheduler::InsertBottom (Node *node)
+{
+  // New events tend to be later than the ones already in Bottom,
+  // so search for the insertion point from the tail.
+  Node *pos = m_bottom.tail;
+  while (pos != 0 && node->ev.key < pos->ev.key)
+    {
+      pos = pos->prev;
+    }
+  node->prev = pos;
+  if (pos != 0)
+    {
+      node->next = pos->next;
+      pos->next = node;
+    }
+  else
+    {
+      node->next = m_bottom.head;
+      m_bottom.head = node;
+    }
+  if (node->next != 0)
+    {
+      node->next->prev = node;
+    }
+  else
+    {
+      m_bottom.tail = node;
+    }
+  m_bottom.size++;
+}
+
+uint64_t
+LadderScheduler::CurrentStart (const Rung &rung)
+{
+  return rung.start + rung.current * rung.width;
+}
+
+uint32_t
+LadderScheduler::FindRung (uint64_t ts) const
+{
+  uint32_t i = 0;
+  while (i < m_nRungs && ts < CurrentStart (m_rungs[i]))
+    {
+      ++i;
+    }
+  return i;
+}
+
+LadderScheduler::List &
+LadderScheduler::GetBucket (Rung &rung, uint64_t ts)
+{
+  uint64_t bucket = (ts - rung.start) / rung.width;
+  NS_ASSERT (bucket >= rung.current && bucket < rung.buckets.size ());
+  return rung.buckets[bucket];
+}
+
+void
+LadderScheduler::SpawnRung (List &list, uint64_t start, uint64_t end)
+{
+  NS_LOG_FUNCTION (this << list.size << start << end);
+  NS_ASSERT (m_nRungs < MAX_RUNGS);
+  NS_ASSERT (list.size > 0 && end > start);
+
+  uint64_t span = end - start;
+  Rung &rung = m_rungs[m_nRungs++];
+  rung.width = (span + list.size - 1) / list.size;
+  rung.start = start;
+  rung.current = 0;
+  rung.count = list.size;
+  List empty = { 0, 0, 0};
+  rung.buckets.assign ((span + rung.width - 1) / rung.width, empty);
+
+  Node *node = list.head;
+  while (node != 0)
+    {
+      Node *next = node->next;
+      Append (GetBucket (rung, node->ev.key.m_ts), node);
+      node = next;
+    }
+  list = empty;
+}
+
+void
+LadderScheduler::MoveToBottom (List &list)
+{
+  NS_LOG_FUNCTION (this << list.size);
+  NS_ASSERT (m_bottom.head == 0);
+
+  m_sortBuffer.clear ();
+  for (Node *node = list.head; node != 0; node = node->next)
+    {
+      m_sortBuffer.push_back (node);
+    }
+  std::sort (m_sortBuffer.begin (), m_sortBuffer.end (),
+             [] (const Node *a, const Node *b) -> bool
+    {
+      return a->ev.key < b->ev.key;
+    });
+  for (std::vector<Node *>::iterator i = m_sortBuffer.begin (); i != m_sortBuffer.end (); ++i)
+    {
+      Append (m_bottom, *i);
+    }
+  list.head = list.tail = 0;
+  list.size = 0;
+}
+
+void
+LadderScheduler::Refill (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  while (m_bottom.head == 0)
+    {
+      if (m_nRungs == 0)
+        {
+          NS_ASSERT (m_top.size > 0);
+          NS_LOG_LOGIC ("spread " << m_top.size << " events from top");
+          SpawnRung (m_top, m_topMin, m_topMax + 1);
+          const Rung &first = m_rungs[0];
+          m_topStart = first.start + first.buckets.size () * first.width;
+          m_topMin = UINT64_MAX;
+          m_topMax = 0;
+          continue;
+        }
+
+      Rung &rung = m_rungs[m_nRungs - 1];
+      if (rung.count == 0)
+        {
+          --m_nRungs;
+          continue;
+        }
+      while (rung.buckets[rung.current].size == 0)
+        {
+          ++rung.current;
+        }
+      List &bucket = rung.buckets[rung.current];
+      uint64_t start = CurrentStart (rung);
+      ++rung.current;
+      rung.count -= bucket.size;
+
+      bool split = bucket.size > m_threshold
+        && rung.width > 1
+        && m_nRungs < MAX_RUNGS;
+      if (split)
+        {
+          // Spawning a rung is pointless if all events are simultaneous.
+          split = false;
+          uint64_t ts = bucket.head->ev.key.m_ts;
+          for (Node *node = bucket.head->next; node != 0; node = node->next)
+            {
+              if (node->ev.key.m_ts != ts)
+                {
+                  split = true;
+                  break;
+                }
+            }
+        }
+      if (split)
+        {
+          SpawnRung (bucket, start, start + rung.width);
+        }
+      else
+        {
+          MoveToBottom (bucket);
+        }
+    }
+}
+
+void
+LadderScheduler::SplitBottom (void)
+{
+  NS_LOG_FUNCTION (this << m_bottom.size);
+  uint64_t end = m_topStart;
+  if (m_nRungs > 0)
+    {
+      end = CurrentStart (m_rungs[m_nRungs - 1]);
+    }
+  SpawnRung (m_bottom, m_bottom.head->ev.key.m_ts, end);
+  Refill ();
+}
+
+void
+LadderScheduler::Insert (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.key.m_ts << ev.key.m_uid);
+  Node *node = AllocateNode (ev);
+  uint64_t ts = ev.key.m_ts;
+  m_qSize++;
+
+  if (ts >= m_topStart)
+    {
+      Append (m_top, node);
+      m_topMin = std::min (m_topMin, ts);
+      m_topMax = std::max (m_topMax, ts);
+      if (m_bottom.head == 0)
+        {
+          Refill ();
+        }
+      return;
+    }
+
+  uint32_t i = FindRung (ts);
+  if (i < m_nRungs)
+    {
+      Append (GetBucket (m_rungs[i], ts), node);
+      m_rungs[i].count++;
+      if (m_bottom.head == 0)
+        {
+          Refill ();
+        }
+      return;
+    }
+
+  InsertBottom (node);
+  if (m_bottom.size > m_threshold
+      && m_nRungs < MAX_RUNGS
+      && m_bottom.head->ev.key.m_ts != m_bottom.tail->ev.key.m_ts)
+    {
+      SplitBottom ();
+    }
+}
+
+bool
+LadderScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_qSize == 0;
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  // Bottom is always refilled eagerly, so it holds the next event.
+  return m_bottom.head->ev;
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+
+  Node *node = m_bottom.head;
+  Unlink (m_bottom, node);
+  Scheduler::Event ev = node->ev;
+  FreeNode (node);
+  m_qSize--;
+  if (m_qSize > 0 && m_bottom.head == 0)
+    {
+      Refill ();
+    }
+  NS_LOG_LOGIC ("remove ts=" << ev.key.m_ts << ", key=" << ev.key.m_uid);
+  return ev;
+}
+
+void
+LadderScheduler::Remove (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.key.m_ts << ev.key.m_uid);
+  NS_ASSERT (!IsEmpty ());
+
+  uint64_t ts = ev.key.m_ts;
+  List *list = &m_bottom;
+  uint32_t rung = m_nRungs;
+  if (ts >= m_topStart)
+    {
+      list = &m_top;
+    }
+  else
+    {
+      rung = FindRung (ts);
+      if (rung < m_nRungs)
+        {
+          list = &GetBucket (m_rungs[rung], ts);
+        }
+    }
+
+  for (Node *node = list->head; node != 0; node = node->next)
+    {
+      if (node->ev.key.m_uid == ev.key.m_uid)
+        {
+          NS_ASSERT (ev.impl == node->ev.impl);
+          Unlink (*list, node);
+          FreeNode (node);
+          if (rung < m_nRungs)
+            {
+              m_rungs[rung].count--;
+            }
+          m_qSize--;
+          if (m_qSize > 0 && m_bottom.head == 0)
+            {
+              Refill ();
+            }
+          return;
+        }
+    }
+  NS_ASSERT (false);
+}
+
+} // namespace ns3
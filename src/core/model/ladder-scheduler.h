@@ -0,0 +1,240 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler class declaration.
+ */
+
+namespace ns3 {
+
+class EventImpl;
+
+/**
+ * \ingroup scheduler
+ * \brief a ladder queue event scheduler
+ *
+ * This event scheduler implements the Ladder Queue described in
+ * ["Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation" by Wai Teng Tang, Rick Siow Mong Goh
+ * and Ian Li-Jin Thng][Tang].
+ *
+ * [Tang]: https://doi.org/10.1145/1103323.1103325 "Tang"
+ *
+ * The event list is split in three tiers:
+ *
+ * - *Top*, an unsorted list receiving all events scheduled beyond
+ *   the range currently covered by the ladder;
+ * - the *ladder* itself, a small stack of rungs, each rung being an
+ *   array of unsorted buckets of uniform width.  Each rung refines a
+ *   single bucket of the rung above;
+ * - *Bottom*, a short sorted list from which events are dequeued.
+ *
+ * When Bottom runs dry the next non-empty bucket of the lowest rung
+ * is either copied (and sorted) into Bottom, if it holds at most
+ * `Threshold` events, or spawned into a new, finer rung.  When the
+ * ladder is empty, the whole Top list is spread into a new first rung.
+ * Since every event is only moved a bounded number of times, the
+ * amortized cost of Insert() and RemoveNext() is independent of the
+ * number of pending events.  Remove() searches the list holding the
+ * event: this is short for a rung bucket or Bottom, but linear in the
+ * number of events in Top, when the event is scheduled beyond the
+ * ladder.
+ *
+ * Unlike CalendarScheduler, the events are not stored in `std::list`
+ * but in intrusive nodes drawn from a private pool, which grows in
+ * chunks and is never returned to the allocator until the scheduler
+ * is destroyed.  Insert() and RemoveNext() therefore do not allocate
+ * in steady state.
+ *
+ * \par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | ~Constant       | Append to Top or rung bucket; Bottom is short
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | Constant        | Head of Bottom
+ * Remove()     | Linear          | Search in Top, a rung bucket or Bottom
+ * RemoveNext() | ~Constant       | Head of Bottom; possible refill from ladder
+ *
+ * \par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | ~1 KB + 16 bytes per rung bucket | Rung array and pool chunks
+ * Per Event | 2 x `sizeof (*)`                 | Intrusive node links
+ */
+class LadderScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  LadderScheduler ();
+  /** Destructor. */
+  virtual ~LadderScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+
+private:
+  /** Intrusive, doubly-linked event node. */
+  struct Node
+  {
+    Scheduler::Event ev;   //!< The event.
+    Node *prev;            //!< Previous node in the list.
+    Node *next;            //!< Next node in the list, or in the free list.
+  };
+
+  /** An intrusive list of event nodes. */
+  struct List
+  {
+    Node *head;            //!< First node.
+    Node *tail;            //!< Last node.
+    uint32_t size;         //!< Number of nodes.
+  };
+
+  /** One rung of the ladder: an array of buckets of uniform width. */
+  struct Rung
+  {
+    std::vector<List> buckets; //!< The buckets.
+    uint64_t start;        //!< Time stamp of the start of the first bucket.
+    uint64_t width;        //!< Duration of a bucket.
+    uint32_t current;      //!< Index of the first bucket not yet dequeued.
+    uint32_t count;        //!< Number of events stored in this rung.
+  };
+
+  /** Maximum number of rungs in the ladder. */
+  static const uint32_t MAX_RUNGS = 8;
+  /** Number of nodes allocated at once by the node pool. */
+  static const uint32_t CHUNK_SIZE = 1024;
+
+  /**
+   * Get a node from the pool.
+   * \param [in] ev The event to store in the node.
+   * \returns The node.
+   */
+  Node * AllocateNode (const Scheduler::Event &ev);
+  /**
+   * Return a node to the pool.
+   * \param [in] node The node.
+   */
+  void FreeNode (Node *node);
+
+  /**
+   * Append a node at the end of a list.
+   * \param [in,out] list The list.
+   * \param [in] node The node.
+   */
+  static void Append (List &list, Node *node);
+  /**
+   * Unlink a node from a list.
+   * \param [in,out] list The list.
+   * \param [in] node The node.
+   */
+  static void Unlink (List &list, Node *node);
+  /**
+   * Insert a node into Bottom, keeping it sorted.
+   * \param [in] node The node.
+   */
+  void InsertBottom (Node *node);
+
+  /**
+   * Get the time stamp of the first bucket of a rung not yet dequeued.
+   * \param [in] rung The rung.
+   * \returns The time stamp.
+   */
+  static uint64_t CurrentStart (const Rung &rung);
+  /**
+   * Find the rung covering a time stamp.
+   * \param [in] ts The time stamp, which must be below \c m_topStart.
+   * \returns The rung index, or \c m_nRungs if the time stamp belongs in Bottom.
+   */
+  uint32_t FindRung (uint64_t ts) const;
+  /**
+   * Get the bucket of a rung covering a time stamp.
+   * \param [in] rung The rung.
+   * \param [in] ts The time stamp.
+   * \returns The bucket.
+   */
+  static List & GetBucket (Rung &rung, uint64_t ts);
+
+  /**
+   * Spread a list of events over a new rung at the bottom of the ladder.
+   *
+   * \param [in,out] list The events to move, emptied on return.
+   * \param [in] start The start of the range covered by the new rung.
+   * \param [in] end The end of the range covered by the new rung.
+   */
+  void SpawnRung (List &list, uint64_t start, uint64_t end);
+  /**
+   * Sort a bucket into Bottom, which must be empty.
+   * \param [in,out] list The bucket, emptied on return.
+   */
+  void MoveToBottom (List &list);
+  /** Refill Bottom from the ladder and Top until it is non-empty. */
+  void Refill (void);
+  /** Spread Bottom over a new rung if it grew too large. */
+  void SplitBottom (void);
+
+  /** Top: events beyond the range covered by the ladder. */
+  List m_top;
+  /** Smallest time stamp in Top. */
+  uint64_t m_topMin;
+  /** Largest time stamp in Top. */
+  uint64_t m_topMax;
+  /** Events with a time stamp at or after this value go into Top. */
+  uint64_t m_topStart;
+  /** The ladder. */
+  Rung m_rungs[MAX_RUNGS];
+  /** Number of rungs in use. */
+  uint32_t m_nRungs;
+  /** Bottom: sorted list of the earliest events. */
+  List m_bottom;
+  /** Number of events in queue. */
+  uint32_t m_qSize;
+  /** Largest bucket moved to Bottom without spawning a new rung. */
+  uint32_t m_threshold;
+
+  /** Head of the free node list. */
+  Node *m_freeNodes;
+  /** Node chunks allocated by the pool. */
+  std::vector<Node *> m_chunks;
+  /** Scratch space used to sort buckets. */
+  std::vector<Node *> m_sortBuffer;
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
@@ -0,0 +1,622 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "simulator.h"
+#include "multithreaded-simulator-impl.h"
+#include "scheduler.h"
+#include "event-impl.h"
+
+#include "ptr.h"
+#include "uinteger.h"
+#include "assert.h"
+#include "fatal-error.h"
+#include "log.h"
+
+#include <algorithm>
+#include <thread>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3 {
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+NS_LOG_COMPONENT_DEFINE ("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED (MultithreadedSimulatorImpl);
+
+/**
+ * \ingroup simulator
+ * Unnamed namespace for the partition state of the current thread.
+ */
+namespace {
+
+/** The partition run by the current thread, if any. */
+thread_local void *g_currentPartition = 0;
+/** Start of the current window, in the current thread. */
+thread_local uint64_t g_windowStart = 0;
+
+}  // unnamed namespace
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::MultithreadedSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .SetGroupName ("Core")
+    .AddConstructor<MultithreadedSimulatorImpl> ()
+    .AddAttribute ("ThreadCount",
+                   "Number of partitions, each run by its own thread. "
+                   "Zero selects the number of hardware threads.",
+                   TypeId::ATTR_CONSTRUCT,
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&MultithreadedSimulatorImpl::m_threadCount),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("LookAhead",
+                   "Smallest delay of an event scheduled for another partition, "
+                   "typically the smallest delay of the channels connecting "
+                   "nodes of different partitions.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&MultithreadedSimulatorImpl::m_lookAhead),
+                   MakeTimeChecker (Seconds (0)))
+  ;
+  return tid;
+}
+
+MultithreadedSimulatorImpl::Barrier::Barrier (uint32_t count)
+  : m_count (count),
+    m_waiting (0),
+    m_generation (0)
+{}
+
+void
+MultithreadedSimulatorImpl::Barrier::Wait (void)
+{
+  std::unique_lock<std::mutex> lock (m_mutex);
+  uint64_t generation = m_generation;
+  if (++m_waiting == m_count)
+    {
+      m_waiting = 0;
+      m_generation++;
+      m_cond.notify_all ();
+      return;
+    }
+  m_cond.wait (lock, [this, generation] { return m_generation != generation; });
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl ()
+  : m_threadCount (0),
+    m_barrier (0),
+    m_running (false),
+    m_stop (false),
+    m_stopRound (false),
+    m_currentTs (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      delete *i;
+    }
+  m_partitions.clear ();
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      Partition *partition = *i;
+      DeliverEvents (partition);
+      while (!partition->events->IsEmpty ())
+        {
+          Scheduler::Event next = partition->events->RemoveNext ();
+          next.impl->Unref ();
+        }
+      partition->events = 0;
+    }
+  SimulatorImpl::DoDispose ();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_destroyEvents.empty ())
+    {
+      Ptr<EventImpl> ev = m_destroyEvents.front ().PeekEventImpl ();
+      m_destroyEvents.pop_front ();
+      NS_LOG_LOGIC ("handle destroy " << ev);
+      if (!ev->IsCancelled ())
+        {
+          ev->Invoke ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::CreatePartitions (void)
+{
+  if (!m_partitions.empty ())
+    {
+      return;
+    }
+  uint32_t count = m_threadCount;
+  if (count == 0)
+    {
+      count = std::max (std::thread::hardware_concurrency (), 1u);
+    }
+  NS_LOG_FUNCTION (this << count);
+  for (uint32_t i = 0; i < count; ++i)
+    {
+      Partition *partition = new Partition ();
+      partition->index = i;
+      // uids are allocated from 4, see DefaultSimulatorImpl.
+      partition->uid = 4;
+      partition->currentUid = 0;
+      partition->currentTs = 0;
+      partition->currentContext = Simulator::NO_CONTEXT;
+      partition->eventCount = 0;
+      partition->nextTs = UINT64_MAX;
+      partition->outbox.resize (count);
+      m_partitions.push_back (partition);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  NS_LOG_FUNCTION (this << schedulerFactory);
+  NS_ASSERT_MSG (!m_running, "Cannot change the scheduler while running");
+  CreatePartitions ();
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler> ();
+      Partition *partition = *i;
+      if (partition->events != 0)
+        {
+          while (!partition->events->IsEmpty ())
+            {
+              scheduler->Insert (partition->events->RemoveNext ());
+            }
+        }
+      partition->events = scheduler;
+    }
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartition (uint32_t context) const
+{
+  if (context == Simulator::NO_CONTEXT)
+    {
+      return 0;
+    }
+  return context % m_partitions.size ();
+}
+
+MultithreadedSimulatorImpl::Partition *
+MultithreadedSimulatorImpl::GetCurrentPartition (void) const
+{
+  return static_cast<Partition *> (g_currentPartition);
+}
+
+// System ID for non-distributed simulation is always zero
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId (void) const
+{
+  return 0;
+}
+
+Scheduler::Event
+MultithreadedSimulatorImpl::Insert (Partition *partition, uint64_t ts,
+                                    uint32_t context, EventImpl *event)
+{
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = ts;
+  ev.key.m_context = context;
+  ev.key.m_uid = partition->uid;
+  partition->uid++;
+  partition->events->Insert (ev);
+  return ev;
+}
+
+void
+MultithreadedSimulatorImpl::DeliverEvents (Partition *partition)
+{
+  // The sources are visited in a fixed order, so that the uids, and
+  // therefore the order of simultaneous events, are deterministic.
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      std::vector<Scheduler::Event> &mailbox = (*i)->outbox[partition->index];
+      for (std::vector<Scheduler::Event>::iterator j = mailbox.begin (); j != mailbox.end (); ++j)
+        {
+          NS_ASSERT (j->key.m_ts >= partition->currentTs);
+          Insert (partition, j->key.m_ts, j->key.m_context, j->impl);
+        }
+      mailbox.clear ();
+    }
+
+  EventsWithContext eventsWithContext;
+  {
+    CriticalSection cs (partition->eventsWithContextMutex);
+    partition->eventsWithContext.swap (eventsWithContext);
+  }
+  while (!eventsWithContext.empty ())
+    {
+      EventWithContext event = eventsWithContext.front ();
+      eventsWithContext.pop_front ();
+      Insert (partition, partition->currentTs + event.timestamp, event.context, event.event);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::RunPartition (uint32_t index)
+{
+  Partition *partition = m_partitions[index];
+  g_currentPartition = partition;
+  uint64_t lookAhead = std::max (m_lookAhead.GetTimeStep (), (int64_t)1);
+
+  while (true)
+    {
+      if (index == 0)
+        {
+          m_stopRound = m_stop.load ();
+        }
+      DeliverEvents (partition);
+      partition->nextTs = UINT64_MAX;
+      if (!partition->events->IsEmpty ())
+        {
+          partition->nextTs = partition->events->PeekNext ().key.m_ts;
+        }
+      m_barrier->Wait ();
+
+      // Every thread computes the same window from the published state.
+      uint64_t start = UINT64_MAX;
+      for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+        {
+          start = std::min (start, (*i)->nextTs);
+        }
+      if (start == UINT64_MAX || m_stopRound)
+        {
+          break;
+        }
+      uint64_t end = (start > UINT64_MAX - lookAhead) ? UINT64_MAX : start + lookAhead;
+      g_windowStart = start;
+
+      // A Stop is only acted upon at the next round, so that all the
+      // partitions run the whole window whatever the thread timing.
+      while (!partition->events->IsEmpty ()
+             && partition->events->PeekNext ().key.m_ts < end)
+        {
+          Scheduler::Event next = partition->events->RemoveNext ();
+          NS_ASSERT (next.key.m_ts >= partition->currentTs);
+          partition->eventCount.store (partition->eventCount.load (std::memory_order_relaxed) + 1,
+                                       std::memory_order_relaxed);
+          partition->currentTs = next.key.m_ts;
+          partition->currentContext = next.key.m_context;
+          partition->currentUid = next.key.m_uid;
+          next.impl->Invoke ();
+          next.impl->Unref ();
+        }
+      m_barrier->Wait ();
+    }
+
+  g_currentPartition = 0;
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished (void) const
+{
+  if (m_stop)
+    {
+      return true;
+    }
+  for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      if (!(*i)->events->IsEmpty ())
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+MultithreadedSimulatorImpl::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (GetCurrentPartition () == 0, "Simulator::Run called from an event");
+  uint32_t count = m_partitions.size ();
+  NS_LOG_LOGIC ("running " << count << " partitions, lookahead " << m_lookAhead);
+
+  m_stop = false;
+  m_running = true;
+  m_barrier = new Barrier (count);
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < count; ++i)
+    {
+      threads.push_back (std::thread (&MultithreadedSimulatorImpl::RunPartition, this, i));
+    }
+  RunPartition (0);
+  for (std::vector<std::thread>::iterator i = threads.begin (); i != threads.end (); ++i)
+    {
+      i->join ();
+    }
+  delete m_barrier;
+  m_barrier = 0;
+  m_running = false;
+
+  for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      m_currentTs = std::max (m_currentTs, (*i)->currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_stop = true;
+}
+
+void
+MultithreadedSimulatorImpl::Stop (Time const &delay)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep ());
+  Simulator::Schedule (delay, &Simulator::Stop);
+}
+
+//
+// Schedule an event for a _relative_ time in the future.
+//
+EventId
+MultithreadedSimulatorImpl::Schedule (Time const &delay, EventImpl *event)
+{
+  NS_ASSERT_MSG (delay.IsPositive (), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+  Partition *partition = GetCurrentPartition ();
+  uint64_t now = m_currentTs;
+  uint32_t context = Simulator::NO_CONTEXT;
+  if (partition != 0)
+    {
+      now = partition->currentTs;
+      context = partition->currentContext;
+    }
+  else
+    {
+      NS_ASSERT_MSG (!m_running, "Simulator::Schedule Thread-unsafe invocation!");
+      partition = m_partitions[GetPartition (context)];
+    }
+  Time tAbsolute = delay + TimeStep (now);
+  Scheduler::Event ev = Insert (partition, tAbsolute.GetTimeStep (), context, event);
+  return EventId (event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << delay.GetTimeStep () << event);
+  Partition *target = m_partitions[GetPartition (context)];
+  Partition *partition = GetCurrentPartition ();
+
+  if (partition == 0)
+    {
+      if (!m_running)
+        {
+          Time tAbsolute = delay + TimeStep (m_currentTs);
+          Insert (target, tAbsolute.GetTimeStep (), context, event);
+        }
+      else
+        {
+          // Current time added in DeliverEvents()
+          EventWithContext ev;
+          ev.context = context;
+          ev.timestamp = delay.GetTimeStep ();
+          ev.event = event;
+          CriticalSection cs (target->eventsWithContextMutex);
+          target->eventsWithContext.push_back (ev);
+        }
+      return;
+    }
+
+  Time tAbsolute = delay + TimeStep (partition->currentTs);
+  if (target == partition)
+    {
+      Insert (partition, tAbsolute.GetTimeStep (), context, event);
+      return;
+    }
+  if (delay < m_lookAhead)
+    {
+      NS_FATAL_ERROR ("Event for context " << context << " scheduled with delay " << delay
+                      << ", smaller than the lookahead " << m_lookAhead);
+    }
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = tAbsolute.GetTimeStep ();
+  ev.key.m_context = context;
+  ev.key.m_uid = 0;     // allocated on delivery
+  partition->outbox[target->index].push_back (ev);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  return Schedule (TimeStep (0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  EventId id (Ptr<EventImpl> (event, false), Now ().GetTimeStep (), 0xffffffff, 2);
+  CriticalSection cs (m_destroyEventsMutex);
+  m_destroyEvents.push_back (id);
+  return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now (void) const
+{
+  // Do not add function logging here, to avoid stack overflow
+  Partition *partition = GetCurrentPartition ();
+  if (partition != 0)
+    {
+      return TimeStep (partition->currentTs);
+    }
+  return TimeStep (m_currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  if (IsExpired (id))
+    {
+      return TimeStep (0);
+    }
+  else
+    {
+      return TimeStep (id.GetTs ()) - Now ();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove (const EventId &id)
+{
+  if (id.GetUid () == 2)
+    {
+      // destroy events.
+      CriticalSection cs (m_destroyEventsMutex);
+      for (DestroyEvents::iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              m_destroyEvents.erase (i);
+              break;
+            }
+        }
+      return;
+    }
+  if (IsExpired (id))
+    {
+      return;
+    }
+  Partition *owner = m_partitions[GetPartition (id.GetContext ())];
+  Partition *partition = GetCurrentPartition ();
+  if (partition != 0 && partition != owner)
+    {
+      // The event list of another partition cannot be modified while
+      // it runs, so just cancel the event.
+      id.PeekEventImpl ()->Cancel ();
+      return;
+    }
+  Scheduler::Event event;
+  event.impl = id.PeekEventImpl ();
+  event.key.m_ts = id.GetTs ();
+  event.key.m_context = id.GetContext ();
+  event.key.m_uid = id.GetUid ();
+  owner->events->Remove (event);
+  event.impl->Cancel ();
+  // whenever we remove an event from the event list, we have to unref it.
+  event.impl->Unref ();
+}
+
+void
+MultithreadedSimulatorImpl::Cancel (const EventId &id)
+{
+  if (!IsExpired (id))
+    {
+      id.PeekEventImpl ()->Cancel ();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired (const EventId &id) const
+{
+  if (id.GetUid () == 2)
+    {
+      if (id.PeekEventImpl () == 0
+          || id.PeekEventImpl ()->IsCancelled ())
+        {
+          return true;
+        }
+      // destroy events.
+      CriticalSection cs (m_destroyEventsMutex);
+      for (DestroyEvents::const_iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              return false;
+            }
+        }
+      return true;
+    }
+  if (id.PeekEventImpl () == 0
+      || id.PeekEventImpl ()->IsCancelled ())
+    {
+      return true;
+    }
+  const Partition *owner = m_partitions[GetPartition (id.GetContext ())];
+  const Partition *partition = GetCurrentPartition ();
+  if (partition != 0 && partition != owner)
+    {
+      // The other partition is running: only events before the
+      // current window are known to have been executed.
+      return id.GetTs () < g_windowStart;
+    }
+  return id.GetTs () < owner->currentTs
+         || (id.GetTs () == owner->currentTs && id.GetUid () <= owner->currentUid);
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  return TimeStep (0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext (void) const
+{
+  Partition *partition = GetCurrentPartition ();
+  if (partition != 0)
+    {
+      return partition->currentContext;
+    }
+  return Simulator::NO_CONTEXT;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount (void) const
+{
+  uint64_t count = 0;
+  for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      count += (*i)->eventCount.load (std::memory_order_relaxed);
+    }
+  return count;
+}
+
+} // namespace ns3
@@ -0,0 +1,252 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "simulator-impl.h"
+#include "scheduler.h"
+#include "event-impl.h"
+#include "system-mutex.h"
+#include "nstime.h"
+
+#include "ptr.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * A shared-memory parallel simulator implementation.
+ *
+ * The events are split in partitions according to their context,
+ * which is the node id for all events scheduled with
+ * Simulator::ScheduleWithContext by the network models:
+ * partition `context % ThreadCount` runs the events of a node, and
+ * events without context run in partition 0.  Each partition has its
+ * own Scheduler and runs in its own thread during Simulator::Run
+ * (partition 0 runs in the calling thread).
+ *
+ * The partitions are synchronized conservatively with the same
+ * granted time window algorithm as ns3::DistributedSimulatorImpl:
+ * at each round all partitions agree on the time `T` of the earliest
+ * pending event, and then run in parallel all their events before
+ * `T + LookAhead`.  An event scheduled for another partition is
+ * appended to a per-(source, destination) mailbox, which is only
+ * written by the source during a window and only read by the destination
+ * between windows, so that no locking is needed.
+ *
+ * For this to be correct, every event scheduled across partitions must
+ * be at least `LookAhead` in the future.  This is naturally the case
+ * when `LookAhead` is the smallest delay of the channels connecting
+ * nodes of different partitions; a violation of this constraint is
+ * reported with a fatal error.  A zero `LookAhead` is valid, but then
+ * each round only runs the events of a single timestamp.
+ *
+ * The models must not share mutable state between nodes of different
+ * partitions, other than through scheduled events.  Packets, and the
+ * objects held by a Ptr, can only be passed between partitions when
+ * ns-3 is configured with `--enable-mt-packets`: the reference counts
+ * (ns3::SimpleRefCount, and the data shared by copies of an
+ * ns3::Packet) are then atomic and the packet free lists are per
+ * thread.  Shared-medium channels must have all their devices in the
+ * same partition.  In particular,
+ * Simulator::Remove, Simulator::Cancel and Simulator::IsExpired are
+ * only exact for events of the calling partition.  Simulator::Stop
+ * takes effect at the end of the current window, in all partitions, so
+ * that the events run do not depend on the thread timing.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  MultithreadedSimulatorImpl ();
+  /** Destructor. */
+  ~MultithreadedSimulatorImpl ();
+
+  // Inherited
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (const Time &delay);
+  virtual EventId Schedule (const Time &delay, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &id);
+  virtual void Cancel (const EventId &id);
+  virtual bool IsExpired (const EventId &id) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+  virtual uint64_t GetEventCount (void) const;
+
+  /**
+   * Get the partition running the events of a context.
+   * \param [in] context The context, usually a node id.
+   * \returns The partition index.
+   */
+  uint32_t GetPartition (uint32_t context) const;
+
+private:
+  virtual void DoDispose (void);
+
+  /** Wrap an event scheduled from a thread outside of the simulation. */
+  struct EventWithContext
+  {
+    /** The event context. */
+    uint32_t context;
+    /** Event delay, relative to the time it is received. */
+    uint64_t timestamp;
+    /** The event implementation. */
+    EventImpl *event;
+  };
+  /** Container type for the events from a different thread. */
+  typedef std::list<struct EventWithContext> EventsWithContext;
+
+  /** The state of one partition. */
+  struct Partition
+  {
+    /** The partition index. */
+    uint32_t index;
+    /** The event priority queue. */
+    Ptr<Scheduler> events;
+    /** Next event unique id. */
+    uint32_t uid;
+    /** Unique id of the current event. */
+    uint32_t currentUid;
+    /** Timestamp of the current event. */
+    uint64_t currentTs;
+    /** Execution context of the current event. */
+    uint32_t currentContext;
+    /** The event count, only written by the partition thread. */
+    std::atomic<uint64_t> eventCount;
+    /** Timestamp of the next event, published between windows. */
+    uint64_t nextTs;
+    /** Mailboxes of the events sent to each partition during a window. */
+    std::vector<std::vector<Scheduler::Event> > outbox;
+    /** The events received from threads outside of the simulation. */
+    EventsWithContext eventsWithContext;
+    /** Mutex to control access to the events from other threads. */
+    SystemMutex eventsWithContextMutex;
+  };
+
+  /** A reusable barrier for the partition threads. */
+  class Barrier
+  {
+  public:
+    /**
+     * Constructor.
+     * \param [in] count The number of threads to synchronize.
+     */
+    Barrier (uint32_t count);
+    /** Wait until all threads have reached the barrier. */
+    void Wait (void);
+
+  private:
+    std::mutex m_mutex;                 //!< Protects the counters.
+    std::condition_variable m_cond;     //!< Signaled when a round completes.
+    uint32_t m_count;                   //!< Number of threads.
+    uint32_t m_waiting;                 //!< Number of threads waiting.
+    uint64_t m_generation;              //!< Number of completed rounds.
+  };
+
+  /**
+   * Create the partitions, if needed.
+   */
+  void CreatePartitions (void);
+  /**
+   * Get the partition of the calling thread.
+   * \returns The partition, or 0 if the calling thread is not running
+   *          a partition.
+   */
+  Partition * GetCurrentPartition (void) const;
+  /**
+   * Insert an event in a partition, allocating its uid.
+   * \param [in] partition The partition.
+   * \param [in] ts The event timestamp.
+   * \param [in] context The event context.
+   * \param [in] event The event implementation.
+   * \returns The scheduler event.
+   */
+  Scheduler::Event Insert (Partition *partition, uint64_t ts,
+                           uint32_t context, EventImpl *event);
+  /**
+   * Move the events sent to a partition in its event queue.
+   * \param [in] partition The partition.
+   */
+  void DeliverEvents (Partition *partition);
+  /**
+   * Main loop of a partition thread.
+   * \param [in] index The partition index.
+   */
+  void RunPartition (uint32_t index);
+
+  /** The partitions. */
+  std::vector<Partition *> m_partitions;
+  /** Number of partitions, as set by the ThreadCount attribute. */
+  uint32_t m_threadCount;
+  /** The lookahead. */
+  Time m_lookAhead;
+  /** The barrier synchronizing the partition threads. */
+  Barrier *m_barrier;
+  /** Is Run () executing. */
+  bool m_running;
+  /** Flag calling for the end of the simulation. */
+  std::atomic<bool> m_stop;
+  /**
+   * Value of m_stop sampled by partition 0 at the start of a round:
+   * all the partitions stop together, between two windows.
+   */
+  bool m_stopRound;
+  /** Timestamp of the last event, outside of Run (). */
+  uint64_t m_currentTs;
+
+  /** Container type for the events to run at Simulator::Destroy() */
+  typedef std::list<EventId> DestroyEvents;
+  /** The container of events to run at Destroy. */
+  DestroyEvents m_destroyEvents;
+  /** Mutex to control access to the destroy events. */
+  mutable SystemMutex m_destroyEventsMutex;
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
@@ -229,6 +229,16 @@ public:
   virtual bool HasGetter (void) const;
   virtual bool HasSetter (void) const;
 
+  /**
+   * Get an instance from the container, identified by its index,
+   * without getting all the instances of the container.
+   *
+   * \param [in] object The container object.
+   * \param [in] index The index of the instance.
+   * \returns The instance, or 0 if there is no instance with this index.
+   */
+  Ptr<Object> Find (const ObjectBase * object, std::size_t index) const;
+
 private:
   /**
    * Get the number of instances in the container.
@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_SHARED_VALUE_H
+#define NS3_SHARED_VALUE_H
+
+#include <stdint.h>
+#ifdef NS3_MT_PACKETS
+#include <atomic>
+#endif
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::SharedValue declaration and NS_MT_PACKETS_THREAD_LOCAL definition.
+ *
+ * The packets, and the objects held by a Ptr, are only safe to share
+ * between threads, e.g., between the partitions of an
+ * ns3::MultithreadedSimulatorImpl, when ns-3 is configured with
+ * \c --enable-mt-packets, which defines \c NS3_MT_PACKETS.  The
+ * default build uses plain integers and process-wide free lists, which
+ * are faster in a single-threaded simulation.
+ */
+
+#ifdef NS3_MT_PACKETS
+/**
+ * \ingroup core
+ * Storage class of the free lists and caches of the packets:
+ * per thread with \c --enable-mt-packets, per process otherwise.
+ */
+#define NS_MT_PACKETS_THREAD_LOCAL thread_local
+#else
+#define NS_MT_PACKETS_THREAD_LOCAL
+#endif
+
+namespace ns3 {
+
+#ifdef NS3_MT_PACKETS
+/**
+ * \ingroup core
+ * A counter or bound shared by several objects: atomic with
+ * \c --enable-mt-packets, a plain value otherwise.
+ */
+template <typename T>
+using SharedValue = std::atomic<T>;
+#else
+template <typename T>
+using SharedValue = T;
+#endif
+
+/**
+ * \ingroup core
+ * Replace a shared value if it still holds the expected value.
+ *
+ * With \c --enable-mt-packets, this is a compare-and-swap, so that only
+ * one of the threads racing for the same value succeeds.
+ *
+ * \param [in,out] value The shared value.
+ * \param [in] expected The value which \p value must hold.
+ * \param [in] desired The new value.
+ * \returns \c true if \p value held \p expected and was replaced.
+ */
+inline bool
+SharedValueClaim (SharedValue<uint32_t> &value, uint32_t expected, uint32_t desired)
+{
+#ifdef NS3_MT_PACKETS
+  return value.compare_exchange_strong (expected, desired);
+#else
+  if (value != expected)
+    {
+      return false;
+    }
+  value = desired;
+  return true;
+#endif
+}
+
+} // namespace ns3
+
+#endif /* NS3_SHARED_VALUE_H */
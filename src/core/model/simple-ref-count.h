@@ -26,6 +26,7 @@
 #include "default-deleter.h"
 #include "assert.h"
 #include "unused.h"
+#include "shared-value.h"
 #include <stdint.h>
 #include <limits>
 
@@ -68,6 +69,10 @@ namespace ns3 {
  *      to the object it manages exist anymore.
  *
  * Interesting users of this class include ns3::Object as well as ns3::Packet.
+ *
+ * With \c --enable-mt-packets, the reference count is atomic, so that
+ * the references to an object can be taken and released concurrently,
+ * e.g., by the partitions of an ns3::MultithreadedSimulatorImpl.
  */
 template <typename T, typename PARENT = empty, typename DELETER = DefaultDeleter<T> >
 class SimpleRefCount : public PARENT
@@ -104,8 +109,13 @@ public:
    */
   inline void Ref (void) const
   {
+#ifdef NS3_MT_PACKETS
+    NS_ASSERT (m_count.load (std::memory_order_relaxed) < std::numeric_limits<uint32_t>::max ());
+    m_count.fetch_add (1, std::memory_order_relaxed);
+#else
     NS_ASSERT (m_count < std::numeric_limits<uint32_t>::max ());
     m_count++;
+#endif
   }
   /**
    * Decrement the reference count. This method should not be called
@@ -115,11 +125,20 @@ public:
    */
   inline void Unref (void) const
   {
+#ifdef NS3_MT_PACKETS
+    // The last release must see all the changes made through the
+    // other references before the object is deleted.
+    if (m_count.fetch_sub (1, std::memory_order_acq_rel) == 1)
+      {
+        DELETER::Delete (static_cast<T*> (const_cast<SimpleRefCount *> (this)));
+      }
+#else
     m_count--;
     if (m_count == 0)
       {
         DELETER::Delete (static_cast<T*> (const_cast<SimpleRefCount *> (this)));
       }
+#endif
   }
 
   /**
@@ -141,7 +160,7 @@ private:
    * Note we make this mutable so that the const methods can still
    * change it.
    */
-  mutable uint32_t m_count;
+  mutable SharedValue<uint32_t> m_count;
 };
 
 } // namespace ns3
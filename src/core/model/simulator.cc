@@ -173,6 +173,7 @@ Simulator::Run (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
   Time::ClearMarkedTimes ();
+  EventImpl::UpdatePoolEnabled ();
   GetImpl ()->Run ();
 }
 
@@ -308,6 +309,18 @@ Simulator::GetEventCount (void)
   return GetImpl ()->GetEventCount ();
 }
 
+uint64_t
+Simulator::GetAllocatedEventCount (void)
+{
+  return EventImpl::GetAllocatedCount ();
+}
+
+uint64_t
+Simulator::GetRecycledEventCount (void)
+{
+  return EventImpl::GetRecycledCount ();
+}
+
 uint32_t
 Simulator::GetSystemId (void)
 {
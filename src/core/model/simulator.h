@@ -205,6 +205,27 @@ public:
    */
   static uint64_t GetEventCount (void);
 
+  /**
+   * Get the number of events allocated from the system allocator
+   * while the event pool was enabled.
+   *
+   * The count is per process, not per simulation: it covers all the
+   * threads, and is not reset by Simulator::Destroy.
+   * \see \ref GlobalValueEventPool "EventPool" global value
+   * \returns The number of events allocated.
+   */
+  static uint64_t GetAllocatedEventCount (void);
+
+  /**
+   * Get the number of events served from the event pool free lists.
+   *
+   * The count is per process, not per simulation: it covers all the
+   * threads, and is not reset by Simulator::Destroy.
+   * \see \ref GlobalValueEventPool "EventPool" global value
+   * \returns The number of events recycled.
+   */
+  static uint64_t GetRecycledEventCount (void);
+
 
   /**
    * @name Schedule events (in the same context) to run at a future time.
@@ -21,7 +21,7 @@
 #ifndef TRACED_CALLBACK_H
 #define TRACED_CALLBACK_H
 
-#include <list>
+#include <vector>
 #include "callback.h"
 
 /**
@@ -85,10 +85,28 @@ public:
   void Disconnect (const CallbackBase & callback, std::string path);
   /**
    * \brief Functor which invokes the chain of Callbacks.
+   *
+   * The arguments are passed down to the Callbacks as CallbackArgTraits
+   * does, without a copy of the arguments which are not scalar.
+   * Every Callback is thus given the very object passed by the trace
+   * source, and not a copy taken before the first Callback is invoked:
+   * a Callback which modifies the state of the trace source, for example
+   * the member variable passed as argument, changes the argument seen
+   * by the Callbacks which follow it.
+   *
    * \tparam Ts \deduced Types of the functor arguments.
    * \param [in] args The arguments to the functor
    */
-  void operator() (Ts... args) const;
+  void operator() (typename CallbackArgTraits<Ts>::Type... args) const;
+  /**
+   * \brief Check if the chain of Callbacks is empty.
+   *
+   * This is cheap enough to be checked before building the arguments
+   * of a trace source on a hot path; see NS_HOT_TRACE.
+   *
+   * \returns \c true if no Callback is connected.
+   */
+  bool IsEmpty (void) const;
 
   /**
    *  TracedCallback signature for POD.
@@ -105,15 +123,64 @@ private:
   /**
    * Container type for holding the chain of Callbacks.
    *
+   * Most trace sources have no or few sinks, and are invoked far more
+   * often than connected: the Callbacks are stored contiguously.
+   *
    * \tparam Ts \deduced Types of the functor arguments.
    */
-  typedef std::list<Callback<void,Ts...> > CallbackList;
-  /** The chain of Callbacks. */
+  typedef std::vector<Callback<void,Ts...> > CallbackList;
+  /**
+   * Remove the Callbacks disconnected while the chain was invoked.
+   */
+  void RemoveDisconnected (void);
+  /**
+   * The chain of Callbacks, followed by the m_disconnected Callbacks
+   * disconnected while the chain is invoked.  Such a Callback is
+   * nullified in the chain, to keep the indexes of the others, and
+   * its copy at the end keeps it alive until the end of the invocation.
+   */
   CallbackList m_callbackList;
+  /** The number of invocations of the chain in progress. */
+  mutable uint32_t m_invoking;
+  /** The number of Callbacks kept at the end of m_callbackList. */
+  uint32_t m_disconnected;
 };
 
 } // namespace ns3
 
+/**
+ * \ingroup tracing
+ * \brief Invoke a TracedCallback on a hot path.
+ *
+ * The arguments are only evaluated if a Callback is connected to the
+ * trace source.  If ns-3 is configured with \c --disable-hot-traces,
+ * the invocation is compiled out entirely, and the trace source never
+ * fires even if connected.  This is meant for the trace sources invoked
+ * for each packet by the devices, which are rarely connected; it is
+ * only used by the MacTx, PhyTxBegin, PhyTxEnd and PhyRxEnd sources of
+ * the point-to-point and CSMA devices.
+ *
+ * \param [in] trace The TracedCallback to invoke.
+ * \param [in] ... The arguments of the TracedCallback.
+ */
+#ifdef NS3_HOT_TRACES_DISABLE
+#define NS_HOT_TRACE(trace, ...)                      \
+  do {                                                \
+      if (false)                                      \
+        {                                             \
+          trace (__VA_ARGS__);                        \
+        }                                             \
+    } while (false)
+#else /* NS3_HOT_TRACES_DISABLE */
+#define NS_HOT_TRACE(trace, ...)                      \
+  do {                                                \
+      if (!(trace).IsEmpty ())                        \
+        {                                             \
+          trace (__VA_ARGS__);                        \
+        }                                             \
+    } while (false)
+#endif /* NS3_HOT_TRACES_DISABLE */
+
 
 /********************************************************************
  *  Implementation of the templates declared above.
@@ -123,7 +190,9 @@ namespace ns3 {
 
 template<typename... Ts>
 TracedCallback<Ts...>::TracedCallback ()
-  : m_callbackList ()
+  : m_callbackList (),
+    m_invoking (0),
+    m_disconnected (0)
 {}
 template<typename... Ts>
 void
@@ -134,7 +203,7 @@ TracedCallback<Ts...>::ConnectWithoutContext (const CallbackBase & callback)
     {
       NS_FATAL_ERROR_NO_MSG ();
     }
-  m_callbackList.push_back (cb);
+  m_callbackList.insert (m_callbackList.end () - m_disconnected, cb);
 }
 template<typename... Ts>
 void
@@ -146,18 +215,27 @@ TracedCallback<Ts...>::Connect (const CallbackBase & callback, std::string path)
       NS_FATAL_ERROR ("when connecting to " << path);
     }
   Callback<void,Ts...> realCb = cb.Bind (path);
-  m_callbackList.push_back (realCb);
+  m_callbackList.insert (m_callbackList.end () - m_disconnected, realCb);
 }
 template<typename... Ts>
 void
 TracedCallback<Ts...>::DisconnectWithoutContext (const CallbackBase & callback)
 {
-  for (typename CallbackList::iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); /* empty */)
+  for (std::size_t i = 0; i < m_callbackList.size () - m_disconnected; /* empty */)
     {
-      if ((*i).IsEqual (callback))
+      if (!m_callbackList[i].IsNull () && m_callbackList[i].IsEqual (callback))
         {
-          i = m_callbackList.erase (i);
+          if (m_invoking > 0)
+            {
+              m_callbackList.push_back (m_callbackList[i]);
+              m_disconnected++;
+              m_callbackList[i].Nullify ();
+              i++;
+            }
+          else
+            {
+              m_callbackList.erase (m_callbackList.begin () + i);
+            }
         }
       else
         {
@@ -179,14 +257,49 @@ TracedCallback<Ts...>::Disconnect (const CallbackBase & callback, std::string pa
 }
 template<typename... Ts>
 void
-TracedCallback<Ts...>::operator() (Ts... args) const
+TracedCallback<Ts...>::operator() (typename CallbackArgTraits<Ts>::Type... args) const
+{
+  // Iterate by index, a Callback may connect another one to this
+  // TracedCallback while it is invoked, or disconnect one.
+  m_invoking++;
+  for (std::size_t i = 0; i < m_callbackList.size () - m_disconnected; i++)
+    {
+      if (!m_callbackList[i].IsNull ())
+        {
+          m_callbackList[i](args...);
+        }
+    }
+  m_invoking--;
+  if (m_invoking == 0 && m_disconnected > 0)
+    {
+      const_cast<TracedCallback<Ts...> *> (this)->RemoveDisconnected ();
+    }
+}
+template<typename... Ts>
+void
+TracedCallback<Ts...>::RemoveDisconnected (void)
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  m_callbackList.erase (m_callbackList.end () - m_disconnected, m_callbackList.end ());
+  m_disconnected = 0;
+  for (typename CallbackList::iterator i = m_callbackList.begin ();
+       i != m_callbackList.end (); /* empty */)
     {
-      (*i)(args...);
+      if ((*i).IsNull ())
+        {
+          i = m_callbackList.erase (i);
+        }
+      else
+        {
+          i++;
+        }
     }
 }
+template<typename... Ts>
+inline bool
+TracedCallback<Ts...>::IsEmpty (void) const
+{
+  return m_callbackList.empty ();
+}
 
 } // namespace ns3
 
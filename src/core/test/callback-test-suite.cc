@@ -595,6 +595,72 @@ NullifyCallbackTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (target1.IsNull (), true, "Nullified Callback reports not IsNull()");
 }
 
+// ===========================================================================
+// Test the copies of the arguments passed through a Callback
+// ===========================================================================
+static int gCopyCallbackTestCopies;
+
+class CopyCallbackTestArgument
+{
+public:
+  CopyCallbackTestArgument ()
+  {}
+  CopyCallbackTestArgument (const CopyCallbackTestArgument &)
+  {
+    gCopyCallbackTestCopies++;
+  }
+};
+
+void
+CopyCallbackTarget1 (CopyCallbackTestArgument)
+{}
+
+void
+CopyCallbackTarget2 (int, CopyCallbackTestArgument)
+{}
+
+class CopyCallbackTestCase : public TestCase
+{
+public:
+  CopyCallbackTestCase ();
+  virtual ~CopyCallbackTestCase ()
+  {}
+
+  void Target1 (CopyCallbackTestArgument)
+  {}
+
+private:
+  virtual void DoRun (void);
+};
+
+CopyCallbackTestCase::CopyCallbackTestCase ()
+  : TestCase ("Check the copies of the arguments of a Callback")
+{}
+
+void
+CopyCallbackTestCase::DoRun (void)
+{
+  //
+  // The arguments are only copied when the target is called, if it takes
+  // them by value, and not by each layer of the Callback.
+  //
+  CopyCallbackTestArgument argument;
+  Callback<void, CopyCallbackTestArgument> target1 = MakeCallback (&CopyCallbackTarget1);
+  gCopyCallbackTestCopies = 0;
+  target1 (argument);
+  NS_TEST_ASSERT_MSG_EQ (gCopyCallbackTestCopies, 1, "Argument copied through a function Callback");
+
+  Callback<void, CopyCallbackTestArgument> target2 = MakeCallback (&CopyCallbackTestCase::Target1, this);
+  gCopyCallbackTestCopies = 0;
+  target2 (argument);
+  NS_TEST_ASSERT_MSG_EQ (gCopyCallbackTestCopies, 1, "Argument copied through a member Callback");
+
+  Callback<void, CopyCallbackTestArgument> target3 = MakeBoundCallback (&CopyCallbackTarget2, 1);
+  gCopyCallbackTestCopies = 0;
+  target3 (argument);
+  NS_TEST_ASSERT_MSG_EQ (gCopyCallbackTestCopies, 1, "Argument copied through a bound Callback");
+}
+
 // ===========================================================================
 // Make sure that various MakeCallback template functions compile and execute.
 // Doesn't check an results of the execution.
@@ -755,6 +821,7 @@ CallbackTestSuite::CallbackTestSuite ()
   AddTestCase (new MakeCallbackTestCase, TestCase::QUICK);
   AddTestCase (new MakeBoundCallbackTestCase, TestCase::QUICK);
   AddTestCase (new NullifyCallbackTestCase, TestCase::QUICK);
+  AddTestCase (new CopyCallbackTestCase, TestCase::QUICK);
   AddTestCase (new MakeCallbackTemplatesTestCase, TestCase::QUICK);
 }
 
@@ -33,6 +33,7 @@
 #include "ns3/unused.h"
 
 
+#include <map>
 #include <sstream>
 
 /**
@@ -840,6 +841,132 @@ SearchAttributesOfParentObjectsTestCase::DoRun (void)
 
 }
 
+/**
+ * \ingroup config-tests
+ * Test for the paths compiled once and resolved many times, and for the
+ * connection of a sink per trace source with ConnectAll.
+ */
+class CompiledPathTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  CompiledPathTestCase ();
+  /** Destructor. */
+  virtual ~CompiledPathTestCase ()
+  {}
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Get the sink of a trace source.
+   * \param path The path of the trace source.
+   * \returns The sink, bound to the path.
+   */
+  CallbackBase MakeSink (std::string path);
+  /**
+   * Trace callback, bound to the path of its trace source.
+   * \param test The test case.
+   * \param path The path of the trace source.
+   * \param oldValue The old value.
+   * \param newValue The new value.
+   */
+  static void Trace (CompiledPathTestCase *test, std::string path, int16_t oldValue, int16_t newValue);
+
+  std::map<std::string, int16_t> m_values; //!< The last value traced by path.
+};
+
+CompiledPathTestCase::CompiledPathTestCase ()
+  : TestCase ("Check the compiled paths and ConnectAll")
+{}
+
+CallbackBase
+CompiledPathTestCase::MakeSink (std::string path)
+{
+  return MakeBoundCallback (&CompiledPathTestCase::Trace, this, path);
+}
+
+void
+CompiledPathTestCase::Trace (CompiledPathTestCase *test, std::string path, int16_t oldValue, int16_t newValue)
+{
+  NS_UNUSED (oldValue);
+  test->m_values[path] = newValue;
+}
+
+void
+CompiledPathTestCase::DoRun (void)
+{
+  //
+  // Name the root of the objects, so that the objects of the other tests
+  // do not match the paths
+  //
+  Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject> ();
+  Names::Add ("CompiledPathTest", root);
+  std::vector<Ptr<ConfigTestObject> > objects;
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      objects.push_back (CreateObject<ConfigTestObject> ());
+      root->AddNodeA (objects.back ());
+    }
+
+  Config::CompiledPath all ("/Names/CompiledPathTest/NodesA/*");
+  Config::MatchContainer matches = all.LookupMatches ();
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 3, "Wrong number of objects matching a wildcard");
+  for (uint32_t i = 0; i < matches.GetN (); i++)
+    {
+      std::ostringstream oss;
+      oss << "/Names/CompiledPathTest/NodesA/" << i << "/";
+      NS_TEST_EXPECT_MSG_EQ (matches.Get (i), objects[i], "Wrong object matching a wildcard");
+      NS_TEST_EXPECT_MSG_EQ (matches.GetMatchedPath (i), oss.str (), "Wrong path matching a wildcard");
+    }
+
+  // Indexes, with the direct lookup of the object, and with other patterns
+  Config::CompiledPath one ("/Names/CompiledPathTest/NodesA/1");
+  matches = one.LookupMatches ();
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 1, "Wrong number of objects matching an index");
+  NS_TEST_EXPECT_MSG_EQ (matches.Get (0), objects[1], "Wrong object matching an index");
+  NS_TEST_EXPECT_MSG_EQ (matches.GetMatchedPath (0), "/Names/CompiledPathTest/NodesA/1/", "Wrong path matching an index");
+  matches = Config::CompiledPath ("/Names/CompiledPathTest/NodesA/0|2").LookupMatches ();
+  NS_TEST_EXPECT_MSG_EQ (matches.GetN (), 2, "Wrong number of objects matching an alternative");
+
+  // A compiled path matches the objects added after its compilation
+  Config::CompiledPath last ("/Names/CompiledPathTest/NodesA/3");
+  NS_TEST_EXPECT_MSG_EQ (last.LookupMatches ().GetN (), 0, "Object matching an index out of range");
+  objects.push_back (CreateObject<ConfigTestObject> ());
+  root->AddNodeA (objects.back ());
+  NS_TEST_EXPECT_MSG_EQ (last.LookupMatches ().GetN (), 1, "Object added not found");
+  NS_TEST_EXPECT_MSG_EQ (all.LookupMatches ().GetN (), 4, "Object added not matching a wildcard");
+  NS_TEST_EXPECT_MSG_EQ (Config::LookupMatches ("/Names/CompiledPathTest/NodesA/*").GetN (), 4,
+                         "Wrong number of objects matching a path which is not compiled");
+
+  // Attributes
+  Config::CompiledPath attribute ("/Names/CompiledPathTest/NodesA/2/A");
+  attribute.Set (IntegerValue (-5));
+  IntegerValue iv;
+  objects[2]->GetAttribute ("A", iv);
+  NS_TEST_EXPECT_MSG_EQ (iv.Get (), -5, "Attribute not set through a compiled path");
+  objects[1]->GetAttribute ("A", iv);
+  NS_TEST_EXPECT_MSG_EQ (iv.Get (), 10, "Attribute of another object set through a compiled path");
+
+  // A sink per trace source
+  std::size_t connected = Config::ConnectAll ("/Names/CompiledPathTest/NodesA/*/Source",
+                                              MakeCallback (&CompiledPathTestCase::MakeSink, this));
+  NS_TEST_ASSERT_MSG_EQ (connected, 4, "Wrong number of trace sources connected");
+  for (uint32_t i = 0; i < objects.size (); i++)
+    {
+      objects[i]->SetAttribute ("Source", IntegerValue (-10 - static_cast<int16_t> (i)));
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_values.size (), 4, "Wrong number of sinks called");
+  for (uint32_t i = 0; i < objects.size (); i++)
+    {
+      std::ostringstream oss;
+      oss << "/Names/CompiledPathTest/NodesA/" << i << "/Source";
+      NS_TEST_EXPECT_MSG_EQ (m_values[oss.str ()], -10 - static_cast<int16_t> (i), "Wrong sink called");
+    }
+
+  Names::Clear ();
+}
+
 /**
  * \ingroup config-tests
  * The Test Suite that glues all of the Test Cases together.
@@ -858,6 +985,7 @@ ConfigTestSuite::ConfigTestSuite ()
   AddTestCase (new UnderRootNamespaceConfigTestCase);
   AddTestCase (new ObjectVectorConfigTestCase);
   AddTestCase (new SearchAttributesOfParentObjectsTestCase);
+  AddTestCase (new CompiledPathTestCase);
 }
 
 /**
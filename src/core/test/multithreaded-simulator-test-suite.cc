@@ -0,0 +1,266 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/simulator-impl.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/object-factory.h"
+#include "ns3/uinteger.h"
+#include "ns3/nstime.h"
+
+#include <algorithm>
+#include <vector>
+#include <utility>
+
+using namespace ns3;
+
+/**
+ * \ingroup tests
+ *
+ * Check that the multithreaded simulator runs the events of each
+ * context in the same order and at the same times as the
+ * default simulator.
+ *
+ * Each context runs a chain of events which periodically reschedules
+ * itself locally, and forwards tokens to the next context with a delay
+ * at least equal to the lookahead.
+ *
+ * When an event calls Simulator::Stop, the multithreaded simulator must
+ * stop at the end of the current window in all partitions, so that the
+ * same events are run whatever the timing of the threads.
+ *
+ * The events only record what they see; everything is checked in
+ * the main thread, as the test macros are not thread-safe.
+ */
+class MultithreadedSimulatorTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param [in] threads The number of partitions.
+   */
+  MultithreadedSimulatorTestCase (uint32_t threads);
+  virtual void DoRun (void);
+
+private:
+  /** The record of one event: time stamp and token. */
+  typedef std::pair<int64_t, uint32_t> Record;
+
+  /**
+   * Run the scenario with a simulator implementation.
+   * \param [in] factory The simulator implementation factory.
+   * \param [out] log The events run by each context.
+   * \param [out] wrongContexts The number of events of each context
+   *             run with another context.
+   * \param [in] stop The time at which an event calls Simulator::Stop,
+   *             or zero to run all the events.
+   * \returns The number of events run.
+   */
+  uint64_t RunScenario (ObjectFactory factory, std::vector<std::vector<Record> > &log,
+                        std::vector<uint32_t> &wrongContexts, Time stop = Time (0));
+  /**
+   * Local periodic event.
+   * \param [in] context The context.
+   * \param [in] left Number of remaining repetitions.
+   */
+  void Tick (uint32_t context, uint32_t left);
+  /**
+   * Token received from another context.
+   * \param [in] context The context.
+   * \param [in] token The token.
+   * \param [in] hops Number of remaining hops.
+   */
+  void Receive (uint32_t context, uint32_t token, uint32_t hops);
+  /** Stop the simulation. */
+  void StopNow (void);
+
+  uint32_t m_threads;                       //!< Number of partitions.
+  std::vector<std::vector<Record> > *m_log; //!< Current log.
+  std::vector<uint32_t> *m_wrongContexts;   //!< Current count of events with a wrong context.
+};
+
+/** Number of contexts. */
+static const uint32_t N_CONTEXTS = 13;
+
+MultithreadedSimulatorTestCase::MultithreadedSimulatorTestCase (uint32_t threads)
+  : TestCase ("Check the multithreaded simulator against the default one with "
+              + std::to_string (threads) + " threads"),
+    m_threads (threads),
+    m_log (0),
+    m_wrongContexts (0)
+{}
+
+void
+MultithreadedSimulatorTestCase::Tick (uint32_t context, uint32_t left)
+{
+  if (Simulator::GetContext () != context)
+    {
+      (*m_wrongContexts)[context]++;
+    }
+  (*m_log)[context].push_back (Record (Simulator::Now ().GetTimeStep (), 1000000 + left));
+  if (left > 0)
+    {
+      Simulator::Schedule (NanoSeconds (300 + 17 * context), &MultithreadedSimulatorTestCase::Tick,
+                           this, context, left - 1);
+    }
+  if (left % 7 == 0)
+    {
+      uint32_t next = (context + 1 + left % 3) % N_CONTEXTS;
+      Simulator::ScheduleWithContext (next, MicroSeconds (1) + NanoSeconds (left),
+                                      &MultithreadedSimulatorTestCase::Receive,
+                                      this, next, context * 1000 + left, 20);
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::Receive (uint32_t context, uint32_t token, uint32_t hops)
+{
+  if (Simulator::GetContext () != context)
+    {
+      (*m_wrongContexts)[context]++;
+    }
+  (*m_log)[context].push_back (Record (Simulator::Now ().GetTimeStep (), token));
+  if (hops > 0)
+    {
+      uint32_t next = (context + token) % N_CONTEXTS;
+      Simulator::ScheduleWithContext (next, MicroSeconds (1) + NanoSeconds (token % 500),
+                                      &MultithreadedSimulatorTestCase::Receive,
+                                      this, next, token, hops - 1);
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::StopNow (void)
+{
+  Simulator::Stop ();
+}
+
+uint64_t
+MultithreadedSimulatorTestCase::RunScenario (ObjectFactory factory,
+                                             std::vector<std::vector<Record> > &log,
+                                             std::vector<uint32_t> &wrongContexts, Time stop)
+{
+  log.assign (N_CONTEXTS, std::vector<Record> ());
+  wrongContexts.assign (N_CONTEXTS, 0);
+  m_log = &log;
+  m_wrongContexts = &wrongContexts;
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+  for (uint32_t context = 0; context < N_CONTEXTS; ++context)
+    {
+      Simulator::ScheduleWithContext (context, NanoSeconds (context),
+                                      &MultithreadedSimulatorTestCase::Tick,
+                                      this, context, 200);
+    }
+  if (!stop.IsZero ())
+    {
+      Simulator::ScheduleWithContext (N_CONTEXTS / 2, stop,
+                                      &MultithreadedSimulatorTestCase::StopNow, this);
+    }
+  Simulator::Run ();
+  uint64_t count = Simulator::GetEventCount ();
+  Simulator::Destroy ();
+  m_log = 0;
+  m_wrongContexts = 0;
+  return count;
+}
+
+void
+MultithreadedSimulatorTestCase::DoRun (void)
+{
+  std::vector<std::vector<Record> > expected;
+  std::vector<uint32_t> wrongContexts;
+  uint64_t expectedCount = RunScenario (ObjectFactory ("ns3::DefaultSimulatorImpl"),
+                                        expected, wrongContexts);
+
+  ObjectFactory factory ("ns3::MultithreadedSimulatorImpl");
+  factory.Set ("ThreadCount", UintegerValue (m_threads));
+  factory.Set ("LookAhead", TimeValue (MicroSeconds (1)));
+  std::vector<std::vector<Record> > actual;
+  uint64_t count = RunScenario (factory, actual, wrongContexts);
+
+  NS_TEST_ASSERT_MSG_EQ (count, expectedCount, "Wrong number of events");
+  for (uint32_t context = 0; context < N_CONTEXTS; ++context)
+    {
+      NS_TEST_EXPECT_MSG_EQ (wrongContexts[context], 0,
+                             "Events of context " << context << " run with a wrong context");
+      // Simultaneous events received from other partitions may run
+      // in a different order than with the default simulator.
+      std::sort (expected[context].begin (), expected[context].end ());
+      std::sort (actual[context].begin (), actual[context].end ());
+      NS_TEST_ASSERT_MSG_EQ (actual[context].size (), expected[context].size (),
+                             "Wrong number of events for context " << context);
+      for (uint32_t i = 0; i < actual[context].size (); ++i)
+        {
+          NS_TEST_ASSERT_MSG_EQ (actual[context][i].first, expected[context][i].first,
+                                 "Wrong time for event " << i << " of context " << context);
+          NS_TEST_ASSERT_MSG_EQ (actual[context][i].second, expected[context][i].second,
+                                 "Wrong event " << i << " of context " << context);
+        }
+    }
+
+  // Every run stopped by an event runs the same events: all those
+  // up to the stop, and none a lookahead later.
+  Time stop = MicroSeconds (37);
+  int64_t end = (stop + MicroSeconds (1)).GetTimeStep ();
+  std::vector<std::vector<Record> > first;
+  std::vector<std::vector<Record> > second;
+  RunScenario (factory, first, wrongContexts, stop);
+  RunScenario (factory, second, wrongContexts, stop);
+  for (uint32_t context = 0; context < N_CONTEXTS; ++context)
+    {
+      std::sort (first[context].begin (), first[context].end ());
+      std::sort (second[context].begin (), second[context].end ());
+      NS_TEST_ASSERT_MSG_EQ ((first[context] == second[context]), true,
+                             "Different events run before the stop for context " << context);
+      uint32_t expectedBefore = 0;
+      for (uint32_t i = 0; i < expected[context].size (); ++i)
+        {
+          expectedBefore += (expected[context][i].first <= stop.GetTimeStep ()) ? 1 : 0;
+        }
+      uint32_t before = 0;
+      for (uint32_t i = 0; i < first[context].size (); ++i)
+        {
+          before += (first[context][i].first <= stop.GetTimeStep ()) ? 1 : 0;
+          NS_TEST_ASSERT_MSG_LT (first[context][i].first, end,
+                                 "Event " << i << " of context " << context << " run after the stop");
+        }
+      NS_TEST_ASSERT_MSG_EQ (before, expectedBefore,
+                             "Wrong number of events before the stop for context " << context);
+    }
+}
+
+/**
+ * \ingroup tests
+ *
+ * MultithreadedSimulatorImpl test suite.
+ */
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+public:
+  MultithreadedSimulatorTestSuite ()
+    : TestSuite ("multithreaded-simulator")
+  {
+    AddTestCase (new MultithreadedSimulatorTestCase (1), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorTestCase (4), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorTestCase (16), TestCase::QUICK);
+  }
+};
+
+/** Static variable for test initialization. */
+static MultithreadedSimulatorTestSuite g_multithreadedSimulatorTestSuite;
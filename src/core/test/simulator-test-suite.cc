@@ -23,7 +23,14 @@
 #include "ns3/heap-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/ladder-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/event-impl.h"
+#include "ns3/simulator-impl.h"
+#include "ns3/config.h"
+#include "ns3/boolean.h"
+#include <set>
 
 using namespace ns3;
 
@@ -465,6 +472,161 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class SchedulerOrderTestCase : public TestCase
+{
+public:
+  SchedulerOrderTestCase (ObjectFactory schedulerFactory);
+  virtual void DoRun (void);
+  ObjectFactory m_schedulerFactory;
+};
+
+SchedulerOrderTestCase::SchedulerOrderTestCase (ObjectFactory schedulerFactory)
+  : TestCase ("Check event ordering under random insert and remove with " +
+              schedulerFactory.GetTypeId ().GetName ()),
+    m_schedulerFactory (schedulerFactory)
+{}
+void
+SchedulerOrderTestCase::DoRun (void)
+{
+  Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler> ();
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable> ();
+  rng->SetStream (1);
+  std::set<Scheduler::EventKey> pending;
+  uint64_t now = 0;
+  uint32_t uid = 0;
+
+  // Start with a large population, so that the ladder grows several rungs.
+  for (; uid < 10000; ++uid)
+    {
+      Scheduler::Event ev;
+      ev.impl = 0;
+      ev.key.m_ts = rng->GetInteger (0, 1000000);
+      ev.key.m_uid = uid;
+      ev.key.m_context = 0;
+      scheduler->Insert (ev);
+      pending.insert (ev.key);
+    }
+  for (uint32_t round = 0; round < 20000; ++round)
+    {
+      uint32_t choice = rng->GetInteger (0, 9);
+      if (choice < 5 || pending.empty ())
+        {
+          // Mix spread out events with bursts of simultaneous ones.
+          uint64_t delay = (choice == 0) ? 0 : rng->GetInteger (0, 1000000);
+          uint32_t burst = (rng->GetInteger (0, 99) == 0) ? 100 : 1;
+          for (uint32_t i = 0; i < burst; ++i)
+            {
+              Scheduler::Event ev;
+              ev.impl = 0;
+              ev.key.m_ts = now + delay;
+              ev.key.m_uid = uid++;
+              ev.key.m_context = 0;
+              scheduler->Insert (ev);
+              pending.insert (ev.key);
+            }
+        }
+      else if (choice < 9)
+        {
+          Scheduler::Event next = scheduler->PeekNext ();
+          NS_TEST_ASSERT_MSG_EQ (next.key.m_uid, pending.begin ()->m_uid, "Wrong next event");
+          Scheduler::Event ev = scheduler->RemoveNext ();
+          NS_TEST_ASSERT_MSG_EQ (ev.key.m_uid, pending.begin ()->m_uid, "Wrong event removed");
+          NS_TEST_ASSERT_MSG_EQ ((ev.key.m_ts >= now), true, "Event removed out of order");
+          now = ev.key.m_ts;
+          pending.erase (pending.begin ());
+        }
+      else
+        {
+          Scheduler::EventKey key;
+          key.m_ts = now + rng->GetInteger (0, 1000000);
+          key.m_uid = 0;
+          key.m_context = 0;
+          std::set<Scheduler::EventKey>::iterator it = pending.lower_bound (key);
+          if (it == pending.end ())
+            {
+              it = pending.begin ();
+            }
+          Scheduler::Event ev;
+          ev.impl = 0;
+          ev.key = *it;
+          scheduler->Remove (ev);
+          pending.erase (it);
+        }
+      NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), pending.empty (), "Wrong queue size");
+    }
+  while (!pending.empty ())
+    {
+      Scheduler::Event ev = scheduler->RemoveNext ();
+      NS_TEST_ASSERT_MSG_EQ (ev.key.m_uid, pending.begin ()->m_uid, "Wrong event removed");
+      pending.erase (pending.begin ());
+    }
+  NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), true, "Scheduler not empty");
+}
+
+class SimulatorEventPoolTestCase : public TestCase
+{
+public:
+  SimulatorEventPoolTestCase ();
+  virtual void DoRun (void);
+  void Reschedule (uint32_t left, uint64_t a, uint64_t b, uint64_t c);
+  uint32_t m_count;
+};
+
+SimulatorEventPoolTestCase::SimulatorEventPoolTestCase ()
+  : TestCase ("Check that released events are recycled by the event pool")
+{}
+void
+SimulatorEventPoolTestCase::Reschedule (uint32_t left, uint64_t a, uint64_t b, uint64_t c)
+{
+  NS_TEST_EXPECT_MSG_EQ (a + b + c, left * 3, "Bound arguments corrupted");
+  m_count++;
+  if (left > 0)
+    {
+      Simulator::Schedule (NanoSeconds (1), &SimulatorEventPoolTestCase::Reschedule,
+                           this, left - 1, left - 1, left - 1, left - 1);
+    }
+}
+void
+SimulatorEventPoolTestCase::DoRun (void)
+{
+  m_count = 0;
+  EventImpl::SetPoolEnabled (true);
+  // The creation of a simulator implementation does not change the pool
+  Simulator::Destroy ();
+  Simulator::GetImplementation ();
+  NS_TEST_EXPECT_MSG_EQ (EventImpl::IsPoolEnabled (), true,
+                         "Event pool disabled by the simulator implementation");
+  uint64_t allocated = Simulator::GetAllocatedEventCount ();
+  uint64_t recycled = Simulator::GetRecycledEventCount ();
+
+  Simulator::Schedule (NanoSeconds (1), &SimulatorEventPoolTestCase::Reschedule,
+                       this, 100, 100, 100, 100);
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (m_count, 101, "Events did not run");
+  NS_TEST_EXPECT_MSG_GT (Simulator::GetRecycledEventCount () - recycled, 90,
+                         "Released events were not recycled");
+  NS_TEST_EXPECT_MSG_LT (Simulator::GetAllocatedEventCount () - allocated, 10,
+                         "Too many events allocated");
+
+  EventImpl::SetPoolEnabled (false);
+  Simulator::Destroy ();
+
+  // The EventPool global value set after events were scheduled applies
+  // when the simulation runs
+  m_count = 0;
+  Simulator::Schedule (NanoSeconds (1), &SimulatorEventPoolTestCase::Reschedule,
+                       this, 100, 100, 100, 100);
+  Config::SetGlobal ("EventPool", BooleanValue (true));
+  recycled = Simulator::GetRecycledEventCount ();
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (m_count, 101, "Events did not run");
+  NS_TEST_EXPECT_MSG_GT (Simulator::GetRecycledEventCount () - recycled, 90,
+                         "EventPool set before Simulator::Run ignored");
+
+  EventImpl::SetPoolEnabled (false);
+  Simulator::Destroy ();
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -481,7 +643,18 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (CalendarScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (LadderScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (PriorityQueueScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+
+    factory.SetTypeId (MapScheduler::GetTypeId ());
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (CalendarScheduler::GetTypeId ());
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (LadderScheduler::GetTypeId ());
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
+
+    AddTestCase (new SimulatorEventPoolTestCase (), TestCase::QUICK);
   }
 } g_simulatorTestSuite;
@@ -113,6 +113,135 @@ BasicTracedCallbackTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (m_two, true, "Callback CbTwo not called");
 }
 
+class ChainTracedCallbackTestCase : public TestCase
+{
+public:
+  ChainTracedCallbackTestCase ();
+  virtual ~ChainTracedCallbackTestCase ()
+  {}
+
+private:
+  virtual void DoRun (void);
+
+  void CbCount (int a);
+  void CbConnect (int a);
+  void CbDisconnect (int a);
+
+  TracedCallback<int> m_trace;
+  int m_count;
+  bool m_connected;
+};
+
+ChainTracedCallbackTestCase::ChainTracedCallbackTestCase ()
+  : TestCase ("Check the chain of a TracedCallback and NS_HOT_TRACE")
+{}
+
+void
+ChainTracedCallbackTestCase::CbCount (int a)
+{
+  m_count += a;
+}
+
+void
+ChainTracedCallbackTestCase::CbConnect (int a)
+{
+  m_count += a;
+  if (!m_connected)
+    {
+      m_trace.ConnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbCount, this));
+      m_connected = true;
+    }
+}
+
+void
+ChainTracedCallbackTestCase::CbDisconnect (int a)
+{
+  m_count += a;
+  m_trace.DisconnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbDisconnect, this));
+}
+
+void
+ChainTracedCallbackTestCase::DoRun (void)
+{
+  NS_TEST_ASSERT_MSG_EQ (m_trace.IsEmpty (), true, "New TracedCallback not empty");
+
+  //
+  // The arguments of NS_HOT_TRACE are not evaluated without a callback.
+  //
+  m_count = 0;
+  NS_HOT_TRACE (m_trace, m_count++);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 0, "Arguments evaluated without a callback");
+
+  //
+  // The same callback connected several times is invoked as many times, in
+  // the order of the connections.
+  //
+  for (int i = 0; i < 4; i++)
+    {
+      m_trace.ConnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbCount, this));
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_trace.IsEmpty (), false, "Connected TracedCallback empty");
+  m_count = 0;
+  m_trace (1);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 4, "Callbacks not all called");
+  m_trace.DisconnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbCount, this));
+  NS_TEST_ASSERT_MSG_EQ (m_trace.IsEmpty (), true, "Disconnected TracedCallback not empty");
+
+  //
+  // A callback which connects another one while the chain is invoked: the
+  // callback connected is invoked too.
+  //
+  m_connected = false;
+  m_trace.ConnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbConnect, this));
+  m_count = 0;
+  m_trace (1);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 2, "Callback connected while invoked not called");
+  m_count = 0;
+#ifdef NS3_HOT_TRACES_DISABLE
+  NS_HOT_TRACE (m_trace, 1);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 0, "Callback called while hot traces are disabled");
+#else /* NS3_HOT_TRACES_DISABLE */
+  NS_HOT_TRACE (m_trace, 1);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 2, "Callbacks not called by NS_HOT_TRACE");
+#endif /* NS3_HOT_TRACES_DISABLE */
+  m_trace.DisconnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbConnect, this));
+  m_trace.DisconnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbCount, this));
+  NS_TEST_ASSERT_MSG_EQ (m_trace.IsEmpty (), true, "Disconnected TracedCallback not empty");
+
+  //
+  // A callback which disconnects itself while the chain is invoked: the
+  // callbacks which follow it are still invoked, once.
+  //
+  m_trace.ConnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbDisconnect, this));
+  m_trace.ConnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbCount, this));
+  m_trace.ConnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbCount, this));
+  m_count = 0;
+  m_trace (1);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 3, "Callback following a disconnected one not called");
+  m_count = 0;
+  m_trace (1);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 2, "Disconnected callback called");
+  m_trace.DisconnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbCount, this));
+  NS_TEST_ASSERT_MSG_EQ (m_trace.IsEmpty (), true, "Disconnected TracedCallback not empty");
+
+  //
+  // A callback connected after another one disconnected itself, in the
+  // same invocation, is invoked too.
+  //
+  m_connected = false;
+  m_trace.ConnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbDisconnect, this));
+  m_trace.ConnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbConnect, this));
+  m_count = 0;
+  m_trace (1);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 3, "Callback connected after a disconnection not called");
+  m_count = 0;
+  m_trace (1);
+  NS_TEST_ASSERT_MSG_EQ (m_count, 2, "Disconnected callback called");
+  m_trace.DisconnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbConnect, this));
+  m_trace.DisconnectWithoutContext (MakeCallback (&ChainTracedCallbackTestCase::CbCount, this));
+  NS_TEST_ASSERT_MSG_EQ (m_trace.IsEmpty (), true, "Disconnected TracedCallback not empty");
+}
+
 class TracedCallbackTestSuite : public TestSuite
 {
 public:
@@ -123,6 +252,7 @@ TracedCallbackTestSuite::TracedCallbackTestSuite ()
   : TestSuite ("traced-callback", UNIT)
 {
   AddTestCase (new BasicTracedCallbackTestCase, TestCase::QUICK);
+  AddTestCase (new ChainTracedCallbackTestCase, TestCase::QUICK);
 }
 
 static TracedCallbackTestSuite tracedCallbackTestSuite;
@@ -29,6 +29,7 @@
 #include "ns3/boolean.h"
 #include "ns3/uinteger.h"
 #include "ns3/pointer.h"
+#include "ns3/super-segment-tag.h"
 #include "ns3/trace-source-accessor.h"
 #include "csma-net-device.h"
 #include "csma-channel.h"
@@ -505,7 +506,7 @@ CsmaNetDevice::TransmitStart (void)
       //
       // The channel is free, transmit the packet
       //
-      m_phyTxBeginTrace (m_currentPkt);
+      NS_HOT_TRACE (m_phyTxBeginTrace, m_currentPkt);
       if (m_channel->TransmitStart (m_currentPkt, m_deviceId) == false)
         {
           NS_LOG_WARN ("Channel TransmitStart returns an error");
@@ -523,6 +524,13 @@ CsmaNetDevice::TransmitStart (void)
           m_txMachineState = BUSY;
 
           Time tEvent = m_bps.CalculateBytesTxTime (m_currentPkt->GetSize ());
+          SuperSegmentTag superSegment;
+          if (m_currentPkt->PeekPacketTag (superSegment))
+            {
+              // A super-segment is sent as a train of segments
+              tEvent = m_bps.CalculateBytesTxTime (superSegment.GetWireSize (m_currentPkt->GetSize ()))
+                + (superSegment.GetSegments () - 1) * m_tInterframeGap;
+            }
           NS_LOG_LOGIC ("Schedule TransmitCompleteEvent in " << tEvent.As (Time::S));
           Simulator::Schedule (tEvent, &CsmaNetDevice::TransmitCompleteEvent, this);
         }
@@ -598,7 +606,7 @@ CsmaNetDevice::TransmitCompleteEvent (void)
   NS_LOG_LOGIC ("Pkt UID is " << m_currentPkt->GetUid () << ")");
 
   m_channel->TransmitEnd (); 
-  m_phyTxEndTrace (m_currentPkt);
+  NS_HOT_TRACE (m_phyTxEndTrace, m_currentPkt);
   m_currentPkt = 0;
 
   NS_LOG_LOGIC ("Schedule TransmitReadyEvent in " << m_tInterframeGap.As (Time::S));
@@ -702,7 +710,7 @@ CsmaNetDevice::Receive (Ptr<Packet> packet, Ptr<CsmaNetDevice> senderDevice)
   // Hit the trace hook.  This trace will fire on all packets received from the
   // channel except those originated by this device.
   //
-  m_phyRxEndTrace (packet);
+  NS_HOT_TRACE (m_phyRxEndTrace, packet);
 
   // 
   // Only receive if the send side of net device is enabled
@@ -965,7 +973,7 @@ CsmaNetDevice::SendFrom (Ptr<Packet> packet, const Address& src, const Address&
   Mac48Address source = Mac48Address::ConvertFrom (src);
   AddHeader (packet, source, destination, protocolNumber);
 
-  m_macTxTrace (packet);
+  NS_HOT_TRACE (m_macTxTrace, packet);
 
   //
   // Place the packet to be sent on the send queue.  Note that the 
@@ -1048,6 +1056,13 @@ CsmaNetDevice::SupportsSendFrom () const
   return true;
 }
 
+bool
+CsmaNetDevice::SupportsSuperSegments () const
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  return true;
+}
+
 int64_t
 CsmaNetDevice::AssignStreams (int64_t stream)
 {
@@ -19,6 +19,7 @@
  * Author: Faker Moatamri <faker.moatamri@sophia.inria.fr>
  */
 
+#include "ns3/abort.h"
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/object.h"
@@ -777,6 +778,8 @@ InternetStackHelper::EnableAsciiIpv4Internal (
   uint32_t interface,
   bool explicitFilename)
 {
+  NS_ABORT_MSG_IF (stream != 0 && stream->GetTraceFormat () != OutputStreamWrapper::TEXT,
+                   "InternetStackHelper::EnableAsciiIpv4Internal(): only text streams are supported");
   if (!m_ipv4Enabled)
     {
       NS_LOG_INFO ("Call to enable Ipv4 ascii tracing but Ipv4 not enabled");
@@ -1115,6 +1118,8 @@ InternetStackHelper::EnableAsciiIpv6Internal (
   uint32_t interface,
   bool explicitFilename)
 {
+  NS_ABORT_MSG_IF (stream != 0 && stream->GetTraceFormat () != OutputStreamWrapper::TEXT,
+                   "InternetStackHelper::EnableAsciiIpv6Internal(): only text streams are supported");
   if (!m_ipv6Enabled)
     {
       NS_LOG_INFO ("Call to enable Ipv6 ascii tracing but Ipv6 not enabled");
@@ -195,42 +195,40 @@ void
 ArpCache::HandleWaitReplyTimeout (void)
 {
   NS_LOG_FUNCTION (this);
-  ArpCache::Entry* entry;
   bool restartWaitReplyTimer = false;
-  for (CacheI i = m_arpCache.begin (); i != m_arpCache.end (); i++) 
+  std::set<Ipv4Address>::const_iterator i = m_waitReply.begin ();
+  while (i != m_waitReply.end ())
     {
-      entry = (*i).second;
-      if (entry != 0 && entry->IsWaitReply ())
+      // Marking the entry dead removes it from the set
+      ArpCache::Entry* entry = Lookup (*i++);
+      NS_ASSERT (entry != 0 && entry->IsWaitReply ());
+      if (entry->GetRetries () < m_maxRetries)
         {
-          if (entry->GetRetries () < m_maxRetries)
-            {
-              NS_LOG_LOGIC ("node="<< m_device->GetNode ()->GetId () <<
-                            ", ArpWaitTimeout for " << entry->GetIpv4Address () <<
-                            " expired -- retransmitting arp request since retries = " <<
-                            entry->GetRetries ());
-              m_arpRequestCallback (this, entry->GetIpv4Address ());
-              restartWaitReplyTimer = true;
-              entry->IncrementRetries ();
-            }
-          else
+          NS_LOG_LOGIC ("node="<< m_device->GetNode ()->GetId () <<
+                        ", ArpWaitTimeout for " << entry->GetIpv4Address () <<
+                        " expired -- retransmitting arp request since retries = " <<
+                        entry->GetRetries ());
+          m_arpRequestCallback (this, entry->GetIpv4Address ());
+          restartWaitReplyTimer = true;
+          entry->IncrementRetries ();
+        }
+      else
+        {
+          NS_LOG_LOGIC ("node="<<m_device->GetNode ()->GetId () <<
+                        ", wait reply for " << entry->GetIpv4Address () <<
+                        " expired -- drop since max retries exceeded: " <<
+                        entry->GetRetries ());
+          entry->MarkDead ();
+          entry->ClearRetries ();
+          Ipv4PayloadHeaderPair pending = entry->DequeuePending ();
+          while (pending.first != 0)
             {
-              NS_LOG_LOGIC ("node="<<m_device->GetNode ()->GetId () <<
-                            ", wait reply for " << entry->GetIpv4Address () <<
-                            " expired -- drop since max retries exceeded: " <<
-                            entry->GetRetries ());
-              entry->MarkDead ();
-              entry->ClearRetries ();
-              Ipv4PayloadHeaderPair pending = entry->DequeuePending ();
-              while (pending.first != 0)
-                {
-                  // add the Ipv4 header for tracing purposes
-                  pending.first->AddHeader (pending.second);
-                  m_dropTrace (pending.first);
-                  pending = entry->DequeuePending ();
-                }
+              // add the Ipv4 header for tracing purposes
+              pending.first->AddHeader (pending.second);
+              m_dropTrace (pending.first);
+              pending = entry->DequeuePending ();
             }
         }
-
     }
   if (restartWaitReplyTimer)
     {
@@ -244,11 +242,8 @@ void
 ArpCache::Flush (void)
 {
   NS_LOG_FUNCTION (this);
-  for (CacheI i = m_arpCache.begin (); i != m_arpCache.end (); i++) 
-    {
-      delete (*i).second;
-    }
-  m_arpCache.erase (m_arpCache.begin (), m_arpCache.end ());
+  m_arpCache.clear ();
+  m_waitReply.clear ();
   if (m_waitReplyTimer.IsRunning ())
     {
       NS_LOG_LOGIC ("Stopping WaitReplyTimer at " << Simulator::Now ().GetSeconds () << " due to ArpCache flush");
@@ -275,17 +270,17 @@ ArpCache::PrintArpCache (Ptr<OutputStreamWrapper> stream)
           *os << static_cast<int> (m_device->GetIfIndex ());
         }
 
-      *os << " lladdr " << i->second->GetMacAddress ();
+      *os << " lladdr " << i->second.GetMacAddress ();
 
-      if (i->second->IsAlive ())
+      if (i->second.IsAlive ())
         {
           *os << " REACHABLE\n";
         }
-      else if (i->second->IsWaitReply ())
+      else if (i->second.IsWaitReply ())
         {
           *os << " DELAY\n";
         }
-      else if (i->second->IsPermanent ())
+      else if (i->second.IsPermanent ())
 	{
 	  *os << " PERMANENT\n";
 	}
@@ -304,7 +299,7 @@ ArpCache::LookupInverse (Address to)
   std::list<ArpCache::Entry *> entryList;
   for (CacheI i = m_arpCache.begin (); i != m_arpCache.end (); i++)
     {
-      ArpCache::Entry *entry = (*i).second;
+      ArpCache::Entry *entry = &i->second;
       if (entry->GetMacAddress () == to)
         {
           entryList.push_back (entry);
@@ -321,7 +316,7 @@ ArpCache::Lookup (Ipv4Address to)
   CacheI it = m_arpCache.find (to);
   if (it != m_arpCache.end ())
     {
-      return it->second;
+      return &it->second;
     }
   return 0;
 }
@@ -332,8 +327,7 @@ ArpCache::Add (Ipv4Address to)
   NS_LOG_FUNCTION (this << to);
   NS_ASSERT (m_arpCache.find (to) == m_arpCache.end ());
 
-  ArpCache::Entry *entry = new ArpCache::Entry (this);
-  m_arpCache[to] = entry;
+  ArpCache::Entry *entry = &m_arpCache.insert (std::make_pair (to, ArpCache::Entry (this))).first->second;
   entry->SetIpv4Address (to);
   return entry;
 }
@@ -342,16 +336,13 @@ void
 ArpCache::Remove (ArpCache::Entry *entry)
 {
   NS_LOG_FUNCTION (this << entry);
-  
-  for (CacheI i = m_arpCache.begin (); i != m_arpCache.end (); i++)
+
+  CacheI i = m_arpCache.find (entry->GetIpv4Address ());
+  if (i != m_arpCache.end () && &i->second == entry)
     {
-      if ((*i).second == entry)
-        {
-          m_arpCache.erase (i);
-          entry->ClearPendingPacket (); //clear the pending packets for entry's ipaddress
-          delete entry;
-          return;
-        }
+      m_waitReply.erase (i->first);
+      m_arpCache.erase (i);
+      return;
     }
   NS_LOG_WARN ("Entry not found in this ARP Cache");
 }
@@ -396,6 +387,7 @@ ArpCache::Entry::MarkDead (void)
 {
   NS_LOG_FUNCTION (this);
   NS_ASSERT (m_state == ALIVE || m_state == WAIT_REPLY || m_state == DEAD);
+  m_arp->m_waitReply.erase (m_ipv4Address);
   m_state = DEAD;
   ClearRetries ();
   UpdateSeen ();
@@ -405,6 +397,7 @@ ArpCache::Entry::MarkAlive (Address macAddress)
 {
   NS_LOG_FUNCTION (this << macAddress);
   NS_ASSERT (m_state == WAIT_REPLY);
+  m_arp->m_waitReply.erase (m_ipv4Address);
   m_macAddress = macAddress;
   m_state = ALIVE;
   ClearRetries ();
@@ -416,6 +409,7 @@ ArpCache::Entry::MarkPermanent (void)
   NS_LOG_FUNCTION (this << m_macAddress);
   NS_ASSERT (!m_macAddress.IsInvalid ());
 
+  m_arp->m_waitReply.erase (m_ipv4Address);
   m_state = PERMANENT;
   ClearRetries ();
   UpdateSeen ();
@@ -445,6 +439,7 @@ ArpCache::Entry::MarkWaitReply (Ipv4PayloadHeaderPair waiting)
   NS_ASSERT_MSG (waiting.first, "Can not add a null packet to the ARP queue");
 
   m_state = WAIT_REPLY;
+  m_arp->m_waitReply.insert (m_ipv4Address);
   m_pending.push_back (waiting);
   UpdateSeen ();
   m_arp->StartWaitReplyTimer ();
@@ -37,6 +37,7 @@ namespace ns3 {
 const uint32_t SPF_INFINITY = 0xffffffff; //!< "infinite" distance between nodes
 
 class CandidateQueue;
+class Ipv4;
 class Ipv4GlobalRouting;
 
 /**
@@ -674,6 +675,47 @@ public:
    */
   uint32_t GetNumExtLSAs () const;
 
+  /**
+   * @brief Get the number of Link State Advertisements, not counting the
+   * External ones.
+   *
+   * @returns the number of Link State Advertisements.
+   */
+  uint32_t GetNumLSAs () const;
+
+  /**
+   * @brief Create a copy of the database and of its Link State Advertisements.
+   *
+   * SPF calculations mark the LSAs they explore, so that concurrent
+   * calculations must each work on their own copy of the database.
+   *
+   * @returns a new database, to be deleted by the caller.
+   */
+  GlobalRouteManagerLSDB* Copy () const;
+
+  /**
+   * @brief Find the Link State Advertisements which differ from those of
+   * another database.
+   *
+   * @param [in] other the other database
+   * @param [out] changed the sorted link state IDs of the LSAs whose
+   * content differs between the two databases
+   * @returns false if the two databases do not hold the same link state IDs
+   * or the same External Link State Advertisements, in which case changed
+   * is not filled
+   */
+  bool Compare (const GlobalRouteManagerLSDB& other,
+                std::vector<Ipv4Address>& changed) const;
+
+  /**
+   * @brief Get the link state IDs of the Link State Advertisements returned
+   * by GetLSA () and GetLSAByLinkData () since the last call to Initialize ().
+   *
+   * These are the LSAs an SPF calculation depends on.
+   *
+   * @returns the link state IDs, in lookup order and possibly repeated.
+   */
+  const std::vector<Ipv4Address>& GetLookups () const;
 
 private:
   typedef std::map<Ipv4Address, GlobalRoutingLSA*> LSDBMap_t; //!< container of IPv4 addresses / Link State Advertisements
@@ -681,6 +723,9 @@ private:
 
   LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
   std::vector<GlobalRoutingLSA*> m_extdatabase; //!< database of External Link State Advertisements
+  /// the first entry of m_database with a TransitNetwork link record, for each link data
+  std::map<Ipv4Address, LSDBMap_t::const_iterator> m_linkDataIndex;
+  mutable std::vector<Ipv4Address> m_lookups; //!< the link state IDs of the LSAs looked up since Initialize ()
 
 /**
  * @brief GlobalRouteManagerLSDB copy construction is disallowed.  There's no 
@@ -718,6 +763,10 @@ public:
  * @brief Delete all static routes on all nodes that have a
  * GlobalRouterInterface
  *
+ * When the "GlobalRoutingIncremental" global value is true, the routes are
+ * kept, as well as the LSDB, which InitializeRoutes () compares with the
+ * next one to find the routes to recompute.
+ *
  * \todo  separate manually assigned static routes from static routes that
  * the global routing code injects, and only delete the latter
  */
@@ -746,7 +795,27 @@ public:
  */
   void DebugSPFCalculate (Ipv4Address root);
 
+/**
+ * @brief Debugging routine; get the number of SPF calculations run by the
+ * last call to InitializeRoutes ()
+ * @returns the number of SPF calculations
+ */
+  uint32_t DebugGetNSPFCalculations (void) const;
+
 private:
+  /**
+   * @brief The router at the root of an SPF calculation, whose routing
+   * table is populated by the calculation.
+   */
+  struct SPFRoot
+  {
+    Ipv4Address routerId;            //!< the router ID
+    Ptr<Ipv4> ipv4;                  //!< the Ipv4 of the node, 0 if no node has this router ID
+    Ptr<Ipv4GlobalRouting> routing;  //!< the routing protocol of the node, 0 if no node has this router ID
+  };
+  /// The sorted link state IDs of the LSAs an SPF calculation depends on, empty for all the LSAs
+  typedef std::vector<Ipv4Address> SPFDependencies;
+
 /**
  * @brief GlobalRouteManagerImpl copy construction is disallowed.
  * There's no  need for it and a compiler provided shallow copy would be 
@@ -767,7 +836,57 @@ private:
   GlobalRouteManagerImpl& operator= (GlobalRouteManagerImpl& srmi);
 
   SPFVertex* m_spfroot; //!< the root node
+  Ptr<Ipv4> m_spfrootIpv4; //!< the Ipv4 of the node at the root of the SPF tree
+  Ptr<Ipv4GlobalRouting> m_spfrootRouting; //!< the routing protocol of the node at the root of the SPF tree
   GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
+  GlobalRouteManagerLSDB* m_previousLsdb; //!< the LSDB of the previous calculation, in incremental mode
+  /// the dependencies of the last SPF calculation of each root, in incremental mode
+  std::map<Ipv4Address, SPFDependencies> m_spfDependencies;
+  uint32_t m_nSpfCalculations; //!< the number of SPF calculations run by the last InitializeRoutes ()
+
+  /**
+   * \brief Find the node with a given router ID.
+   *
+   * \param routerId the router ID
+   * \returns the root of an SPF calculation for this router
+   */
+  SPFRoot GetSPFRoot (Ipv4Address routerId) const;
+
+  /**
+   * \brief Run the SPF calculations of several roots.
+   *
+   * The calculations are shared among the number of threads set by the
+   * "GlobalRoutingThreads" global value, each working on its own copy of
+   * the LSDB, and only writing to the routing table of its current root.
+   *
+   * \param [in] roots the roots
+   * \param [out] dependencies the dependencies of the calculation of each
+   * root, not recorded if 0
+   */
+  void SPFCalculate (const std::vector<SPFRoot>& roots,
+                     std::vector<SPFDependencies>* dependencies);
+
+  /**
+   * \brief Get the dependencies of the last SPF calculation.
+   *
+   * \returns the sorted link state IDs of the LSAs looked up by the
+   * calculation, or an empty list, standing for all the LSAs, when they
+   * cover a large part of the LSDB
+   */
+  SPFDependencies GetSPFDependencies (void) const;
+
+  /**
+   * \brief Remove the routes of all the nodes that have a GlobalRouter
+   * interface.
+   */
+  void RemoveRoutes (void);
+
+  /**
+   * \brief Remove all the routes of a routing protocol.
+   *
+   * \param routing the routing protocol
+   */
+  void RemoveRoutes (Ptr<Ipv4GlobalRouting> routing);
 
   /**
    * \brief Test if a node is a stub, from an OSPF sense.
@@ -787,7 +906,7 @@ private:
    * Equivalent to quagga ospf_spf_calculate
    * \param root the root node
    */
-  void SPFCalculate (Ipv4Address root);
+  void SPFCalculate (const SPFRoot& root);
 
   /**
    * \brief Process Stub nodes
@@ -23,6 +23,8 @@
 
 #include <stdint.h>
 #include <list>
+#include <unordered_map>
+#include <vector>
 #include "ns3/ipv4-address.h"
 #include "ipv4-interface.h"
 
@@ -40,6 +42,10 @@ class Ipv4EndPoint;
  * of endpoints, and has APIs to add and find endpoints in this demux.  This
  * code is shared in common to TCP and UDP protocols in ns3.  This demux
  * sits between ns3's layer four and the socket layer
+ *
+ * The endpoints are also indexed by local port and peer, so that a lookup
+ * only looks at the endpoints connected to the source of a packet and at
+ * the ones accepting any peer, whatever the number of sockets.
  */
 
 class Ipv4EndPointDemux {
@@ -192,6 +198,103 @@ private:
    * \brief A list of IPv4 end points.
    */
   EndPoints m_endPoints;
+
+  friend class Ipv4EndPoint;
+
+  /**
+   * \brief Add an end point to the list and to the indexes.
+   * \param endPoint the end point
+   */
+  void Add (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Add an end point to the indexes, with its current local port
+   * and peer.
+   * \param endPoint the end point
+   */
+  void Index (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Remove an end point from the indexes, before its local port or
+   * peer change.
+   * \param endPoint the end point
+   */
+  void Unindex (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Check how an end point matches a packet, and add it to the
+   * corresponding lists of Lookup.
+   * \param endP the end point
+   * \param daddr destination address
+   * \param dport destination port
+   * \param saddr source address
+   * \param sport source port
+   * \param incomingInterface the incoming interface
+   * \param retval1 the end points matching the local port only
+   * \param retval2 the end points matching the local port and address
+   * \param retval3 the end points matching all but the local address
+   * \param retval4 the end points matching all 4
+   */
+  void Match (Ipv4EndPoint *endP,
+              Ipv4Address daddr, uint16_t dport,
+              Ipv4Address saddr, uint16_t sport,
+              Ptr<Ipv4Interface> incomingInterface,
+              EndPoints &retval1, EndPoints &retval2,
+              EndPoints &retval3, EndPoints &retval4);
+
+  /**
+   * \brief The local port and peer of end points.
+   *
+   * An end point only matches the packets from a given peer if it is
+   * connected to it, or if it accepts any peer.
+   */
+  struct PeerKey
+  {
+    uint16_t localPort;       //!< the local port
+    Ipv4Address peerAddress; //!< the peer address
+    uint16_t peerPort;        //!< the peer port
+
+    /**
+     * \brief Comparison operator.
+     * \param other the other key
+     * \return true if the keys are equal
+     */
+    bool operator== (const PeerKey &other) const
+    {
+      return localPort == other.localPort && peerPort == other.peerPort
+             && peerAddress == other.peerAddress;
+    }
+  };
+
+  /**
+   * \brief Hash function of PeerKey.
+   */
+  struct PeerKeyHash
+  {
+    /**
+     * \param key the key
+     * \return the hash of the key
+     */
+    size_t operator() (const PeerKey &key) const
+    {
+      return Ipv4AddressHash () (key.peerAddress) ^ (key.localPort << 16 | key.peerPort);
+    }
+  };
+
+  /**
+   * \brief The end points, by local port and peer.
+   */
+  std::unordered_map<PeerKey, std::vector<Ipv4EndPoint *>, PeerKeyHash> m_peerIndex;
+
+  /**
+   * \brief The number of end points using each local port.
+   */
+  std::unordered_map<uint16_t, uint32_t> m_localPorts;
+
+  /**
+   * \brief The position of each end point in the list.
+   */
+  std::unordered_map<Ipv4EndPoint *, EndPointsI> m_positions;
 };
 
 } // namespace ns3
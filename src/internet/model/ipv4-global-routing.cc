@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <iomanip>
+#include <algorithm>
 #include "ns3/names.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -30,6 +31,7 @@
 #include "ns3/node.h"
 #include "ipv4-global-routing.h"
 #include "global-route-manager.h"
+#include "ipv4-l3-protocol.h"
 
 namespace ns3 {
 
@@ -59,7 +61,8 @@ Ipv4GlobalRouting::GetTypeId (void)
 
 Ipv4GlobalRouting::Ipv4GlobalRouting () 
   : m_randomEcmpRouting (false),
-    m_respondToInterfaceEvents (false)
+    m_respondToInterfaceEvents (false),
+    m_forwardingTablesValid (false)
 {
   NS_LOG_FUNCTION (this);
 
@@ -80,6 +83,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, nextHop, interface);
   m_hostRoutes.push_back (route);
+  InvalidateForwardingTables ();
 }
 
 void 
@@ -90,6 +94,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, interface);
   m_hostRoutes.push_back (route);
+  InvalidateForwardingTables ();
 }
 
 void 
@@ -105,6 +110,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         nextHop,
                                                         interface);
   m_networkRoutes.push_back (route);
+  InvalidateForwardingTables ();
 }
 
 void 
@@ -118,6 +124,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         networkMask,
                                                         interface);
   m_networkRoutes.push_back (route);
+  InvalidateForwardingTables ();
 }
 
 void 
@@ -133,9 +140,52 @@ Ipv4GlobalRouting::AddASExternalRouteTo (Ipv4Address network,
                                                         nextHop,
                                                         interface);
   m_ASexternalRoutes.push_back (route);
+  InvalidateForwardingTables ();
 }
 
 
+void
+Ipv4GlobalRouting::InvalidateForwardingTables (void)
+{
+  m_forwardingTablesValid = false;
+  Ptr<Ipv4L3Protocol> ipv4 = DynamicCast<Ipv4L3Protocol> (m_ipv4);
+  if (ipv4 != 0)
+    {
+      ipv4->FlushFlowCache ();
+    }
+}
+
+void
+Ipv4GlobalRouting::UpdateForwardingTables (void)
+{
+  if (m_forwardingTablesValid)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  uint8_t buf[4];
+  m_hostTable.clear ();
+  for (HostRoutesCI i = m_hostRoutes.begin (); i != m_hostRoutes.end (); i++)
+    {
+      m_hostTable[(*i)->GetDest ().Get ()].push_back (*i);
+    }
+  m_networkTable.assign (m_networkRoutes.begin (), m_networkRoutes.end ());
+  m_networkTrie.Clear ();
+  for (uint32_t j = 0; j < m_networkTable.size (); j++)
+    {
+      m_networkTable[j]->GetDestNetwork ().Serialize (buf);
+      m_networkTrie.Insert (buf, m_networkTable[j]->GetDestNetworkMask ().GetPrefixLength (), j);
+    }
+  m_externalTable.assign (m_ASexternalRoutes.begin (), m_ASexternalRoutes.end ());
+  m_externalTrie.Clear ();
+  for (uint32_t k = 0; k < m_externalTable.size (); k++)
+    {
+      m_externalTable[k]->GetDestNetwork ().Serialize (buf);
+      m_externalTrie.Insert (buf, m_externalTable[k]->GetDestNetworkMask ().GetPrefixLength (), k);
+    }
+  m_forwardingTablesValid = true;
+}
+
 Ptr<Ipv4Route>
 Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
 {
@@ -146,14 +196,14 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
   typedef std::vector<Ipv4RoutingTableEntry*> RouteVec_t;
   RouteVec_t allRoutes;
 
+  UpdateForwardingTables ();
   NS_LOG_LOGIC ("Number of m_hostRoutes = " << m_hostRoutes.size ());
-  for (HostRoutesCI i = m_hostRoutes.begin (); 
-       i != m_hostRoutes.end (); 
-       i++) 
+  std::unordered_map<uint32_t, RouteVec_t>::const_iterator hosts = m_hostTable.find (dest.Get ());
+  if (hosts != m_hostTable.end ())
     {
-      NS_ASSERT ((*i)->IsHost ());
-      if ((*i)->GetDest () == dest)
+      for (RouteVec_t::const_iterator i = hosts->second.begin (); i != hosts->second.end (); i++)
         {
+          NS_ASSERT ((*i)->IsHost ());
           if (oif != 0)
             {
               if (oif != m_ipv4->GetNetDevice ((*i)->GetInterface ()))
@@ -163,56 +213,70 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
                 }
             }
           allRoutes.push_back (*i);
-          NS_LOG_LOGIC (allRoutes.size () << "Found global host route" << *i); 
+          NS_LOG_LOGIC (allRoutes.size () << "Found global host route" << *i);
         }
     }
+  uint8_t buf[4];
+  dest.Serialize (buf);
   if (allRoutes.size () == 0) // if no host route is found
     {
       NS_LOG_LOGIC ("Number of m_networkRoutes" << m_networkRoutes.size ());
-      for (NetworkRoutesI j = m_networkRoutes.begin (); 
-           j != m_networkRoutes.end (); 
-           j++) 
+      // All the matching network routes are candidates, whatever their
+      // prefix length, in routing table order
+      m_networkTrie.Lookup (buf, 32, m_matches);
+      std::vector<uint32_t> indexes;
+      for (PrefixTrie::Matches::const_iterator m = m_matches.begin (); m != m_matches.end (); m++)
+        {
+          indexes.insert (indexes.end (), (*m)->begin (), (*m)->end ());
+        }
+      if (m_matches.size () > 1)
         {
-          Ipv4Mask mask = (*j)->GetDestNetworkMask ();
-          Ipv4Address entry = (*j)->GetDestNetwork ();
-          if (mask.IsMatch (dest, entry)) 
+          std::sort (indexes.begin (), indexes.end ());
+        }
+      for (std::vector<uint32_t>::const_iterator j = indexes.begin (); j != indexes.end (); j++)
+        {
+          Ipv4RoutingTableEntry *route = m_networkTable[*j];
+          if (oif != 0)
             {
-              if (oif != 0)
+              if (oif != m_ipv4->GetNetDevice (route->GetInterface ()))
                 {
-                  if (oif != m_ipv4->GetNetDevice ((*j)->GetInterface ()))
-                    {
-                      NS_LOG_LOGIC ("Not on requested interface, skipping");
-                      continue;
-                    }
+                  NS_LOG_LOGIC ("Not on requested interface, skipping");
+                  continue;
                 }
-              allRoutes.push_back (*j);
-              NS_LOG_LOGIC (allRoutes.size () << "Found global network route" << *j);
             }
+          allRoutes.push_back (route);
+          NS_LOG_LOGIC (allRoutes.size () << "Found global network route" << route);
         }
     }
   if (allRoutes.size () == 0)  // consider external if no host/network found
     {
-      for (ASExternalRoutesI k = m_ASexternalRoutes.begin ();
-           k != m_ASexternalRoutes.end ();
-           k++)
+      // The first matching external route in routing table order
+      m_externalTrie.Lookup (buf, 32, m_matches);
+      Ipv4RoutingTableEntry *external = 0;
+      uint32_t first = m_externalTable.size ();
+      for (PrefixTrie::Matches::const_iterator m = m_matches.begin (); m != m_matches.end (); m++)
         {
-          Ipv4Mask mask = (*k)->GetDestNetworkMask ();
-          Ipv4Address entry = (*k)->GetDestNetwork ();
-          if (mask.IsMatch (dest, entry))
+          for (PrefixTrie::Values::const_iterator k = (*m)->begin (); k != (*m)->end () && *k < first; k++)
             {
-              NS_LOG_LOGIC ("Found external route" << *k);
+              Ipv4RoutingTableEntry *route = m_externalTable[*k];
+              NS_LOG_LOGIC ("Found external route" << route);
               if (oif != 0)
                 {
-                  if (oif != m_ipv4->GetNetDevice ((*k)->GetInterface ()))
+                  if (oif != m_ipv4->GetNetDevice (route->GetInterface ()))
                     {
                       NS_LOG_LOGIC ("Not on requested interface, skipping");
                       continue;
                     }
                 }
-              allRoutes.push_back (*k);
+              external = route;
+              first = *k;
               break;
             }
         }
+      if (external != 0)
+        {
+          allRoutes.push_back (external);
+        }
     }
   if (allRoutes.size () > 0 ) // if route(s) is found
     {
@@ -321,6 +385,7 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
               NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_hostRoutes.size ());
               delete *i;
               m_hostRoutes.erase (i);
+              InvalidateForwardingTables ();
               NS_LOG_LOGIC ("Done removing host route " << index << "; host route remaining size = " << m_hostRoutes.size ());
               return;
             }
@@ -338,6 +403,7 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
           NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_networkRoutes.size ());
           delete *j;
           m_networkRoutes.erase (j);
+          InvalidateForwardingTables ();
           NS_LOG_LOGIC ("Done removing network route " << index << "; network route remaining size = " << m_networkRoutes.size ());
           return;
         }
@@ -354,6 +420,7 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
           NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_ASexternalRoutes.size ());
           delete *k;
           m_ASexternalRoutes.erase (k);
+          InvalidateForwardingTables ();
           NS_LOG_LOGIC ("Done removing network route " << index << "; network route remaining size = " << m_networkRoutes.size ());
           return;
         }
@@ -392,6 +459,12 @@ Ipv4GlobalRouting::DoDispose (void)
     {
       delete (*l);
     }
+  m_forwardingTablesValid = false;
+  m_hostTable.clear ();
+  m_networkTable.clear ();
+  m_networkTrie.Clear ();
+  m_externalTable.clear ();
+  m_externalTrie.Clear ();
 
   Ipv4RoutingProtocol::DoDispose ();
 }
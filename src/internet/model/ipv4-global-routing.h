@@ -21,6 +21,8 @@
 #define IPV4_GLOBAL_ROUTING_H
 
 #include <list>
+#include <vector>
+#include <unordered_map>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
@@ -28,6 +30,7 @@
 #include "ns3/ipv4.h"
 #include "ns3/ipv4-routing-protocol.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/prefix-trie.h"
 
 namespace ns3 {
 
@@ -268,10 +271,37 @@ private:
    */
   Ptr<Ipv4Route> LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif = 0);
 
+  /**
+   * \brief Rebuild the forwarding tables from the routes, if a route was
+   * added or removed since they were last built.
+   */
+  void UpdateForwardingTables (void);
+
+  /**
+   * \brief Mark the forwarding tables to be rebuilt, and flush the
+   * routes cached by IPv4 for the forwarded flows.
+   *
+   * This is called from the threads of the SPF calculations of the
+   * GlobalRouteManager, which only touch the objects of the node whose
+   * routes they calculate: the flush must not use the state of other
+   * nodes.
+   */
+  void InvalidateForwardingTables (void);
+
   HostRoutes m_hostRoutes;             //!< Routes to hosts
   NetworkRoutes m_networkRoutes;       //!< Routes to networks
   ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
+  /// Set to false when the routes change, to rebuild the forwarding tables
+  bool m_forwardingTablesValid;
+  /// Routes to each host, in routing table order
+  std::unordered_map<uint32_t, std::vector<Ipv4RoutingTableEntry *> > m_hostTable;
+  std::vector<Ipv4RoutingTableEntry *> m_networkTable;  //!< Routes to networks, in routing table order
+  PrefixTrie m_networkTrie;                             //!< Indexes in m_networkTable of the routes to each network
+  std::vector<Ipv4RoutingTableEntry *> m_externalTable; //!< External routes, in routing table order
+  PrefixTrie m_externalTrie;                            //!< Indexes in m_externalTable of the external routes to each network
+  PrefixTrie::Matches m_matches;                        //!< Prefixes matched by the last lookup
+
   Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
 
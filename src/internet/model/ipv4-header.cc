@@ -41,10 +41,48 @@ Ipv4Header::Ipv4Header ()
     m_fragmentOffset (0),
     m_checksum (0),
     m_goodChecksum (true),
+    m_checksumUpdated (false),
     m_headerSize(5*4)
 {
 }
 
+/**
+ * \brief Update a checksum for the change of a 16-bit word (RFC 1624, eqn. 3).
+ * \param checksum the checksum
+ * \param oldWord the old value of the word
+ * \param newWord the new value of the word
+ * \return the updated checksum
+ */
+static uint16_t
+UpdateChecksum (uint16_t checksum, uint16_t oldWord, uint16_t newWord)
+{
+  uint32_t sum = static_cast<uint16_t> (~checksum);
+  sum += static_cast<uint16_t> (~oldWord);
+  sum += newWord;
+  sum = (sum & 0xffff) + (sum >> 16);
+  sum = (sum & 0xffff) + (sum >> 16);
+  return ~sum;
+}
+
+/**
+ * \brief Update a checksum for the change of an address.
+ * \param checksum the checksum
+ * \param oldAddress the old address
+ * \param newAddress the new address
+ * \return the updated checksum
+ */
+static uint16_t
+UpdateChecksum (uint16_t checksum, Ipv4Address oldAddress, Ipv4Address newAddress)
+{
+  // The checksum words are read as Buffer::Iterator::ReadU16 does
+  uint32_t o = oldAddress.Get ();
+  uint32_t n = newAddress.Get ();
+  checksum = UpdateChecksum (checksum, ((o >> 24) & 0xff) | ((o >> 8) & 0xff00),
+                             ((n >> 24) & 0xff) | ((n >> 8) & 0xff00));
+  return UpdateChecksum (checksum, ((o >> 8) & 0xff) | ((o << 8) & 0xff00),
+                         ((n >> 8) & 0xff) | ((n << 8) & 0xff00));
+}
+
 void
 Ipv4Header::EnableChecksum (void)
 {
@@ -57,6 +95,7 @@ Ipv4Header::SetPayloadSize (uint16_t size)
 {
   NS_LOG_FUNCTION (this << size);
   m_payloadSize = size;
+  m_checksumUpdated = false;
 }
 uint16_t
 Ipv4Header::GetPayloadSize (void) const
@@ -76,6 +115,7 @@ Ipv4Header::SetIdentification (uint16_t identification)
 {
   NS_LOG_FUNCTION (this << identification);
   m_identification = identification;
+  m_checksumUpdated = false;
 }
 
 void 
@@ -83,6 +123,7 @@ Ipv4Header::SetTos (uint8_t tos)
 {
   NS_LOG_FUNCTION (this << static_cast<uint32_t> (tos));
   m_tos = tos;
+  m_checksumUpdated = false;
 }
 
 void
@@ -91,6 +132,7 @@ Ipv4Header::SetDscp (DscpType dscp)
   NS_LOG_FUNCTION (this << dscp);
   m_tos &= 0x3; // Clear out the DSCP part, retain 2 bits of ECN
   m_tos |= (dscp << 2);
+  m_checksumUpdated = false;
 }
 
 void
@@ -99,6 +141,7 @@ Ipv4Header::SetEcn (EcnType ecn)
   NS_LOG_FUNCTION (this << ecn);
   m_tos &= 0xFC; // Clear out the ECN part, retain 6 bits of DSCP
   m_tos |= ecn;
+  m_checksumUpdated = false;
 }
 
 Ipv4Header::DscpType 
@@ -201,12 +244,14 @@ Ipv4Header::SetMoreFragments (void)
 {
   NS_LOG_FUNCTION (this);
   m_flags |= MORE_FRAGMENTS;
+  m_checksumUpdated = false;
 }
 void
 Ipv4Header::SetLastFragment (void)
 {
   NS_LOG_FUNCTION (this);
   m_flags &= ~MORE_FRAGMENTS;
+  m_checksumUpdated = false;
 }
 bool 
 Ipv4Header::IsLastFragment (void) const
@@ -220,12 +265,14 @@ Ipv4Header::SetDontFragment (void)
 {
   NS_LOG_FUNCTION (this);
   m_flags |= DONT_FRAGMENT;
+  m_checksumUpdated = false;
 }
 void 
 Ipv4Header::SetMayFragment (void)
 {
   NS_LOG_FUNCTION (this);
   m_flags &= ~DONT_FRAGMENT;
+  m_checksumUpdated = false;
 }
 bool 
 Ipv4Header::IsDontFragment (void) const
@@ -241,6 +288,7 @@ Ipv4Header::SetFragmentOffset (uint16_t offsetBytes)
   // check if the user is trying to set an invalid offset
   NS_ABORT_MSG_IF ((offsetBytes & 0x7), "offsetBytes must be multiple of 8 bytes");
   m_fragmentOffset = offsetBytes;
+  m_checksumUpdated = false;
 }
 uint16_t 
 Ipv4Header::GetFragmentOffset (void) const
@@ -259,6 +307,11 @@ void
 Ipv4Header::SetTtl (uint8_t ttl)
 {
   NS_LOG_FUNCTION (this << static_cast<uint32_t> (ttl));
+  if (m_checksumUpdated)
+    {
+      // The TTL is the first byte of a word, the protocol the second one
+      m_checksum = UpdateChecksum (m_checksum, m_ttl | (m_protocol << 8), ttl | (m_protocol << 8));
+    }
   m_ttl = ttl;
 }
 uint8_t 
@@ -279,12 +332,17 @@ Ipv4Header::SetProtocol (uint8_t protocol)
 {
   NS_LOG_FUNCTION (this << static_cast<uint32_t> (protocol));
   m_protocol = protocol;
+  m_checksumUpdated = false;
 }
 
 void 
 Ipv4Header::SetSource (Ipv4Address source)
 {
   NS_LOG_FUNCTION (this << source);
+  if (m_checksumUpdated)
+    {
+      m_checksum = UpdateChecksum (m_checksum, m_source, source);
+    }
   m_source = source;
 }
 Ipv4Address
@@ -298,6 +356,10 @@ void
 Ipv4Header::SetDestination (Ipv4Address dst)
 {
   NS_LOG_FUNCTION (this << dst);
+  if (m_checksumUpdated)
+    {
+      m_checksum = UpdateChecksum (m_checksum, m_destination, dst);
+    }
   m_destination = dst;
 }
 Ipv4Address
@@ -409,7 +471,14 @@ Ipv4Header::Serialize (Buffer::Iterator start) const
   i.WriteHtonU32 (m_source.Get ());
   i.WriteHtonU32 (m_destination.Get ());
 
-  if (m_calcChecksum) 
+  if (m_calcChecksum && m_checksumUpdated)
+    {
+      NS_LOG_LOGIC ("updated checksum=" << m_checksum);
+      i = start;
+      i.Next (10);
+      i.WriteU16 (m_checksum);
+    }
+  else if (m_calcChecksum)
     {
       i = start;
       uint16_t checksum = i.CalculateIpChecksum (20);
@@ -470,6 +539,9 @@ Ipv4Header::Deserialize (Buffer::Iterator start)
 
       m_goodChecksum = (checksum == 0);
     }
+  // A header without options is serialized as it was received: its checksum
+  // can be updated as the fields change, rather than computed again.
+  m_checksumUpdated = m_calcChecksum && m_goodChecksum && headerSize == 5*4;
   return GetSerializedSize ();
 }
 
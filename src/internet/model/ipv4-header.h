@@ -259,6 +259,7 @@ private:
   Ipv4Address m_destination; //!< destination address
   uint16_t m_checksum; //!< checksum
   bool m_goodChecksum; //!< true if checksum is correct
+  bool m_checksumUpdated; //!< true if the checksum is updated with the fields, as in RFC 1624
   uint16_t m_headerSize; //!< IP header size
 };
 
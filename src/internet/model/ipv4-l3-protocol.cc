@@ -35,12 +35,14 @@
 #include "ns3/boolean.h"
 #include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/traffic-control-layer.h"
+#include "ns3/super-segment-tag.h"
 
 #include "loopback-net-device.h"
 #include "arp-l3-protocol.h"
 #include "arp-cache.h"
 #include "ipv4-l3-protocol.h"
 #include "icmpv4-l4-protocol.h"
+#include "tcp-l4-protocol.h"
 #include "ipv4-interface.h"
 #include "ipv4-raw-socket-impl.h"
 
@@ -86,6 +88,20 @@ Ipv4L3Protocol::GetTypeId (void)
                    TimeValue (Seconds (1)),
                    MakeTimeAccessor (&Ipv4L3Protocol::m_purge),
                    MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("FlowCacheTimeout",
+                   "Lifetime of the routes cached for the forwarded flows, "
+                   "0 means that the routes are not cached.  The routing "
+                   "protocols which do not flush the cache when their routes "
+                   "change, e.g., OLSR or AODV, only update the route of a "
+                   "flow when it expires",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&Ipv4L3Protocol::m_flowCacheTimeout),
+                   MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("FlowCacheSize",
+                   "Maximum number of routes cached for the forwarded flows",
+                   UintegerValue (1024),
+                   MakeUintegerAccessor (&Ipv4L3Protocol::m_flowCacheSize),
+                   MakeUintegerChecker<uint32_t> (1))
     .AddTraceSource ("Tx",
                      "Send ipv4 packet to outgoing interface.",
                      MakeTraceSourceAccessor (&Ipv4L3Protocol::m_txTrace),
@@ -130,6 +146,7 @@ Ipv4L3Protocol::GetTypeId (void)
 }
 
 Ipv4L3Protocol::Ipv4L3Protocol()
+  : m_flowCacheInterface (-1)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -293,6 +310,7 @@ Ipv4L3Protocol::SetRoutingProtocol (Ptr<Ipv4RoutingProtocol> routingProtocol)
   NS_LOG_FUNCTION (this << routingProtocol);
   m_routingProtocol = routingProtocol;
   m_routingProtocol->SetIpv4 (this);
+  FlushFlowCache ();
 }
 
 
@@ -323,6 +341,7 @@ Ipv4L3Protocol::DoDispose (void)
   m_sockets.clear ();
   m_node = 0;
   m_routingProtocol = 0;
+  m_flowCache.clear ();
 
   for (MapFragments_t::iterator it = m_fragments.begin (); it != m_fragments.end (); it++)
     {
@@ -660,6 +679,26 @@ Ipv4L3Protocol::Receive ( Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t p
       return;
     }
 
+  // Packets with a nix-vector are routed with it, hop by hop
+  if (!m_flowCacheTimeout.IsZero () && !packet->GetNixVector ())
+    {
+      FlowCache_t::iterator it = m_flowCache.find (GetFlowCacheKey (interface, ipHeader));
+      if (it != m_flowCache.end ())
+        {
+          if (it->second.expiration > Simulator::Now ())
+            {
+              NS_LOG_LOGIC ("Forwarding with the cached route of the flow");
+              m_flowCacheLru.splice (m_flowCacheLru.begin (), m_flowCacheLru, it->second.lru);
+              IpForward (it->second.route, packet, ipHeader);
+              return;
+            }
+          m_flowCacheLru.erase (it->second.lru);
+          m_flowCache.erase (it);
+        }
+      // The route given to IpForward during the routing is cached
+      m_flowCacheInterface = interface;
+    }
+
   NS_ASSERT_MSG (m_routingProtocol != 0, "Need a routing protocol object to process packets");
   if (!m_routingProtocol->RouteInput (packet, ipHeader, device,
                                       MakeCallback (&Ipv4L3Protocol::IpForward, this),
@@ -671,6 +710,24 @@ Ipv4L3Protocol::Receive ( Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t p
       NS_LOG_WARN ("No route found for forwarding packet.  Drop.");
       m_dropTrace (ipHeader, packet, DROP_NO_ROUTE, m_node->GetObject<Ipv4> (), interface);
     }
+  m_flowCacheInterface = -1;
+}
+
+Ipv4L3Protocol::FlowCacheKey_t
+Ipv4L3Protocol::GetFlowCacheKey (uint32_t iif, const Ipv4Header &header) const
+{
+  uint64_t addresses = (static_cast<uint64_t> (header.GetSource ().Get ()) << 32)
+    | header.GetDestination ().Get ();
+  uint32_t other = (iif << 16) | (header.GetProtocol () << 8) | header.GetTos ();
+  return std::make_pair (addresses, other);
+}
+
+void
+Ipv4L3Protocol::FlushFlowCache (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_flowCache.clear ();
+  m_flowCacheLru.clear ();
 }
 
 Ptr<Icmpv4L4Protocol> 
@@ -989,7 +1046,31 @@ Ipv4L3Protocol::SendRealOut (Ptr<Ipv4Route> route,
   if (outInterface->IsUp ())
     {
       NS_LOG_LOGIC ("Send to " << targetLabel << " " << target);
-      if ( packet->GetSize () + ipHeader.GetSerializedSize () > outInterface->GetDevice ()->GetMtu () )
+      SuperSegmentTag superSegment;
+      bool isSuperSegment = packet->PeekPacketTag (superSegment);
+      if (isSuperSegment && !outDev->SupportsSuperSegments ())
+        {
+          // The device does not send super-segments as a train of
+          // segments, so send the segments one by one
+          if (ipHeader.GetProtocol () == TcpL4Protocol::PROT_NUMBER)
+            {
+              NS_LOG_LOGIC ("Splitting a super-segment of " << superSegment.GetSegments () << " segments");
+              std::vector<Ptr<Packet> > segments =
+                TcpL4Protocol::SplitSuperSegment (packet, ipHeader.GetSource (), ipHeader.GetDestination ());
+              for (std::vector<Ptr<Packet> >::const_iterator it = segments.begin (); it != segments.end (); it++)
+                {
+                  Ipv4Header segmentHeader = ipHeader;
+                  segmentHeader.SetPayloadSize ((*it)->GetSize ());
+                  SendRealOut (route, *it, segmentHeader);
+                }
+              return;
+            }
+          packet->RemovePacketTag (superSegment);
+          isSuperSegment = false;
+        }
+      // Super-segments are sent as a train of segments by the device
+      if ( packet->GetSize () + ipHeader.GetSerializedSize () > outInterface->GetDevice ()->GetMtu ()
+           && !isSuperSegment )
         {
           std::list<Ipv4PayloadHeaderPair> listFragments;
           DoFragmentation (packet, ipHeader, outInterface->GetDevice ()->GetMtu (), listFragments);
@@ -1051,6 +1132,28 @@ Ipv4L3Protocol::IpForward (Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ip
 {
   NS_LOG_FUNCTION (this << rtentry << p << header);
   NS_LOG_LOGIC ("Forwarding logic for node: " << m_node->GetId ());
+  if (m_flowCacheInterface >= 0)
+    {
+      // The flow is not in the cache (IpReceive removed it if it had
+      // expired): when the cache is full, the least recently used flows
+      // make room for it
+      while (!m_flowCacheLru.empty () && m_flowCache.size () >= m_flowCacheSize)
+        {
+          m_flowCache.erase (m_flowCacheLru.back ());
+          m_flowCacheLru.pop_back ();
+        }
+      if (m_flowCacheSize > 0)
+        {
+          FlowCacheKey_t key = GetFlowCacheKey (m_flowCacheInterface, header);
+          NS_ASSERT (m_flowCache.find (key) == m_flowCache.end ());
+          m_flowCacheLru.push_front (key);
+          FlowCacheEntry &entry = m_flowCache[key];
+          entry.route = rtentry;
+          entry.expiration = Simulator::Now () + m_flowCacheTimeout;
+          entry.lru = m_flowCacheLru.begin ();
+        }
+      m_flowCacheInterface = -1;
+    }
   // Forwarding
   Ipv4Header ipHeader = header;
   Ptr<Packet> packet = p->Copy ();
@@ -1153,6 +1256,7 @@ Ipv4L3Protocol::AddAddress (uint32_t i, Ipv4InterfaceAddress address)
   NS_LOG_FUNCTION (this << i << address);
   Ptr<Ipv4Interface> interface = GetInterface (i);
   bool retVal = interface->AddAddress (address);
+  FlushFlowCache ();
   if (m_routingProtocol != 0)
     {
       m_routingProtocol->NotifyAddAddress (i, address);
@@ -1184,6 +1288,7 @@ Ipv4L3Protocol::RemoveAddress (uint32_t i, uint32_t addressIndex)
   Ipv4InterfaceAddress address = interface->RemoveAddress (addressIndex);
   if (address != Ipv4InterfaceAddress ())
     {
+      FlushFlowCache ();
       if (m_routingProtocol != 0)
         {
           m_routingProtocol->NotifyRemoveAddress (i, address);
@@ -1207,6 +1312,7 @@ Ipv4L3Protocol::RemoveAddress (uint32_t i, Ipv4Address address)
   Ipv4InterfaceAddress ifAddr = interface->RemoveAddress (address);
   if (ifAddr != Ipv4InterfaceAddress ())
     {
+      FlushFlowCache ();
       if (m_routingProtocol != 0)
         {
           m_routingProtocol->NotifyRemoveAddress (i, ifAddr);
@@ -1341,6 +1447,7 @@ Ipv4L3Protocol::SetUp (uint32_t i)
   if (interface->GetDevice ()->GetMtu () >= 68)
     {
       interface->SetUp ();
+      FlushFlowCache ();
 
       if (m_routingProtocol != 0)
         {
@@ -1359,6 +1466,7 @@ Ipv4L3Protocol::SetDown (uint32_t ifaceIndex)
   NS_LOG_FUNCTION (this << ifaceIndex);
   Ptr<Ipv4Interface> interface = GetInterface (ifaceIndex);
   interface->SetDown ();
+  FlushFlowCache ();
 
   if (m_routingProtocol != 0)
     {
@@ -1381,6 +1489,7 @@ Ipv4L3Protocol::SetForwarding (uint32_t i, bool val)
   NS_LOG_FUNCTION (this << i);
   Ptr<Ipv4Interface> interface = GetInterface (i);
   interface->SetForwarding (val);
+  FlushFlowCache ();
 }
 
 Ptr<NetDevice>
@@ -1399,6 +1508,7 @@ Ipv4L3Protocol::SetIpForward (bool forward)
     {
       (*i)->SetForwarding (forward);
     }
+  FlushFlowCache ();
 }
 
 bool 
@@ -1413,6 +1523,7 @@ Ipv4L3Protocol::SetWeakEsModel (bool model)
 {
   NS_LOG_FUNCTION (this << model);
   m_weakEsModel = model;
+  FlushFlowCache ();
 }
 
 bool 
@@ -222,6 +222,14 @@ public:
    */
   bool IsUnicast (Ipv4Address ad) const;
 
+  /**
+   * \brief Flush the routes cached for the forwarded flows.
+   *
+   * The routing protocols call this function when their routes change,
+   * so that the next packets of the flows are routed again.
+   */
+  void FlushFlowCache (void);
+
   /**
    * TracedCallback signature for packet send, forward, or local deliver events.
    *
@@ -632,6 +640,34 @@ private:
   Time                m_expire;       //!< duplicate entry expiration delay
   Time                m_purge;        //!< time between purging expired duplicate entries
   EventId             m_cleanDpd;     //!< event to cleanup expired duplicate entries
+
+  /// Flow cache key: {source and destination addresses, input interface, protocol and TOS}
+  typedef std::pair<uint64_t, uint32_t> FlowCacheKey_t;
+  /// Flow cache keys, from the most to the least recently used
+  typedef std::list<FlowCacheKey_t> FlowCacheLru_t;
+  /// Flow cache entry
+  struct FlowCacheEntry
+  {
+    Ptr<Ipv4Route> route;          //!< route of the flow
+    Time expiration;               //!< expiration time of the entry
+    FlowCacheLru_t::iterator lru;  //!< position of the flow in m_flowCacheLru
+  };
+  /// Maps a flow to its cache entry
+  typedef std::map<FlowCacheKey_t, FlowCacheEntry> FlowCache_t;
+
+  /**
+   * \brief Get the flow cache key of a packet.
+   * \param [in] iif The input interface.
+   * \param [in] header The IPv4 header of the packet.
+   * \return The key of the flow of the packet.
+   */
+  FlowCacheKey_t GetFlowCacheKey (uint32_t iif, const Ipv4Header &header) const;
+
+  Time                m_flowCacheTimeout;   //!< lifetime of the flow cache entries, zero to disable the cache
+  uint32_t            m_flowCacheSize;      //!< maximum number of flow cache entries
+  FlowCache_t         m_flowCache;          //!< routes of the forwarded flows
+  FlowCacheLru_t      m_flowCacheLru;       //!< flows of m_flowCache, the least recently used last
+  int32_t             m_flowCacheInterface; //!< input interface of the packet being routed, -1 if none
 };
 
 } // Namespace ns3
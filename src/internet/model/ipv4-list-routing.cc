@@ -19,6 +19,7 @@
 
 #include "ns3/log.h"
 #include "ns3/ipv4.h"
+#include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4-route.h"
 #include "ns3/node.h"
 #include "ns3/ipv4-static-routing.h"
@@ -259,6 +260,12 @@ Ipv4ListRouting::AddRoutingProtocol (Ptr<Ipv4RoutingProtocol> routingProtocol, i
     {
       routingProtocol->SetIpv4 (m_ipv4);
     }
+  // the new protocol may take precedence over the cached routes
+  Ptr<Ipv4L3Protocol> ipv4 = DynamicCast<Ipv4L3Protocol> (m_ipv4);
+  if (ipv4 != 0)
+    {
+      ipv4->FlushFlowCache ();
+    }
 }
 
 uint32_t 
@@ -23,6 +23,7 @@
 #define IPV4_STATIC_ROUTING_H
 
 #include <list>
+#include <vector>
 #include <utility>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
@@ -31,6 +32,7 @@
 #include "ns3/ptr.h"
 #include "ns3/ipv4.h"
 #include "ns3/ipv4-routing-protocol.h"
+#include "ns3/prefix-trie.h"
 
 namespace ns3 {
 
@@ -394,11 +396,44 @@ private:
   Ptr<Ipv4MulticastRoute> LookupStatic (Ipv4Address origin, Ipv4Address group,
                                         uint32_t interface);
 
+  /**
+   * \brief Rebuild the network forwarding table from the network routes,
+   * if a route was added or removed since it was last built.
+   */
+  void UpdateForwardingTable (void);
+
+  /**
+   * \brief Mark the network forwarding table to be rebuilt, and flush the
+   * routes cached by IPv4 for the forwarded flows.
+   */
+  void InvalidateForwardingTable (void);
+
   /**
    * \brief the forwarding table for network.
    */
   NetworkRoutes m_networkRoutes;
 
+  /**
+   * \brief Set to false when the network routes change, to rebuild
+   * the network forwarding table.
+   */
+  bool m_networkTableValid;
+
+  /**
+   * \brief the network routes and their metric, in routing table order.
+   */
+  std::vector<std::pair<Ipv4RoutingTableEntry *, uint32_t> > m_networkTable;
+
+  /**
+   * \brief the indexes in m_networkTable of the routes to each network.
+   */
+  PrefixTrie m_networkTrie;
+
+  /**
+   * \brief the prefixes matched by the last lookup.
+   */
+  PrefixTrie::Matches m_matches;
+
   /**
    * \brief the forwarding table for multicast.
    */
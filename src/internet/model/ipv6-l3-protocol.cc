@@ -31,6 +31,7 @@
 #include "ns3/mac16-address.h"
 #include "ns3/mac64-address.h"
 #include "ns3/traffic-control-layer.h"
+#include "ns3/super-segment-tag.h"
 
 #include "loopback-net-device.h"
 #include "ipv6-l3-protocol.h"
@@ -43,6 +44,7 @@
 #include "ipv6-option-demux.h"
 #include "ipv6-option.h"
 #include "icmpv6-l4-protocol.h"
+#include "tcp-l4-protocol.h"
 #include "ndisc-cache.h"
 #include "ipv6-raw-socket-factory-impl.h"
 
@@ -1093,7 +1095,32 @@ void Ipv6L3Protocol::SendRealOut (Ptr<Ipv6Route> route, Ptr<Packet> packet, Ipv6
       targetMtu = dev->GetMtu ();
     }
 
-  if (packet->GetSize () > targetMtu + 40) /* 40 => size of IPv6 header */
+  SuperSegmentTag superSegment;
+  bool isSuperSegment = packet->PeekPacketTag (superSegment);
+  if (isSuperSegment && !dev->SupportsSuperSegments ())
+    {
+      // The device does not send super-segments as a train of segments,
+      // so send the segments one by one
+      if (ipHeader.GetNextHeader () == TcpL4Protocol::PROT_NUMBER)
+        {
+          NS_LOG_LOGIC ("Splitting a super-segment of " << superSegment.GetSegments () << " segments");
+          std::vector<Ptr<Packet> > segments =
+            TcpL4Protocol::SplitSuperSegment (packet, ipHeader.GetSourceAddress (), ipHeader.GetDestinationAddress ());
+          for (std::vector<Ptr<Packet> >::const_iterator it = segments.begin (); it != segments.end (); it++)
+            {
+              Ipv6Header segmentHeader = ipHeader;
+              segmentHeader.SetPayloadLength ((*it)->GetSize ());
+              SendRealOut (route, *it, segmentHeader);
+            }
+          return;
+        }
+      packet->RemovePacketTag (superSegment);
+      isSuperSegment = false;
+    }
+
+  // Super-segments are sent as a train of segments by the device
+  if (packet->GetSize () > targetMtu + 40 /* 40 => size of IPv6 header */
+      && !isSuperSegment)
     {
       // Router => drop
 
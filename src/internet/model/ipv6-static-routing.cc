@@ -19,6 +19,7 @@
  */
 
 #include <iomanip>
+#include <algorithm>
 #include "ns3/log.h"
 #include "ns3/node.h"
 #include "ns3/packet.h"
@@ -47,7 +48,8 @@ TypeId Ipv6StaticRouting::GetTypeId ()
 }
 
 Ipv6StaticRouting::Ipv6StaticRouting ()
-  : m_ipv6 (0)
+  : m_networkTableValid (false),
+    m_ipv6 (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -152,6 +154,7 @@ void Ipv6StaticRouting::AddNetworkRouteTo (Ipv6Address network, Ipv6Prefix netwo
   Ipv6RoutingTableEntry* route = new Ipv6RoutingTableEntry ();
   *route = Ipv6RoutingTableEntry::CreateNetworkRouteTo (network, networkPrefix, nextHop, interface);
   m_networkRoutes.push_back (std::make_pair (route, metric));
+  m_networkTableValid = false;
 }
 
 void Ipv6StaticRouting::AddNetworkRouteTo (Ipv6Address network, Ipv6Prefix networkPrefix, Ipv6Address nextHop, uint32_t interface, Ipv6Address prefixToUse, uint32_t metric)
@@ -165,6 +168,7 @@ void Ipv6StaticRouting::AddNetworkRouteTo (Ipv6Address network, Ipv6Prefix netwo
   Ipv6RoutingTableEntry* route = new Ipv6RoutingTableEntry ();
   *route = Ipv6RoutingTableEntry::CreateNetworkRouteTo (network, networkPrefix, nextHop, interface, prefixToUse);
   m_networkRoutes.push_back (std::make_pair (route, metric));
+  m_networkTableValid = false;
 }
 
 void Ipv6StaticRouting::AddNetworkRouteTo (Ipv6Address network, Ipv6Prefix networkPrefix, uint32_t interface, uint32_t metric)
@@ -173,6 +177,7 @@ void Ipv6StaticRouting::AddNetworkRouteTo (Ipv6Address network, Ipv6Prefix netwo
   Ipv6RoutingTableEntry* route = new Ipv6RoutingTableEntry ();
   *route = Ipv6RoutingTableEntry::CreateNetworkRouteTo (network, networkPrefix, interface);
   m_networkRoutes.push_back (std::make_pair (route, metric));
+  m_networkTableValid = false;
 }
 
 void Ipv6StaticRouting::SetDefaultRoute (Ipv6Address nextHop, uint32_t interface, Ipv6Address prefixToUse, uint32_t metric)
@@ -197,6 +202,7 @@ void Ipv6StaticRouting::SetDefaultMulticastRoute (uint32_t outputInterface)
   Ipv6Prefix networkMask = Ipv6Prefix (8);
   *route = Ipv6RoutingTableEntry::CreateNetworkRouteTo (network, networkMask, outputInterface);
   m_networkRoutes.push_back (std::make_pair (route, 0));
+  m_networkTableValid = false;
 }
 
 uint32_t Ipv6StaticRouting::GetNMulticastRoutes () const
@@ -281,6 +287,32 @@ bool Ipv6StaticRouting::HasNetworkDest (Ipv6Address network, uint32_t interfaceI
   return false;
 }
 
+void Ipv6StaticRouting::UpdateForwardingTable ()
+{
+  if (m_networkTableValid)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  m_networkTable.assign (m_networkRoutes.begin (), m_networkRoutes.end ());
+  m_networkTrie.Clear ();
+  uint8_t network[16];
+  uint8_t mask[16];
+  for (uint32_t i = 0; i < m_networkTable.size (); i++)
+    {
+      Ipv6RoutingTableEntry* route = m_networkTable[i].first;
+      route->GetDestNetwork ().GetBytes (network);
+      route->GetDestNetworkPrefix ().GetBytes (mask);
+      uint8_t length = 0;
+      while (length < 128 && (mask[length / 8] & (0x80 >> (length % 8))))
+        {
+          length++;
+        }
+      m_networkTrie.Insert (network, length, i);
+    }
+  m_networkTableValid = true;
+}
+
 Ptr<Ipv6Route> Ipv6StaticRouting::LookupStatic (Ipv6Address dst, Ptr<NetDevice> interface)
 {
   NS_LOG_FUNCTION (this << dst << interface);
@@ -300,10 +332,27 @@ Ptr<Ipv6Route> Ipv6StaticRouting::LookupStatic (Ipv6Address dst, Ptr<NetDevice>
       return rtentry;
     }
 
-  for (NetworkRoutesI it = m_networkRoutes.begin (); it != m_networkRoutes.end (); it++)
+  UpdateForwardingTable ();
+  uint8_t buf[16];
+  dst.GetBytes (buf);
+  m_networkTrie.Lookup (buf, 128, m_matches);
+  // The routes are ranked by the prefix length of their destination,
+  // which may differ from the length of its mask: consider every
+  // matching route, in routing table order.
+  std::vector<uint32_t> indexes;
+  for (PrefixTrie::Matches::const_iterator m = m_matches.begin (); m != m_matches.end (); m++)
     {
-      Ipv6RoutingTableEntry* j = it->first;
-      uint32_t metric = it->second;
+      indexes.insert (indexes.end (), (*m)->begin (), (*m)->end ());
+    }
+  if (m_matches.size () > 1)
+    {
+      std::sort (indexes.begin (), indexes.end ());
+    }
+
+  for (std::vector<uint32_t>::const_iterator it = indexes.begin (); it != indexes.end (); it++)
+    {
+      Ipv6RoutingTableEntry* j = m_networkTable[*it].first;
+      uint32_t metric = m_networkTable[*it].second;
       Ipv6Prefix mask = j->GetDestNetworkPrefix ();
       uint16_t maskLen = mask.GetPrefixLength ();
       Ipv6Address entry = j->GetDestNetwork ();
@@ -380,6 +429,9 @@ void Ipv6StaticRouting::DoDispose ()
       delete j->first;
     }
   m_networkRoutes.clear ();
+  m_networkTableValid = false;
+  m_networkTable.clear ();
+  m_networkTrie.Clear ();
 
   for (MulticastRoutesI i = m_multicastRoutes.begin (); i != m_multicastRoutes.end (); i = m_multicastRoutes.erase (i))
     {
@@ -530,6 +582,7 @@ void Ipv6StaticRouting::RemoveRoute (uint32_t index)
         {
           delete it->first;
           m_networkRoutes.erase (it);
+          m_networkTableValid = false;
           return;
         }
       tmp++;
@@ -549,6 +602,7 @@ void Ipv6StaticRouting::RemoveRoute (Ipv6Address network, Ipv6Prefix prefix, uin
         {
           delete it->first;
           m_networkRoutes.erase (it);
+          m_networkTableValid = false;
           return;
         }
     }
@@ -674,6 +728,7 @@ void Ipv6StaticRouting::NotifyInterfaceDown (uint32_t i)
         {
           delete it->first;
           it = m_networkRoutes.erase (it);
+          m_networkTableValid = false;
         }
       else
         {
@@ -719,6 +774,7 @@ void Ipv6StaticRouting::NotifyRemoveAddress (uint32_t interface, Ipv6InterfaceAd
         {
           delete it->first;
           it = m_networkRoutes.erase (it);
+          m_networkTableValid = false;
         }
       else
         {
@@ -763,6 +819,7 @@ void Ipv6StaticRouting::NotifyRemoveRoute (Ipv6Address dst, Ipv6Prefix mask, Ipv
             {
               delete j->first;
               j = m_networkRoutes.erase (j);
+              m_networkTableValid = false;
             }
           else
             {
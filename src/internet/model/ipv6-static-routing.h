@@ -24,12 +24,14 @@
 #include <stdint.h>
 
 #include <list>
+#include <vector>
 
 #include "ns3/ptr.h"
 #include "ns3/ipv6-address.h"
 #include "ns3/ipv6.h"
 #include "ns3/ipv6-header.h"
 #include "ns3/ipv6-routing-protocol.h"
+#include "ns3/prefix-trie.h"
 
 namespace ns3 {
 
@@ -281,11 +283,38 @@ private:
    */
   Ptr<Ipv6MulticastRoute> LookupStatic (Ipv6Address origin, Ipv6Address group, uint32_t ifIndex);
 
+  /**
+   * \brief Rebuild the network forwarding table from the network routes,
+   * if a route was added or removed since it was last built.
+   */
+  void UpdateForwardingTable ();
+
   /**
    * \brief the forwarding table for network.
    */
   NetworkRoutes m_networkRoutes;
 
+  /**
+   * \brief Set to false when the network routes change, to rebuild
+   * the network forwarding table.
+   */
+  bool m_networkTableValid;
+
+  /**
+   * \brief the network routes and their metric, in routing table order.
+   */
+  std::vector<std::pair<Ipv6RoutingTableEntry *, uint32_t> > m_networkTable;
+
+  /**
+   * \brief the indexes in m_networkTable of the routes to each network.
+   */
+  PrefixTrie m_networkTrie;
+
+  /**
+   * \brief the prefixes matched by the last lookup.
+   */
+  PrefixTrie::Matches m_matches;
+
   /**
    * \brief the forwarding table for multicast.
    */
@@ -94,9 +94,10 @@ NdiscCache::Entry* NdiscCache::Lookup (Ipv6Address dst)
 {
   NS_LOG_FUNCTION (this << dst);
 
-  if (m_ndCache.find (dst) != m_ndCache.end ())
+  CacheI it = m_ndCache.find (dst);
+  if (it != m_ndCache.end ())
     {
-      NdiscCache::Entry* entry = m_ndCache[dst];
+      NdiscCache::Entry* entry = it->second;
       NS_LOG_LOGIC ("Found an entry: " << *entry);
 
       return entry;
@@ -138,15 +139,12 @@ void NdiscCache::Remove (NdiscCache::Entry* entry)
 {
   NS_LOG_FUNCTION (this << entry);
 
-  for (CacheI i = m_ndCache.begin (); i != m_ndCache.end (); i++)
+  CacheI i = m_ndCache.find (entry->GetIpv6Address ());
+  if (i != m_ndCache.end () && i->second == entry)
     {
-      if ((*i).second == entry)
-        {
-          m_ndCache.erase (i);
-          entry->ClearWaitingPacket ();
-          delete entry;
-          return;
-        }
+      m_ndCache.erase (i);
+      entry->ClearWaitingPacket ();
+      delete entry;
     }
 }
 
@@ -160,6 +158,36 @@ void NdiscCache::Flush ()
     }
 
   m_ndCache.erase (m_ndCache.begin (), m_ndCache.end ());
+  m_nudEvent.Cancel ();
+}
+
+void NdiscCache::ScheduleNudEvent ()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_nudTimers.empty ())
+    {
+      return;
+    }
+  Time first = m_nudTimers.begin ()->first;
+  if (m_nudEvent.IsRunning () && Simulator::Now () + Simulator::GetDelayLeft (m_nudEvent) <= first)
+    {
+      return;
+    }
+  m_nudEvent.Cancel ();
+  m_nudEvent = Simulator::Schedule (first - Simulator::Now (), &NdiscCache::HandleNudTimers, this);
+}
+
+void NdiscCache::HandleNudTimers ()
+{
+  NS_LOG_FUNCTION (this);
+  // The expired timers may start new timers, or remove entries
+  while (!m_nudTimers.empty () && m_nudTimers.begin ()->first <= Simulator::Now ())
+    {
+      Entry *entry = m_nudTimers.begin ()->second;
+      m_nudTimers.erase (m_nudTimers.begin ());
+      entry->NudTimerExpired ();
+    }
+  ScheduleNudEvent ();
 }
 
 void NdiscCache::SetUnresQlen (uint32_t unresQlen)
@@ -229,13 +257,44 @@ NdiscCache::Entry::Entry (NdiscCache* nd)
   : m_ndCache (nd),
     m_waiting (),
     m_router (false),
-    m_nudTimer (Timer::CANCEL_ON_DESTROY),
+    m_nudFunction (0),
+    m_nudTimerRunning (false),
     m_lastReachabilityConfirmation (Seconds (0.0)),
     m_nsRetransmit (0)
 {
   NS_LOG_FUNCTION (this);
 }
 
+NdiscCache::Entry::~Entry ()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_nudTimerRunning)
+    {
+      m_ndCache->m_nudTimers.erase (m_nudTimer);
+    }
+}
+
+void NdiscCache::Entry::StartNudTimer (void (Entry::*function) (), Time delay)
+{
+  NS_LOG_FUNCTION (this << delay);
+  if (m_nudTimerRunning)
+    {
+      m_ndCache->m_nudTimers.erase (m_nudTimer);
+    }
+  m_nudFunction = function;
+  m_nudDelay = delay;
+  m_nudTimer = m_ndCache->m_nudTimers.insert (std::make_pair (Simulator::Now () + delay, this));
+  m_nudTimerRunning = true;
+  m_ndCache->ScheduleNudEvent ();
+}
+
+void NdiscCache::Entry::NudTimerExpired ()
+{
+  NS_LOG_FUNCTION (this);
+  m_nudTimerRunning = false;
+  (this->*m_nudFunction) ();
+}
+
 void NdiscCache::Entry::SetRouter (bool router)
 {
   NS_LOG_FUNCTION (this << router);
@@ -409,6 +468,12 @@ void NdiscCache::Entry::SetIpv6Address (Ipv6Address ipv6Address)
   m_ipv6Address = ipv6Address;
 }
 
+Ipv6Address NdiscCache::Entry::GetIpv6Address (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_ipv6Address;
+}
+
 Time NdiscCache::Entry::GetLastReachabilityConfirmation () const
 {
   NS_LOG_FUNCTION (this);
@@ -418,75 +483,47 @@ Time NdiscCache::Entry::GetLastReachabilityConfirmation () const
 void NdiscCache::Entry::StartReachableTimer ()
 {
   NS_LOG_FUNCTION (this);
-  if (m_nudTimer.IsRunning ())
-    {
-      m_nudTimer.Cancel ();
-    }
-
   m_lastReachabilityConfirmation = Simulator::Now ();
-  m_nudTimer.SetFunction (&NdiscCache::Entry::FunctionReachableTimeout, this);
-  m_nudTimer.SetDelay (m_ndCache->m_icmpv6->GetReachableTime ());
-  m_nudTimer.Schedule ();
+  StartNudTimer (&NdiscCache::Entry::FunctionReachableTimeout, m_ndCache->m_icmpv6->GetReachableTime ());
 }
 
 void NdiscCache::Entry::UpdateReachableTimer ()
 {
   NS_LOG_FUNCTION (this);
 
-  if (m_state == REACHABLE)
+  if (m_state == REACHABLE && m_nudFunction != 0)
     {
       m_lastReachabilityConfirmation = Simulator::Now ();
-      if (m_nudTimer.IsRunning ())
-        {
-          m_nudTimer.Cancel ();
-        }
-      m_nudTimer.Schedule ();
+      StartNudTimer (m_nudFunction, m_nudDelay);
     }
 }
 
 void NdiscCache::Entry::StartProbeTimer ()
 {
   NS_LOG_FUNCTION (this);
-  if (m_nudTimer.IsRunning ())
-    {
-      m_nudTimer.Cancel ();
-    }
-
-  m_nudTimer.SetFunction (&NdiscCache::Entry::FunctionProbeTimeout, this);
-  m_nudTimer.SetDelay (m_ndCache->m_icmpv6->GetRetransmissionTime ());
-  m_nudTimer.Schedule ();
+  StartNudTimer (&NdiscCache::Entry::FunctionProbeTimeout, m_ndCache->m_icmpv6->GetRetransmissionTime ());
 }
 
 void NdiscCache::Entry::StartDelayTimer ()
 {
   NS_LOG_FUNCTION (this);
-  if (m_nudTimer.IsRunning ())
-    {
-      m_nudTimer.Cancel ();
-    }
-
-  m_nudTimer.SetFunction (&NdiscCache::Entry::FunctionDelayTimeout, this);
-  m_nudTimer.SetDelay (m_ndCache->m_icmpv6->GetDelayFirstProbe ());
-  m_nudTimer.Schedule ();
+  StartNudTimer (&NdiscCache::Entry::FunctionDelayTimeout, m_ndCache->m_icmpv6->GetDelayFirstProbe ());
 }
 
 void NdiscCache::Entry::StartRetransmitTimer ()
 {
   NS_LOG_FUNCTION (this);
-  if (m_nudTimer.IsRunning ())
-    {
-      m_nudTimer.Cancel ();
-    }
-
-  m_nudTimer.SetFunction (&NdiscCache::Entry::FunctionRetransmitTimeout, this);
-  m_nudTimer.SetDelay (m_ndCache->m_icmpv6->GetRetransmissionTime ());
-  m_nudTimer.Schedule ();
+  StartNudTimer (&NdiscCache::Entry::FunctionRetransmitTimeout, m_ndCache->m_icmpv6->GetRetransmissionTime ());
 }
 
 void NdiscCache::Entry::StopNudTimer ()
 {
   NS_LOG_FUNCTION (this);
-  m_nudTimer.Cancel ();
+  if (m_nudTimerRunning)
+    {
+      m_ndCache->m_nudTimers.erase (m_nudTimer);
+      m_nudTimerRunning = false;
+    }
   m_nsRetransmit = 0;
 }
 
@@ -23,14 +23,15 @@
 
 #include <stdint.h>
 #include <list>
+#include <map>
+#include <unordered_map>
 
 #include "ns3/packet.h"
 #include "ns3/nstime.h"
 #include "ns3/net-device.h"
 #include "ns3/ipv6-address.h"
 #include "ns3/ptr.h"
-#include "ns3/timer.h"
-#include "ns3/sgi-hashmap.h"
+#include "ns3/simulator.h"
 #include "ns3/output-stream-wrapper.h"
 
 namespace ns3
@@ -45,6 +46,11 @@ class Icmpv6L4Protocol;
  * \ingroup ipv6
  *
  * \brief IPv6 Neighbor Discovery cache.
+ *
+ * The NUD timers of the entries are kept by the cache, ordered by
+ * expiration time, and a single event expires them all.  Restarting the
+ * timer of an entry, as each packet received from a reachable neighbor
+ * does, thus does not schedule a new event.
  */
 class NdiscCache : public Object
 {
@@ -162,7 +168,7 @@ public:
      */
     Entry (NdiscCache* nd);
 
-    virtual ~Entry() = default;
+    virtual ~Entry();
 
     /**
      * \brief Changes the state to this entry to INCOMPLETE.
@@ -344,6 +350,12 @@ public:
      */
     void SetIpv6Address (Ipv6Address ipv6Address);
 
+    /**
+     * \brief Get the IPv6 address.
+     * \return the IPv6 address
+     */
+    Ipv6Address GetIpv6Address (void) const;
+
     /**
      * \brief Print this entry to the given output stream.
      *
@@ -358,6 +370,20 @@ protected:
     NdiscCache* m_ndCache;
 
 private:
+    friend class NdiscCache;
+
+    /**
+     * \brief Start the NUD timer.
+     * \param function the function called when the timer expires
+     * \param delay the delay of the timer
+     */
+    void StartNudTimer (void (Entry::*function) (), Time delay);
+
+    /**
+     * \brief Function called by the cache when the NUD timer expires.
+     */
+    void NudTimerExpired ();
+
     /**
      * \brief The IPv6 address.
      */
@@ -397,9 +423,24 @@ private:
     bool m_router;
 
     /**
-     * \brief Timer (used for NUD).
+     * \brief Function called when the NUD timer expires.
+     */
+    void (Entry::*m_nudFunction) ();
+
+    /**
+     * \brief Delay of the NUD timer.
+     */
+    Time m_nudDelay;
+
+    /**
+     * \brief Whether the NUD timer is running.
+     */
+    bool m_nudTimerRunning;
+
+    /**
+     * \brief Position of the NUD timer in the timers of the cache, if running.
      */
-    Timer m_nudTimer;
+    std::multimap<Time, Entry *>::iterator m_nudTimer;
 
     /**
      * \brief Last time we see a reachability confirmation.
@@ -421,11 +462,11 @@ protected:
   /**
    * \brief Neighbor Discovery Cache container
    */
-  typedef sgi::hash_map<Ipv6Address, NdiscCache::Entry *, Ipv6AddressHash> Cache;
+  typedef std::unordered_map<Ipv6Address, NdiscCache::Entry *, Ipv6AddressHash> Cache;
   /**
    * \brief Neighbor Discovery Cache container iterator
    */
-  typedef sgi::hash_map<Ipv6Address, NdiscCache::Entry *, Ipv6AddressHash>::iterator CacheI;
+  typedef std::unordered_map<Ipv6Address, NdiscCache::Entry *, Ipv6AddressHash>::iterator CacheI;
 
   /**
    * \brief A list of Entry.
@@ -450,6 +491,27 @@ private:
    */
   NdiscCache& operator= (NdiscCache const &);
 
+  /**
+   * \brief Schedule the event of the first NUD timer to expire, unless
+   * an earlier event is already scheduled.
+   */
+  void ScheduleNudEvent ();
+
+  /**
+   * \brief Expire the NUD timers which are due.
+   */
+  void HandleNudTimers ();
+
+  /**
+   * \brief The running NUD timers of the entries, by expiration time.
+   */
+  std::multimap<Time, Entry *> m_nudTimers;
+
+  /**
+   * \brief The event of the first NUD timer to expire.
+   */
+  EventId m_nudEvent;
+
   /**
    * \brief The NetDevice.
    */
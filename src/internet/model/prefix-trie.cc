@@ -0,0 +1,162 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "prefix-trie.h"
+#include "ns3/assert.h"
+
+#include <cstring>
+
+namespace ns3 {
+
+PrefixTrie::PrefixTrie ()
+  : m_nPrefixes (0)
+{
+  Clear ();
+}
+
+void
+PrefixTrie::Clear (void)
+{
+  uint8_t zero[16] = {};
+  m_nodes.clear ();
+  m_nPrefixes = 0;
+  NewNode (zero, 0);
+}
+
+uint8_t
+PrefixTrie::GetBit (const uint8_t *address, uint8_t bit)
+{
+  return (address[bit >> 3] >> (7 - (bit & 7))) & 1;
+}
+
+uint8_t
+PrefixTrie::GetCommonLength (const uint8_t *a, const uint8_t *b, uint8_t length)
+{
+  uint8_t common = 0;
+  while (common < length)
+    {
+      uint8_t diff = a[common >> 3] ^ b[common >> 3];
+      if (diff == 0)
+        {
+          common += 8;
+          continue;
+        }
+      while ((diff & 0x80) == 0)
+        {
+          diff <<= 1;
+          common++;
+        }
+      break;
+    }
+  return common < length ? common : length;
+}
+
+uint32_t
+PrefixTrie::NewNode (const uint8_t *prefix, uint8_t length)
+{
+  Node node;
+  std::memset (node.prefix, 0, sizeof (node.prefix));
+  std::memcpy (node.prefix, prefix, (length + 7) / 8);
+  if (length % 8 != 0)
+    {
+      node.prefix[length / 8] &= static_cast<uint8_t> (0xff << (8 - length % 8));
+    }
+  node.length = length;
+  node.children[0] = 0;
+  node.children[1] = 0;
+  m_nodes.push_back (node);
+  return m_nodes.size () - 1;
+}
+
+void
+PrefixTrie::Insert (const uint8_t *prefix, uint8_t length, uint32_t value)
+{
+  NS_ASSERT (length <= 128);
+  uint32_t current = 0;
+  while (m_nodes[current].length != length)
+    {
+      // The node is a strict prefix of the inserted prefix
+      uint8_t bit = GetBit (prefix, m_nodes[current].length);
+      uint32_t child = m_nodes[current].children[bit];
+      if (child == 0)
+        {
+          uint32_t leaf = NewNode (prefix, length);
+          m_nodes[current].children[bit] = leaf;
+          current = leaf;
+          break;
+        }
+      uint8_t childLength = m_nodes[child].length;
+      uint8_t common = GetCommonLength (prefix, m_nodes[child].prefix,
+                                        length < childLength ? length : childLength);
+      if (common == childLength)
+        {
+          current = child;
+          continue;
+        }
+      // Split the edge to the child where the prefixes diverge
+      uint32_t branch = NewNode (prefix, common);
+      m_nodes[branch].children[GetBit (m_nodes[child].prefix, common)] = child;
+      m_nodes[current].children[bit] = branch;
+      current = branch;
+    }
+  if (m_nodes[current].values.empty ())
+    {
+      m_nPrefixes++;
+    }
+  m_nodes[current].values.push_back (value);
+}
+
+void
+PrefixTrie::Lookup (const uint8_t *address, uint8_t length, Matches &matches) const
+{
+  matches.clear ();
+  uint32_t current = 0;
+  do
+    {
+      const Node &node = m_nodes[current];
+      if (node.length > length
+          || GetCommonLength (address, node.prefix, node.length) != node.length)
+        {
+          break;
+        }
+      if (!node.values.empty ())
+        {
+          matches.push_back (&node.values);
+        }
+      if (node.length == length)
+        {
+          break;
+        }
+      current = node.children[GetBit (address, node.length)];
+    }
+  while (current != 0);
+}
+
+uint32_t
+PrefixTrie::GetNPrefixes (void) const
+{
+  return m_nPrefixes;
+}
+
+uint32_t
+PrefixTrie::GetNNodes (void) const
+{
+  return m_nodes.size ();
+}
+
+} // namespace ns3
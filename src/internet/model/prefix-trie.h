@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PREFIX_TRIE_H
+#define PREFIX_TRIE_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup ipv4Routing
+ * \ingroup ipv6Routing
+ *
+ * \brief A path-compressed binary trie of address prefixes, used as the
+ * forwarding table of the routing protocols which keep their routes in
+ * lists.
+ *
+ * Each prefix holds the values (typically the indexes of routes in a
+ * routing table) it was inserted with, in insertion order.  A lookup
+ * returns the values of every prefix matching an address, from the
+ * shortest to the longest prefix, so that the caller can apply its own
+ * selection rules: longest prefix match, metric, equal-cost multipath.
+ *
+ * Only the nodes where two prefixes diverge are created, so that a
+ * lookup visits at most one node per matching prefix and per branching
+ * point.  The trie does not support removals: routing protocols rebuild
+ * it when their routes change.
+ *
+ * The addresses are given as big-endian byte arrays of up to 16 bytes.
+ */
+class PrefixTrie
+{
+public:
+  /// The values of a prefix, in insertion order
+  typedef std::vector<uint32_t> Values;
+  /// The prefixes matching an address, from the shortest to the longest
+  typedef std::vector<const Values *> Matches;
+
+  PrefixTrie ();
+
+  /**
+   * Remove all prefixes.
+   */
+  void Clear (void);
+  /**
+   * Add a value to a prefix.
+   *
+   * \param prefix the prefix, as an address whose bits beyond the prefix
+   *        length are ignored
+   * \param length the prefix length in bits, at most 128
+   * \param value the value
+   */
+  void Insert (const uint8_t *prefix, uint8_t length, uint32_t value);
+  /**
+   * Find the prefixes which match an address.
+   *
+   * \param [in] address the address
+   * \param [in] length the address length in bits, i.e., 32 or 128
+   * \param [out] matches the values of the matching prefixes, from the
+   *        shortest to the longest prefix
+   */
+  void Lookup (const uint8_t *address, uint8_t length, Matches &matches) const;
+  /**
+   * \returns the number of prefixes in the trie
+   */
+  uint32_t GetNPrefixes (void) const;
+  /**
+   * \returns the number of nodes of the trie, including the branching
+   *          points which do not hold a prefix
+   */
+  uint32_t GetNNodes (void) const;
+
+private:
+  /// A node of the trie
+  struct Node
+  {
+    uint8_t prefix[16];    //!< the prefix, with the bits beyond length cleared
+    uint8_t length;        //!< the prefix length
+    uint32_t children[2];  //!< the indexes of the children, 0 if none
+    Values values;         //!< the values, empty for a branching point
+  };
+
+  /**
+   * \param address the address
+   * \param bit the bit index, 0 being the most significant bit
+   * \returns the bit of the address
+   */
+  static uint8_t GetBit (const uint8_t *address, uint8_t bit);
+  /**
+   * \param a the first address
+   * \param b the second address
+   * \param length the maximum length to compare
+   * \returns the length of the common prefix of two addresses, at most length
+   */
+  static uint8_t GetCommonLength (const uint8_t *a, const uint8_t *b, uint8_t length);
+  /**
+   * Append a node.
+   *
+   * \param prefix the prefix
+   * \param length the prefix length
+   * \returns the index of the new node
+   */
+  uint32_t NewNode (const uint8_t *prefix, uint8_t length);
+
+  std::vector<Node> m_nodes;  //!< the nodes, the root being the first one
+  uint32_t m_nPrefixes;       //!< the number of prefixes
+};
+
+} // namespace ns3
+
+#endif /* PREFIX_TRIE_H */
@@ -660,6 +660,7 @@ void Rip::AddNetworkRouteTo (Ipv4Address network, Ipv4Mask networkPrefix, Ipv4Ad
   route->SetRouteChanged (true);
 
   m_routes.push_back (std::make_pair (route, EventId ()));
+  FlushFlowCache ();
 }
 
 void Rip::AddNetworkRouteTo (Ipv4Address network, Ipv4Mask networkPrefix, uint32_t interface)
@@ -672,6 +673,7 @@ void Rip::AddNetworkRouteTo (Ipv4Address network, Ipv4Mask networkPrefix, uint32
   route->SetRouteChanged (true);
 
   m_routes.push_back (std::make_pair (route, EventId ()));
+  FlushFlowCache ();
 }
 
 void Rip::InvalidateRoute (RipRoutingTableEntry *route)
@@ -690,6 +692,7 @@ void Rip::InvalidateRoute (RipRoutingTableEntry *route)
               it->second.Cancel ();
             }
           it->second = Simulator::Schedule (m_garbageCollectionDelay, &Rip::DeleteRoute, this, route);
+          FlushFlowCache ();
           return;
         }
     }
@@ -712,6 +715,15 @@ void Rip::DeleteRoute (RipRoutingTableEntry *route)
   NS_ABORT_MSG ("RIP::DeleteRoute - cannot find the route to delete");
 }
 
+void Rip::FlushFlowCache (void)
+{
+  Ptr<Ipv4L3Protocol> ipv4 = DynamicCast<Ipv4L3Protocol> (m_ipv4);
+  if (ipv4 != 0)
+    {
+      ipv4->FlushFlowCache ();
+    }
+}
+
 
 void Rip::Receive (Ptr<Socket> socket)
 {
@@ -1076,6 +1088,7 @@ void Rip::HandleResponses (RipHeader hdr, Ipv4Address senderAddress, uint32_t in
 
   if (changed)
     {
+      FlushFlowCache ();
       SendTriggeredRouteUpdate ();
     }
 }
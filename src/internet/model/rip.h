@@ -371,6 +371,12 @@ private:
    */
   void DeleteRoute (RipRoutingTableEntry *route);
 
+  /**
+   * \brief Flush the routes cached by IPv4 for the forwarded flows,
+   * when a route changes.
+   */
+  void FlushFlowCache (void);
+
   Routes m_routes; //!<  the forwarding table for network.
   Ptr<Ipv4> m_ipv4; //!< IPv4 reference
   Time m_startupDelay; //!< Random delay before protocol startup.
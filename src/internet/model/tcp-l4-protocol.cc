@@ -29,6 +29,7 @@
 #include "ns3/simulator.h"
 #include "ns3/ipv4-route.h"
 #include "ns3/ipv6-route.h"
+#include "ns3/super-segment-tag.h"
 
 #include "tcp-l4-protocol.h"
 #include "tcp-header.h"
@@ -656,6 +657,44 @@ TcpL4Protocol::SendPacketV6 (Ptr<Packet> packet, const TcpHeader &outgoing,
     }
 }
 
+std::vector<Ptr<Packet> >
+TcpL4Protocol::SplitSuperSegment (Ptr<const Packet> packet, const Address &source,
+                                  const Address &destination)
+{
+  SuperSegmentTag superSegment;
+  bool found = packet->PeekPacketTag (superSegment);
+  NS_ASSERT_MSG (found, "Not a super-segment");
+
+  Ptr<Packet> payload = packet->Copy ();
+  TcpHeader header;
+  payload->RemoveHeader (header);
+  payload->RemovePacketTag (superSegment);
+  NS_ASSERT (payload->GetSize () == superSegment.GetPayloadSize ());
+
+  uint32_t segmentSize = (superSegment.GetPayloadSize () + superSegment.GetSegments () - 1)
+    / superSegment.GetSegments ();
+  std::vector<Ptr<Packet> > segments;
+  for (uint32_t offset = 0; offset < payload->GetSize (); offset += segmentSize)
+    {
+      uint32_t size = std::min (segmentSize, payload->GetSize () - offset);
+      Ptr<Packet> segment = payload->CreateFragment (offset, size);
+      TcpHeader segmentHeader = header;
+      segmentHeader.SetSequenceNumber (header.GetSequenceNumber () + offset);
+      if (offset + size < payload->GetSize ())
+        {
+          segmentHeader.SetFlags (header.GetFlags () & ~TcpHeader::FIN);
+        }
+      if (Node::ChecksumEnabled ())
+        {
+          segmentHeader.EnableChecksums ();
+        }
+      segmentHeader.InitializeChecksum (source, destination, PROT_NUMBER);
+      segment->AddHeader (segmentHeader);
+      segments.push_back (segment);
+    }
+  return segments;
+}
+
 void
 TcpL4Protocol::SendPacket (Ptr<Packet> pkt, const TcpHeader &outgoing,
                            const Address &saddr, const Address &daddr,
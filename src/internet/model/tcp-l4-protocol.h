@@ -246,6 +246,23 @@ public:
    */
   void DeAllocate (Ipv6EndPoint *endPoint);
 
+  /**
+   * \brief Split a super-segment into the segments it stands for
+   *
+   * Used by the network layers to send a super-segment (see
+   * SuperSegmentTag) through a device which does not support them.  Each
+   * segment gets a copy of the TCP header, with its own sequence number,
+   * and the FIN flag stays on the last one.
+   *
+   * \param packet the super-segment, starting with its TCP header
+   * \param source the source address, for the checksum
+   * \param destination the destination address, for the checksum
+   * \returns the segments, without SuperSegmentTag
+   */
+  static std::vector<Ptr<Packet> > SplitSuperSegment (Ptr<const Packet> packet,
+                                                      const Address &source,
+                                                      const Address &destination);
+
   // From IpL4Protocol
   virtual enum IpL4Protocol::RxStatus Receive (Ptr<Packet> p,
                                                Ipv4Header const &incomingIpHeader,
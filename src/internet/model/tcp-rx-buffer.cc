@@ -155,8 +155,13 @@ TcpRxBuffer::Add (Ptr<Packet> p, TcpHeader const& tcph)
       if (maxSeq < tailSeq) tailSeq = maxSeq;
       if (tailSeq < headSeq) headSeq = tailSeq;
     }
-  // Remove overlapped bytes from packet
-  BufIterator i = m_data.begin ();
+  // Remove overlapped bytes from packet. The stored blocks do not overlap,
+  // so only the one starting at or before headSeq can contain it.
+  BufIterator i = m_data.upper_bound (headSeq);
+  if (i != m_data.begin ())
+    {
+      --i;
+    }
   while (i != m_data.end () && i->first <= tailSeq)
     {
       SequenceNumber32 lastByteSeq = i->first + SequenceNumber32 (i->second->GetSize ());
@@ -194,29 +199,45 @@ TcpRxBuffer::Add (Ptr<Packet> p, TcpHeader const& tcph)
     }
   // Insert packet into buffer
   NS_ASSERT (m_data.find (headSeq) == m_data.end ()); // Shouldn't be there yet
-  m_data [ headSeq ] = p;
+  NS_LOG_LOGIC ("Buffered packet of seqno=" << headSeq << " len=" << p->GetSize ());
+  m_size += p->GetSize ();      // Occupancy
+  i = m_data.insert (std::make_pair (headSeq, p)).first;
+  p = nullptr;
+
+  // Coalesce the packet with the adjacent blocks. The packets are chained
+  // and not copied, and each block of contiguous data is a single packet.
+  // A stored packet is only modified if the buffer is its only holder.
+  BufIterator next = i;
+  ++next;
+  if (next != m_data.end () && next->first == tailSeq)
+    {
+      GetWritable (i->second)->AddAtEnd (next->second);
+      m_data.erase (next);
+    }
+  if (i != m_data.begin ())
+    {
+      BufIterator previous = i;
+      --previous;
+      if (previous->first + SequenceNumber32 (previous->second->GetSize ()) == headSeq)
+        {
+          GetWritable (previous->second)->AddAtEnd (i->second);
+          m_data.erase (i);
+          i = previous;
+        }
+    }
+  SequenceNumber32 blockTail = i->first + SequenceNumber32 (i->second->GetSize ());
 
   if (headSeq > m_nextRxSeq)
     {
       // Generate a new SACK block
-      UpdateSackList (headSeq, tailSeq);
+      UpdateSackList (i->first, blockTail);
     }
 
-  NS_LOG_LOGIC ("Buffered packet of seqno=" << headSeq << " len=" << p->GetSize ());
   // Update variables
-  m_size += p->GetSize ();      // Occupancy
-  for (i = m_data.begin (); i != m_data.end (); ++i)
+  if (i->first <= m_nextRxSeq && blockTail > m_nextRxSeq)
     {
-      if (i->first < m_nextRxSeq)
-        {
-          continue;
-        }
-      else if (i->first > m_nextRxSeq)
-        {
-          break;
-        };
-      m_nextRxSeq = i->first + SequenceNumber32 (i->second->GetSize ());
-      m_availBytes += i->second->GetSize ();
+      m_availBytes += blockTail - m_nextRxSeq;
+      m_nextRxSeq = blockTail;
       ClearSackList (m_nextRxSeq);
     }
   NS_LOG_LOGIC ("Updated buffer occupancy=" << m_size << " nextRxSeq=" << m_nextRxSeq);
@@ -271,53 +292,23 @@ TcpRxBuffer::UpdateSackList (const SequenceNumber32 &head, const SequenceNumber3
   //     following SACK blocks in the SACK option may be listed in
   //     arbitrary order.
 
-  m_sackList.push_front (current);
-
-  // We have inserted the block at the beginning of the list. Now, we should
-  // check if any existing blocks overlap with that.
-  bool updated = false;
+  // The block is the whole contiguous data containing the segment, so it
+  // contains any block of the list it overlaps: remove them, and insert
+  // the block at the beginning of the list.
   TcpOptionSack::SackList::iterator it = m_sackList.begin ();
-  TcpOptionSack::SackBlock begin = *it;
-  TcpOptionSack::SackBlock merged;
-  ++it;
-
-  // Iterates until we examined all blocks in the list (maximum 4)
   while (it != m_sackList.end ())
     {
-      current = *it;
-
-      // This is a left merge:
-      // [current_first; current_second] [beg_first; beg_second]
-      if (begin.first == current.second)
-        {
-          NS_ASSERT (current.first < begin.second);
-          merged = TcpOptionSack::SackBlock (current.first, begin.second);
-          updated = true;
-        }
-      // while this is a right merge
-      // [begin_first; begin_second] [current_first; current_second]
-      else if (begin.second == current.first)
+      if (it->first < tail && head < it->second)
         {
-          NS_ASSERT (begin.first < current.second);
-          merged = TcpOptionSack::SackBlock (begin.first, current.second);
-          updated = true;
+          NS_ASSERT (head <= it->first && it->second <= tail);
+          it = m_sackList.erase (it);
         }
-
-      // If we have merged the blocks (and the result is in merged) we should
-      // delete the current block (it), the first block, and insert the merged
-      // one at the beginning.
-      if (updated)
+      else
         {
-          m_sackList.erase (it);
-          m_sackList.pop_front ();
-          m_sackList.push_front (merged);
-          it = m_sackList.begin ();
-          begin = *it;
-          updated = false;
+          ++it;
         }
-
-      ++it;
     }
+  m_sackList.push_front (current);
 
   // Since the maximum blocks that fits into a TCP header are 4, there's no
   // point on maintaining the others.
@@ -327,9 +318,8 @@ TcpRxBuffer::UpdateSackList (const SequenceNumber32 &head, const SequenceNumber3
     }
 
   // Please note that, if a block b is discarded and then a block contiguous
-  // to b is received, only that new block (without the b part) is reported.
-  // This is perfectly fine for the RFC point (a), given that we do not report any
-  // overlapping blocks shortly after.
+  // to b is received, the whole block, including the b part, is reported
+  // again, as required by the RFC point (a).
 }
 
 void
@@ -369,17 +359,19 @@ TcpRxBuffer::Extract (uint32_t maxSize)
   NS_LOG_LOGIC ("Requested to extract " << extractSize << " bytes from TcpRxBuffer of size=" << m_size);
   if (extractSize == 0) return nullptr;  // No contiguous block to return
   NS_ASSERT (m_data.size ()); // At least we have something to extract
-  Ptr<Packet> outPkt = Create<Packet> (); // The packet that contains all the data to return
+  Ptr<Packet> outPkt; // The packet that contains all the data to return
   BufIterator i;
   while (extractSize)
     { // Check the buffered data for delivery
       i = m_data.begin ();
       NS_ASSERT (i->first <= m_nextRxSeq); // in-sequence data expected
-      // Check if we send the whole pkt or just a partial
+      // Check if we send the whole pkt or just a partial. The in-sequence
+      // data is coalesced, so there is usually a single packet to return.
       uint32_t pktSize = i->second->GetSize ();
+      Ptr<Packet> part;
       if (pktSize <= extractSize)
         { // Whole packet is extracted
-          outPkt->AddAtEnd (i->second);
+          part = i->second;
           m_data.erase (i);
           m_size -= pktSize;
           m_availBytes -= pktSize;
@@ -387,22 +379,45 @@ TcpRxBuffer::Extract (uint32_t maxSize)
         }
       else
         { // Partial is extracted and done
-          outPkt->AddAtEnd (i->second->CreateFragment (0, extractSize));
-          m_data[i->first + SequenceNumber32 (extractSize)] = i->second->CreateFragment (extractSize, pktSize - extractSize);
+          part = i->second->CreateFragment (0, extractSize);
+          Ptr<Packet> rest = GetWritable (i->second);
+          rest->RemoveAtStart (extractSize);
+          m_data[i->first + SequenceNumber32 (extractSize)] = rest;
           m_data.erase (i);
           m_size -= extractSize;
           m_availBytes -= extractSize;
           extractSize = 0;
         }
+      if (outPkt == nullptr)
+        {
+          outPkt = part;
+        }
+      else
+        {
+          GetWritable (outPkt)->AddAtEnd (part);
+        }
     }
-  if (outPkt->GetSize () == 0)
+  if (outPkt == nullptr || outPkt->GetSize () == 0)
     {
       NS_LOG_LOGIC ("Nothing extracted.");
       return nullptr;
     }
+  // As the data is extracted from several segments, the packet tags of the
+  // first one are not kept
+  GetWritable (outPkt)->RemoveAllPacketTags ();
   NS_LOG_LOGIC ("Extracted " << outPkt->GetSize ( ) << " bytes, bufsize=" << m_size
                              << ", num pkts in buffer=" << m_data.size ());
   return outPkt;
 }
 
+Ptr<Packet>
+TcpRxBuffer::GetWritable (Ptr<Packet> &packet)
+{
+  if (packet->GetReferenceCount () > 1)
+    {
+      packet = packet->Copy ();
+    }
+  return packet;
+}
+
 } //namespace ns3
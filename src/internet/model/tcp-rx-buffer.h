@@ -53,6 +53,12 @@ class Packet;
  * To store data, use Add; for retrieving a certain amount of ordered data, use
  * the method Extract.
  *
+ * The stored data is coalesced: the segments which are contiguous are chained
+ * (without copying their payload) into a single packet, so that the buffer
+ * holds one packet per block of contiguous data. Therefore, Add only looks at
+ * the blocks around the segment, and Extract usually returns the packet of
+ * the first block as is.
+ *
  * SACK list
  * ---------
  *
@@ -183,7 +189,8 @@ public:
 
 private:
   /**
-   * \brief Update the sack list, with the block seq starting at the beginning
+   * \brief Update the sack list, with the block containing the last segment
+   * received at the beginning
    *
    * Note: the maximum size of the block list is 4. Caller is free to
    * drop blocks at the end to accommodate header size; from RFC 2018:
@@ -197,8 +204,10 @@ private:
    * (or other) options, it is even less. For more detail about this function,
    * please see the source code and in-line comments.
    *
-   * \param head sequence number of the block at the beginning
-   * \param tail sequence number of the block at the end
+   * \param head sequence number of the beginning of the contiguous block of
+   * data containing the segment
+   * \param tail sequence number of the end of the contiguous block of data
+   * containing the segment
    */
   void UpdateSackList (const SequenceNumber32 &head, const SequenceNumber32 &tail);
 
@@ -219,13 +228,25 @@ private:
 
   /// container for data stored in the buffer
   typedef std::map<SequenceNumber32, Ptr<Packet> >::iterator BufIterator;
+
+  /**
+   * \brief Get the packet of a block, to modify it
+   *
+   * A packet may be held outside of the buffer, e.g. by the sinks of a
+   * trace source or by the caller of Extract: such a packet is replaced
+   * by a copy, so that only the buffer sees the modification.
+   *
+   * \param packet the packet to modify
+   * \return the packet, or its copy if it is held elsewhere
+   */
+  static Ptr<Packet> GetWritable (Ptr<Packet> &packet);
   TracedValue<SequenceNumber32> m_nextRxSeq; //!< Seqnum of the first missing byte in data (RCV.NXT)
   SequenceNumber32 m_finSeq;                 //!< Seqnum of the FIN packet
   bool m_gotFin;                             //!< Did I received FIN packet?
   uint32_t m_size;                           //!< Number of total data bytes in the buffer, not necessarily contiguous
   uint32_t m_maxBuffer;                      //!< Upper bound of the number of data bytes in buffer (RCV.WND)
   uint32_t m_availBytes;                     //!< Number of bytes available to read, i.e. contiguous block at head
-  std::map<SequenceNumber32, Ptr<Packet> > m_data; //!< Corresponding data (may be null)
+  std::map<SequenceNumber32, Ptr<Packet> > m_data; //!< Blocks of contiguous data (may be null)
 };
 
 } //namespace ns3
@@ -42,6 +42,7 @@
 #include "ns3/pointer.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/data-rate.h"
+#include "ns3/super-segment-tag.h"
 #include "ns3/object.h"
 #include "tcp-socket-base.h"
 #include "tcp-l4-protocol.h"
@@ -147,6 +148,15 @@ TcpSocketBase::GetTypeId (void)
                    BooleanValue (true),
                    MakeBooleanAccessor (&TcpSocketBase::m_limitedTx),
                    MakeBooleanChecker ())
+    .AddAttribute ("TsoSize",
+                   "Maximum size of the super-segments of new data handed down at once, "
+                   "as with TCP segmentation offload (0 disables it). The limit keeps "
+                   "the datagram within the IPv4 total length with the largest headers. "
+                   "A super-segment counts as one packet in the queues: the queues sized "
+                   "in packets hold up to TsoSize / SegmentSize times more bytes.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TcpSocketBase::m_tsoSize),
+                   MakeUintegerChecker<uint32_t> (0, 65415))
     .AddAttribute ("UseEcn", "Parameter to set ECN functionality",
                    EnumValue (TcpSocketState::Off),
                    MakeEnumAccessor (&TcpSocketBase::SetUseEcn),
@@ -350,6 +360,7 @@ TcpSocketBase::TcpSocketBase (const TcpSocketBase& sock)
     m_recoverActive (sock.m_recoverActive),
     m_retxThresh (sock.m_retxThresh),
     m_limitedTx (sock.m_limitedTx),
+    m_tsoSize (sock.m_tsoSize),
     m_isFirstPartialAck (sock.m_isFirstPartialAck),
     m_txTrace (sock.m_txTrace),
     m_rxTrace (sock.m_rxTrace),
@@ -3089,6 +3100,13 @@ TcpSocketBase::SendDataPacket (SequenceNumber32 seq, uint32_t maxSize, bool with
 
   AddSocketTags (p);
 
+  if (sz > m_tcb->m_segmentSize)
+    {
+      // A super-segment, sent by the devices as a train of segments
+      uint16_t segments = (sz + m_tcb->m_segmentSize - 1) / m_tcb->m_segmentSize;
+      p->AddPacketTag (SuperSegmentTag (segments, sz));
+    }
+
   if (m_closeOnEmpty && (remainingData == 0))
     {
       flags |= TcpHeader::FIN;
@@ -3282,6 +3300,31 @@ TcpSocketBase::SendPendingData (bool withAck)
           uint32_t maxSizeToSend = static_cast<uint32_t> (nextHigh - next);
           s = std::min (s, maxSizeToSend);
 
+          // With segmentation offload, new data is handed down as a
+          // super-segment of as many full segments as the windows and the
+          // buffered data allow.  NextSeg () only returned a full segment
+          // of new data, which is sent alone if no more segments fit.
+          if (m_tsoSize > m_tcb->m_segmentSize && s == m_tcb->m_segmentSize
+              && next >= m_tcb->m_highTxMark)
+            {
+              SequenceNumber32 rWndEdge = m_highRxAckMark.Get () + SequenceNumber32 (m_rWnd.Get ());
+              if (rWndEdge > next)
+                {
+                  uint32_t superSize = std::min (availableWindow,
+                                                 static_cast<uint32_t> (rWndEdge - next));
+                  superSize = std::min (std::min (superSize, availableData), m_tsoSize);
+                  superSize -= superSize % m_tcb->m_segmentSize;
+                  s = std::max (s, superSize);
+                }
+            }
+          // NextSeg () returns an empty range of new data when the data
+          // sent, including the SACKed data, fills the receiver window
+          if (s == 0)
+            {
+              NS_LOG_LOGIC ("No room left in the receiver window. Wait to send.");
+              break;
+            }
+
           // (C.2) If any of the data octets sent in (C.1) are below HighData,
           //       HighRxt MUST be set to the highest sequence number of the
           //       retransmitted segment unless NextSeg () rule (4) was
@@ -3487,8 +3530,11 @@ TcpSocketBase::ReceivedData (Ptr<Packet> p, const TcpHeader& tcpHeader)
         }
     }
   else
-    { // In-sequence packet: ACK if delayed ack count allows
-      if (++m_delAckCount >= m_delAckMaxCount)
+    { // In-sequence packet: ACK if delayed ack count allows. A
+      // super-segment counts as the segments it is made of.
+      SuperSegmentTag superSegment;
+      m_delAckCount += p->PeekPacketTag (superSegment) ? superSegment.GetSegments () : 1;
+      if (m_delAckCount >= m_delAckMaxCount)
         {
           m_delAckEvent.Cancel ();
           m_delAckCount = 0;
@@ -58,7 +58,8 @@ TcpTxBuffer::GetTypeId (void)
  * initialized below is insignificant.
  */
 TcpTxBuffer::TcpTxBuffer (uint32_t n)
-  : m_maxBuffer (32768), m_size (0), m_sentSize (0), m_firstByteSeq (n)
+  : m_maxBuffer (32768), m_size (0), m_sentSize (0), m_firstByteSeq (n),
+    m_lostScanned (n)
 {
   m_rWndCallback = MakeNullCallback<uint32_t> ();
 }
@@ -174,6 +175,7 @@ TcpTxBuffer::SetHeadSequence (const SequenceNumber32& seq)
   // if you change the head with data already sent, something bad will happen
   NS_ASSERT (m_sentList.size () == 0);
   m_highestSack = std::make_pair (m_sentList.end (), SequenceNumber32 (0));
+  m_lostScanned = seq;
 }
 
 bool
@@ -296,7 +298,7 @@ TcpTxBuffer::GetNewSegment (uint32_t numBytes)
   NS_ASSERT (it != m_appList.end ());
 
   m_appList.erase (it);
-  m_sentList.insert (m_sentList.end (), item);
+  IndexItem (m_sentList.insert (m_sentList.end (), item));
   m_sentSize += item->m_packet->GetSize ();
 
   return item;
@@ -310,36 +312,33 @@ TcpTxBuffer::GetTransmittedSegment (uint32_t numBytes, const SequenceNumber32 &s
   NS_ASSERT (numBytes <= m_sentSize);
   NS_ASSERT (m_sentList.size () >= 1);
 
-  auto it = m_sentList.begin ();
   bool listEdited = false;
   uint32_t s = numBytes;
 
   // Avoid to merge different packet for this retransmission if flags are
   // different.
-  for (; it != m_sentList.end(); ++it)
+  SentIndex::iterator index = m_sentIndex.find (seq);
+  if (index != m_sentIndex.end ())
     {
-      if ((*it)->m_startSeq == seq)
+      PacketList::iterator it = index->second;
+      PacketList::iterator next = it;
+      next++;
+      if (next != m_sentList.end ())
         {
-          auto next = it;
-          next++;
-          if (next != m_sentList.end ())
+          // Next is not sacked and have the same value for m_lost ... there is the possibility to merge
+          if ((! (*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
             {
-              // Next is not sacked and have the same value for m_lost ... there is the possibility to merge
-              if ((! (*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
-                {
-                  s = std::min(s, (*it)->m_packet->GetSize () + (*next)->m_packet->GetSize ());
-                }
-              else
-                {
-                  // Next is sacked... better to retransmit only the first segment
-                  s = std::min(s, (*it)->m_packet->GetSize ());
-                }
+              s = std::min(s, (*it)->m_packet->GetSize () + (*next)->m_packet->GetSize ());
             }
           else
             {
+              // Next is sacked... better to retransmit only the first segment
               s = std::min(s, (*it)->m_packet->GetSize ());
             }
-          break;
+        }
+      else
+        {
+          s = std::min(s, (*it)->m_packet->GetSize ());
         }
     }
 
@@ -349,6 +348,7 @@ TcpTxBuffer::GetTransmittedSegment (uint32_t numBytes, const SequenceNumber32 &s
     {
       m_retrans += item->m_packet->GetSize ();
       item->m_retrans = true;
+      UpdateScoreboard (item);
     }
 
   return item;
@@ -400,7 +400,7 @@ TcpTxBuffer::SplitItems (TcpTxItem *t1, TcpTxItem *t2, uint32_t size) const
 TcpTxItem*
 TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listStartFrom,
                                 uint32_t numBytes, const SequenceNumber32 &seq,
-                                bool *listEdited) const
+                                bool *listEdited)
 {
   NS_LOG_FUNCTION (this << numBytes << seq);
 
@@ -436,12 +436,25 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
   TcpTxItem *outItem = nullptr;
   PacketList::iterator it = list.begin ();
   SequenceNumber32 beginOfCurrentPacket = listStartFrom;
+  bool isSentList = &list == &m_sentList;
+
+  if (isSentList && !m_sentIndex.empty ())
+    {
+      // Start from the item which contains seq, instead of the head
+      SentIndex::iterator index = m_sentIndex.upper_bound (seq);
+      if (index != m_sentIndex.begin ())
+        {
+          --index;
+          it = index->second;
+          beginOfCurrentPacket = (*it)->m_startSeq;
+        }
+    }
 
   while (it != list.end ())
     {
       currentItem = *it;
       currentPacket = currentItem->m_packet;
-      NS_ASSERT_MSG (list != m_sentList || currentItem->m_startSeq >= m_firstByteSeq,
+      NS_ASSERT_MSG (!isSentList || currentItem->m_startSeq >= m_firstByteSeq,
                      "start: " << m_firstByteSeq << " currentItem start: " <<
                      currentItem->m_startSeq);
 
@@ -471,7 +484,12 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
               SplitItems (firstPart, currentItem, seq - beginOfCurrentPacket);
 
               // insert firstPart before currentItem
-              list.insert (it, firstPart);
+              PacketList::iterator first = list.insert (it, firstPart);
+              if (isSentList)
+                {
+                  IndexItem (first);
+                  IndexItem (it);
+                }
               if (listEdited)
                 {
                   *listEdited = true;
@@ -515,11 +533,17 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
                   // current > outPacket in the list. Merge current with the
                   // previous, and recurse.
                   NS_ASSERT (it != list.begin ());
-                  TcpTxItem *previous = *(--it);
+                  PacketList::iterator previousIt = it;
+                  TcpTxItem *previous = *(--previousIt);
 
+                  MergeItems (previous, currentItem);
                   list.erase (it);
+                  if (isSentList)
+                    {
+                      UnindexItem (currentItem);
+                      UpdateScoreboard (previous);
+                    }
 
-                  MergeItems (previous, currentItem);
                   delete currentItem;
                   if (listEdited)
                     {
@@ -537,7 +561,12 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
               SplitItems (firstPart, currentItem, numBytes);
 
               // insert firstPart before currentItem
-              list.insert (it, firstPart);
+              PacketList::iterator first = list.insert (it, firstPart);
+              if (isSentList)
+                {
+                  IndexItem (first);
+                  IndexItem (it);
+                }
               if (listEdited)
                 {
                   *listEdited = true;
@@ -567,6 +596,11 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
 
           MergeItems (currentItem, next);
           list.erase (it);
+          if (isSentList)
+            {
+              UnindexItem (next);
+              UpdateScoreboard (currentItem);
+            }
 
           delete next;
 
@@ -655,16 +689,17 @@ bool
 TcpTxBuffer::IsRetransmittedDataAcked (const SequenceNumber32& ack) const
 {
   NS_LOG_FUNCTION (this);
-  for (const auto &it : m_sentList)
-     {
-       TcpTxItem *item = it;
-       Ptr<Packet> p = item->m_packet;
-       if (item->m_startSeq + p->GetSize () == ack && !item->m_sacked && item->m_retrans)
-         {
-           return true;
-         }
-     }
-  return false;
+  // The items are contiguous: the only one which can end at ack is the one
+  // before the first item starting at or after ack
+  SentIndex::const_iterator index = m_sentIndex.lower_bound (ack);
+  if (index == m_sentIndex.begin ())
+    {
+      return false;
+    }
+  --index;
+  const TcpTxItem *item = *index->second;
+  return item->m_startSeq + item->m_packet->GetSize () == ack
+         && !item->m_sacked && item->m_retrans;
 }
 
 void
@@ -713,6 +748,7 @@ TcpTxBuffer::DiscardUpTo (const SequenceNumber32& seq,
 
           RemoveFromCounts (item, pktSize);
 
+          UnindexItem (item);
           i = m_sentList.erase (i);
           NS_LOG_INFO ("Removed " << *item << " lost: " << m_lostOut <<
                        " retrans: " << m_retrans << " sacked: " << m_sackedOut <<
@@ -731,8 +767,10 @@ TcpTxBuffer::DiscardUpTo (const SequenceNumber32& seq,
           pktSize -= offset;
           NS_LOG_INFO (*item);
           // PacketTags are preserved when fragmenting
+          UnindexItem (item);
           item->m_packet = item->m_packet->CreateFragment (offset, pktSize);
           item->m_startSeq += offset;
+          IndexItem (i);
           m_size -= offset;
           m_sentSize -= offset;
           m_firstByteSeq += offset;
@@ -762,9 +800,13 @@ TcpTxBuffer::DiscardUpTo (const SequenceNumber32& seq,
           // when adding Reno dupacks in the count.
           head->m_sacked = false;
           m_sackedOut -= head->m_packet->GetSize ();
+          UpdateScoreboard (head);
           NS_LOG_INFO ("Moving the SACK flag from the HEAD to another segment");
-          AddRenoSack ();
+          // MarkHeadAsLost only changes the head, and AddRenoSack never
+          // does: mark the head first, so that the scoreboard is consistent
+          // when AddRenoSack checks it.
           MarkHeadAsLost ();
+          AddRenoSack ();
         }
 
       NS_ASSERT_MSG (head->m_startSeq == seq,
@@ -776,6 +818,10 @@ TcpTxBuffer::DiscardUpTo (const SequenceNumber32& seq,
     {
       m_highestSack = std::make_pair (m_sentList.end (), SequenceNumber32 (0));
     }
+  if (m_lostScanned < m_firstByteSeq)
+    {
+      m_lostScanned = m_firstByteSeq;
+    }
 
   NS_LOG_DEBUG ("Discarded up to " << seq << " lost: " << m_lostOut <<
                 " retrans: " << m_retrans << " sacked: " << m_sackedOut);
@@ -796,26 +842,27 @@ TcpTxBuffer::Update (const TcpOptionSack::SackList &list,
 
   for (auto option_it = list.begin (); option_it != list.end (); ++option_it)
     {
-      PacketList::iterator item_it = m_sentList.begin ();
-      SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
       if (m_firstByteSeq + m_sentSize < (*option_it).first)
         {
           NS_LOG_INFO ("Not updating scoreboard, the option block is outside the sent list");
           return bytesSacked;
         }
 
+      // Start from the first packet which begins inside the block
+      SentIndex::iterator index = m_sentIndex.lower_bound ((*option_it).first);
+      PacketList::iterator item_it = index == m_sentIndex.end () ? m_sentList.end () : index->second;
+
       while (item_it != m_sentList.end ())
         {
           uint32_t pktSize = (*item_it)->m_packet->GetSize ();
+          SequenceNumber32 beginOfCurrentPacket = (*item_it)->m_startSeq;
 
           // Check the boundary of this packet ... only mark as sacked if
           // it is precisely mapped over the option. It means that if the receiver
           // is reporting as sacked single range bytes that are not mapped 1:1
           // in what we have, the option is discarded. There's room for improvement
           // here.
-          if (beginOfCurrentPacket >= (*option_it).first
-              && beginOfCurrentPacket + pktSize <= (*option_it).second)
+          if (beginOfCurrentPacket + pktSize <= (*option_it).second)
             {
               if ((*item_it)->m_sacked)
                 {
@@ -835,6 +882,7 @@ TcpTxBuffer::Update (const TcpOptionSack::SackList &list,
                   (*item_it)->m_sacked = true;
                   m_sackedOut += (*item_it)->m_packet->GetSize ();
                   bytesSacked += (*item_it)->m_packet->GetSize ();
+                  UpdateScoreboard (*item_it);
 
                   if (m_highestSack.first == m_sentList.end()
                       || m_highestSack.second <= beginOfCurrentPacket + pktSize)
@@ -853,7 +901,7 @@ TcpTxBuffer::Update (const TcpOptionSack::SackList &list,
                     }
                 }
             }
-          else if (beginOfCurrentPacket + pktSize > (*option_it).second)
+          else
             {
               // We already passed the received block end. Exit from the loop
               NS_LOG_INFO ("Received block [" << *option_it <<
@@ -862,7 +910,6 @@ TcpTxBuffer::Update (const TcpOptionSack::SackList &list,
               break;
             }
 
-          beginOfCurrentPacket += pktSize;
           ++item_it;
         }
     }
@@ -885,47 +932,43 @@ void
 TcpTxBuffer::UpdateLostCount ()
 {
   NS_LOG_FUNCTION (this);
+  NS_LOG_INFO ("Status before the update: " << *this <<
+               ", highest sack at " << m_highestSack.second);
+
+  // Find the dupAckThresh-th sacked item, counting down from the highest sack
+  SeqSet::const_iterator it = m_sackedIndex.upper_bound (m_highestSack.second);
   uint32_t sacked = 0;
-  SequenceNumber32 beginOfCurrentPacket = m_highestSack.second;
-  if (m_highestSack.first == m_sentList.end ())
+  while (it != m_sackedIndex.begin () && sacked < std::max (m_dupAckThresh, 1U))
     {
-      NS_LOG_INFO ("Status before the update: " << *this <<
-                   ", will start from the latest sent item");
-    }
-  else
-    {
-      NS_LOG_INFO ("Status before the update: " << *this <<
-                   ", will start from item " << *(*m_highestSack.first));
+      --it;
+      ++sacked;
     }
 
-  for (auto it = m_highestSack.first; it != m_sentList.begin(); --it)
+  if (sacked < m_dupAckThresh || sacked == 0)
     {
-      TcpTxItem *item = *it;
-      if (item->m_sacked)
-        {
-          sacked++;
-        }
-
-      if (sacked >= m_dupAckThresh)
-        {
-          if (!item->m_sacked && !item->m_lost)
-            {
-              item->m_lost = true;
-              m_lostOut += item->m_packet->GetSize ();
-            }
-        }
-      beginOfCurrentPacket -= item->m_packet->GetSize ();
+      NS_LOG_INFO ("Only " << sacked << " sacked items, nothing is lost");
+      return;
     }
 
-  if (sacked >= m_dupAckThresh)
+  // All the items which are not sacked below it are lost; the ones below
+  // m_lostScanned are already marked
+  SequenceNumber32 boundary = *it;
+  for (SentIndex::iterator index = m_sentIndex.lower_bound (m_lostScanned);
+       index != m_sentIndex.end () && index->first < boundary; ++index)
     {
-      TcpTxItem *item = *m_sentList.begin ();
-      if (!item->m_lost)
+      TcpTxItem *item = *index->second;
+      if (!item->m_sacked && !item->m_lost)
         {
           item->m_lost = true;
           m_lostOut += item->m_packet->GetSize ();
+          UpdateScoreboard (item);
         }
     }
+  if (m_lostScanned < boundary)
+    {
+      m_lostScanned = boundary;
+    }
+
   NS_LOG_INFO ("Status after the update: " << *this);
   ConsistencyCheck ();
 }
@@ -935,35 +978,27 @@ TcpTxBuffer::IsLost (const SequenceNumber32 &seq) const
 {
   NS_LOG_FUNCTION (this << seq);
 
-  SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-  PacketList::const_iterator it;
-
   if (seq >= m_highestSack.second)
     {
       return false;
     }
 
-  // In theory, using a map and hints when inserting elements can improve
-  // performance
-  for (it = m_sentList.begin (); it != m_sentList.end (); ++it)
+  // Search for the first item at or after seq which is lost or sacked
+  for (SentIndex::const_iterator index = m_sentIndex.lower_bound (seq);
+       index != m_sentIndex.end (); ++index)
     {
-      // Search for the right iterator before calling IsLost()
-      if (beginOfCurrentPacket >= seq)
+      const TcpTxItem *item = *index->second;
+      if (item->m_lost == true)
         {
-          if ((*it)->m_lost == true)
-            {
-              NS_LOG_INFO ("seq=" << seq << " is lost because of lost flag");
-              return true;
-            }
-
-          if ((*it)->m_sacked == true)
-            {
-              NS_LOG_INFO ("seq=" << seq << " is not lost because of sacked flag");
-              return false;
-            }
+          NS_LOG_INFO ("seq=" << seq << " is lost because of lost flag");
+          return true;
         }
 
-      beginOfCurrentPacket += (*it)->m_packet->GetSize ();
+      if (item->m_sacked == true)
+        {
+          NS_LOG_INFO ("seq=" << seq << " is not lost because of sacked flag");
+          return false;
+        }
     }
 
   return false;
@@ -987,36 +1022,23 @@ TcpTxBuffer::NextSeg (SequenceNumber32 *seq, SequenceNumber32 *seqHigh, bool isR
    *
    *     (1.c) IsLost (S2) returns true.
    */
-  PacketList::const_iterator it;
-  TcpTxItem *item;
   SequenceNumber32 seqPerRule3;
   bool isSeqPerRule3Valid = false;
-  SequenceNumber32 beginOfCurrentPkt = m_firstByteSeq;
 
-  for (it = m_sentList.begin (); it != m_sentList.end (); ++it)
+  // Condition 1.a , 1.b , and 1.c: the first lost item, neither sacked nor
+  // retransmitted
+  if (!m_lostIndex.empty ())
     {
-      item = *it;
-
-      // Condition 1.a , 1.b , and 1.c
-      if (item->m_retrans == false && item->m_sacked == false)
-        {
-          if (item->m_lost)
-            {
-              NS_LOG_INFO("IsLost, returning" << beginOfCurrentPkt);
-              *seq = beginOfCurrentPkt;
-              *seqHigh = *seq + m_segmentSize;
-              return true;
-            }
-          else if (seqPerRule3.GetValue () == 0 && isRecovery)
-            {
-              NS_LOG_INFO ("Saving for rule 3 the seq " << beginOfCurrentPkt);
-              isSeqPerRule3Valid = true;
-              seqPerRule3 = beginOfCurrentPkt;
-            }
-        }
-
-      // Nothing found, iterate
-      beginOfCurrentPkt += item->m_packet->GetSize ();
+      NS_LOG_INFO ("IsLost, returning" << *m_lostIndex.begin ());
+      *seq = *m_lostIndex.begin ();
+      *seqHigh = *seq + m_segmentSize;
+      return true;
+    }
+  else if (!m_unsackedIndex.empty () && isRecovery)
+    {
+      NS_LOG_INFO ("Saving for rule 3 the seq " << *m_unsackedIndex.begin ());
+      isSeqPerRule3Valid = true;
+      seqPerRule3 = *m_unsackedIndex.begin ();
     }
 
   /* (2) If no sequence number 'S2' per rule (1) exists but there
@@ -1224,12 +1246,18 @@ TcpTxBuffer::ResetRenoSack ()
   NS_LOG_FUNCTION (this);
 
   m_sackedOut = 0;
-  for (auto it = m_sentList.begin (); it != m_sentList.end (); ++it)
+  SeqSet sacked;
+  sacked.swap (m_sackedIndex);
+  for (auto it = sacked.begin (); it != sacked.end (); ++it)
     {
-      (*it)->m_sacked = false;
+      TcpTxItem *item = *m_sentIndex[*it];
+      item->m_sacked = false;
+      UpdateScoreboard (item);
     }
 
   m_highestSack = std::make_pair (m_sentList.end (), SequenceNumber32 (0));
+  // The items which were sacked are neither sacked nor lost
+  m_lostScanned = m_firstByteSeq;
 }
 
 void
@@ -1254,6 +1282,11 @@ TcpTxBuffer::ResetSentList ()
       m_sentList.pop_back ();
     }
 
+  m_sentIndex.clear ();
+  m_sackedIndex.clear ();
+  m_lostIndex.clear ();
+  m_unsackedIndex.clear ();
+  m_lostScanned = m_firstByteSeq;
   m_sentSize = 0;
   m_lostOut = 0;
   m_retrans = 0;
@@ -1269,6 +1302,7 @@ TcpTxBuffer::ResetLastSegmentSent ()
     {
       TcpTxItem *item = m_sentList.back ();
 
+      UnindexItem (item);
       m_sentList.pop_back ();
       m_sentSize -= item->m_packet->GetSize ();
       if (item->m_retrans)
@@ -1320,6 +1354,7 @@ TcpTxBuffer::SetSentListLost (bool resetSack)
         }
 
       (*it)->m_retrans = false;
+      UpdateScoreboard (*it);
     }
 
   NS_LOG_INFO ("Set sent list lost, status: " << *this);
@@ -1354,6 +1389,7 @@ TcpTxBuffer::DeleteRetransmittedFlagFromHead ()
     {
       m_sentList.front ()->m_retrans = false;
       m_retrans -= m_sentList.front ()->m_packet->GetSize ();
+      UpdateScoreboard (m_sentList.front ());
     }
   ConsistencyCheck ();
 }
@@ -1383,6 +1419,7 @@ TcpTxBuffer::MarkHeadAsLost ()
           m_sentList.front()->m_lost = true;
           m_lostOut += m_sentList.front ()->m_packet->GetSize ();
         }
+      UpdateScoreboard (m_sentList.front ());
     }
   ConsistencyCheck ();
 }
@@ -1417,6 +1454,7 @@ TcpTxBuffer::AddRenoSack (void)
     {
       (*it)->m_sacked = true;
       m_sackedOut += (*it)->m_packet->GetSize ();
+      UpdateScoreboard (*it);
       m_highestSack = std::make_pair (it, (*it)->m_startSeq);
       NS_LOG_INFO ("Added a Reno SACK, status: " << *this);
     }
@@ -1429,6 +1467,49 @@ TcpTxBuffer::AddRenoSack (void)
   ConsistencyCheck ();
 }
 
+void
+TcpTxBuffer::IndexItem (PacketList::iterator it)
+{
+  m_sentIndex[(*it)->m_startSeq] = it;
+  UpdateScoreboard (*it);
+}
+
+void
+TcpTxBuffer::UnindexItem (const TcpTxItem *item)
+{
+  m_sentIndex.erase (item->m_startSeq);
+  m_sackedIndex.erase (item->m_startSeq);
+  m_lostIndex.erase (item->m_startSeq);
+  m_unsackedIndex.erase (item->m_startSeq);
+}
+
+/**
+ * \brief Add or remove a sequence from a set
+ * \param index the set
+ * \param seq the sequence
+ * \param isMember true if the sequence must be in the set
+ */
+static void
+SetMembership (std::set<SequenceNumber32> &index, const SequenceNumber32 &seq, bool isMember)
+{
+  if (isMember)
+    {
+      index.insert (seq);
+    }
+  else
+    {
+      index.erase (seq);
+    }
+}
+
+void
+TcpTxBuffer::UpdateScoreboard (const TcpTxItem *item)
+{
+  SetMembership (m_sackedIndex, item->m_startSeq, item->m_sacked);
+  SetMembership (m_lostIndex, item->m_startSeq, item->m_lost && !item->m_retrans);
+  SetMembership (m_unsackedIndex, item->m_startSeq, !item->m_sacked && !item->m_retrans);
+}
+
 void
 TcpTxBuffer::ConsistencyCheck () const
 {
@@ -1445,6 +1526,13 @@ TcpTxBuffer::ConsistencyCheck () const
 
   for (auto it = m_sentList.begin (); it != m_sentList.end (); ++it)
     {
+      SequenceNumber32 seq = (*it)->m_startSeq;
+      NS_ASSERT_MSG (m_sentIndex.count (seq) == 1 && m_sentIndex.find (seq)->second == it,
+                     "Item " << **it << " is not indexed");
+      NS_ASSERT ((m_sackedIndex.count (seq) == 1) == (*it)->m_sacked);
+      NS_ASSERT ((m_lostIndex.count (seq) == 1) == ((*it)->m_lost && !(*it)->m_retrans));
+      NS_ASSERT ((m_unsackedIndex.count (seq) == 1) == (!(*it)->m_sacked && !(*it)->m_retrans));
+      NS_ASSERT (!(seq < m_lostScanned) || (*it)->m_sacked || (*it)->m_lost);
       if ((*it)->m_sacked)
         {
           sacked += (*it)->m_packet->GetSize ();
@@ -1465,6 +1553,8 @@ TcpTxBuffer::ConsistencyCheck () const
                  " stored lost: " << m_lostOut);
   NS_ASSERT_MSG (retrans == m_retrans, " Counted retrans: " << retrans <<
                  " stored retrans: " << m_retrans);
+  NS_ASSERT (m_sentIndex.size () == m_sentList.size ());
+  NS_ASSERT (m_sackedIndex.size () + m_unsackedIndex.size () <= m_sentList.size ());
 }
 
 std::ostream &
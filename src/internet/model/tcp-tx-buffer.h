@@ -28,6 +28,9 @@
 #include "ns3/tcp-option-sack.h"
 #include "ns3/tcp-tx-item.h"
 
+#include <map>
+#include <set>
+
 namespace ns3 {
 class Packet;
 
@@ -90,6 +93,19 @@ class Packet;
  * segments that can be lost (\see UpdateLostCount), and we set the flags
  * accordingly.
  *
+ * Scoreboard indexes
+ * ------------------
+ *
+ * With large windows, the sent list holds tens of thousands of items, and
+ * walking it for each SACK block, retransmission or loss query makes the
+ * simulation quadratic in the window. Therefore, the sent items are also
+ * indexed by their starting sequence number, and the starting sequences of
+ * the sacked items, of the lost items not retransmitted yet, and of the items
+ * neither sacked nor retransmitted are kept in ordered sets. The indexes are
+ * updated each time an item is added, removed, split, merged or has its flags
+ * changed, so that Update, IsLost, NextSeg and IsRetransmittedDataAcked
+ * only look at the items they return or modify.
+ *
  * Management of bytes in flight
  * -----------------------------
  *
@@ -428,12 +444,35 @@ private:
    * The {New}Reno cases, for now, are managed in TcpSocketBase through the
    * call to MarkHeadAsLost.
    * This function is, therefore, called after a SACK option has been received,
-   * and updates the lost count. It can be probably optimized by not walking
-   * the entire list, but a subset.
-   *
+   * and updates the lost count. The items which are not sacked and are
+   * below the dupAckThresh-th highest sacked item are marked as lost. Since
+   * the lost flag is kept until the item is sacked, only the items above the
+   * previous boundary (m_lostScanned) are visited.
    */
   void UpdateLostCount ();
 
+  /**
+   * \brief Add a sent item to the indexes, replacing any item with the same
+   * starting sequence
+   * \param it the item, in the sent list
+   */
+  void IndexItem (PacketList::iterator it);
+
+  /**
+   * \brief Remove a sent item from the indexes
+   *
+   * To be called before removing the item from the sent list, or before
+   * changing its starting sequence.
+   * \param item the item
+   */
+  void UnindexItem (const TcpTxItem *item);
+
+  /**
+   * \brief Update the scoreboard indexes after a change of the flags of an item
+   * \param item the item, in the sent list
+   */
+  void UpdateScoreboard (const TcpTxItem *item);
+
   /**
    * \brief Remove the size specified from the lostOut, retrans, sacked count
    *
@@ -562,7 +601,7 @@ private:
    */
   TcpTxItem* GetPacketFromList (PacketList &list, const SequenceNumber32 &startingSeq,
                                 uint32_t numBytes, const SequenceNumber32 &requestedSeq,
-                                bool *listEdited = nullptr) const;
+                                bool *listEdited = nullptr);
 
   /**
    * \brief Merge two TcpTxItem
@@ -589,8 +628,8 @@ private:
   void SplitItems (TcpTxItem *t1, TcpTxItem *t2, uint32_t size) const;
 
   /**
-   * \brief Check if the values of sacked, lost, retrans, are in sync
-   * with the sent list.
+   * \brief Check if the values of sacked, lost, retrans, and the indexes
+   * are in sync with the sent list.
    */
   void ConsistencyCheck () const;
 
@@ -601,8 +640,17 @@ private:
   std::pair <TcpTxBuffer::PacketList::const_iterator, SequenceNumber32>
   FindHighestSacked () const;
 
+  /// Index of the sent items, by starting sequence
+  typedef std::map<SequenceNumber32, PacketList::iterator> SentIndex;
+  /// Set of starting sequences of sent items
+  typedef std::set<SequenceNumber32> SeqSet;
+
   PacketList m_appList;  //!< Buffer for application data
   PacketList m_sentList; //!< Buffer for sent (but not acked) data
+  SentIndex m_sentIndex; //!< Sent items, by starting sequence
+  SeqSet m_sackedIndex;  //!< Sacked items
+  SeqSet m_lostIndex;    //!< Lost items, not retransmitted
+  SeqSet m_unsackedIndex; //!< Items neither sacked nor retransmitted
   uint32_t m_maxBuffer;  //!< Max number of data bytes in buffer (SND.WND)
   uint32_t m_size;       //!< Size of all data in this buffer
   uint32_t m_sentSize;   //!< Size of sent (and not discarded) segments
@@ -610,6 +658,7 @@ private:
 
   TracedValue<SequenceNumber32> m_firstByteSeq; //!< Sequence number of the first byte in data (SND.UNA)
   std::pair <PacketList::const_iterator, SequenceNumber32> m_highestSack; //!< Highest SACK byte
+  SequenceNumber32 m_lostScanned; //!< The items below, if not sacked, are lost
 
   uint32_t m_lostOut   {0}; //!< Number of lost bytes
   uint32_t m_sackedOut {0}; //!< Number of sacked bytes
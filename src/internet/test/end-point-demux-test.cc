@@ -0,0 +1,230 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/ipv6-end-point.h"
+
+#include <set>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Addresses of the IPv4 end point demux test.
+ */
+struct Ipv4EndPointDemuxTraits
+{
+  typedef Ipv4EndPointDemux Demux;  //!< The demux
+  typedef Ipv4EndPoint EndPoint;    //!< The end point
+  typedef Ipv4Address Address;      //!< The address
+  typedef Ipv4Interface Interface;  //!< The interface
+
+  /**
+   * \param i the host number
+   * \returns the address of a host
+   */
+  static Address GetAddress (uint32_t i)
+  {
+    return Ipv4Address (0x0a000000 + i);
+  }
+};
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Addresses of the IPv6 end point demux test.
+ */
+struct Ipv6EndPointDemuxTraits
+{
+  typedef Ipv6EndPointDemux Demux;  //!< The demux
+  typedef Ipv6EndPoint EndPoint;    //!< The end point
+  typedef Ipv6Address Address;      //!< The address
+  typedef Ipv6Interface Interface;  //!< The interface
+
+  /**
+   * \param i the host number
+   * \returns the address of a host
+   */
+  static Address GetAddress (uint32_t i)
+  {
+    uint8_t bytes[16] = { 0x20, 0x01, 0x0d, 0xb8 };
+    bytes[12] = i >> 24;
+    bytes[13] = i >> 16;
+    bytes[14] = i >> 8;
+    bytes[15] = i;
+    return Ipv6Address (bytes);
+  }
+};
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check the best-match lookups of an end point demux, as end points
+ * are allocated, connected and removed.
+ */
+template <typename Traits>
+class EndPointDemuxTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param name the address family name
+   */
+  EndPointDemuxTestCase (std::string name);
+
+private:
+  typedef typename Traits::Demux Demux;          //!< The demux
+  typedef typename Traits::EndPoint EndPoint;    //!< The end point
+  typedef typename Traits::Address Address;      //!< The address
+
+  virtual void DoRun (void);
+
+  /**
+   * \param demux the demux
+   * \param daddr destination address
+   * \param dport destination port
+   * \param saddr source address
+   * \param sport source port
+   * \returns the end point found, 0 if none
+   */
+  EndPoint *Lookup (Demux &demux, Address daddr, uint16_t dport, Address saddr, uint16_t sport);
+};
+
+template <typename Traits>
+EndPointDemuxTestCase<Traits>::EndPointDemuxTestCase (std::string name)
+  : TestCase ("Check the lookups of the " + name + " end point demux")
+{}
+
+template <typename Traits>
+typename EndPointDemuxTestCase<Traits>::EndPoint *
+EndPointDemuxTestCase<Traits>::Lookup (Demux &demux, Address daddr, uint16_t dport, Address saddr, uint16_t sport)
+{
+  typename Demux::EndPoints endPoints = demux.Lookup (daddr, dport, saddr, sport,
+                                                      CreateObject<typename Traits::Interface> ());
+  return endPoints.empty () ? 0 : endPoints.front ();
+}
+
+template <typename Traits>
+void
+EndPointDemuxTestCase<Traits>::DoRun (void)
+{
+  Demux demux;
+  Address local = Traits::GetAddress (1);
+  Address any = Address::GetAny ();
+
+  EndPoint *listener = demux.Allocate (0, 80);
+  NS_TEST_ASSERT_MSG_NE (listener, 0, "Listener not allocated");
+  NS_TEST_EXPECT_MSG_EQ (demux.Allocate (0, any, 80), 0, "Duplicated listener allocated");
+  EndPoint *boundListener = demux.Allocate (0, local, 80);
+  NS_TEST_ASSERT_MSG_NE (boundListener, 0, "Listener bound to an address not allocated");
+
+  // Many connections on the same port, as on a server
+  std::vector<EndPoint *> connections;
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      connections.push_back (demux.Allocate (0, local, 80, Traits::GetAddress (100 + i), 1000 + i));
+      NS_TEST_ASSERT_MSG_NE (connections.back (), 0, "Connection not allocated");
+    }
+  NS_TEST_EXPECT_MSG_EQ (demux.Allocate (0, local, 80, Traits::GetAddress (100), 1000), 0,
+                         "Duplicated connection allocated");
+  for (uint32_t i = 0; i < connections.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (Lookup (demux, local, 80, Traits::GetAddress (100 + i), 1000 + i),
+                             connections[i], "Connection not found");
+    }
+
+  // The best match is the listener bound to the address, then the other one
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, local, 80, Traits::GetAddress (100), 999), boundListener,
+                         "Wrong match for a new connection to the bound address");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, Traits::GetAddress (2), 80, Traits::GetAddress (100), 1000), listener,
+                         "Wrong match for a new connection to another address");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, Traits::GetAddress (2), 80, any, 68), listener,
+                         "Wrong match for a packet from an unspecified address");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, local, 81, Traits::GetAddress (100), 1000), 0,
+                         "Match on another port");
+
+  // An end point connected after its allocation
+  EndPoint *client = demux.Allocate (local);
+  NS_TEST_ASSERT_MSG_NE (client, 0, "Client not allocated");
+  uint16_t port = client->GetLocalPort ();
+  NS_TEST_EXPECT_MSG_EQ (demux.LookupPortLocal (port), true, "Ephemeral port not used");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, local, port, Traits::GetAddress (3), 80), client,
+                         "Unconnected client not found");
+  client->SetPeer (Traits::GetAddress (3), 80);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, local, port, Traits::GetAddress (3), 80), client,
+                         "Connected client not found");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, local, port, Traits::GetAddress (4), 80), 0,
+                         "Connected client found for another peer");
+  NS_TEST_EXPECT_MSG_EQ (demux.Allocate (0, local, port, Traits::GetAddress (3), 80), 0,
+                         "Duplicated connected client allocated");
+
+  // Ephemeral ports are not reused while allocated
+  std::set<uint16_t> ports;
+  ports.insert (port);
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      EndPoint *endPoint = demux.Allocate ();
+      NS_TEST_ASSERT_MSG_NE (endPoint, 0, "Ephemeral end point not allocated");
+      NS_TEST_EXPECT_MSG_EQ (ports.insert (endPoint->GetLocalPort ()).second, true, "Ephemeral port reused");
+    }
+
+  // Removals
+  demux.DeAllocate (connections[0]);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, local, 80, Traits::GetAddress (100), 1000), boundListener,
+                         "Removed connection found");
+  demux.DeAllocate (client);
+  NS_TEST_EXPECT_MSG_EQ (demux.LookupPortLocal (port), false, "Port of the removed client used");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (demux, local, port, Traits::GetAddress (3), 80), 0,
+                         "Removed client found");
+  for (uint32_t i = 1; i < connections.size (); i++)
+    {
+      demux.DeAllocate (connections[i]);
+    }
+  demux.DeAllocate (boundListener);
+  demux.DeAllocate (listener);
+  NS_TEST_EXPECT_MSG_EQ (demux.LookupPortLocal (80), false, "Port of the removed end points used");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief End point demux test suite.
+ */
+class EndPointDemuxTestSuite : public TestSuite
+{
+public:
+  EndPointDemuxTestSuite ();
+};
+
+EndPointDemuxTestSuite::EndPointDemuxTestSuite ()
+  : TestSuite ("end-point-demux", UNIT)
+{
+  AddTestCase (new EndPointDemuxTestCase<Ipv4EndPointDemuxTraits> ("IPv4"), TestCase::QUICK);
+  AddTestCase (new EndPointDemuxTestCase<Ipv6EndPointDemuxTraits> ("IPv6"), TestCase::QUICK);
+}
+
+static EndPointDemuxTestSuite g_endPointDemuxTestSuite; //!< Static variable for test initialization
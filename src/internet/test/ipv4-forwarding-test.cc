@@ -26,6 +26,8 @@
 #include "ns3/simple-net-device.h"
 #include "ns3/socket.h"
 #include "ns3/boolean.h"
+#include "ns3/nstime.h"
+#include "ns3/uinteger.h"
 
 #include "ns3/log.h"
 #include "ns3/node.h"
@@ -36,6 +38,7 @@
 #include "ns3/icmpv4-l4-protocol.h"
 #include "ns3/udp-l4-protocol.h"
 #include "ns3/ipv4-static-routing.h"
+#include "ns3/ipv4-list-routing.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-routing-helper.h"
 
@@ -217,6 +220,259 @@ Ipv4ForwardingTest::DoRun (void)
 
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Static routing which counts the packets routed in input.
+ */
+class CountingStaticRouting : public Ipv4StaticRouting
+{
+public:
+  CountingStaticRouting ();
+  virtual bool RouteInput (Ptr<const Packet> p, const Ipv4Header &header, Ptr<const NetDevice> idev,
+                           UnicastForwardCallback ucb, MulticastForwardCallback mcb,
+                           LocalDeliverCallback lcb, ErrorCallback ecb);
+
+  uint32_t m_routeInputs; //!< Number of packets routed in input
+};
+
+CountingStaticRouting::CountingStaticRouting ()
+  : m_routeInputs (0)
+{
+}
+
+bool
+CountingStaticRouting::RouteInput (Ptr<const Packet> p, const Ipv4Header &header, Ptr<const NetDevice> idev,
+                                   UnicastForwardCallback ucb, MulticastForwardCallback mcb,
+                                   LocalDeliverCallback lcb, ErrorCallback ecb)
+{
+  m_routeInputs++;
+  return Ipv4StaticRouting::RouteInput (p, header, idev, ucb, mcb, lcb, ecb);
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Routing protocol which drops all the packets routed in input,
+ * and does not flush the flow cache by itself.
+ */
+class DroppingRouting : public Ipv4RoutingProtocol
+{
+public:
+  DroppingRouting ();
+  virtual Ptr<Ipv4Route> RouteOutput (Ptr<Packet> p, const Ipv4Header &header,
+                                      Ptr<NetDevice> oif, Socket::SocketErrno &sockerr);
+  virtual bool RouteInput (Ptr<const Packet> p, const Ipv4Header &header, Ptr<const NetDevice> idev,
+                           UnicastForwardCallback ucb, MulticastForwardCallback mcb,
+                           LocalDeliverCallback lcb, ErrorCallback ecb);
+  virtual void NotifyInterfaceUp (uint32_t interface) {}
+  virtual void NotifyInterfaceDown (uint32_t interface) {}
+  virtual void NotifyAddAddress (uint32_t interface, Ipv4InterfaceAddress address) {}
+  virtual void NotifyRemoveAddress (uint32_t interface, Ipv4InterfaceAddress address) {}
+  virtual void SetIpv4 (Ptr<Ipv4> ipv4) {}
+  virtual void PrintRoutingTable (Ptr<OutputStreamWrapper> stream, Time::Unit unit) const {}
+
+  uint32_t m_routeInputs; //!< Number of packets routed in input
+};
+
+DroppingRouting::DroppingRouting ()
+  : m_routeInputs (0)
+{
+}
+
+Ptr<Ipv4Route>
+DroppingRouting::RouteOutput (Ptr<Packet> p, const Ipv4Header &header,
+                              Ptr<NetDevice> oif, Socket::SocketErrno &sockerr)
+{
+  sockerr = Socket::ERROR_NOROUTETOHOST;
+  return 0;
+}
+
+bool
+DroppingRouting::RouteInput (Ptr<const Packet> p, const Ipv4Header &header, Ptr<const NetDevice> idev,
+                             UnicastForwardCallback ucb, MulticastForwardCallback mcb,
+                             LocalDeliverCallback lcb, ErrorCallback ecb)
+{
+  m_routeInputs++;
+  ecb (p, header, Socket::ERROR_NOROUTETOHOST);
+  return true;
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 Forwarding Flow Cache Test
+ *
+ * Check that the packets of a flow are forwarded with the cached route,
+ * and that the routing protocol is used again when the route expires or
+ * when the routes change.
+ */
+class Ipv4FlowCacheTest : public TestCase
+{
+  uint32_t m_received; //!< Number of received packets
+  uint8_t m_tos;       //!< TOS of the packets sent
+
+  /**
+   * \brief Send data.
+   * \param socket The sending socket.
+   */
+  void DoSendData (Ptr<Socket> socket);
+  /**
+   * \brief Send data.
+   * \param socket The sending socket.
+   * \param delay The delay before sending.
+   */
+  void SendData (Ptr<Socket> socket, Time delay);
+
+public:
+  virtual void DoRun (void);
+  Ipv4FlowCacheTest ();
+
+  /**
+   * \brief Receive data.
+   * \param socket The receiving socket.
+   */
+  void ReceivePkt (Ptr<Socket> socket);
+};
+
+Ipv4FlowCacheTest::Ipv4FlowCacheTest ()
+  : TestCase ("IPv4 forwarding with the flow cache"),
+    m_received (0),
+    m_tos (0)
+{
+}
+
+void Ipv4FlowCacheTest::ReceivePkt (Ptr<Socket> socket)
+{
+  while (socket->Recv ())
+    {
+      m_received++;
+    }
+}
+
+void
+Ipv4FlowCacheTest::DoSendData (Ptr<Socket> socket)
+{
+  InetSocketAddress realTo = InetSocketAddress (Ipv4Address ("10.0.0.2"), 1234);
+  realTo.SetTos (m_tos);
+  NS_TEST_EXPECT_MSG_EQ (socket->SendTo (Create<Packet> (123), 0, realTo), 123, "Packet not sent");
+}
+
+void
+Ipv4FlowCacheTest::SendData (Ptr<Socket> socket, Time delay)
+{
+  Simulator::ScheduleWithContext (socket->GetNode ()->GetId (), delay,
+                                  &Ipv4FlowCacheTest::DoSendData, this, socket);
+  Simulator::Run ();
+}
+
+void
+Ipv4FlowCacheTest::DoRun (void)
+{
+  InternetStackHelper internet;
+  internet.SetIpv6StackInstall (false);
+  NodeContainer nodes;
+  nodes.Create (3);
+  internet.Install (nodes);
+  Ptr<Node> rxNode = nodes.Get (0);
+  Ptr<Node> fwNode = nodes.Get (1);
+  Ptr<Node> txNode = nodes.Get (2);
+
+  Ptr<Ipv4L3Protocol> fwIpv4 = fwNode->GetObject<Ipv4L3Protocol> ();
+  fwIpv4->SetAttribute ("FlowCacheTimeout", TimeValue (Seconds (10)));
+  Ptr<CountingStaticRouting> routing = CreateObject<CountingStaticRouting> ();
+  fwIpv4->SetRoutingProtocol (routing);
+
+  // rxNode 10.0.0.2 <-> 10.0.0.1 fwNode 10.1.0.1 <-> 10.1.0.2 txNode
+  const char *addresses[][2] = { { "10.0.0.2", "10.0.0.1" }, { "10.1.0.1", "10.1.0.2" } };
+  Ptr<Node> linkNodes[][2] = { { rxNode, fwNode }, { fwNode, txNode } };
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+      for (uint32_t j = 0; j < 2; j++)
+        {
+          Ptr<SimpleNetDevice> dev = CreateObject<SimpleNetDevice> ();
+          dev->SetAddress (Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
+          dev->SetChannel (channel);
+          linkNodes[i][j]->AddDevice (dev);
+          Ptr<Ipv4> ipv4 = linkNodes[i][j]->GetObject<Ipv4> ();
+          uint32_t netdev_idx = ipv4->AddInterface (dev);
+          ipv4->AddAddress (netdev_idx, Ipv4InterfaceAddress (Ipv4Address (addresses[i][j]), Ipv4Mask (0xffff0000U)));
+          ipv4->SetUp (netdev_idx);
+        }
+    }
+  Ptr<Ipv4StaticRouting> txRouting = Ipv4RoutingHelper::GetRouting <Ipv4StaticRouting> (txNode->GetObject<Ipv4> ()->GetRoutingProtocol ());
+  txRouting->SetDefaultRoute (Ipv4Address ("10.1.0.1"), 1);
+
+  Ptr<Socket> rxSocket = rxNode->GetObject<UdpSocketFactory> ()->CreateSocket ();
+  NS_TEST_EXPECT_MSG_EQ (rxSocket->Bind (InetSocketAddress (Ipv4Address ("10.0.0.2"), 1234)), 0, "trivial");
+  rxSocket->SetRecvCallback (MakeCallback (&Ipv4FlowCacheTest::ReceivePkt, this));
+  Ptr<Socket> txSocket = txNode->GetObject<UdpSocketFactory> ()->CreateSocket ();
+
+  // Only the first packet of the flow is routed by the routing protocol
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      SendData (txSocket, Seconds (0));
+    }
+  NS_TEST_EXPECT_MSG_EQ (m_received, 3, "Packets not forwarded");
+  NS_TEST_EXPECT_MSG_EQ (routing->m_routeInputs, 1, "Packets not forwarded with the cached route");
+
+  // The cached route expires
+  SendData (txSocket, Seconds (20));
+  NS_TEST_EXPECT_MSG_EQ (m_received, 4, "Packet not forwarded after the expiration");
+  NS_TEST_EXPECT_MSG_EQ (routing->m_routeInputs, 2, "Expired route used");
+
+  // A route change flushes the cache: the packets go to an unknown gateway
+  routing->AddHostRouteTo (Ipv4Address ("10.0.0.2"), Ipv4Address ("10.1.0.3"), 2);
+  SendData (txSocket, Seconds (0));
+  NS_TEST_EXPECT_MSG_EQ (m_received, 4, "Packet forwarded with a stale route");
+  NS_TEST_EXPECT_MSG_EQ (routing->m_routeInputs, 3, "Cache not flushed by the route change");
+  routing->RemoveRoute (routing->GetNRoutes () - 1);
+  SendData (txSocket, Seconds (0));
+  NS_TEST_EXPECT_MSG_EQ (m_received, 5, "Packet not forwarded after the route removal");
+
+  // When the cache is full, the least recently used flow is evicted. The
+  // flows differ by their TOS.
+  fwIpv4->SetAttribute ("FlowCacheSize", UintegerValue (2));
+  fwIpv4->FlushFlowCache ();
+  uint32_t routeInputs = routing->m_routeInputs;
+  const uint8_t tos[] = { 0, 4, 0, 8, 0, 4 };  // flows A, B, A, C, A, B
+  for (uint32_t i = 0; i < sizeof (tos); i++)
+    {
+      m_tos = tos[i];
+      SendData (txSocket, Seconds (0));
+    }
+  m_tos = 0;
+  NS_TEST_EXPECT_MSG_EQ (m_received, 11, "Packets not forwarded");
+  // A, B and C are routed, then B again, evicted by C
+  NS_TEST_EXPECT_MSG_EQ (routing->m_routeInputs - routeInputs, 4, "Wrong flow evicted from the cache");
+
+  // A protocol added to a list routing flushes the cache
+  Ptr<Ipv4ListRouting> list = CreateObject<Ipv4ListRouting> ();
+  list->AddRoutingProtocol (CreateObject<Ipv4StaticRouting> (), 0);
+  fwIpv4->SetRoutingProtocol (list);
+  SendData (txSocket, Seconds (0));
+  NS_TEST_EXPECT_MSG_EQ (m_received, 12, "Packet not forwarded by the list routing");
+  Ptr<DroppingRouting> preferred = CreateObject<DroppingRouting> ();
+  list->AddRoutingProtocol (preferred, 10);
+  SendData (txSocket, Seconds (0));
+  NS_TEST_EXPECT_MSG_EQ (m_received, 12, "Packet forwarded with a stale route");
+  NS_TEST_EXPECT_MSG_EQ (preferred->m_routeInputs, 1, "Cache not flushed by the new protocol");
+  fwIpv4->SetRoutingProtocol (CreateObject<Ipv4StaticRouting> ());
+  SendData (txSocket, Seconds (0));
+  NS_TEST_EXPECT_MSG_EQ (m_received, 13, "Packet not forwarded by the static routing");
+
+  // An interface going down flushes the cache
+  fwIpv4->SetDown (1);
+  SendData (txSocket, Seconds (0));
+  NS_TEST_EXPECT_MSG_EQ (m_received, 13, "Packet forwarded on an interface down");
+
+  Simulator::Destroy ();
+}
+
 
 /**
  * \ingroup internet-test
@@ -235,6 +491,7 @@ Ipv4ForwardingTestSuite::Ipv4ForwardingTestSuite ()
   : TestSuite ("ipv4-forwarding", UNIT)
 {
   AddTestCase (new Ipv4ForwardingTest, TestCase::QUICK);
+  AddTestCase (new Ipv4FlowCacheTest, TestCase::QUICK);
 }
 
 static Ipv4ForwardingTestSuite g_ipv4forwardingTestSuite; //!< Static variable for test initialization
@@ -42,6 +42,9 @@
 #include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/ipv4-global-routing.h"
 #include "ns3/bridge-helper.h"
+#include "ns3/global-route-manager-impl.h"
+#include "ns3/simulation-singleton.h"
+#include <sstream>
 
 using namespace ns3;
 
@@ -1244,6 +1247,134 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Compare the routes recomputed by several threads, or incrementally,
+ * with those of a full recomputation.
+ *
+ * The network is a 4x4 grid of routers connected by point-to-point links,
+ * each router having a host attached by another point-to-point link.
+ */
+class Ipv4GlobalRoutingRecomputeTestCase : public TestCase
+{
+public:
+  Ipv4GlobalRoutingRecomputeTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * \returns the routes of all the nodes, as a string
+   */
+  std::string GetRoutes (void) const;
+
+  NodeContainer m_nodes; //!< Nodes used in the test.
+};
+
+Ipv4GlobalRoutingRecomputeTestCase::Ipv4GlobalRoutingRecomputeTestCase ()
+  : TestCase ("Global routing recomputed by several threads and incrementally")
+{
+}
+
+std::string
+Ipv4GlobalRoutingRecomputeTestCase::GetRoutes (void) const
+{
+  std::ostringstream oss;
+  for (uint32_t i = 0; i < m_nodes.GetN (); i++)
+    {
+      Ptr<Ipv4GlobalRouting> globalRouting =
+        m_nodes.Get (i)->GetObject<Ipv4> ()->GetRoutingProtocol ()->GetObject<Ipv4GlobalRouting> ();
+      oss << "node " << i << std::endl;
+      for (uint32_t j = 0; j < globalRouting->GetNRoutes (); j++)
+        {
+          Ipv4RoutingTableEntry *route = globalRouting->GetRoute (j);
+          oss << route->GetDest () << "/" << route->GetDestNetworkMask ()
+              << " gw " << route->GetGateway ()
+              << " if " << route->GetInterface () << std::endl;
+        }
+    }
+  return oss.str ();
+}
+
+void
+Ipv4GlobalRoutingRecomputeTestCase::DoRun (void)
+{
+  const uint32_t side = 4;
+  NodeContainer routers;
+  routers.Create (side * side);
+  NodeContainer hosts;
+  hosts.Create (side * side);
+  m_nodes.Add (routers);
+  m_nodes.Add (hosts);
+
+  InternetStackHelper internet;
+  Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+  internet.SetRoutingHelper (ipv4RoutingHelper);
+  internet.Install (m_nodes);
+
+  SimpleNetDeviceHelper simpleHelper;
+  simpleHelper.SetNetDevicePointToPointMode (true);
+  Ipv4AddressHelper ipv4;
+  ipv4.SetBase ("10.1.0.0", "255.255.255.252");
+  NetDeviceContainer firstLink;
+  for (uint32_t i = 0; i < side * side; i++)
+    {
+      if (i % side + 1 < side)
+        {
+          NetDeviceContainer link = simpleHelper.Install (NodeContainer (routers.Get (i), routers.Get (i + 1)));
+          ipv4.Assign (link);
+          ipv4.NewNetwork ();
+          if (i == 0)
+            {
+              firstLink = link;
+            }
+        }
+      if (i + side < side * side)
+        {
+          ipv4.Assign (simpleHelper.Install (NodeContainer (routers.Get (i), routers.Get (i + side))));
+          ipv4.NewNetwork ();
+        }
+      ipv4.Assign (simpleHelper.Install (NodeContainer (routers.Get (i), hosts.Get (i))));
+      ipv4.NewNetwork ();
+    }
+
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+  GlobalRouteManagerImpl *impl = SimulationSingleton<GlobalRouteManagerImpl>::Get ();
+  NS_TEST_EXPECT_MSG_EQ (impl->DebugGetNSPFCalculations (), 2 * side * side, "Wrong number of SPF calculations");
+  std::string routes = GetRoutes ();
+
+  Config::SetGlobal ("GlobalRoutingThreads", UintegerValue (4));
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  NS_TEST_EXPECT_MSG_EQ (GetRoutes (), routes, "Different routes computed by several threads");
+
+  // The first incremental recomputation recomputes everything, and records
+  // the dependencies of the routers
+  Config::SetGlobal ("GlobalRoutingIncremental", BooleanValue (true));
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  NS_TEST_EXPECT_MSG_EQ (impl->DebugGetNSPFCalculations (), 2 * side * side, "Wrong number of SPF calculations");
+  NS_TEST_EXPECT_MSG_EQ (GetRoutes (), routes, "Different routes computed incrementally");
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  NS_TEST_EXPECT_MSG_EQ (impl->DebugGetNSPFCalculations (), 0, "SPF calculations without any change");
+  NS_TEST_EXPECT_MSG_EQ (GetRoutes (), routes, "Different routes computed incrementally");
+
+  // Take the link between the first two routers down: the routers, and the
+  // hosts of these two routers, are recomputed
+  Ptr<Ipv4> ipv40 = routers.Get (0)->GetObject<Ipv4> ();
+  ipv40->SetDown (ipv40->GetInterfaceForDevice (firstLink.Get (0)));
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  NS_TEST_EXPECT_MSG_EQ (impl->DebugGetNSPFCalculations (), side * side + 2, "Wrong number of SPF calculations");
+  std::string incrementalRoutes = GetRoutes ();
+  NS_TEST_EXPECT_MSG_NE (incrementalRoutes, routes, "Routes not changed by the link down");
+
+  Config::SetGlobal ("GlobalRoutingIncremental", BooleanValue (false));
+  Config::SetGlobal ("GlobalRoutingThreads", UintegerValue (1));
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  NS_TEST_EXPECT_MSG_EQ (GetRoutes (), incrementalRoutes, "Different routes computed incrementally");
+
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -1267,6 +1398,7 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite ()
     AddTestCase (new TwoBridgeTest, TestCase::QUICK);
     AddTestCase (new Ipv4DynamicGlobalRoutingTestCase, TestCase::QUICK);
     AddTestCase (new Ipv4GlobalRoutingSlash32TestCase, TestCase::QUICK);
+    AddTestCase (new Ipv4GlobalRoutingRecomputeTestCase, TestCase::QUICK);
   }
 
 static Ipv4GlobalRoutingTestSuite g_globalRoutingTestSuite; //!< Static variable for test initialization
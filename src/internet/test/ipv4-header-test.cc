@@ -43,6 +43,7 @@
 #include <string>
 #include <sstream>
 #include <limits>
+#include <cstring>
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -265,6 +266,120 @@ Ipv4HeaderTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 Header Checksum Update Test
+ *
+ * Check that the checksum of a received header, updated as its TTL and
+ * addresses change, is the checksum computed for the new fields.
+ */
+class Ipv4HeaderChecksumTest : public TestCase
+{
+  /**
+   * \brief Serialize a header.
+   * \param header The header.
+   * \return The serialized header.
+   */
+  Buffer Serialize (const Ipv4Header &header);
+  /**
+   * \brief Deserialize a header, with the checksum enabled.
+   * \param buffer The serialized header.
+   * \return The header.
+   */
+  Ipv4Header Deserialize (const Buffer &buffer);
+  /**
+   * \brief Compare two serialized headers.
+   * \param actual The serialized header.
+   * \param expected The expected serialized header.
+   * \return true if the headers are equal.
+   */
+  bool IsEqual (const Buffer &actual, const Buffer &expected);
+
+public:
+  virtual void DoRun (void);
+  Ipv4HeaderChecksumTest ();
+};
+
+Ipv4HeaderChecksumTest::Ipv4HeaderChecksumTest ()
+  : TestCase ("IPv4 Header checksum update")
+{
+}
+
+Buffer
+Ipv4HeaderChecksumTest::Serialize (const Ipv4Header &header)
+{
+  Buffer buffer;
+  buffer.AddAtStart (header.GetSerializedSize ());
+  header.Serialize (buffer.Begin ());
+  return buffer;
+}
+
+Ipv4Header
+Ipv4HeaderChecksumTest::Deserialize (const Buffer &buffer)
+{
+  Ipv4Header header;
+  header.EnableChecksum ();
+  header.Deserialize (buffer.Begin ());
+  return header;
+}
+
+bool
+Ipv4HeaderChecksumTest::IsEqual (const Buffer &actual, const Buffer &expected)
+{
+  return actual.GetSize () == expected.GetSize ()
+         && std::memcmp (actual.PeekData (), expected.PeekData (), actual.GetSize ()) == 0;
+}
+
+void
+Ipv4HeaderChecksumTest::DoRun (void)
+{
+  Ipv4Header header;
+  header.EnableChecksum ();
+  header.SetSource (Ipv4Address ("10.1.2.3"));
+  header.SetDestination (Ipv4Address ("192.168.254.1"));
+  header.SetProtocol (6);
+  header.SetPayloadSize (1000);
+  header.SetIdentification (0xabcd);
+  header.SetTos (0x28);
+
+  for (uint32_t ttl = 255; ttl > 0; ttl--)
+    {
+      header.SetTtl (ttl);
+      Ipv4Header received = Deserialize (Serialize (header));
+      NS_TEST_ASSERT_MSG_EQ (received.IsChecksumOk (), true, "Bad checksum for TTL " << ttl);
+      received.SetTtl (ttl - 1);
+      Ipv4Header expected = header;
+      expected.SetTtl (ttl - 1);
+      NS_TEST_ASSERT_MSG_EQ (IsEqual (Serialize (received), Serialize (expected)), true, "Checksum not updated for TTL " << ttl);
+    }
+
+  // Address rewrites, as a NAT does
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      Ipv4Header received = Deserialize (Serialize (header));
+      Ipv4Address source (0x01000000 * (i % 256) + 0x00ff00ff * i);
+      Ipv4Address destination (0xffffffff - 0x00010203 * i);
+      received.SetSource (source);
+      received.SetDestination (destination);
+      Ipv4Header expected = header;
+      expected.SetSource (source);
+      expected.SetDestination (destination);
+      NS_TEST_ASSERT_MSG_EQ (IsEqual (Serialize (received), Serialize (expected)), true, "Checksum not updated for " << source << " > " << destination);
+      NS_TEST_ASSERT_MSG_EQ (Deserialize (Serialize (received)).IsChecksumOk (), true, "Bad updated checksum");
+    }
+
+  // Other changes compute the checksum again
+  Ipv4Header received = Deserialize (Serialize (header));
+  received.SetEcn (Ipv4Header::ECN_CE);
+  received.SetTtl (3);
+  Ipv4Header expected = header;
+  expected.SetEcn (Ipv4Header::ECN_CE);
+  expected.SetTtl (3);
+  NS_TEST_ASSERT_MSG_EQ (IsEqual (Serialize (received), Serialize (expected)), true, "Checksum not computed again");
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -277,6 +392,7 @@ public:
   Ipv4HeaderTestSuite () : TestSuite ("ipv4-header", UNIT)
   {
     AddTestCase (new Ipv4HeaderTest, TestCase::QUICK);
+    AddTestCase (new Ipv4HeaderChecksumTest, TestCase::QUICK);
   }
 };
 
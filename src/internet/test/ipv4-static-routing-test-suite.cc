@@ -35,6 +35,9 @@
 #include "ns3/simple-net-device-helper.h"
 #include "ns3/socket-factory.h"
 #include "ns3/udp-socket-factory.h"
+#include "ns3/ipv4-static-routing.h"
+#include "ns3/ipv4-route.h"
+#include "ns3/ipv4-routing-table-entry.h"
 
 using namespace ns3;
 
@@ -201,6 +204,108 @@ Ipv4StaticRoutingSlash32TestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 StaticRouting route selection Test: longest prefix match,
+ * then shortest metric, with routes added and removed between lookups.
+ */
+class Ipv4StaticRoutingSelectionTestCase : public TestCase
+{
+public:
+  Ipv4StaticRoutingSelectionTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Look up a route.
+   * \param dest the destination address
+   * \param oif the output device, or 0
+   * \returns the gateway of the route, or 0.0.0.0 if no route was found
+   */
+  Ipv4Address Lookup (std::string dest, Ptr<NetDevice> oif = 0);
+
+  Ptr<Ipv4StaticRouting> m_routing; //!< the routing protocol
+};
+
+Ipv4StaticRoutingSelectionTestCase::Ipv4StaticRoutingSelectionTestCase ()
+  : TestCase ("Static routing route selection")
+{
+}
+
+Ipv4Address
+Ipv4StaticRoutingSelectionTestCase::Lookup (std::string dest, Ptr<NetDevice> oif)
+{
+  Ipv4Header header;
+  header.SetDestination (Ipv4Address (dest.c_str ()));
+  Socket::SocketErrno sockerr;
+  Ptr<Ipv4Route> route = m_routing->RouteOutput (Create<Packet> (), header, oif, sockerr);
+  return route != 0 ? route->GetGateway () : Ipv4Address::GetZero ();
+}
+
+void
+Ipv4StaticRoutingSelectionTestCase::DoRun (void)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  Ptr<SimpleNetDevice> devices[2];
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      devices[i] = CreateObject<SimpleNetDevice> ();
+      devices[i]->SetAddress (Mac48Address::Allocate ());
+      node->AddDevice (devices[i]);
+      int32_t ifIndex = ipv4->AddInterface (devices[i]);
+      std::ostringstream address;
+      address << i + 1 << ".0.0.1";
+      ipv4->AddAddress (ifIndex, Ipv4InterfaceAddress (Ipv4Address (address.str ().c_str ()), Ipv4Mask ("/8")));
+      ipv4->SetUp (ifIndex);
+    }
+
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  m_routing = ipv4RoutingHelper.GetStaticRouting (ipv4);
+  m_routing->SetDefaultRoute (Ipv4Address ("1.0.0.7"), 1);
+  m_routing->AddNetworkRouteTo (Ipv4Address ("10.0.0.0"), Ipv4Mask ("/8"), Ipv4Address ("1.0.0.2"), 1);
+  m_routing->AddNetworkRouteTo (Ipv4Address ("10.1.0.0"), Ipv4Mask ("/16"), Ipv4Address ("1.0.0.3"), 1, 5);
+  m_routing->AddNetworkRouteTo (Ipv4Address ("10.1.0.0"), Ipv4Mask ("/16"), Ipv4Address ("1.0.0.4"), 1, 2);
+  m_routing->AddNetworkRouteTo (Ipv4Address ("10.1.0.0"), Ipv4Mask ("/16"), Ipv4Address ("1.0.0.5"), 1, 2);
+  m_routing->AddNetworkRouteTo (Ipv4Address ("10.1.7.0"), Ipv4Mask ("/24"), Ipv4Address ("2.0.0.2"), 2, 9);
+  m_routing->AddHostRouteTo (Ipv4Address ("10.1.2.3"), Ipv4Address ("1.0.0.6"), 1, 9);
+  m_routing->AddHostRouteTo (Ipv4Address ("10.1.2.3"), Ipv4Address ("1.0.0.8"), 1, 1);
+
+  // The first host route, whatever its metric
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.2.3"), Ipv4Address ("1.0.0.6"), "Wrong host route");
+  // The last of the routes with the shortest metric
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.2.4"), Ipv4Address ("1.0.0.5"), "Wrong /16 route");
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.7.1"), Ipv4Address ("2.0.0.2"), "Wrong /24 route");
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.2.0.1"), Ipv4Address ("1.0.0.2"), "Wrong /8 route");
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("11.0.0.1"), Ipv4Address ("1.0.0.7"), "Wrong default route");
+  // The longest prefix among the routes through the output device
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.7.1", devices[0]), Ipv4Address ("1.0.0.5"), "Wrong /16 route on device");
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.7.1", devices[1]), Ipv4Address ("2.0.0.2"), "Wrong /24 route on device");
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.2.3", devices[1]), Ipv4Address ("0.0.0.0"), "Unexpected route on device");
+
+  // Routes removed and added after lookups
+  for (uint32_t i = 0; i < m_routing->GetNRoutes (); i++)
+    {
+      if (m_routing->GetRoute (i).GetGateway () == Ipv4Address ("1.0.0.6"))
+        {
+          m_routing->RemoveRoute (i);
+          break;
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.2.3"), Ipv4Address ("1.0.0.8"), "Wrong host route after removal");
+  ipv4->SetDown (2);
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.7.1"), Ipv4Address ("1.0.0.5"), "Wrong route after interface down");
+  m_routing->AddNetworkRouteTo (Ipv4Address ("10.1.7.0"), Ipv4Mask ("/24"), Ipv4Address ("1.0.0.9"), 1);
+  NS_TEST_EXPECT_MSG_EQ (Lookup ("10.1.7.1"), Ipv4Address ("1.0.0.9"), "Wrong route after addition");
+
+  m_routing = 0;
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -217,6 +322,7 @@ Ipv4StaticRoutingTestSuite::Ipv4StaticRoutingTestSuite ()
   : TestSuite ("ipv4-static-routing", UNIT)
 {
   AddTestCase (new Ipv4StaticRoutingSlash32TestCase, TestCase::QUICK);
+  AddTestCase (new Ipv4StaticRoutingSelectionTestCase, TestCase::QUICK);
 }
 
 static Ipv4StaticRoutingTestSuite ipv4StaticRoutingTestSuite; //!< Static variable for test initialization
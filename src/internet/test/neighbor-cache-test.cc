@@ -0,0 +1,244 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/mac48-address.h"
+#include "ns3/arp-cache.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/ipv6-interface.h"
+#include "ns3/ndisc-cache.h"
+#include "ns3/icmpv6-l4-protocol.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check the retries of the ARP cache entries waiting for a reply.
+ */
+class ArpCacheWaitReplyTestCase : public TestCase
+{
+public:
+  ArpCacheWaitReplyTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Count an ARP request.
+   * \param cache the ARP cache
+   * \param address the address to resolve
+   */
+  void Request (Ptr<const ArpCache> cache, Ipv4Address address);
+  /**
+   * Count a dropped packet.
+   * \param p the packet
+   */
+  void Drop (Ptr<const Packet> p);
+  /**
+   * Mark alive the entries of the even addresses.
+   * \param cache the ARP cache
+   */
+  void Reply (Ptr<ArpCache> cache);
+
+  uint32_t m_requests; //!< Number of ARP requests
+  uint32_t m_drops;    //!< Number of dropped packets
+};
+
+ArpCacheWaitReplyTestCase::ArpCacheWaitReplyTestCase ()
+  : TestCase ("Check the retries of the ARP cache entries waiting for a reply"),
+    m_requests (0),
+    m_drops (0)
+{}
+
+void
+ArpCacheWaitReplyTestCase::Request (Ptr<const ArpCache> cache, Ipv4Address address)
+{
+  m_requests++;
+  NS_TEST_EXPECT_MSG_EQ (address.Get () % 2, 1, "Request for a resolved address");
+}
+
+void
+ArpCacheWaitReplyTestCase::Drop (Ptr<const Packet> p)
+{
+  m_drops++;
+}
+
+void
+ArpCacheWaitReplyTestCase::Reply (Ptr<ArpCache> cache)
+{
+  for (uint32_t i = 0; i < 100; i += 2)
+    {
+      cache->Lookup (Ipv4Address (0x0a000000 + i))->MarkAlive (Mac48Address::Allocate ());
+    }
+}
+
+void
+ArpCacheWaitReplyTestCase::DoRun (void)
+{
+  Ptr<ArpCache> cache = CreateObject<ArpCache> ();
+  cache->SetArpRequestCallback (MakeCallback (&ArpCacheWaitReplyTestCase::Request, this));
+  cache->TraceConnectWithoutContext ("Drop", MakeCallback (&ArpCacheWaitReplyTestCase::Drop, this));
+
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      ArpCache::Entry *entry = cache->Add (Ipv4Address (0x0a000000 + i));
+      entry->MarkWaitReply (ArpCache::Ipv4PayloadHeaderPair (Create<Packet> (), Ipv4Header ()));
+    }
+  Simulator::Schedule (MilliSeconds (500), &ArpCacheWaitReplyTestCase::Reply, this, cache);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_requests, 50 * 3, "Wrong number of retries");
+  NS_TEST_EXPECT_MSG_EQ (m_drops, 50, "Wrong number of dropped packets");
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      ArpCache::Entry *entry = cache->Lookup (Ipv4Address (0x0a000000 + i));
+      NS_TEST_ASSERT_MSG_NE (entry, 0, "Entry not found");
+      NS_TEST_EXPECT_MSG_EQ ((i % 2 == 0 ? entry->IsAlive () : entry->IsDead ()), true,
+                             "Wrong state for entry " << i);
+    }
+  cache->Remove (cache->Lookup (Ipv4Address (0x0a000000)));
+  NS_TEST_EXPECT_MSG_EQ (cache->Lookup (Ipv4Address (0x0a000000)), 0, "Removed entry found");
+
+  cache->Dispose ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check the expiration of the NUD timers of the NDISC cache entries.
+ */
+class NdiscCacheNudTimersTestCase : public TestCase
+{
+public:
+  NdiscCacheNudTimersTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \param i the host number
+   * \returns the address of a host
+   */
+  static Ipv6Address GetAddress (uint32_t i);
+  /**
+   * Confirm the reachability of the even hosts.
+   * \param cache the NDISC cache
+   */
+  void Confirm (Ptr<NdiscCache> cache);
+  /**
+   * Check the state of the entries.
+   * \param cache the NDISC cache
+   * \param reachable whether the even hosts should be still reachable
+   */
+  void Check (Ptr<NdiscCache> cache, bool reachable);
+};
+
+NdiscCacheNudTimersTestCase::NdiscCacheNudTimersTestCase ()
+  : TestCase ("Check the expiration of the NUD timers of the NDISC cache entries")
+{}
+
+Ipv6Address
+NdiscCacheNudTimersTestCase::GetAddress (uint32_t i)
+{
+  uint8_t bytes[16] = { 0x20, 0x01, 0x0d, 0xb8 };
+  bytes[14] = i >> 8;
+  bytes[15] = i;
+  return Ipv6Address (bytes);
+}
+
+void
+NdiscCacheNudTimersTestCase::Confirm (Ptr<NdiscCache> cache)
+{
+  for (uint32_t i = 0; i < 1000; i += 2)
+    {
+      cache->Lookup (GetAddress (i))->UpdateReachableTimer ();
+    }
+}
+
+void
+NdiscCacheNudTimersTestCase::Check (Ptr<NdiscCache> cache, bool reachable)
+{
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      NdiscCache::Entry *entry = cache->Lookup (GetAddress (i));
+      NS_TEST_ASSERT_MSG_NE (entry, 0, "Entry not found");
+      bool expected = reachable && i % 2 == 0;
+      NS_TEST_EXPECT_MSG_EQ (entry->IsReachable (), expected, "Wrong state for entry " << i);
+      NS_TEST_EXPECT_MSG_EQ (entry->IsStale (), !expected, "Wrong state for entry " << i);
+    }
+}
+
+void
+NdiscCacheNudTimersTestCase::DoRun (void)
+{
+  Ptr<Icmpv6L4Protocol> icmpv6 = CreateObject<Icmpv6L4Protocol> ();
+  icmpv6->SetAttribute ("ReachableTime", TimeValue (Seconds (30)));
+  Ptr<NdiscCache> cache = CreateObject<NdiscCache> ();
+  cache->SetDevice (0, 0, icmpv6);
+
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      NdiscCache::Entry *entry = cache->Add (GetAddress (i));
+      entry->MarkReachable (Mac48Address::Allocate ());
+      entry->StartReachableTimer ();
+    }
+  Simulator::Schedule (Seconds (10), &NdiscCacheNudTimersTestCase::Confirm, this, cache);
+  Simulator::Schedule (Seconds (35), &NdiscCacheNudTimersTestCase::Check, this, cache, true);
+  Simulator::Schedule (Seconds (45), &NdiscCacheNudTimersTestCase::Check, this, cache, false);
+  Simulator::Run ();
+
+  // The timers expiring together are handled by a single event
+  NS_TEST_EXPECT_MSG_LT (Simulator::GetEventCount (), 10, "One event per timer");
+
+  // Removing an entry with a running timer
+  NdiscCache::Entry *entry = cache->Lookup (GetAddress (0));
+  entry->StartReachableTimer ();
+  cache->Remove (entry);
+  NS_TEST_EXPECT_MSG_EQ (cache->Lookup (GetAddress (0)), 0, "Removed entry found");
+  Simulator::Run ();
+
+  cache->Dispose ();
+  icmpv6->Dispose ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief ARP and NDISC caches test suite.
+ */
+class NeighborCacheTestSuite : public TestSuite
+{
+public:
+  NeighborCacheTestSuite ();
+};
+
+NeighborCacheTestSuite::NeighborCacheTestSuite ()
+  : TestSuite ("neighbor-cache", UNIT)
+{
+  AddTestCase (new ArpCacheWaitReplyTestCase (), TestCase::QUICK);
+  AddTestCase (new NdiscCacheNudTimersTestCase (), TestCase::QUICK);
+}
+
+static NeighborCacheTestSuite g_neighborCacheTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/prefix-trie.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Compare the lookups in a PrefixTrie with a linear search
+ * among the inserted prefixes.
+ */
+class PrefixTrieTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param length the address length, in bits
+   */
+  PrefixTrieTestCase (uint8_t length);
+
+private:
+  virtual void DoRun (void);
+
+  /// A prefix inserted in the trie
+  struct Prefix
+  {
+    uint8_t bytes[16];  //!< the prefix
+    uint8_t length;     //!< the prefix length
+  };
+
+  /**
+   * \param address the address
+   * \param prefix the prefix
+   * \returns true if the address matches the prefix
+   */
+  static bool IsMatch (const uint8_t *address, const Prefix &prefix);
+
+  uint8_t m_length;  //!< the address length
+};
+
+PrefixTrieTestCase::PrefixTrieTestCase (uint8_t length)
+  : TestCase ("Check the lookups in a trie of prefixes of " + std::to_string (length) + "-bit addresses"),
+    m_length (length)
+{}
+
+bool
+PrefixTrieTestCase::IsMatch (const uint8_t *address, const Prefix &prefix)
+{
+  for (uint8_t bit = 0; bit < prefix.length; bit++)
+    {
+      uint8_t mask = 0x80 >> (bit % 8);
+      if ((address[bit / 8] & mask) != (prefix.bytes[bit / 8] & mask))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+PrefixTrieTestCase::DoRun (void)
+{
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+  uint8_t bytes = m_length / 8;
+
+  // Prefixes sharing the first bytes, so that many of them overlap
+  std::vector<Prefix> prefixes;
+  for (uint32_t i = 0; i < 500; i++)
+    {
+      Prefix prefix;
+      for (uint8_t j = 0; j < 16; j++)
+        {
+          prefix.bytes[j] = j < bytes - 2 ? 10 : rand->GetInteger (0, 7) * 32 + rand->GetInteger (0, 3);
+        }
+      prefix.length = i % 5 == 0 ? m_length : rand->GetInteger (0, m_length);
+      prefixes.push_back (prefix);
+    }
+  // Two routes to the same prefix, written differently
+  prefixes.push_back (prefixes[1]);
+  prefixes.back ().bytes[bytes - 1] ^= 1;
+  prefixes.back ().length = m_length - 8;
+  prefixes.push_back (prefixes.back ());
+  prefixes.back ().bytes[bytes - 1] ^= 2;
+
+  PrefixTrie trie;
+  for (uint32_t i = 0; i < prefixes.size (); i++)
+    {
+      trie.Insert (prefixes[i].bytes, prefixes[i].length, i);
+    }
+  NS_TEST_EXPECT_MSG_LT_OR_EQ (trie.GetNNodes (), 2 * trie.GetNPrefixes () + 1, "Too many nodes");
+
+  PrefixTrie::Matches matches;
+  for (uint32_t i = 0; i < 2000; i++)
+    {
+      uint8_t address[16];
+      const Prefix &near = prefixes[rand->GetInteger (0, prefixes.size () - 1)];
+      for (uint8_t j = 0; j < 16; j++)
+        {
+          address[j] = near.bytes[j];
+        }
+      address[bytes - 1] ^= rand->GetInteger (0, 255) >> rand->GetInteger (0, 8);
+      trie.Lookup (address, m_length, matches);
+
+      std::vector<uint32_t> found;
+      uint8_t previous = 0;
+      for (uint32_t j = 0; j < matches.size (); j++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (matches[j]->empty (), false, "Empty match");
+          uint8_t length = prefixes[matches[j]->front ()].length;
+          NS_TEST_ASSERT_MSG_EQ ((j == 0 || length > previous), true, "Matches not sorted by length");
+          previous = length;
+          for (uint32_t k = 0; k < matches[j]->size (); k++)
+            {
+              uint32_t value = (*matches[j])[k];
+              NS_TEST_ASSERT_MSG_EQ (prefixes[value].length, length, "Values of different lengths");
+              NS_TEST_ASSERT_MSG_EQ ((k == 0 || value > (*matches[j])[k - 1]), true, "Values not in insertion order");
+              found.push_back (value);
+            }
+        }
+      uint32_t expected = 0;
+      for (uint32_t j = 0; j < prefixes.size (); j++)
+        {
+          if (IsMatch (address, prefixes[j]))
+            {
+              expected++;
+              NS_TEST_ASSERT_MSG_EQ ((std::find (found.begin (), found.end (), j) != found.end ()),
+                                     true, "Matching prefix " << j << " not found");
+            }
+        }
+      NS_TEST_ASSERT_MSG_EQ (found.size (), expected, "Wrong number of matches");
+    }
+
+  trie.Clear ();
+  trie.Lookup (prefixes[0].bytes, m_length, matches);
+  NS_TEST_EXPECT_MSG_EQ (matches.size (), 0, "Trie not cleared");
+  NS_TEST_EXPECT_MSG_EQ (trie.GetNPrefixes (), 0, "Trie not cleared");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief PrefixTrie test suite.
+ */
+class PrefixTrieTestSuite : public TestSuite
+{
+public:
+  PrefixTrieTestSuite ();
+};
+
+PrefixTrieTestSuite::PrefixTrieTestSuite ()
+  : TestSuite ("prefix-trie", UNIT)
+{
+  AddTestCase (new PrefixTrieTestCase (32), TestCase::QUICK);
+  AddTestCase (new PrefixTrieTestCase (128), TestCase::QUICK);
+}
+
+static PrefixTrieTestSuite g_prefixTrieTestSuite; //!< Static variable for test initialization
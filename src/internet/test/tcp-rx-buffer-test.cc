@@ -44,6 +44,16 @@ private:
    * \brief Test the SACK list update.
    */
   void TestUpdateSACKList ();
+
+  /**
+   * \brief Test the coalescing of contiguous segments.
+   */
+  void TestCoalescing ();
+
+  /**
+   * \brief Test that the packets held outside of the buffer are not modified.
+   */
+  void TestHeldPackets ();
 };
 
 TcpRxBufferTestCase::TcpRxBufferTestCase ()
@@ -55,6 +65,8 @@ void
 TcpRxBufferTestCase::DoRun ()
 {
   TestUpdateSACKList ();
+  TestCoalescing ();
+  TestHeldPackets ();
 }
 
 void
@@ -338,6 +350,109 @@ TcpRxBufferTestCase::TestUpdateSACKList ()
                          "SACK list should contain no element");
 }
 
+void
+TcpRxBufferTestCase::TestCoalescing ()
+{
+  const uint32_t segments = 1000;
+  const uint32_t segmentSize = 100;
+  TcpRxBuffer rxBuf;
+  rxBuf.SetNextRxSequence (SequenceNumber32 (1));
+  rxBuf.SetMaxBufferSize (segments * segmentSize);
+
+  TcpHeader h;
+  uint8_t data[segmentSize];
+
+  // Segments received in reverse order, except the first one
+  for (uint32_t i = segments - 1; i > 0; --i)
+    {
+      memset (data, i % 256, segmentSize);
+      h.SetSequenceNumber (SequenceNumber32 (1 + i * segmentSize));
+      NS_TEST_ASSERT_MSG_EQ (rxBuf.Add (Create<Packet> (data, segmentSize), h), true,
+                             "Segment " << i << " not added");
+      TcpOptionSack::SackList sackList = rxBuf.GetSackList ();
+      NS_TEST_ASSERT_MSG_EQ (sackList.size (), 1, "SACK list should contain one element");
+      NS_TEST_ASSERT_MSG_EQ (sackList.front ().first, SequenceNumber32 (1 + i * segmentSize),
+                             "SACK block different than expected");
+      NS_TEST_ASSERT_MSG_EQ (sackList.front ().second, SequenceNumber32 (1 + segments * segmentSize),
+                             "SACK block different than expected");
+    }
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Size (), (segments - 1) * segmentSize, "Wrong buffer size");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Available (), 0, "Data available with a hole");
+
+  // A duplicate segment is not added
+  h.SetSequenceNumber (SequenceNumber32 (1 + 3 * segmentSize / 2));
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Add (Create<Packet> (segmentSize), h), false,
+                         "Duplicate segment added");
+
+  // The first segment fills the hole
+  memset (data, 0, segmentSize);
+  h.SetSequenceNumber (SequenceNumber32 (1));
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Add (Create<Packet> (data, segmentSize), h), true,
+                         "First segment not added");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.NextRxSequence (), SequenceNumber32 (1 + segments * segmentSize),
+                         "Sequence number differs from expected");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Available (), segments * segmentSize, "Wrong available data");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.GetSackListSize (), 0, "SACK list should contain no element");
+
+  // The data is extracted in order
+  Ptr<Packet> first = rxBuf.Extract (segmentSize / 2);
+  NS_TEST_ASSERT_MSG_EQ (first->GetSize (), segmentSize / 2, "Wrong extracted size");
+  Ptr<Packet> rest = rxBuf.Extract (segments * segmentSize);
+  NS_TEST_ASSERT_MSG_EQ (rest->GetSize (), segments * segmentSize - segmentSize / 2,
+                         "Wrong extracted size");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Size (), 0, "Data left in the buffer");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Available (), 0, "Data left in the buffer");
+
+  std::vector<uint8_t> received (rest->GetSize ());
+  rest->CopyData (&received[0], received.size ());
+  for (uint32_t i = 0; i < received.size (); ++i)
+    {
+      uint32_t segment = (i + segmentSize / 2) / segmentSize;
+      NS_TEST_ASSERT_MSG_EQ (static_cast<uint32_t> (received[i]), segment % 256,
+                             "Wrong byte " << i);
+    }
+}
+
+void
+TcpRxBufferTestCase::TestHeldPackets ()
+{
+  TcpRxBuffer rxBuf;
+  rxBuf.SetNextRxSequence (SequenceNumber32 (1));
+  rxBuf.SetMaxBufferSize (1000);
+
+  TcpHeader h;
+
+  // The packets added are held, as by the sinks of the Rx trace source
+  Ptr<Packet> a = Create<Packet> (100);
+  h.SetSequenceNumber (SequenceNumber32 (1));
+  rxBuf.Add (a, h);
+  Ptr<Packet> b = Create<Packet> (100);
+  h.SetSequenceNumber (SequenceNumber32 (101));
+  rxBuf.Add (b, h);
+  NS_TEST_ASSERT_MSG_EQ (a->GetSize (), 100, "Packet added modified by the coalescing");
+  NS_TEST_ASSERT_MSG_EQ (b->GetSize (), 100, "Packet added modified by the coalescing");
+
+  // The packet extracted is held by the application
+  Ptr<Packet> x = rxBuf.Extract (200);
+  NS_TEST_ASSERT_MSG_EQ (x->GetSize (), 200, "Wrong extracted size");
+
+  Ptr<Packet> c = Create<Packet> (100);
+  h.SetSequenceNumber (SequenceNumber32 (301));
+  rxBuf.Add (c, h);
+  Ptr<Packet> d = Create<Packet> (100);
+  h.SetSequenceNumber (SequenceNumber32 (201));
+  rxBuf.Add (d, h);
+  Ptr<Packet> y = rxBuf.Extract (50);
+  Ptr<Packet> z = rxBuf.Extract (150);
+  NS_TEST_ASSERT_MSG_EQ (y->GetSize (), 50, "Wrong extracted size");
+  NS_TEST_ASSERT_MSG_EQ (z->GetSize (), 150, "Wrong extracted size");
+  NS_TEST_ASSERT_MSG_EQ (x->GetSize (), 200, "Packet extracted modified by the buffer");
+  NS_TEST_ASSERT_MSG_EQ (c->GetSize (), 100, "Packet added modified by the coalescing");
+  NS_TEST_ASSERT_MSG_EQ (d->GetSize (), 100, "Packet added modified by the coalescing");
+  NS_TEST_ASSERT_MSG_EQ (y->GetSize (), 50, "Packet extracted modified by the buffer");
+  NS_TEST_ASSERT_MSG_EQ (rxBuf.Size (), 0, "Data left in the buffer");
+}
+
 void
 TcpRxBufferTestCase::DoTeardown ()
 {
@@ -0,0 +1,590 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/string.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/data-rate.h"
+#include "ns3/error-model.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/inet6-socket-address.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/drop-tail-queue.h"
+#include "ns3/net-device-queue-interface.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-global-routing-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv6-address-helper.h"
+#include "ns3/ipv4-l3-protocol.h"
+#include "ns3/ipv6-l3-protocol.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/ipv6-header.h"
+#include "ns3/tcp-header.h"
+#include "ns3/tcp-socket-factory.h"
+#include "ns3/super-segment-tag.h"
+#include "ns3/node-container.h"
+#include "ns3/simulator.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("TcpTsoTest");
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief A SimpleNetDevice which supports super-segments.
+ *
+ * Like the devices with segmentation offload, it sends a super-segment
+ * as one packet, even though it is larger than the MTU.
+ */
+class TcpTsoTestNetDevice : public SimpleNetDevice
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  virtual bool SendFrom (Ptr<Packet> packet, const Address& source, const Address& dest, uint16_t protocolNumber);
+  virtual bool SupportsSuperSegments (void) const;
+};
+
+NS_OBJECT_ENSURE_REGISTERED (TcpTsoTestNetDevice);
+
+TypeId
+TcpTsoTestNetDevice::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TcpTsoTestNetDevice")
+    .SetParent<SimpleNetDevice> ()
+    .SetGroupName ("Internet")
+    .AddConstructor<TcpTsoTestNetDevice> ()
+  ;
+  return tid;
+}
+
+bool
+TcpTsoTestNetDevice::SendFrom (Ptr<Packet> packet, const Address& source, const Address& dest, uint16_t protocolNumber)
+{
+  SuperSegmentTag superSegment;
+  if (!packet->PeekPacketTag (superSegment))
+    {
+      return SimpleNetDevice::SendFrom (packet, source, dest, protocolNumber);
+    }
+  // SimpleNetDevice drops the packets larger than the MTU
+  uint16_t mtu = GetMtu ();
+  SetMtu (0xffff);
+  bool sent = SimpleNetDevice::SendFrom (packet, source, dest, protocolNumber);
+  SetMtu (mtu);
+  return sent;
+}
+
+bool
+TcpTsoTestNetDevice::SupportsSuperSegments (void) const
+{
+  return true;
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check TCP segmentation offload.
+ *
+ * A sender with TsoSize set to 4 segments sends 100 segments to a
+ * receiver, directly or through a router, over links which support
+ * super-segments or not.  The super-segments must cross the former, and
+ * be split into segments before the latter, on the sender or on the
+ * router.  The receiver must ACK at once each super-segment of at least
+ * two segments.
+ *
+ * With losses, TsoSize is set to 8 segments, the receive buffer holds
+ * 5.5 segments, and the receiver drops some packets: the super-segments
+ * are then limited by the receiver window, which is not a multiple of
+ * the segment size, and new data is sent during the SACK recovery.
+ */
+class TcpTsoTestCase : public TestCase
+{
+public:
+  /// The kinds of links
+  enum Link
+  {
+    NONE,    //!< No link
+    TSO,     //!< TcpTsoTestNetDevice, with super-segments
+    SIMPLE   //!< SimpleNetDevice, without super-segments
+  };
+
+  /**
+   * Constructor.
+   * \param first the link from the sender
+   * \param second the link from the router to the receiver, or NONE
+   * \param ipv6 whether IPv6 is used instead of IPv4
+   * \param lossy whether the receiver window is small and packets are lost
+   */
+  TcpTsoTestCase (Link first, Link second, bool ipv6, bool lossy);
+
+private:
+  virtual void DoRun (void);
+
+  /// A data segment, as seen by the IP layer
+  struct Segment
+  {
+    Time time;         //!< The time it was seen
+    uint32_t payload;  //!< The size of the TCP payload
+    uint8_t flags;     //!< The TCP flags
+    bool tagged;       //!< Whether it has a SuperSegmentTag
+  };
+
+  /**
+   * Install a link.
+   * \param link the kind of link
+   * \param a the first node
+   * \param b the second node
+   * \returns the devices
+   */
+  NetDeviceContainer Install (Link link, Ptr<Node> a, Ptr<Node> b);
+  /**
+   * Connect the sender and send 100 segments.
+   * \param socket the socket of the sender
+   * \param address the address of the receiver
+   */
+  void StartFlow (Ptr<Socket> socket, Address address);
+  /**
+   * Parse a packet traced by IPv4.
+   * \param segments the segments the packet is added to
+   * \param p the packet, with its IPv4 header
+   * \param ipv4 the IPv4 protocol
+   * \param interface the interface
+   */
+  void Ipv4Trace (std::vector<Segment> *segments, Ptr<const Packet> p, Ptr<Ipv4> ipv4, uint32_t interface);
+  /**
+   * Parse a packet traced by IPv6.
+   * \param segments the segments the packet is added to
+   * \param p the packet, with its IPv6 header
+   * \param ipv6 the IPv6 protocol
+   * \param interface the interface
+   */
+  void Ipv6Trace (std::vector<Segment> *segments, Ptr<const Packet> p, Ptr<Ipv6> ipv6, uint32_t interface);
+  /**
+   * Parse a TCP segment.
+   * \param segments the segments the packet is added to
+   * \param p the packet, starting with its TCP header
+   */
+  void TcpTrace (std::vector<Segment> *segments, Ptr<Packet> p);
+  /**
+   * Check the data segments sent through a link.
+   * \param link the kind of link
+   * \param segments the segments sent through the link
+   * \param name the name of the link, for the messages
+   */
+  void CheckLink (Link link, const std::vector<Segment> &segments, std::string name);
+  /**
+   * Count the bytes received by the receiver.
+   * \param socket the socket of the receiver
+   */
+  void Receive (Ptr<Socket> socket);
+  /**
+   * Accept a connection.
+   * \param socket the connected socket
+   * \param from the address of the sender
+   */
+  void Accept (Ptr<Socket> socket, const Address &from);
+
+  Link m_first;   //!< the link from the sender
+  Link m_second;  //!< the link from the router, or NONE
+  bool m_ipv6;    //!< whether IPv6 is used
+  bool m_lossy;   //!< whether the receiver window is small and packets are lost
+  uint32_t m_maxSuperSegment; //!< the largest allowed super-segment
+  uint32_t m_totalRx;         //!< the bytes received by the receiver
+  std::vector<Segment> m_sent[2];  //!< the segments sent through each link
+  std::vector<Segment> m_received; //!< the segments received by the receiver
+  std::vector<Segment> m_acks;     //!< the segments sent by the receiver
+};
+
+/**
+ * \param first the link from the sender
+ * \param second the link from the router
+ * \param ipv6 whether IPv6 is used
+ * \returns the name of the test
+ */
+static std::string
+GetTsoTestName (TcpTsoTestCase::Link first, TcpTsoTestCase::Link second, bool ipv6, bool lossy)
+{
+  const char *names[] = { "none", "offload", "simple" };
+  std::ostringstream oss;
+  oss << "Check TCP segmentation offload over " << names[first];
+  if (second != TcpTsoTestCase::NONE)
+    {
+      oss << " and " << names[second];
+    }
+  oss << (ipv6 ? " with IPv6" : " with IPv4");
+  if (lossy)
+    {
+      oss << ", a small receiver window and losses";
+    }
+  return oss.str ();
+}
+
+TcpTsoTestCase::TcpTsoTestCase (Link first, Link second, bool ipv6, bool lossy)
+  : TestCase (GetTsoTestName (first, second, ipv6, lossy)),
+    m_first (first),
+    m_second (second),
+    m_ipv6 (ipv6),
+    m_lossy (lossy),
+    m_maxSuperSegment (lossy ? 5000 : 4000),
+    m_totalRx (0)
+{
+}
+
+NetDeviceContainer
+TcpTsoTestCase::Install (Link link, Ptr<Node> a, Ptr<Node> b)
+{
+  NetDeviceContainer devices;
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  channel->SetAttribute ("Delay", StringValue ("1ms"));
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      Ptr<SimpleNetDevice> device;
+      if (link == TSO)
+        {
+          device = CreateObject<TcpTsoTestNetDevice> ();
+        }
+      else
+        {
+          device = CreateObject<SimpleNetDevice> ();
+        }
+      device->SetAttribute ("DataRate", StringValue ("100Mbps"));
+      device->SetAttribute ("PointToPointMode", BooleanValue (true));
+      device->SetAddress (Mac48Address::Allocate ());
+      device->SetMtu (1500);
+      (i == 0 ? a : b)->AddDevice (device);
+      device->SetChannel (channel);
+      Ptr<Queue<Packet> > queue = CreateObject<DropTailQueue<Packet> > ();
+      device->SetQueue (queue);
+      Ptr<NetDeviceQueueInterface> ndqi = CreateObject<NetDeviceQueueInterface> ();
+      ndqi->GetTxQueue (0)->ConnectQueueTraces (queue);
+      device->AggregateObject (ndqi);
+      devices.Add (device);
+    }
+  return devices;
+}
+
+void
+TcpTsoTestCase::Receive (Ptr<Socket> socket)
+{
+  Ptr<Packet> p;
+  while ((p = socket->Recv ()))
+    {
+      m_totalRx += p->GetSize ();
+    }
+}
+
+void
+TcpTsoTestCase::Accept (Ptr<Socket> socket, const Address &from)
+{
+  socket->SetRecvCallback (MakeCallback (&TcpTsoTestCase::Receive, this));
+}
+
+void
+TcpTsoTestCase::StartFlow (Ptr<Socket> socket, Address address)
+{
+  socket->Connect (address);
+  socket->Send (Create<Packet> (100000));
+}
+
+void
+TcpTsoTestCase::Ipv4Trace (std::vector<Segment> *segments, Ptr<const Packet> p, Ptr<Ipv4> ipv4, uint32_t interface)
+{
+  Ptr<Packet> copy = p->Copy ();
+  Ipv4Header header;
+  copy->RemoveHeader (header);
+  if (header.GetProtocol () == 6)
+    {
+      TcpTrace (segments, copy);
+    }
+}
+
+void
+TcpTsoTestCase::Ipv6Trace (std::vector<Segment> *segments, Ptr<const Packet> p, Ptr<Ipv6> ipv6, uint32_t interface)
+{
+  Ptr<Packet> copy = p->Copy ();
+  Ipv6Header header;
+  copy->RemoveHeader (header);
+  if (header.GetNextHeader () == 6)
+    {
+      TcpTrace (segments, copy);
+    }
+}
+
+void
+TcpTsoTestCase::TcpTrace (std::vector<Segment> *segments, Ptr<Packet> p)
+{
+  TcpHeader header;
+  p->RemoveHeader (header);
+  SuperSegmentTag superSegment;
+  Segment segment;
+  segment.time = Simulator::Now ();
+  segment.payload = p->GetSize ();
+  segment.flags = header.GetFlags ();
+  segment.tagged = p->PeekPacketTag (superSegment);
+  segments->push_back (segment);
+}
+
+void
+TcpTsoTestCase::CheckLink (Link link, const std::vector<Segment> &segments, std::string name)
+{
+  uint32_t nData = 0;
+  uint32_t nTagged = 0;
+  for (uint32_t i = 0; i < segments.size (); i++)
+    {
+      const Segment &segment = segments[i];
+      if (segment.payload == 0)
+        {
+          continue;
+        }
+      nData++;
+      if (segment.tagged)
+        {
+          nTagged++;
+          NS_TEST_EXPECT_MSG_EQ (segment.payload % 1000, 0, name << ": super-segment not made of full segments");
+          NS_TEST_EXPECT_MSG_LT_OR_EQ (segment.payload, m_maxSuperSegment, name << ": super-segment larger than allowed");
+        }
+      else
+        {
+          NS_TEST_EXPECT_MSG_LT_OR_EQ (segment.payload, 1000, name << ": large segment without tag");
+        }
+    }
+  if (link == SIMPLE)
+    {
+      NS_TEST_EXPECT_MSG_EQ (nTagged, 0, name << ": super-segments sent through a device without support");
+      if (m_lossy)
+        {
+          NS_TEST_EXPECT_MSG_GT (nData, 100, name << ": no retransmission");
+        }
+      else
+        {
+          NS_TEST_EXPECT_MSG_EQ (nData, 100, name << ": wrong number of segments");
+        }
+    }
+  else
+    {
+      NS_TEST_EXPECT_MSG_GT (nTagged, 0, name << ": no super-segment");
+      if (!m_lossy)
+        {
+          NS_TEST_EXPECT_MSG_LT (nData, 100, name << ": too many segments");
+        }
+    }
+}
+
+void
+TcpTsoTestCase::DoRun (void)
+{
+  uint16_t port = 50000;
+  NodeContainer nodes;
+  nodes.Create (m_second == NONE ? 2 : 3);
+  Ptr<Node> sender = nodes.Get (0);
+  Ptr<Node> receiver = nodes.Get (nodes.GetN () - 1);
+
+  NetDeviceContainer first = Install (m_first, nodes.Get (0), nodes.Get (1));
+  NetDeviceContainer second;
+  if (m_second != NONE)
+    {
+      second = Install (m_second, nodes.Get (1), nodes.Get (2));
+    }
+
+  InternetStackHelper internet;
+  internet.Install (nodes);
+
+  Address sinkAddress;
+  if (m_ipv6)
+    {
+      Ipv6AddressHelper address;
+      address.SetBase (Ipv6Address ("2001:1::"), Ipv6Prefix (64));
+      Ipv6InterfaceContainer firstInterfaces = address.Assign (first);
+      Ipv6InterfaceContainer lastInterfaces = firstInterfaces;
+      if (m_second != NONE)
+        {
+          address.SetBase (Ipv6Address ("2001:2::"), Ipv6Prefix (64));
+          lastInterfaces = address.Assign (second);
+          firstInterfaces.SetForwarding (1, true);
+          firstInterfaces.SetDefaultRouteInAllNodes (1);
+          lastInterfaces.SetForwarding (0, true);
+          lastInterfaces.SetDefaultRouteInAllNodes (0);
+        }
+      sinkAddress = Inet6SocketAddress (lastInterfaces.GetAddress (1, 1), port);
+    }
+  else
+    {
+      Ipv4AddressHelper address;
+      address.SetBase ("10.1.1.0", "255.255.255.0");
+      Ipv4InterfaceContainer lastInterfaces = address.Assign (first);
+      if (m_second != NONE)
+        {
+          address.SetBase ("10.1.2.0", "255.255.255.0");
+          lastInterfaces = address.Assign (second);
+          Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+        }
+      sinkAddress = InetSocketAddress (lastInterfaces.GetAddress (1), port);
+    }
+
+  Ptr<Socket> sink = Socket::CreateSocket (receiver, TcpSocketFactory::GetTypeId ());
+  if (m_lossy)
+    {
+      sink->SetAttribute ("RcvBufSize", UintegerValue (5500));
+      NetDeviceContainer last = m_second == NONE ? first : second;
+      Ptr<ReceiveListErrorModel> errorModel = CreateObject<ReceiveListErrorModel> ();
+      std::list<uint32_t> drops;
+      drops.push_back (10);
+      drops.push_back (25);
+      drops.push_back (26);
+      errorModel->SetList (drops);
+      DynamicCast<SimpleNetDevice> (last.Get (1))->SetReceiveErrorModel (errorModel);
+    }
+  if (m_ipv6)
+    {
+      sink->Bind (Inet6SocketAddress (Ipv6Address::GetAny (), port));
+    }
+  else
+    {
+      sink->Bind (InetSocketAddress (Ipv4Address::GetAny (), port));
+    }
+  sink->Listen ();
+  sink->SetAcceptCallback (MakeNullCallback<bool, Ptr<Socket>, const Address &> (),
+                           MakeCallback (&TcpTsoTestCase::Accept, this));
+
+  Ptr<Socket> socket = Socket::CreateSocket (sender, TcpSocketFactory::GetTypeId ());
+  socket->SetAttribute ("SegmentSize", UintegerValue (1000));
+  socket->SetAttribute ("TsoSize", UintegerValue (m_lossy ? 8000 : 4000));
+  if (m_ipv6)
+    {
+      socket->Bind6 ();
+    }
+  else
+    {
+      socket->Bind ();
+    }
+  // Let the IPv6 duplicate address detection complete
+  Simulator::Schedule (Seconds (2), &TcpTsoTestCase::StartFlow, this, socket, sinkAddress);
+
+  // The segments sent through each link, and received and sent by the
+  // receiver
+  for (uint32_t i = 0; i + 1 < nodes.GetN (); i++)
+    {
+      if (m_ipv6)
+        {
+          nodes.Get (i)->GetObject<Ipv6L3Protocol> ()->TraceConnectWithoutContext (
+            "Tx", MakeCallback (&TcpTsoTestCase::Ipv6Trace, this).Bind (&m_sent[i]));
+        }
+      else
+        {
+          nodes.Get (i)->GetObject<Ipv4L3Protocol> ()->TraceConnectWithoutContext (
+            "Tx", MakeCallback (&TcpTsoTestCase::Ipv4Trace, this).Bind (&m_sent[i]));
+        }
+    }
+  if (m_ipv6)
+    {
+      receiver->GetObject<Ipv6L3Protocol> ()->TraceConnectWithoutContext (
+        "Rx", MakeCallback (&TcpTsoTestCase::Ipv6Trace, this).Bind (&m_received));
+      receiver->GetObject<Ipv6L3Protocol> ()->TraceConnectWithoutContext (
+        "Tx", MakeCallback (&TcpTsoTestCase::Ipv6Trace, this).Bind (&m_acks));
+    }
+  else
+    {
+      receiver->GetObject<Ipv4L3Protocol> ()->TraceConnectWithoutContext (
+        "Rx", MakeCallback (&TcpTsoTestCase::Ipv4Trace, this).Bind (&m_received));
+      receiver->GetObject<Ipv4L3Protocol> ()->TraceConnectWithoutContext (
+        "Tx", MakeCallback (&TcpTsoTestCase::Ipv4Trace, this).Bind (&m_acks));
+    }
+
+  Simulator::Stop (Seconds (10));
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_totalRx, 100000, "Data not received");
+  if (m_lossy)
+    {
+      uint32_t sentBytes = 0;
+      for (uint32_t i = 0; i < m_sent[0].size (); i++)
+        {
+          sentBytes += m_sent[0][i].payload;
+        }
+      NS_TEST_EXPECT_MSG_GT (sentBytes, 100000, "No retransmission");
+    }
+  CheckLink (m_first, m_sent[0], "first link");
+  if (m_second != NONE)
+    {
+      CheckLink (m_second, m_sent[1], "second link");
+    }
+
+  // Each super-segment of at least two segments is ACKed at once
+  Link last = m_second == NONE ? m_first : m_second;
+  uint32_t nChecked = 0;
+  for (uint32_t i = 0; i < m_received.size (); i++)
+    {
+      if (!m_received[i].tagged || m_received[i].payload < 2000)
+        {
+          continue;
+        }
+      nChecked++;
+      bool acked = false;
+      for (uint32_t j = 0; !acked && j < m_acks.size (); j++)
+        {
+          acked = m_acks[j].time == m_received[i].time && m_acks[j].payload == 0
+            && m_acks[j].flags == TcpHeader::ACK;
+        }
+      NS_TEST_EXPECT_MSG_EQ (acked, true, "Super-segment received at " << m_received[i].time.As (Time::S)
+                             << " not ACKed at once");
+    }
+  if (last != SIMPLE)
+    {
+      NS_TEST_EXPECT_MSG_GT (nChecked, 0, "No super-segment received");
+    }
+  else
+    {
+      NS_TEST_EXPECT_MSG_EQ (nChecked, 0, "Super-segment received through a device without support");
+    }
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief TestSuite: TCP segmentation offload
+ */
+class TcpTsoTestSuite : public TestSuite
+{
+public:
+  TcpTsoTestSuite ()
+    : TestSuite ("tcp-tso", UNIT)
+  {
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::TSO, TcpTsoTestCase::NONE, false, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::TSO, TcpTsoTestCase::NONE, true, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::TSO, TcpTsoTestCase::TSO, false, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::SIMPLE, TcpTsoTestCase::NONE, false, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::SIMPLE, TcpTsoTestCase::NONE, true, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::TSO, TcpTsoTestCase::SIMPLE, false, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::TSO, TcpTsoTestCase::SIMPLE, true, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::TSO, TcpTsoTestCase::NONE, false, true), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (TcpTsoTestCase::TSO, TcpTsoTestCase::SIMPLE, true, true), TestCase::QUICK);
+  }
+};
+
+static TcpTsoTestSuite g_tcpTsoTestSuite; //!< Static variable for test initialization
@@ -53,6 +53,10 @@ private:
   /** \brief Test the logic of merging items in GetTransmittedSegment()
    * which is triggered by CopyFromSequence()*/
   void TestMergeItemsWhenGetTransmittedSegment ();
+  /** \brief Test the scoreboard after items are merged for a retransmission */
+  void TestMergeThenRenoSack ();
+  /** \brief Test the scoreboard with a large window and many holes */
+  void TestLargeWindow ();
   /** \brief Callback to provide a value of receiver window */
   uint32_t GetRWnd (void) const;
 };
@@ -98,6 +102,23 @@ TcpTxBufferTestCase::DoRun ()
   Simulator::Schedule (Seconds (0.0),
                          &TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment, this);
 
+  /*
+   * Case for merged items:
+   *  -> two sent items are merged to retransmit a full segment
+   *  -> the merged item is then marked as lost, and a Reno SACK is added
+   *  -> the acknowledgment of the merged item moves the SACK flag of the head
+   */
+  Simulator::Schedule (Seconds (0.0),
+                       &TcpTxBufferTestCase::TestMergeThenRenoSack, this);
+
+  /*
+   * Case for a large window:
+   *  -> one segment out of ten is lost, the others are sacked one by one
+   *  -> the holes are retransmitted in order
+   */
+  Simulator::Schedule (Seconds (0.0),
+                       &TcpTxBufferTestCase::TestLargeWindow, this);
+
   Simulator::Run ();
   Simulator::Destroy ();
 }
@@ -150,6 +171,74 @@ TcpTxBufferTestCase::TestIsLost ()
 
 }
 
+void
+TcpTxBufferTestCase::TestLargeWindow ()
+{
+  const uint32_t segments = 10000;
+  const uint32_t segmentSize = 100;
+  Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer> ();
+  txBuf->SetRWndCallback (MakeCallback (&TcpTxBufferTestCase::GetRWnd, this));
+  SequenceNumber32 head (1);
+  txBuf->SetHeadSequence (head);
+  txBuf->SetSegmentSize (segmentSize);
+  txBuf->SetDupAckThresh (3);
+  txBuf->SetMaxBufferSize (segments * segmentSize);
+
+  txBuf->Add (Create<Packet> (segments * segmentSize));
+  for (uint32_t i = 0; i < segments; ++i)
+    {
+      txBuf->CopyFromSequence (segmentSize, head + i * segmentSize);
+    }
+
+  // Every tenth segment is lost, the others are sacked
+  for (uint32_t i = 0; i < segments; ++i)
+    {
+      if (i % 10 != 0)
+        {
+          TcpOptionSack::SackList list;
+          list.push_back (TcpOptionSack::SackBlock (head + i * segmentSize,
+                                                    head + (i + 1) * segmentSize));
+          NS_TEST_ASSERT_MSG_EQ (txBuf->Update (list), segmentSize, "Segment " << i << " not sacked");
+        }
+    }
+
+  uint32_t holes = segments / 10;
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetSacked (), (segments - holes) * segmentSize, "Wrong sacked count");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetLost (), holes * segmentSize, "Wrong lost count");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->BytesInFlight (), 0, "Wrong bytes in flight");
+  for (uint32_t i = 0; i < 20; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (txBuf->IsLost (head + i * segmentSize), (i % 10 == 0),
+                             "Wrong loss for segment " << i);
+    }
+
+  // The holes are retransmitted in order
+  SequenceNumber32 seq;
+  SequenceNumber32 seqHigh;
+  for (uint32_t i = 0; i < holes; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (txBuf->NextSeg (&seq, &seqHigh, false), true, "No hole returned");
+      NS_TEST_ASSERT_MSG_EQ (seq, head + i * 10 * segmentSize, "Wrong hole returned");
+      TcpTxItem *item = txBuf->CopyFromSequence (segmentSize, seq);
+      NS_TEST_ASSERT_MSG_EQ (item->GetSeqSize (), segmentSize, "Wrong retransmission size");
+      NS_TEST_ASSERT_MSG_EQ (item->IsRetrans (), true, "Not a retransmission");
+    }
+  NS_TEST_ASSERT_MSG_EQ (txBuf->NextSeg (&seq, &seqHigh, false), false, "Segment returned without holes");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetRetransmitsCount (), holes * segmentSize, "Wrong retransmitted count");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->BytesInFlight (), holes * segmentSize, "Wrong bytes in flight");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->IsRetransmittedDataAcked (head + segmentSize), true,
+                         "Retransmission of the head not found");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->IsRetransmittedDataAcked (head + 2 * segmentSize), false,
+                         "Sacked segment found as retransmitted");
+
+  // The retransmissions are received
+  txBuf->DiscardUpTo (head + segments * segmentSize);
+  NS_TEST_ASSERT_MSG_EQ (txBuf->Size (), 0, "Data left in the buffer");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetSacked (), 0, "Sacked data left in the buffer");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetLost (), 0, "Lost data left in the buffer");
+  NS_TEST_ASSERT_MSG_EQ (txBuf->GetRetransmitsCount (), 0, "Retransmitted data left in the buffer");
+}
+
 uint32_t
 TcpTxBufferTestCase::GetRWnd (void) const
 {
@@ -382,6 +471,55 @@ TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment ()
   txBuf.CopyFromSequence (2000, SequenceNumber32(1));
 }
 
+void
+TcpTxBufferTestCase::TestMergeThenRenoSack ()
+{
+  TcpTxBuffer txBuf;
+  SequenceNumber32 head (1);
+  SequenceNumber32 seq;
+  SequenceNumber32 seqHigh;
+  txBuf.SetHeadSequence (head);
+  txBuf.SetSegmentSize (1000);
+  txBuf.SetDupAckThresh (3);
+  txBuf.SetSackEnabled (false);
+
+  // Sent items: [1,501) [501,1001) [1001,1501) [1501,2001) [2001,3001) [3001,4001)
+  txBuf.Add (Create<Packet> (4000));
+  txBuf.CopyFromSequence (500, SequenceNumber32 (1));
+  txBuf.CopyFromSequence (500, SequenceNumber32 (501));
+  txBuf.CopyFromSequence (500, SequenceNumber32 (1001));
+  txBuf.CopyFromSequence (500, SequenceNumber32 (1501));
+  txBuf.CopyFromSequence (1000, SequenceNumber32 (2001));
+  txBuf.CopyFromSequence (1000, SequenceNumber32 (3001));
+
+  // The retransmission of a full segment merges the two first items
+  TcpTxItem *item = txBuf.CopyFromSequence (1000, SequenceNumber32 (1));
+  NS_TEST_ASSERT_MSG_EQ (item->GetSeqSize (), 1000, "Items not merged");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetRetransmitsCount (), 1000, "Merged item not retransmitted");
+
+  txBuf.MarkHeadAsLost ();
+  txBuf.AddRenoSack ();
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetRetransmitsCount (), 0, "Lost head still retransmitted");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetLost (), 1000, "Merged head not lost");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetSacked (), 500, "Item after the merged head not sacked");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.NextSeg (&seq, &seqHigh, false), true, "No segment to send");
+  NS_TEST_ASSERT_MSG_EQ (seq, SequenceNumber32 (1), "Merged head not retransmitted");
+
+  // The head is sacked once the merged item is acknowledged: its SACK flag
+  // is moved to the next item, and it is marked as lost
+  txBuf.DiscardUpTo (SequenceNumber32 (1001));
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetLost (), 500, "Head not lost");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetSacked (), 500, "SACK flag not moved");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.IsLost (SequenceNumber32 (1001)), true, "Head not lost");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.NextSeg (&seq, &seqHigh, false), true, "No segment to send");
+  NS_TEST_ASSERT_MSG_EQ (seq, SequenceNumber32 (1001), "Head not retransmitted");
+
+  txBuf.DiscardUpTo (SequenceNumber32 (4001));
+  NS_TEST_ASSERT_MSG_EQ (txBuf.Size (), 0, "Acknowledged data not discarded");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetLost (), 0, "Lost bytes after the acknowledgment of all the data");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetSacked (), 0, "Sacked bytes after the acknowledgment of all the data");
+}
+
 void
 TcpTxBufferTestCase::TestTransmittedBlock ()
 {
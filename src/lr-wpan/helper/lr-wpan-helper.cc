@@ -29,6 +29,7 @@
 #include <ns3/propagation-loss-model.h>
 #include <ns3/propagation-delay-model.h>
 #include <ns3/log.h>
+#include <ns3/abort.h>
 #include "ns3/names.h"
 
 namespace ns3 {
@@ -376,6 +377,8 @@ LrWpanHelper::EnableAsciiInternal (
   Ptr<NetDevice> nd,
   bool explicitFilename)
 {
+  NS_ABORT_MSG_IF (stream != 0 && stream->GetTraceFormat () != OutputStreamWrapper::TEXT,
+                   "LrWpanHelper::EnableAsciiInternal(): only text streams are supported");
   uint32_t nodeid = nd->GetNode ()->GetId ();
   uint32_t deviceid = nd->GetIfIndex ();
   std::ostringstream oss;
@@ -142,6 +142,8 @@ protected:
                                               */
 
   Ptr<const SpectrumValue> m_noise {nullptr}; ///< the noise value
+  SpectrumValue m_interf; ///< the interference plus noise of the current chunk
+  SpectrumValue m_sinr; ///< the SINR of the current chunk
 
   Time m_lastChangeTime {Seconds(0)}; /**< the time of the last change in
                                        * m_TotalPower
@@ -0,0 +1,221 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "spatial-grid.h"
+#include "mobility-model.h"
+#include "ns3/simulator.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SpatialGrid");
+
+bool
+SpatialGrid::Expiry::operator > (const Expiry &o) const
+{
+  return time > o.time;
+}
+
+SpatialGrid::SpatialGrid ()
+  : m_cellSize (1.0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SpatialGrid::~SpatialGrid ()
+{
+  NS_LOG_FUNCTION (this);
+  Clear ();
+}
+
+void
+SpatialGrid::SetCellSize (double size)
+{
+  NS_LOG_FUNCTION (this << size);
+  NS_ASSERT (size > 0);
+  Clear ();
+  m_cellSize = size;
+}
+
+double
+SpatialGrid::GetCellSize (void) const
+{
+  return m_cellSize;
+}
+
+uint32_t
+SpatialGrid::Add (Ptr<MobilityModel> mobility)
+{
+  NS_LOG_FUNCTION (this << mobility);
+  NS_ASSERT (mobility != 0);
+  uint32_t index = m_items.size ();
+  Item item;
+  item.mobility = mobility;
+  item.cell = 0;
+  item.generation = 0;
+  m_items.push_back (item);
+  std::vector<uint32_t> &items = m_mobilities[PeekPointer (mobility)];
+  if (items.empty ())
+    {
+      mobility->TraceConnectWithoutContext ("CourseChange",
+                                            MakeCallback (&SpatialGrid::CourseChanged, this));
+    }
+  items.push_back (index);
+  Update (index);
+  return index;
+}
+
+uint32_t
+SpatialGrid::GetNItems (void) const
+{
+  return m_items.size ();
+}
+
+void
+SpatialGrid::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::map<const MobilityModel *, std::vector<uint32_t> >::iterator i = m_mobilities.begin ();
+       i != m_mobilities.end (); ++i)
+    {
+      Ptr<MobilityModel> mobility = m_items[i->second.front ()].mobility;
+      mobility->TraceDisconnectWithoutContext ("CourseChange",
+                                               MakeCallback (&SpatialGrid::CourseChanged, this));
+    }
+  m_mobilities.clear ();
+  m_items.clear ();
+  m_cells.clear ();
+  m_expiries = std::priority_queue<Expiry, std::vector<Expiry>, std::greater<Expiry> > ();
+}
+
+uint64_t
+SpatialGrid::GetCell (int64_t x, int64_t y)
+{
+  return (static_cast<uint64_t> (static_cast<uint32_t> (x)) << 32)
+         | static_cast<uint32_t> (y);
+}
+
+void
+SpatialGrid::Update (uint32_t index)
+{
+  Item &item = m_items[index];
+  Vector position = item.mobility->GetPosition ();
+  uint64_t cell = GetCell (static_cast<int64_t> (std::floor (position.x / m_cellSize)),
+                           static_cast<int64_t> (std::floor (position.y / m_cellSize)));
+  if (item.generation == 0 || cell != item.cell)
+    {
+      if (item.generation != 0)
+        {
+          std::vector<uint32_t> &old = m_cells[item.cell];
+          std::vector<uint32_t>::iterator i = std::find (old.begin (), old.end (), index);
+          NS_ASSERT (i != old.end ());
+          *i = old.back ();
+          old.pop_back ();
+        }
+      m_cells[cell].push_back (index);
+      item.cell = cell;
+    }
+  item.generation++;
+
+  double speed = item.mobility->GetVelocity ().GetLength ();
+  if (speed > 0)
+    {
+      // The item may leave the neighborhood of its cell once it has
+      // moved by half a cell.
+      Expiry expiry;
+      expiry.time = Simulator::Now () + std::max (Seconds (m_cellSize / 2 / speed),
+                                                  TimeStep (1));
+      expiry.item = index;
+      expiry.generation = item.generation;
+      m_expiries.push (expiry);
+    }
+}
+
+void
+SpatialGrid::CourseChanged (Ptr<const MobilityModel> mobility)
+{
+  NS_LOG_FUNCTION (this << mobility);
+  std::map<const MobilityModel *, std::vector<uint32_t> >::const_iterator i =
+    m_mobilities.find (PeekPointer (mobility));
+  NS_ASSERT (i != m_mobilities.end ());
+  for (std::vector<uint32_t>::const_iterator j = i->second.begin (); j != i->second.end (); ++j)
+    {
+      Update (*j);
+    }
+}
+
+void
+SpatialGrid::GetNeighbors (const Vector &position, double range,
+                           std::vector<uint32_t> &items)
+{
+  NS_LOG_FUNCTION (this << position << range);
+  items.clear ();
+  Time now = Simulator::Now ();
+  while (!m_expiries.empty () && m_expiries.top ().time <= now)
+    {
+      Expiry expiry = m_expiries.top ();
+      m_expiries.pop ();
+      if (m_items[expiry.item].generation == expiry.generation)
+        {
+          Update (expiry.item);
+        }
+    }
+
+  // Items may have moved by up to half a cell from their indexed position.
+  double reach = range + m_cellSize / 2;
+  int64_t xMin = static_cast<int64_t> (std::floor ((position.x - reach) / m_cellSize));
+  int64_t xMax = static_cast<int64_t> (std::floor ((position.x + reach) / m_cellSize));
+  int64_t yMin = static_cast<int64_t> (std::floor ((position.y - reach) / m_cellSize));
+  int64_t yMax = static_cast<int64_t> (std::floor ((position.y + reach) / m_cellSize));
+  if (static_cast<double> (xMax - xMin + 1) * (yMax - yMin + 1) > m_cells.size ())
+    {
+      // Cheaper to look at every non-empty cell.
+      for (std::unordered_map<uint64_t, std::vector<uint32_t> >::const_iterator i = m_cells.begin ();
+           i != m_cells.end (); ++i)
+        {
+          int64_t x = static_cast<int32_t> (i->first >> 32);
+          int64_t y = static_cast<int32_t> (i->first & 0xffffffff);
+          if (x >= xMin && x <= xMax && y >= yMin && y <= yMax)
+            {
+              items.insert (items.end (), i->second.begin (), i->second.end ());
+            }
+        }
+    }
+  else
+    {
+      for (int64_t x = xMin; x <= xMax; ++x)
+        {
+          for (int64_t y = yMin; y <= yMax; ++y)
+            {
+              std::unordered_map<uint64_t, std::vector<uint32_t> >::const_iterator i =
+                m_cells.find (GetCell (x, y));
+              if (i != m_cells.end ())
+                {
+                  items.insert (items.end (), i->second.begin (), i->second.end ());
+                }
+            }
+        }
+    }
+  std::sort (items.begin (), items.end ());
+}
+
+} // namespace ns3
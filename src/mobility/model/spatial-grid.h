@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/vector.h"
+
+#include <functional>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+class MobilityModel;
+
+/**
+ * \ingroup mobility
+ *
+ * \brief Index of the positions of a set of mobility models in a grid of
+ * square cells, to find the neighbors of a position without looking at
+ * every item.
+ *
+ * Channels use it to only evaluate the propagation to the receivers which
+ * may be within range of the transmitter.  The grid is two-dimensional:
+ * since the horizontal distance between two positions never exceeds
+ * their actual distance, no neighbor is missed.
+ *
+ * The index is updated lazily.  The position of an item is read when the
+ * item is added, and again when its mobility model fires its
+ * \c CourseChange trace source.  Between course changes, the velocity of
+ * the item is assumed to be constant, so that the distance it has moved
+ * from its indexed position is bounded by its speed times the time
+ * elapsed: the position of a moving item is only read again when it may
+ * have moved by more than half a cell.  This assumption does not hold
+ * for mobility models which change their velocity without notifying a
+ * course change, such as ns3::ConstantAccelerationMobilityModel.
+ */
+class SpatialGrid
+{
+public:
+  SpatialGrid ();
+  ~SpatialGrid ();
+
+  /**
+   * Set the size of the cells, removing all items.
+   * \param size The length of the side of a cell, in meters.
+   *
+   * GetNeighbors is most efficient when the cell size is the range
+   * of the queries.
+   */
+  void SetCellSize (double size);
+  /**
+   * \returns The length of the side of a cell, in meters.
+   */
+  double GetCellSize (void) const;
+
+  /**
+   * Add an item to the index.
+   * \param mobility The mobility model of the item.
+   * \returns The index of the item, that is the number of items
+   *          added before it.
+   */
+  uint32_t Add (Ptr<MobilityModel> mobility);
+  /**
+   * \returns The number of items.
+   */
+  uint32_t GetNItems (void) const;
+  /** Remove all items. */
+  void Clear (void);
+
+  /**
+   * Find the items which may be within range of a position.
+   * \param [in] position The position.
+   * \param [in] range The range, in meters.
+   * \param [out] items The indexes of all the items within range of
+   *              \pname{position}, in increasing order, possibly with
+   *              some items out of range.
+   */
+  void GetNeighbors (const Vector &position, double range,
+                     std::vector<uint32_t> &items);
+
+private:
+  /** An item of the index. */
+  struct Item
+  {
+    Ptr<MobilityModel> mobility;  //!< The mobility model.
+    uint64_t cell;                //!< The cell of the indexed position.
+    uint32_t generation;          //!< Number of updates of the position.
+  };
+
+  /** A time at which the indexed position of an item expires. */
+  struct Expiry
+  {
+    Time time;                    //!< Expiration time.
+    uint32_t item;                //!< Item index.
+    uint32_t generation;          //!< Item generation when scheduled.
+    /**
+     * Order by time.
+     * \param [in] o The other expiry.
+     * \returns \c true if this expiry is later than \pname{o}.
+     */
+    bool operator > (const Expiry &o) const;
+  };
+
+  /**
+   * Get the cell of a position.
+   * \param [in] x The x coordinate of the cell.
+   * \param [in] y The y coordinate of the cell.
+   * \returns The cell key.
+   */
+  static uint64_t GetCell (int64_t x, int64_t y);
+  /**
+   * Read the position of an item, and move it to its new cell.
+   * \param [in] item The item index.
+   */
+  void Update (uint32_t item);
+  /**
+   * Notified by the mobility models when their velocity changes.
+   * \param [in] mobility The mobility model.
+   */
+  void CourseChanged (Ptr<const MobilityModel> mobility);
+
+  double m_cellSize;                                          //!< Cell size.
+  std::vector<Item> m_items;                                  //!< The items.
+  std::unordered_map<uint64_t, std::vector<uint32_t> > m_cells; //!< Items of each cell.
+  /** Items of each mobility model, to handle course changes. */
+  std::map<const MobilityModel *, std::vector<uint32_t> > m_mobilities;
+  /** Expiration of the indexed positions of the moving items. */
+  std::priority_queue<Expiry, std::vector<Expiry>, std::greater<Expiry> > m_expiries;
+};
+
+} // namespace ns3
+
+#endif /* SPATIAL_GRID_H */
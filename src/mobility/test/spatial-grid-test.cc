@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/spatial-grid.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Check that SpatialGrid::GetNeighbors finds every item within
+ * range of a position, while some items move and change course.
+ */
+class SpatialGridTestCase : public TestCase
+{
+public:
+  SpatialGridTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Query the grid around each item, and compare with the distances.
+   * \param range The query range.
+   */
+  void Check (double range);
+  /**
+   * Reverse the velocity of a mobility model.
+   * \param mobility The mobility model.
+   */
+  void Reverse (Ptr<ConstantVelocityMobilityModel> mobility);
+
+  SpatialGrid m_grid;                             //!< The grid.
+  std::vector<Ptr<MobilityModel> > m_mobilities;  //!< Mobility of each item.
+  uint32_t m_nCandidates;                         //!< Total number of candidates.
+  uint32_t m_nQueries;                            //!< Number of queries.
+};
+
+SpatialGridTestCase::SpatialGridTestCase ()
+  : TestCase ("Check the neighbors found in a spatial grid"),
+    m_nCandidates (0),
+    m_nQueries (0)
+{}
+
+void
+SpatialGridTestCase::Reverse (Ptr<ConstantVelocityMobilityModel> mobility)
+{
+  Vector v = mobility->GetVelocity ();
+  mobility->SetVelocity (Vector (-v.x, -v.y, v.z));
+}
+
+void
+SpatialGridTestCase::Check (double range)
+{
+  std::vector<uint32_t> neighbors;
+  for (uint32_t i = 0; i < m_mobilities.size (); ++i)
+    {
+      Vector position = m_mobilities[i]->GetPosition ();
+      m_grid.GetNeighbors (position, range, neighbors);
+      NS_TEST_ASSERT_MSG_EQ (std::is_sorted (neighbors.begin (), neighbors.end ()), true,
+                             "Neighbors not sorted");
+      NS_TEST_ASSERT_MSG_EQ ((std::adjacent_find (neighbors.begin (), neighbors.end ())
+                              == neighbors.end ()), true, "Duplicate neighbor");
+      for (uint32_t j = 0; j < m_mobilities.size (); ++j)
+        {
+          if (m_mobilities[j]->GetDistanceFrom (m_mobilities[i]) <= range)
+            {
+              NS_TEST_ASSERT_MSG_EQ (std::binary_search (neighbors.begin (), neighbors.end (), j),
+                                     true, "Item " << j << " within range of item " << i
+                                     << " not found at " << Simulator::Now ().As (Time::S));
+            }
+        }
+      m_nCandidates += neighbors.size ();
+      m_nQueries++;
+    }
+}
+
+void
+SpatialGridTestCase::DoRun (void)
+{
+  const uint32_t n = 200;
+  const double range = 100;
+  m_grid.SetCellSize (range);
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      Vector position ((i * 389) % 2000, (i * 733) % 2000, (i % 3) * 10.0);
+      if (i % 2 == 0)
+        {
+          Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+          mobility->SetPosition (position);
+          m_mobilities.push_back (mobility);
+        }
+      else
+        {
+          Ptr<ConstantVelocityMobilityModel> mobility = CreateObject<ConstantVelocityMobilityModel> ();
+          mobility->SetPosition (position);
+          mobility->SetVelocity (Vector ((i % 7) * 5.0 - 15, (i % 11) * 3.0 - 15, 0));
+          m_mobilities.push_back (mobility);
+          Simulator::Schedule (Seconds (3 + i % 5), &SpatialGridTestCase::Reverse, this, mobility);
+        }
+      NS_TEST_ASSERT_MSG_EQ (m_grid.Add (m_mobilities.back ()), i, "Wrong item index");
+    }
+  // Two items sharing the same mobility model.
+  NS_TEST_ASSERT_MSG_EQ (m_grid.Add (m_mobilities[1]), n, "Wrong item index");
+  m_mobilities.push_back (m_mobilities[1]);
+
+  for (uint32_t t = 0; t < 40; ++t)
+    {
+      Simulator::Schedule (Seconds (0.5 * t) + MilliSeconds (t), &SpatialGridTestCase::Check, this, range);
+    }
+  // A larger range than the cell size.
+  Simulator::Schedule (Seconds (7.5), &SpatialGridTestCase::Check, this, 3 * range);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_LT (m_nCandidates, m_nQueries * m_mobilities.size () / 10,
+                         "Too many candidates");
+  m_grid.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (m_grid.GetNItems (), 0, "Grid not cleared");
+  m_mobilities.clear ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief SpatialGrid test suite.
+ */
+class SpatialGridTestSuite : public TestSuite
+{
+public:
+  SpatialGridTestSuite ();
+};
+
+SpatialGridTestSuite::SpatialGridTestSuite ()
+  : TestSuite ("spatial-grid", UNIT)
+{
+  AddTestCase (new SpatialGridTestCase, TestCase::QUICK);
+}
+
+static SpatialGridTestSuite g_spatialGridTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,503 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "mpi-partition-helper.h"
+
+#include "ns3/node.h"
+#include "ns3/node-list.h"
+#include "ns3/channel.h"
+#include "ns3/channel-list.h"
+#include "ns3/net-device.h"
+#include "ns3/uinteger.h"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/fatal-error.h"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <list>
+
+/**
+ * \file
+ * \ingroup mpi
+ * ns3::MpiPartitionHelper implementation.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("MpiPartitionHelper");
+
+/**
+ * \ingroup mpi
+ * Unnamed namespace for the partitioner internals.
+ */
+namespace {
+
+/** Maximum number of refinement passes. */
+const uint32_t MAX_REFINE_PASSES = 8;
+
+/**
+ * Find the representative of a vertex, with path halving.
+ * \param [in,out] parent The union-find forest.
+ * \param [in] v The vertex.
+ * \returns The representative.
+ */
+uint32_t
+FindRoot (std::vector<uint32_t> &parent, uint32_t v)
+{
+  while (parent[v] != v)
+    {
+      parent[v] = parent[parent[v]];
+      v = parent[v];
+    }
+  return v;
+}
+
+/**
+ * Merge the sets of two vertices.
+ * \param [in,out] parent The union-find forest.
+ * \param [in] a The first vertex.
+ * \param [in] b The second vertex.
+ */
+void
+Union (std::vector<uint32_t> &parent, uint32_t a, uint32_t b)
+{
+  a = FindRoot (parent, a);
+  b = FindRoot (parent, b);
+  if (a != b)
+    {
+      parent[std::max (a, b)] = std::min (a, b);
+    }
+}
+
+} // unnamed namespace
+
+
+MpiPartitionHelper::MpiPartitionHelper ()
+  : m_tolerance (0.05),
+    m_lookAhead (Time::Max ()),
+    m_cutWeight (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+MpiPartitionHelper::SetNodeWeight (Ptr<Node> node, double weight)
+{
+  NS_LOG_FUNCTION (this << node << weight);
+  NS_ASSERT (weight >= 0);
+  if (node->GetId () >= m_nodeWeights.size ())
+    {
+      m_nodeWeights.resize (node->GetId () + 1, 1.0);
+    }
+  m_nodeWeights[node->GetId ()] = weight;
+}
+
+void
+MpiPartitionHelper::SetChannelWeight (Ptr<Channel> channel, double weight)
+{
+  NS_LOG_FUNCTION (this << channel << weight);
+  NS_ASSERT (weight >= 0);
+  m_channelWeights[channel->GetId ()] = weight;
+}
+
+void
+MpiPartitionHelper::SetBalanceTolerance (double tolerance)
+{
+  NS_LOG_FUNCTION (this << tolerance);
+  NS_ASSERT (tolerance >= 0);
+  m_tolerance = tolerance;
+}
+
+void
+MpiPartitionHelper::BuildGraph (std::vector<Edge> &edges,
+                                std::vector<std::pair<uint32_t, uint32_t> > &merged) const
+{
+  NS_LOG_FUNCTION (this);
+  std::vector<uint32_t> nodes;
+  for (ChannelList::Iterator i = ChannelList::Begin (); i != ChannelList::End (); ++i)
+    {
+      Ptr<Channel> channel = *i;
+      nodes.clear ();
+      for (std::size_t j = 0; j < channel->GetNDevices (); ++j)
+        {
+          Ptr<NetDevice> device = channel->GetDevice (j);
+          if (device == 0 || device->GetNode () == 0)
+            {
+              continue;
+            }
+          uint32_t id = device->GetNode ()->GetId ();
+          if (std::find (nodes.begin (), nodes.end (), id) == nodes.end ())
+            {
+              nodes.push_back (id);
+            }
+        }
+      if (nodes.size () < 2)
+        {
+          continue;
+        }
+
+      TimeValue delay;
+      if (nodes.size () == 2 && channel->GetAttributeFailSafe ("Delay", delay))
+        {
+          Edge edge;
+          edge.a = nodes[0];
+          edge.b = nodes[1];
+          edge.delay = delay.Get ().GetTimeStep ();
+          edge.weight = 1.0;
+          std::map<uint32_t, double>::const_iterator w = m_channelWeights.find (channel->GetId ());
+          if (w != m_channelWeights.end ())
+            {
+              edge.weight = w->second;
+            }
+          edges.push_back (edge);
+        }
+      else
+        {
+          NS_LOG_LOGIC ("channel " << channel->GetId () << " cannot be split");
+          for (std::size_t j = 1; j < nodes.size (); ++j)
+            {
+              merged.push_back (std::make_pair (nodes[0], nodes[j]));
+            }
+        }
+    }
+}
+
+bool
+MpiPartitionHelper::PartitionAbove (const std::vector<Edge> &edges,
+                                    const std::vector<std::pair<uint32_t, uint32_t> > &merged,
+                                    int64_t threshold, uint32_t nRanks,
+                                    std::vector<uint32_t> &ranks) const
+{
+  NS_LOG_FUNCTION (this << threshold << nRanks);
+  uint32_t nNodes = m_nodeWeights.size ();
+
+  // Contract all the edges which may not be cut.
+  std::vector<uint32_t> parent (nNodes);
+  for (uint32_t v = 0; v < nNodes; ++v)
+    {
+      parent[v] = v;
+    }
+  for (std::size_t i = 0; i < merged.size (); ++i)
+    {
+      Union (parent, merged[i].first, merged[i].second);
+    }
+  for (std::size_t i = 0; i < edges.size (); ++i)
+    {
+      if (edges[i].delay < threshold)
+        {
+          Union (parent, edges[i].a, edges[i].b);
+        }
+    }
+
+  std::vector<uint32_t> cluster (nNodes);
+  std::vector<double> weight;
+  double total = 0;
+  for (uint32_t v = 0; v < nNodes; ++v)
+    {
+      uint32_t root = FindRoot (parent, v);
+      if (root == v)
+        {
+          cluster[v] = weight.size ();
+          weight.push_back (0);
+        }
+      else
+        {
+          cluster[v] = cluster[root];
+        }
+      weight[cluster[v]] += m_nodeWeights[v];
+      total += m_nodeWeights[v];
+    }
+  uint32_t nClusters = weight.size ();
+  double capacity = (1 + m_tolerance) * total / nRanks;
+
+  std::vector<std::vector<std::pair<uint32_t, double> > > adjacency (nClusters);
+  for (std::size_t i = 0; i < edges.size (); ++i)
+    {
+      uint32_t a = cluster[edges[i].a];
+      uint32_t b = cluster[edges[i].b];
+      if (a != b)
+        {
+          adjacency[a].push_back (std::make_pair (b, edges[i].weight));
+          adjacency[b].push_back (std::make_pair (a, edges[i].weight));
+        }
+    }
+
+  // Visit the clusters in breadth-first order from the heaviest ones,
+  // so that connected clusters tend to be assigned one after the other.
+  std::vector<uint32_t> bySize (nClusters);
+  for (uint32_t c = 0; c < nClusters; ++c)
+    {
+      bySize[c] = c;
+    }
+  std::stable_sort (bySize.begin (), bySize.end (),
+                    [&weight] (uint32_t a, uint32_t b) -> bool
+    {
+      return weight[a] > weight[b];
+    });
+  std::vector<uint32_t> order;
+  std::vector<bool> visited (nClusters, false);
+  for (uint32_t i = 0; i < nClusters; ++i)
+    {
+      if (visited[bySize[i]])
+        {
+          continue;
+        }
+      std::list<uint32_t> queue (1, bySize[i]);
+      visited[bySize[i]] = true;
+      while (!queue.empty ())
+        {
+          uint32_t c = queue.front ();
+          queue.pop_front ();
+          order.push_back (c);
+          for (std::size_t j = 0; j < adjacency[c].size (); ++j)
+            {
+              uint32_t n = adjacency[c][j].first;
+              if (!visited[n])
+                {
+                  visited[n] = true;
+                  queue.push_back (n);
+                }
+            }
+        }
+    }
+
+  // Greedy growing: put each cluster in the rank it is most connected
+  // to, among the ranks with enough room left for it.
+  const uint32_t NONE = std::numeric_limits<uint32_t>::max ();
+  std::vector<uint32_t> rank (nClusters, NONE);
+  std::vector<double> load (nRanks, 0);
+  std::vector<double> connection (nRanks);
+  for (std::size_t i = 0; i < order.size (); ++i)
+    {
+      uint32_t c = order[i];
+      std::fill (connection.begin (), connection.end (), 0);
+      for (std::size_t j = 0; j < adjacency[c].size (); ++j)
+        {
+          uint32_t r = rank[adjacency[c][j].first];
+          if (r != NONE)
+            {
+              connection[r] += adjacency[c][j].second;
+            }
+        }
+      uint32_t best = 0;
+      bool fits = false;
+      for (uint32_t r = 0; r < nRanks; ++r)
+        {
+          bool rFits = load[r] + weight[c] <= capacity;
+          if ((rFits && !fits)
+              || (rFits == fits
+                  && (connection[r] > connection[best]
+                      || (connection[r] == connection[best] && load[r] < load[best]))))
+            {
+              best = r;
+              fits = rFits;
+            }
+        }
+      rank[c] = best;
+      load[best] += weight[c];
+    }
+
+  // Refinement: move single clusters while it reduces the cut weight
+  // without breaking the balance.
+  for (uint32_t pass = 0; pass < MAX_REFINE_PASSES; ++pass)
+    {
+      bool moved = false;
+      for (uint32_t c = 0; c < nClusters; ++c)
+        {
+          std::fill (connection.begin (), connection.end (), 0);
+          for (std::size_t j = 0; j < adjacency[c].size (); ++j)
+            {
+              connection[rank[adjacency[c][j].first]] += adjacency[c][j].second;
+            }
+          uint32_t from = rank[c];
+          uint32_t best = from;
+          double bestGain = 0;
+          for (uint32_t r = 0; r < nRanks; ++r)
+            {
+              if (r == from || load[r] + weight[c] > capacity)
+                {
+                  continue;
+                }
+              double gain = connection[r] - connection[from];
+              if (gain > bestGain
+                  || (gain == bestGain && gain == 0 && best == from
+                      && load[r] + weight[c] < load[from]))
+                {
+                  best = r;
+                  bestGain = gain;
+                }
+            }
+          if (best != from)
+            {
+              load[from] -= weight[c];
+              load[best] += weight[c];
+              rank[c] = best;
+              moved = moved || bestGain > 0;
+            }
+        }
+      if (!moved)
+        {
+          break;
+        }
+    }
+
+  ranks.resize (nNodes);
+  for (uint32_t v = 0; v < nNodes; ++v)
+    {
+      ranks[v] = rank[cluster[v]];
+    }
+  double heaviestRank = *std::max_element (load.begin (), load.end ());
+  NS_LOG_LOGIC ("threshold " << threshold << ": " << nClusters << " clusters, "
+                << "heaviest rank " << heaviestRank << " for capacity " << capacity);
+  return heaviestRank <= capacity;
+}
+
+void
+MpiPartitionHelper::Partition (uint32_t nRanks)
+{
+  NS_LOG_FUNCTION (this << nRanks);
+  NS_ASSERT (nRanks > 0);
+
+  uint32_t nNodes = NodeList::GetNNodes ();
+  m_nodeWeights.resize (nNodes, 1.0);
+  m_systemIds.assign (nNodes, 0);
+  m_lookAhead = Time::Max ();
+  m_cutWeight = 0;
+  if (nRanks == 1 || nNodes == 0)
+    {
+      return;
+    }
+
+  std::vector<Edge> edges;
+  std::vector<std::pair<uint32_t, uint32_t> > merged;
+  BuildGraph (edges, merged);
+
+  // Try the candidate lookaheads from the largest one: first without
+  // cutting any channel, then cutting only the slowest channels, and so on.
+  std::vector<int64_t> thresholds (1, std::numeric_limits<int64_t>::max ());
+  for (std::size_t i = 0; i < edges.size (); ++i)
+    {
+      thresholds.push_back (edges[i].delay);
+    }
+  std::sort (thresholds.begin (), thresholds.end (), std::greater<int64_t> ());
+  thresholds.erase (std::unique (thresholds.begin (), thresholds.end ()), thresholds.end ());
+
+  bool balanced = false;
+  for (std::size_t i = 0; i < thresholds.size () && !balanced; ++i)
+    {
+      balanced = PartitionAbove (edges, merged, thresholds[i], nRanks, m_systemIds);
+    }
+  if (!balanced)
+    {
+      NS_LOG_WARN ("Could not balance " << nNodes << " nodes over " << nRanks << " ranks");
+    }
+
+  for (std::size_t i = 0; i < edges.size (); ++i)
+    {
+      if (m_systemIds[edges[i].a] != m_systemIds[edges[i].b])
+        {
+          m_cutWeight += edges[i].weight;
+          m_lookAhead = std::min (m_lookAhead, TimeStep (edges[i].delay));
+        }
+    }
+  NS_LOG_INFO ("Partitioned " << nNodes << " nodes over " << nRanks << " ranks, "
+               << "cut weight " << m_cutWeight << ", lookahead " << m_lookAhead);
+}
+
+uint32_t
+MpiPartitionHelper::GetSystemId (uint32_t nodeId) const
+{
+  NS_LOG_FUNCTION (this << nodeId);
+  if (nodeId >= m_systemIds.size ())
+    {
+      NS_FATAL_ERROR ("No system id for node " << nodeId <<
+                      ", was Partition () or Read () called?");
+    }
+  return m_systemIds[nodeId];
+}
+
+uint32_t
+MpiPartitionHelper::GetNNodes (void) const
+{
+  return m_systemIds.size ();
+}
+
+Time
+MpiPartitionHelper::GetLookAhead (void) const
+{
+  return m_lookAhead;
+}
+
+double
+MpiPartitionHelper::GetCutWeight (void) const
+{
+  return m_cutWeight;
+}
+
+void
+MpiPartitionHelper::Assign (void) const
+{
+  NS_LOG_FUNCTION (this);
+  for (NodeList::Iterator i = NodeList::Begin (); i != NodeList::End (); ++i)
+    {
+      (*i)->SetAttribute ("SystemId", UintegerValue (GetSystemId ((*i)->GetId ())));
+    }
+}
+
+void
+MpiPartitionHelper::Write (std::string filename) const
+{
+  NS_LOG_FUNCTION (this << filename);
+  std::ofstream os (filename.c_str ());
+  if (!os.is_open ())
+    {
+      NS_FATAL_ERROR ("Can't open file " << filename);
+    }
+  for (std::size_t i = 0; i < m_systemIds.size (); ++i)
+    {
+      os << m_systemIds[i] << std::endl;
+    }
+}
+
+void
+MpiPartitionHelper::Read (std::string filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+  std::ifstream is (filename.c_str ());
+  if (!is.is_open ())
+    {
+      NS_FATAL_ERROR ("Can't open file " << filename);
+    }
+  m_systemIds.clear ();
+  uint32_t systemId;
+  while (is >> systemId)
+    {
+      m_systemIds.push_back (systemId);
+    }
+  if (!is.eof ())
+    {
+      NS_FATAL_ERROR ("Malformed partition file " << filename);
+    }
+  m_lookAhead = Time::Max ();
+  m_cutWeight = 0;
+}
+
+} // namespace ns3
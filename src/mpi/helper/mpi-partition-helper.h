@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MPI_PARTITION_HELPER_H
+#define MPI_PARTITION_HELPER_H
+
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mpi
+ * ns3::MpiPartitionHelper declaration.
+ */
+
+namespace ns3 {
+
+class Node;
+class Channel;
+
+/**
+ * \ingroup mpi
+ *
+ * \brief Compute the system ids of the nodes of a distributed simulation
+ * from the topology.
+ *
+ * The helper builds a graph from the NodeList and the ChannelList, in
+ * which each node is a vertex, and each channel connecting exactly two
+ * nodes through a \c Delay attribute is an edge which may be cut between
+ * two ranks.  The nodes attached to any other channel (broadcast
+ * channels, or channels without a \c Delay attribute) are always kept
+ * in the same rank.
+ *
+ * Partition() then searches, in order of priority:
+ *
+ * 1. the largest lookahead, that is the largest smallest delay of the
+ *    cut channels, such that the rank loads stay within the balance
+ *    tolerance of each other;
+ * 2. for this lookahead, the partition minimizing the total traffic
+ *    weight of the cut channels.
+ *
+ * The node weights and channel traffic weights default to 1, and can be
+ * set with SetNodeWeight() and SetChannelWeight().
+ *
+ * Since the point-to-point helpers decide whether to create a remote
+ * channel when the link is installed, the system ids must be known
+ * before the topology is built.  The intended workflow is therefore to
+ * run the script once sequentially, with the nodes all created in
+ * system 0, to compute the partition and Write() it to a file; the
+ * distributed run then Read()s the file and creates each node with
+ * `CreateObject<Node> (helper.GetSystemId (i))`.  Assign() can also be
+ * used to set the \c SystemId attribute of the existing nodes directly,
+ * before any link is installed between them.  For the same reason, the
+ * partition is not computed automatically by Simulator::Run: by then, the
+ * links between the nodes of different ranks are already local channels.
+ */
+class MpiPartitionHelper
+{
+public:
+  /** Constructor. */
+  MpiPartitionHelper ();
+
+  /**
+   * Set the relative computational load of a node.
+   * \param [in] node The node.
+   * \param [in] weight The node weight, 1 by default.
+   */
+  void SetNodeWeight (Ptr<Node> node, double weight);
+  /**
+   * Set the expected traffic on a channel.
+   * \param [in] channel The channel.
+   * \param [in] weight The cost of cutting the channel, 1 by default.
+   */
+  void SetChannelWeight (Ptr<Channel> channel, double weight);
+  /**
+   * Set the balance tolerance.
+   * \param [in] tolerance The largest load of a rank, relative to
+   *             the average load, minus 1.  The default is 0.05.
+   */
+  void SetBalanceTolerance (double tolerance);
+
+  /**
+   * Partition the nodes of the NodeList.
+   * \param [in] nRanks The number of ranks.
+   */
+  void Partition (uint32_t nRanks);
+
+  /**
+   * Get the system id computed for a node.
+   * \param [in] nodeId The node id.
+   * \returns The system id.
+   */
+  uint32_t GetSystemId (uint32_t nodeId) const;
+  /**
+   * Get the number of nodes partitioned.
+   * \returns The number of nodes.
+   */
+  uint32_t GetNNodes (void) const;
+  /**
+   * Get the lookahead of the partition.
+   * \returns The smallest delay of the channels cut by the partition,
+   *          or Time::Max () if no channel is cut.
+   */
+  Time GetLookAhead (void) const;
+  /**
+   * Get the cost of the partition.
+   * \returns The total weight of the channels cut by the partition.
+   */
+  double GetCutWeight (void) const;
+
+  /** Set the \c SystemId attribute of each node of the NodeList. */
+  void Assign (void) const;
+  /**
+   * Save the system ids to a file, one per line in node id order.
+   * \param [in] filename The file name.
+   */
+  void Write (std::string filename) const;
+  /**
+   * Load the system ids from a file written by Write().
+   * \param [in] filename The file name.
+   */
+  void Read (std::string filename);
+
+private:
+  /** An edge of the partition graph. */
+  struct Edge
+  {
+    uint32_t a;        //!< First vertex.
+    uint32_t b;        //!< Second vertex.
+    int64_t delay;     //!< Channel delay, in time steps.
+    double weight;     //!< Traffic weight.
+  };
+
+  /**
+   * Build the partition graph from the NodeList and ChannelList.
+   * \param [out] edges The edges which may be cut.
+   * \param [out] merged Pairs of vertices which must stay together.
+   */
+  void BuildGraph (std::vector<Edge> &edges,
+                   std::vector<std::pair<uint32_t, uint32_t> > &merged) const;
+  /**
+   * Partition the graph, contracting all edges shorter than a delay.
+   * \param [in] edges The edges.
+   * \param [in] merged Pairs of vertices which must stay together.
+   * \param [in] threshold Edges with a smaller delay are never cut.
+   * \param [in] nRanks The number of ranks.
+   * \param [out] ranks The rank of each vertex.
+   * \returns \c true if the partition is within the balance tolerance.
+   */
+  bool PartitionAbove (const std::vector<Edge> &edges,
+                       const std::vector<std::pair<uint32_t, uint32_t> > &merged,
+                       int64_t threshold, uint32_t nRanks,
+                       std::vector<uint32_t> &ranks) const;
+
+  std::vector<double> m_nodeWeights;           //!< Node weights, by node id.
+  std::map<uint32_t, double> m_channelWeights; //!< Channel weights, by channel id.
+  double m_tolerance;                          //!< Balance tolerance.
+  std::vector<uint32_t> m_systemIds;           //!< The computed system ids.
+  Time m_lookAhead;                            //!< Lookahead of the partition.
+  double m_cutWeight;                          //!< Cost of the partition.
+};
+
+} // namespace ns3
+
+#endif /* MPI_PARTITION_HELPER_H */
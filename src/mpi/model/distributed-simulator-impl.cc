@@ -39,6 +39,7 @@
 
 #include <mpi.h>
 #include <cmath>
+#include <set>
 
 namespace ns3 {
 
@@ -176,6 +177,8 @@ DistributedSimulatorImpl::CalculateLookAhead (void)
     }
   else
     {
+      // a channel shared by several local devices is only visited once
+      std::set<Ptr<Channel> > visited;
       NodeContainer c = NodeContainer::GetGlobal ();
       for (NodeContainer::Iterator iter = c.Begin (); iter != c.End (); ++iter)
         {
@@ -187,43 +190,38 @@ DistributedSimulatorImpl::CalculateLookAhead (void)
           for (uint32_t i = 0; i < (*iter)->GetNDevices (); ++i)
             {
               Ptr<NetDevice> localNetDevice = (*iter)->GetDevice (i);
-              // only works for p2p links currently
-              if (!localNetDevice->IsPointToPoint ())
-                {
-                  continue;
-                }
               Ptr<Channel> channel = localNetDevice->GetChannel ();
-              if (channel == 0)
+              if (channel == 0 || !visited.insert (channel).second)
                 {
                   continue;
                 }
 
-              // grab the adjacent node
-              Ptr<Node> remoteNode;
-              if (channel->GetDevice (0) == localNetDevice)
-                {
-                  remoteNode = (channel->GetDevice (1))->GetNode ();
-                }
-              else
-                {
-                  remoteNode = (channel->GetDevice (0))->GetNode ();
-                }
-
-              // if it's not remote, don't consider it
-              if (remoteNode->GetSystemId () == MpiInterface::GetSystemId ())
+              // only channels with a propagation delay can bound
+              // the lookahead
+              TimeValue delay;
+              if (!channel->GetAttributeFailSafe ("Delay", delay))
                 {
                   continue;
                 }
 
-              // compare delay on the channel with current value of
-              // m_lookAhead.  if delay on channel is smaller, make
-              // it the new lookAhead.
-              TimeValue delay;
-              channel->GetAttribute ("Delay", delay);
-
-              if (delay.Get () < m_lookAhead)
+              for (std::size_t j = 0; j < channel->GetNDevices (); ++j)
                 {
-                  m_lookAhead = delay.Get ();
+                  // if it's not remote, don't consider it
+                  Ptr<Node> remoteNode = channel->GetDevice (j)->GetNode ();
+                  if (remoteNode->GetSystemId () == MpiInterface::GetSystemId ())
+                    {
+                      continue;
+                    }
+
+                  // compare delay on the channel with current value of
+                  // m_lookAhead.  if delay on channel is smaller, make
+                  // it the new lookAhead.
+                  if (delay.Get () < m_lookAhead)
+                    {
+                      m_lookAhead = delay.Get ();
+                    }
+                  // the other remote devices see the same delay
+                  break;
                 }
             }
         }
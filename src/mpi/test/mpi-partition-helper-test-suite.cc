@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/node.h"
+#include "ns3/node-container.h"
+#include "ns3/node-list.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/uinteger.h"
+#include "ns3/mpi-partition-helper.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup mpi
+ * \defgroup mpi-test mpi module tests
+ */
+
+/**
+ * \ingroup mpi-test
+ * \ingroup tests
+ *
+ * Check the partitions computed by MpiPartitionHelper.
+ */
+class MpiPartitionHelperTestCase : public TestCase
+{
+public:
+  MpiPartitionHelperTestCase ();
+  virtual void DoRun (void);
+
+private:
+  /**
+   * Connect two nodes with a SimpleChannel.
+   * \param [in] a The first node.
+   * \param [in] b The second node.
+   * \param [in] delay The channel delay.
+   * \returns The channel.
+   */
+  Ptr<SimpleChannel> Link (Ptr<Node> a, Ptr<Node> b, Time delay);
+  /** Two clusters of fast links joined by slow links. */
+  void TestClusters (void);
+  /** A chain in which the slowest links cannot be balanced. */
+  void TestChain (void);
+};
+
+MpiPartitionHelperTestCase::MpiPartitionHelperTestCase ()
+  : TestCase ("Check the MPI partition helper")
+{}
+
+Ptr<SimpleChannel>
+MpiPartitionHelperTestCase::Link (Ptr<Node> a, Ptr<Node> b, Time delay)
+{
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  channel->SetAttribute ("Delay", TimeValue (delay));
+  Ptr<Node> nodes[2] = { a, b };
+  for (uint32_t i = 0; i < 2; ++i)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      nodes[i]->AddDevice (device);
+      device->SetChannel (channel);
+    }
+  return channel;
+}
+
+void
+MpiPartitionHelperTestCase::TestClusters (void)
+{
+  NodeContainer left;
+  left.Create (8);
+  NodeContainer right;
+  right.Create (8);
+  for (uint32_t i = 0; i < 8; ++i)
+    {
+      Link (left.Get (i), left.Get ((i + 1) % 8), MicroSeconds (1));
+      Link (right.Get (i), right.Get ((i + 1) % 8), MicroSeconds (1));
+    }
+  Link (left.Get (0), right.Get (0), MilliSeconds (10));
+  Link (left.Get (4), right.Get (4), MilliSeconds (20));
+
+  MpiPartitionHelper helper;
+  helper.Partition (2);
+  NS_TEST_ASSERT_MSG_EQ (helper.GetNNodes (), 16, "Wrong number of nodes");
+  NS_TEST_EXPECT_MSG_EQ (helper.GetLookAhead (), MilliSeconds (10), "Wrong lookahead");
+  NS_TEST_EXPECT_MSG_EQ (helper.GetCutWeight (), 2, "Wrong cut weight");
+  uint32_t leftId = helper.GetSystemId (left.Get (0)->GetId ());
+  uint32_t rightId = helper.GetSystemId (right.Get (0)->GetId ());
+  NS_TEST_EXPECT_MSG_NE (leftId, rightId, "Clusters in the same rank");
+  for (uint32_t i = 0; i < 8; ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (helper.GetSystemId (left.Get (i)->GetId ()), leftId,
+                             "Left cluster split");
+      NS_TEST_EXPECT_MSG_EQ (helper.GetSystemId (right.Get (i)->GetId ()), rightId,
+                             "Right cluster split");
+    }
+
+  std::string filename = CreateTempDirFilename ("partition.txt");
+  helper.Write (filename);
+  helper.Assign ();
+  MpiPartitionHelper other;
+  other.Read (filename);
+  NS_TEST_ASSERT_MSG_EQ (other.GetNNodes (), 16, "Wrong number of nodes read");
+  for (uint32_t i = 0; i < 16; ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (other.GetSystemId (i), helper.GetSystemId (i), "Wrong system id read");
+      NS_TEST_EXPECT_MSG_EQ (NodeList::GetNode (i)->GetSystemId (), helper.GetSystemId (i),
+                             "Wrong system id assigned");
+    }
+
+  Simulator::Destroy ();
+}
+
+void
+MpiPartitionHelperTestCase::TestChain (void)
+{
+  NodeContainer nodes;
+  nodes.Create (4);
+  Link (nodes.Get (0), nodes.Get (1), MilliSeconds (5));
+  Link (nodes.Get (1), nodes.Get (2), MilliSeconds (1));
+  Ptr<SimpleChannel> heavy = Link (nodes.Get (2), nodes.Get (3), MilliSeconds (5));
+
+  // Nodes 1 and 2 must stay together to keep a 5 ms lookahead.
+  MpiPartitionHelper helper;
+  helper.SetBalanceTolerance (0.5);
+  helper.SetChannelWeight (heavy, 10);
+  helper.Partition (2);
+  NS_TEST_EXPECT_MSG_EQ (helper.GetLookAhead (), MilliSeconds (5), "Wrong lookahead");
+  NS_TEST_EXPECT_MSG_EQ (helper.GetCutWeight (), 1, "Heavy channel cut");
+  NS_TEST_EXPECT_MSG_EQ (helper.GetSystemId (1), helper.GetSystemId (2), "Fast channel cut");
+  NS_TEST_EXPECT_MSG_EQ (helper.GetSystemId (2), helper.GetSystemId (3), "Heavy channel cut");
+  NS_TEST_EXPECT_MSG_NE (helper.GetSystemId (0), helper.GetSystemId (1), "No channel cut");
+
+  // A tight balance forces cutting the fast channel.
+  helper.SetBalanceTolerance (0);
+  helper.SetNodeWeight (nodes.Get (1), 2);
+  helper.SetNodeWeight (nodes.Get (2), 2);
+  helper.Partition (2);
+  NS_TEST_EXPECT_MSG_EQ (helper.GetLookAhead (), MilliSeconds (1), "Wrong lookahead");
+  NS_TEST_EXPECT_MSG_NE (helper.GetSystemId (1), helper.GetSystemId (2), "Unbalanced partition");
+
+  Simulator::Destroy ();
+}
+
+void
+MpiPartitionHelperTestCase::DoRun (void)
+{
+  TestClusters ();
+  TestChain ();
+}
+
+/**
+ * \ingroup mpi-test
+ * \ingroup tests
+ *
+ * MpiPartitionHelper test suite.
+ */
+class MpiPartitionHelperTestSuite : public TestSuite
+{
+public:
+  MpiPartitionHelperTestSuite ()
+    : TestSuite ("mpi-partition-helper", UNIT)
+  {
+    AddTestCase (new MpiPartitionHelperTestCase (), TestCase::QUICK);
+  }
+};
+
+/** Static variable for test initialization. */
+static MpiPartitionHelperTestSuite g_mpiPartitionHelperTestSuite;
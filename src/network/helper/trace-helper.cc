@@ -28,6 +28,7 @@
 #include "ns3/names.h"
 #include "ns3/net-device.h"
 #include "ns3/pcap-file-wrapper.h"
+#include "ns3/binary-trace.h"
 
 #include "trace-helper.h"
 
@@ -208,6 +209,17 @@ AsciiTraceHelper::CreateFileStream (std::string filename, std::ios::openmode fil
   return StreamWrapper;
 }
 
+Ptr<OutputStreamWrapper>
+AsciiTraceHelper::CreateBinaryFileStream (std::string filename, bool flows)
+{
+  NS_LOG_FUNCTION (filename << flows);
+
+  Ptr<OutputStreamWrapper> stream = Create<OutputStreamWrapper> (filename, std::ios::out | std::ios::binary);
+  stream->SetTraceFormat (flows ? OutputStreamWrapper::BINARY_WITH_FLOWS : OutputStreamWrapper::BINARY);
+  BinaryTrace::WriteHeader (*stream->GetStream (), flows);
+  return stream;
+}
+
 std::string
 AsciiTraceHelper::GetFilenameFromDevice (std::string prefix, Ptr<NetDevice> device, bool useObjectNames)
 {
@@ -295,6 +307,21 @@ AsciiTraceHelper::GetFilenameFromInterfacePair (
   return oss.str ();
 }
 
+/**
+ * \brief Write the binary trace record of an event.
+ * \param stream the output stream, with a binary trace format
+ * \param event the event
+ * \param context the trace context, empty if unknown
+ * \param p the packet
+ */
+static void
+WriteBinaryRecord (Ptr<OutputStreamWrapper> stream, BinaryTrace::Event event,
+                   const std::string &context, Ptr<const Packet> p)
+{
+  bool flows = stream->GetTraceFormat () == OutputStreamWrapper::BINARY_WITH_FLOWS;
+  BinaryTrace::Write (*stream->GetStream (), BinaryTrace::MakeRecord (event, context, p, flows), flows);
+}
+
 //
 // One of the basic default trace sink sets.  Enqueue:
 //
@@ -310,6 +337,11 @@ void
 AsciiTraceHelper::DefaultEnqueueSinkWithoutContext (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  if (stream->GetTraceFormat () != OutputStreamWrapper::TEXT)
+    {
+      WriteBinaryRecord (stream, BinaryTrace::ENQUEUE, "", p);
+      return;
+    }
   *stream->GetStream () << "+ " << Simulator::Now ().GetSeconds () << " " << *p << std::endl;
 }
 
@@ -317,6 +349,11 @@ void
 AsciiTraceHelper::DefaultEnqueueSinkWithContext (Ptr<OutputStreamWrapper> stream, std::string context, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  if (stream->GetTraceFormat () != OutputStreamWrapper::TEXT)
+    {
+      WriteBinaryRecord (stream, BinaryTrace::ENQUEUE, context, p);
+      return;
+    }
   *stream->GetStream () << "+ " << Simulator::Now ().GetSeconds () << " " << context << " " << *p << std::endl;
 }
 
@@ -336,6 +373,11 @@ void
 AsciiTraceHelper::DefaultDropSinkWithoutContext (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  if (stream->GetTraceFormat () != OutputStreamWrapper::TEXT)
+    {
+      WriteBinaryRecord (stream, BinaryTrace::DROP, "", p);
+      return;
+    }
   *stream->GetStream () << "d " << Simulator::Now ().GetSeconds () << " " << *p << std::endl;
 }
 
@@ -343,6 +385,11 @@ void
 AsciiTraceHelper::DefaultDropSinkWithContext (Ptr<OutputStreamWrapper> stream, std::string context, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  if (stream->GetTraceFormat () != OutputStreamWrapper::TEXT)
+    {
+      WriteBinaryRecord (stream, BinaryTrace::DROP, context, p);
+      return;
+    }
   *stream->GetStream () << "d " << Simulator::Now ().GetSeconds () << " " << context << " " << *p << std::endl;
 }
 
@@ -363,6 +410,11 @@ void
 AsciiTraceHelper::DefaultDequeueSinkWithoutContext (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  if (stream->GetTraceFormat () != OutputStreamWrapper::TEXT)
+    {
+      WriteBinaryRecord (stream, BinaryTrace::DEQUEUE, "", p);
+      return;
+    }
   *stream->GetStream () << "- " << Simulator::Now ().GetSeconds () << " " << *p << std::endl;
 }
 
@@ -370,6 +422,11 @@ void
 AsciiTraceHelper::DefaultDequeueSinkWithContext (Ptr<OutputStreamWrapper> stream, std::string context, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  if (stream->GetTraceFormat () != OutputStreamWrapper::TEXT)
+    {
+      WriteBinaryRecord (stream, BinaryTrace::DEQUEUE, context, p);
+      return;
+    }
   *stream->GetStream () << "- " << Simulator::Now ().GetSeconds () << " " << context << " " << *p << std::endl;
 }
 
@@ -387,6 +444,11 @@ void
 AsciiTraceHelper::DefaultReceiveSinkWithoutContext (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  if (stream->GetTraceFormat () != OutputStreamWrapper::TEXT)
+    {
+      WriteBinaryRecord (stream, BinaryTrace::RECEIVE, "", p);
+      return;
+    }
   *stream->GetStream () << "r " << Simulator::Now ().GetSeconds () << " " << *p << std::endl;
 }
 
@@ -394,6 +456,11 @@ void
 AsciiTraceHelper::DefaultReceiveSinkWithContext (Ptr<OutputStreamWrapper> stream, std::string context, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  if (stream->GetTraceFormat () != OutputStreamWrapper::TEXT)
+    {
+      WriteBinaryRecord (stream, BinaryTrace::RECEIVE, context, p);
+      return;
+    }
   *stream->GetStream () << "r " << Simulator::Now ().GetSeconds () << " " << context << " " << *p << std::endl;
 }
 
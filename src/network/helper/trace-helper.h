@@ -222,6 +222,21 @@ public:
   Ptr<OutputStreamWrapper> CreateFileStream (std::string filename, 
                                              std::ios::openmode filemode = std::ios::out);
 
+  /**
+   * @brief Create and initialize an output stream object where the default
+   * trace sinks write binary records, rather than text lines.
+   *
+   * The stream can be given to the EnableAscii methods of the device
+   * helpers, as a stream created by CreateFileStream.  The format of the
+   * file is described in BinaryTrace; the binary-trace-convert utility
+   * converts it to text.
+   *
+   * @param filename file name
+   * @param flows whether the records have the IPv4 flow columns
+   * @returns a smart pointer to the output stream
+   */
+  Ptr<OutputStreamWrapper> CreateBinaryFileStream (std::string filename, bool flows = false);
+
   /**
    * @brief Hook a trace source to the default enqueue operation trace sink that
    * does not accept nor log a trace context.
@@ -20,6 +20,9 @@
 #include "buffer.h"
 #include "ns3/assert.h"
 #include "ns3/log.h"
+#include "ns3/unused.h"
+#include <algorithm>
+#include <cstring>
 
 #define LOG_INTERNAL_STATE(y)                                                                    \
   NS_LOG_LOGIC (y << "start="<<m_start<<", end="<<m_end<<", zero start="<<m_zeroAreaStart<<              \
@@ -43,6 +46,77 @@ static struct Zeroes
   const uint32_t size;  //!< buffer size
 } g_zeroes; //!< Zero-filled buffer
 
+/**
+ * \ingroup packet
+ * \brief Swap the bytes of a 16-bit word.
+ * \param word the word
+ * \return the swapped word
+ */
+inline uint16_t
+SwapBytes (uint32_t word)
+{
+  return ((word & 0xff) << 8) | ((word >> 8) & 0xff);
+}
+
+/**
+ * \ingroup packet
+ * \brief Sum contiguous bytes as 16-bit words in host order, with the
+ * one's complement arithmetic of RFC 1071.
+ *
+ * The bytes are summed four at a time, with the carries accumulated in
+ * the upper bits of a 64-bit sum.
+ *
+ * \param data the bytes
+ * \param size the number of bytes
+ * \return the folded sum
+ */
+uint16_t
+SumWords (const uint8_t *data, uint32_t size)
+{
+  uint64_t sum = 0;
+  uint32_t word;
+  while (size >= 4)
+    {
+      memcpy (&word, data, 4);
+      sum += word;
+      data += 4;
+      size -= 4;
+    }
+  uint16_t half = 0;
+  if (size >= 2)
+    {
+      memcpy (&half, data, 2);
+      sum += half;
+      data += 2;
+      size -= 2;
+    }
+  if (size == 1)
+    {
+      // The last byte is the first byte of a word padded with zero
+      half = 0;
+      memcpy (&half, data, 1);
+      sum += half;
+    }
+  while (sum >> 16)
+    {
+      sum = (sum & 0xffff) + (sum >> 16);
+    }
+  return sum;
+}
+
+/**
+ * \ingroup packet
+ * \return true if the host is little endian
+ */
+inline bool
+IsLittleEndian (void)
+{
+  uint16_t word = 1;
+  uint8_t first;
+  memcpy (&first, &word, 1);
+  return first == 1;
+}
+
 }
 
 namespace ns3 {
@@ -50,16 +124,23 @@ namespace ns3 {
 NS_LOG_COMPONENT_DEFINE ("Buffer");
 
 
-uint32_t Buffer::g_recommendedStart = 0;
+NS_MT_PACKETS_THREAD_LOCAL uint32_t Buffer::g_recommendedStart = 0;
 #ifdef BUFFER_FREE_LIST
-/* The following macros are pretty evil but they are needed to allow us to
+/* With --enable-mt-packets, each thread has its own free list, so that
+ * packets can be created and destroyed concurrently, e.g., by the
+ * partitions of a multithreaded simulation.  A buffer released by another
+ * thread than the one which created it goes to the free list of the
+ * releasing thread.
+ *
+ * The following macros are pretty evil but they are needed to allow us to
  * keep track of 3 possible states for the g_freeList variable:
  *  - uninitialized means that no one has created a buffer yet
  *    so no one has created the associated free list (it is created
  *    on-demand when the first buffer is created)
  *  - initialized means that the free list exists and is valid
- *  - destroyed means that the static destructors of this compilation unit
- *    have run so, the free list has been cleared from its content
+ *  - destroyed means that the static (or thread-local) destructors of this
+ *    compilation unit have run so, the free list has been cleared from its
+ *    content
  * The key is that in destroyed state, we are careful not re-create it
  * which is a typical weakness of lazy evaluation schemes which use 
  * '0' as a special value to indicate both un-initialized and destroyed.
@@ -75,9 +156,9 @@ uint32_t Buffer::g_recommendedStart = 0;
 #define IS_INITIALIZED(x) (!IS_UNINITIALIZED (x) && !IS_DESTROYED (x))
 #define DESTROYED ((Buffer::FreeList*)MAGIC_DESTROYED)
 #define UNINITIALIZED ((Buffer::FreeList*)0)
-uint32_t Buffer::g_maxSize = 0;
-Buffer::FreeList *Buffer::g_freeList = 0;
-struct Buffer::LocalStaticDestructor Buffer::g_localStaticDestructor;
+NS_MT_PACKETS_THREAD_LOCAL uint32_t Buffer::g_maxSize = 0;
+NS_MT_PACKETS_THREAD_LOCAL Buffer::FreeList *Buffer::g_freeList = 0;
+NS_MT_PACKETS_THREAD_LOCAL struct Buffer::LocalStaticDestructor Buffer::g_localStaticDestructor;
 
 Buffer::LocalStaticDestructor::~LocalStaticDestructor(void)
 {
@@ -122,6 +203,11 @@ Buffer::Create (uint32_t dataSize)
   /* try to find a buffer correctly sized. */
   if (IS_UNINITIALIZED (g_freeList))
     {
+#ifdef NS3_MT_PACKETS
+      // Odr-use the destructor so that it runs at thread exit.
+      struct LocalStaticDestructor *destructor = &g_localStaticDestructor;
+      NS_UNUSED (destructor);
+#endif
       g_freeList = new Buffer::FreeList ();
     }
   else if (IS_INITIALIZED (g_freeList))
@@ -186,18 +272,21 @@ Buffer::Deallocate (struct Buffer::Data *data)
 }
 
 Buffer::Buffer ()
+  : m_fragments (0)
 {
   NS_LOG_FUNCTION (this);
   Initialize (0);
 }
 
 Buffer::Buffer (uint32_t dataSize)
+  : m_fragments (0)
 {
   NS_LOG_FUNCTION (this << dataSize);
   Initialize (dataSize);
 }
 
 Buffer::Buffer (uint32_t dataSize, bool initialize)
+  : m_fragments (0)
 {
   NS_LOG_FUNCTION (this << dataSize << initialize);
   if (initialize == true)
@@ -259,11 +348,26 @@ Buffer &
 Buffer::operator = (Buffer const&o)
 {
   NS_ASSERT (CheckInternalState ());
+  // o may be one of our own fragments: take the new references
+  // before dropping the old ones.
+  struct FragmentList *fragments = o.m_fragments;
+  if (fragments != 0)
+    {
+      fragments->m_count++;
+    }
+  AssignData (o);
+  ReleaseFragments ();
+  m_fragments = fragments;
+  return *this;
+}
+
+void
+Buffer::AssignData (Buffer const &o)
+{
   if (m_data != o.m_data) 
     {
       // not assignment to self.
-      m_data->m_count--;
-      if (m_data->m_count == 0) 
+      if (--m_data->m_count == 0)
         {
           Recycle (m_data);
         }
@@ -277,7 +381,98 @@ Buffer::operator = (Buffer const&o)
   m_start = o.m_start;
   m_end = o.m_end;
   NS_ASSERT (CheckInternalState ());
-  return *this;
+}
+
+void
+Buffer::ReleaseFragments (void)
+{
+  if (m_fragments != 0)
+    {
+      if (--m_fragments->m_count == 0)
+        {
+          delete m_fragments;
+        }
+      m_fragments = 0;
+    }
+}
+
+void
+Buffer::UnshareFragments (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_fragments == 0)
+    {
+      m_fragments = new FragmentList;
+      m_fragments->m_count = 1;
+      m_fragments->m_size = 0;
+    }
+  else if (m_fragments->m_count > 1)
+    {
+      struct FragmentList *copy = new FragmentList;
+      copy->m_count = 1;
+      copy->m_size = m_fragments->m_size;
+      copy->m_buffers = m_fragments->m_buffers;
+      ReleaseFragments ();
+      m_fragments = copy;
+    }
+}
+
+void
+Buffer::AppendFragment (Buffer const &o)
+{
+  NS_ASSERT (o.m_fragments == 0 && o.GetSize () > 0);
+  NS_ASSERT (m_fragments != 0 && m_fragments->m_count == 1);
+  m_fragments->m_buffers.push_back (o);
+  m_fragments->m_size += o.GetSize ();
+}
+
+void
+Buffer::Materialize (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (m_fragments != 0);
+  uint32_t size = GetSize ();
+  uint32_t start = g_recommendedStart;
+  struct Buffer::Data *data = Buffer::Create (start + size);
+  uint8_t *p = data->m_data + start;
+  Buffer::Iterator (this).Read (p, m_end - m_start);
+  p += m_end - m_start;
+  for (std::vector<Buffer>::const_iterator i = m_fragments->m_buffers.begin ();
+       i != m_fragments->m_buffers.end (); ++i)
+    {
+      i->Begin ().Read (p, i->GetSize ());
+      p += i->GetSize ();
+    }
+
+  m_maxZeroAreaStart = std::max (m_maxZeroAreaStart, m_zeroAreaStart);
+  if (--m_fragments->m_count == 0)
+    {
+      delete m_fragments;
+    }
+  m_fragments = 0;
+  if (--m_data->m_count == 0)
+    {
+      Buffer::Recycle (m_data);
+    }
+  m_data = data;
+  m_start = start;
+  m_zeroAreaStart = start;
+  m_zeroAreaEnd = start;
+  m_end = start + size;
+  data->m_dirtyStart = m_start;
+  data->m_dirtyEnd = m_end;
+  LOG_INTERNAL_STATE ("materialize ");
+  NS_ASSERT (CheckInternalState ());
+}
+
+uint32_t
+Buffer::GetNFragments (void) const
+{
+  if (m_fragments != 0)
+    {
+      return 1 + m_fragments->m_buffers.size ();
+    }
+  return 1;
 }
 
 Buffer::~Buffer ()
@@ -285,11 +480,11 @@ Buffer::~Buffer ()
   NS_LOG_FUNCTION (this);
   NS_ASSERT (CheckInternalState ());
   g_recommendedStart = std::max (g_recommendedStart, m_maxZeroAreaStart);
-  m_data->m_count--;
-  if (m_data->m_count == 0) 
+  if (--m_data->m_count == 0)
     {
       Recycle (m_data);
     }
+  ReleaseFragments ();
 }
 
 uint32_t
@@ -305,31 +500,56 @@ Buffer::GetInternalEnd (void) const
   return m_end - (m_zeroAreaEnd - m_zeroAreaStart);
 }
 
+bool
+Buffer::ClaimAtStart (uint32_t start)
+{
+  uint32_t newStart = m_start - start;
+  if (m_data->m_count == 1)
+    {
+      // no other Buffer can access the data.
+      m_data->m_dirtyStart = newStart;
+      return true;
+    }
+  // the bytes before the dirty area are free for the first Buffer
+  // which reaches them, even if another thread races with us.
+  return SharedValueClaim (m_data->m_dirtyStart, m_start, newStart);
+}
+
+bool
+Buffer::ClaimAtEnd (uint32_t end)
+{
+  uint32_t newEnd = m_end + end;
+  if (m_data->m_count == 1)
+    {
+      // no other Buffer can access the data.
+      m_data->m_dirtyEnd = newEnd;
+      return true;
+    }
+  // the bytes after the dirty area are free for the first Buffer
+  // which reaches them, even if another thread races with us.
+  return SharedValueClaim (m_data->m_dirtyEnd, m_end, newEnd);
+}
+
 void
 Buffer::AddAtStart (uint32_t start)
 {
   NS_LOG_FUNCTION (this << start);
   NS_ASSERT (CheckInternalState ());
-  bool isDirty = m_data->m_count > 1 && m_start > m_data->m_dirtyStart;
-  if (m_start >= start && !isDirty)
+  if (m_start >= start && ClaimAtStart (start))
     {
       /* enough space in the buffer and not dirty. 
        * To add: |..|
        * Before: |*****---------***|
        * After:  |***..---------***|
        */
-      NS_ASSERT (m_data->m_count == 1 || m_start == m_data->m_dirtyStart);
       m_start -= start;
-      // update dirty area
-      m_data->m_dirtyStart = m_start;
     } 
   else
     {
       uint32_t newSize = GetInternalSize () + start;
       struct Buffer::Data *newData = Buffer::Create (newSize);
       memcpy (newData->m_data + start, m_data->m_data + m_start, GetInternalSize ());
-      m_data->m_count--;
-      if (m_data->m_count == 0)
+      if (--m_data->m_count == 0)
         {
           Buffer::Recycle (m_data);
         }
@@ -355,26 +575,25 @@ Buffer::AddAtEnd (uint32_t end)
 {
   NS_LOG_FUNCTION (this << end);
   NS_ASSERT (CheckInternalState ());
-  bool isDirty = m_data->m_count > 1 && m_end < m_data->m_dirtyEnd;
-  if (GetInternalEnd () + end <= m_data->m_size && !isDirty)
+  if (m_fragments != 0)
+    {
+      Materialize ();
+    }
+  if (GetInternalEnd () + end <= m_data->m_size && ClaimAtEnd (end))
     {
       /* enough space in buffer and not dirty
        * Add:    |...|
        * Before: |**----*****|
        * After:  |**----...**|
        */
-      NS_ASSERT (m_data->m_count == 1 || m_end == m_data->m_dirtyEnd);
       m_end += end;
-      // update dirty area.
-      m_data->m_dirtyEnd = m_end;
     } 
   else
     {
       uint32_t newSize = GetInternalSize () + end;
       struct Buffer::Data *newData = Buffer::Create (newSize);
       memcpy (newData->m_data, m_data->m_data + m_start, GetInternalSize ());
-      m_data->m_count--;
-      if (m_data->m_count == 0) 
+      if (--m_data->m_count == 0)
         {
           Buffer::Recycle (m_data);
         }
@@ -400,7 +619,18 @@ void
 Buffer::AddAtEnd (const Buffer &o)
 {
   NS_LOG_FUNCTION (this << &o);
-  if (m_data->m_count == 1 &&
+  if (o.GetSize () == 0)
+    {
+      return;
+    }
+  if (GetSize () == 0)
+    {
+      *this = o;
+      return;
+    }
+  if (m_fragments == 0 &&
+      o.m_fragments == 0 &&
+      m_data->m_count == 1 &&
       m_end == m_zeroAreaEnd &&
       m_end == m_data->m_dirtyEnd &&
       o.m_start == o.m_zeroAreaStart &&
@@ -426,11 +656,27 @@ Buffer::AddAtEnd (const Buffer &o)
       return;
     }
 
-  *this = CreateFullCopy ();
-  AddAtEnd (o.GetSize ());
-  Buffer::Iterator destStart = End ();
-  destStart.Prev (o.GetSize ());
-  destStart.Write (o.Begin (), o.End ());
+  // Share the bytes of o instead of copying them.  The local copy
+  // keeps o valid if it is this buffer or one of its fragments.
+  Buffer src = o;
+  UnshareFragments ();
+  if (src.m_end > src.m_start)
+    {
+      Buffer head = src;
+      head.ReleaseFragments ();
+      AppendFragment (head);
+    }
+  if (src.m_fragments != 0)
+    {
+      for (std::vector<Buffer>::const_iterator i = src.m_fragments->m_buffers.begin ();
+           i != src.m_fragments->m_buffers.end (); ++i)
+        {
+          AppendFragment (*i);
+        }
+    }
+#ifdef NS3_MT_PACKETS
+  Materialize ();
+#endif
   NS_ASSERT (CheckInternalState ());
 }
 
@@ -439,6 +685,39 @@ Buffer::RemoveAtStart (uint32_t start)
 {
   NS_LOG_FUNCTION (this << start);
   NS_ASSERT (CheckInternalState ());
+  if (m_fragments != 0 && start >= m_end - m_start)
+    {
+      /* remove all of m_data and the first fragments: the first
+       * fragment left becomes the new m_data.
+       */
+      start -= m_end - m_start;
+      UnshareFragments ();
+      std::vector<Buffer> &buffers = m_fragments->m_buffers;
+      std::vector<Buffer>::iterator i = buffers.begin ();
+      while (i != buffers.end () && start >= i->GetSize ())
+        {
+          start -= i->GetSize ();
+          m_fragments->m_size -= i->GetSize ();
+          ++i;
+        }
+      if (i == buffers.end ())
+        {
+          ReleaseFragments ();
+          RemoveAtStart (m_end - m_start);
+          return;
+        }
+      Buffer head = *i;
+      m_fragments->m_size -= head.GetSize ();
+      buffers.erase (buffers.begin (), i + 1);
+      head.RemoveAtStart (start);
+      AssignData (head);
+      if (buffers.empty ())
+        {
+          ReleaseFragments ();
+        }
+      LOG_INTERNAL_STATE ("rem start=" << start << ", ");
+      return;
+    }
   uint32_t newStart = m_start + start;
   if (newStart <= m_zeroAreaStart)
     {
@@ -484,6 +763,36 @@ Buffer::RemoveAtEnd (uint32_t end)
 {
   NS_LOG_FUNCTION (this << end);
   NS_ASSERT (CheckInternalState ());
+  if (m_fragments != 0)
+    {
+      /* remove the last fragments first */
+      UnshareFragments ();
+      std::vector<Buffer> &buffers = m_fragments->m_buffers;
+      while (end > 0 && !buffers.empty ())
+        {
+          uint32_t size = buffers.back ().GetSize ();
+          if (end < size)
+            {
+              buffers.back ().RemoveAtEnd (end);
+              m_fragments->m_size -= end;
+              end = 0;
+            }
+          else
+            {
+              end -= size;
+              m_fragments->m_size -= size;
+              buffers.pop_back ();
+            }
+        }
+      if (buffers.empty ())
+        {
+          ReleaseFragments ();
+        }
+      if (end == 0)
+        {
+          return;
+        }
+    }
   uint32_t newEnd = m_end - std::min (end, m_end - m_start);
   if (newEnd > m_zeroAreaEnd)
     {
@@ -532,6 +841,13 @@ Buffer::CreateFullCopy (void) const
 {
   NS_LOG_FUNCTION (this);
   NS_ASSERT (CheckInternalState ());
+  if (m_fragments != 0)
+    {
+      // a materialized copy has no zero area
+      Buffer tmp = *this;
+      tmp.Materialize ();
+      return tmp;
+    }
   if (m_zeroAreaEnd - m_zeroAreaStart != 0) 
     {
       Buffer tmp;
@@ -558,6 +874,12 @@ Buffer::GetSerializedSize (void) const
   NS_LOG_FUNCTION (this);
   uint32_t dataStart = (m_zeroAreaStart - m_start + 3) & (~0x3);
   uint32_t dataEnd = (m_end - m_zeroAreaEnd + 3) & (~0x3);
+  if (m_fragments != 0)
+    {
+      // serialized as materialized, all the bytes after the zero area
+      dataStart = 0;
+      dataEnd = (GetSize () + 3) & (~0x3);
+    }
 
   // total size 4-bytes for dataStart length 
   // + X number of bytes for dataStart 
@@ -576,6 +898,12 @@ uint32_t
 Buffer::Serialize (uint8_t* buffer, uint32_t maxSize) const
 {
   NS_LOG_FUNCTION (this << &buffer << maxSize);
+  if (m_fragments != 0)
+    {
+      Buffer tmp = *this;
+      tmp.Materialize ();
+      return tmp.Serialize (buffer, maxSize);
+    }
   uint32_t* p = reinterpret_cast<uint32_t *> (buffer);
   uint32_t size = 0;
 
@@ -648,6 +976,7 @@ uint32_t
 Buffer::Deserialize (const uint8_t *buffer, uint32_t size)
 {
   NS_LOG_FUNCTION (this << &buffer << size);
+  ReleaseFragments ();
   const uint32_t* p = reinterpret_cast<const uint32_t *> (buffer);
   uint32_t sizeCheck = size-4;
 
@@ -706,6 +1035,10 @@ Buffer::PeekData (void) const
 {
   NS_LOG_FUNCTION (this);
   NS_ASSERT (CheckInternalState ());
+  if (m_fragments != 0)
+    {
+      Materialize ();
+    }
   TransformIntoRealBuffer ();
   NS_ASSERT (CheckInternalState ());
   return m_data->m_data + m_start;
@@ -715,6 +1048,22 @@ void
 Buffer::CopyData (std::ostream *os, uint32_t size) const
 {
   NS_LOG_FUNCTION (this << &os << size);
+  if (m_fragments != 0)
+    {
+      Buffer head = *this;
+      head.ReleaseFragments ();
+      uint32_t tmpsize = std::min (size, head.GetSize ());
+      head.CopyData (os, tmpsize);
+      size -= tmpsize;
+      for (std::vector<Buffer>::const_iterator i = m_fragments->m_buffers.begin ();
+           i != m_fragments->m_buffers.end () && size > 0; ++i)
+        {
+          tmpsize = std::min (size, i->GetSize ());
+          i->CopyData (os, tmpsize);
+          size -= tmpsize;
+        }
+      return;
+    }
   if (size > 0)
     {
       uint32_t tmpsize = std::min (m_zeroAreaStart-m_start, size);
@@ -744,6 +1093,18 @@ uint32_t
 Buffer::CopyData (uint8_t *buffer, uint32_t size) const
 {
   NS_LOG_FUNCTION (this << &buffer << size);
+  if (m_fragments != 0)
+    {
+      Buffer head = *this;
+      head.ReleaseFragments ();
+      uint32_t copied = head.CopyData (buffer, size);
+      for (std::vector<Buffer>::const_iterator i = m_fragments->m_buffers.begin ();
+           i != m_fragments->m_buffers.end () && copied < size; ++i)
+        {
+          copied += i->CopyData (buffer + copied, size - copied);
+        }
+      return copied;
+    }
   uint32_t originalSize = size;
   if (size > 0)
     {
@@ -1141,16 +1502,50 @@ Buffer::Iterator::CalculateIpChecksum (uint16_t size, uint32_t initialChecksum)
 {
   NS_LOG_FUNCTION (this << size << initialChecksum);
   /* see RFC 1071 to understand this code. */
-  uint32_t sum = initialChecksum;
-
-  for (int j = 0; j < size/2; j++)
-    sum += ReadU16 ();
-
-  if (size & 1)
-    sum += ReadU8 ();
+  NS_ASSERT_MSG (m_current + size <= m_dataEnd, GetReadErrorMessage ());
+  uint32_t start = m_current;
+  uint32_t end = m_current + size;
+  uint64_t sum = 0;
+  while (m_current < end)
+    {
+      // Sum the bytes before and after the zero area at once.  The sum of
+      // bytes starting at an odd offset is the byte-swapped sum of the words
+      // they would form at an even offset.
+      uint32_t stop;
+      uint16_t chunk = 0;
+      if (m_current < m_zeroStart)
+        {
+          stop = std::min (end, m_zeroStart);
+          chunk = SumWords (m_data + m_current, stop - m_current);
+        }
+      else if (m_current < m_zeroEnd)
+        {
+          stop = std::min (end, m_zeroEnd);
+        }
+      else
+        {
+          stop = end;
+          chunk = SumWords (m_data + m_current - (m_zeroEnd - m_zeroStart), stop - m_current);
+        }
+      sum += ((m_current - start) & 1) ? SwapBytes (chunk) : chunk;
+      m_current = stop;
+    }
+  while (sum >> 16)
+    {
+      sum = (sum & 0xffff) + (sum >> 16);
+    }
 
+  // The words are summed as ReadU16 reads them, the first byte being the
+  // least significant one.
+  if (!IsLittleEndian ())
+    {
+      sum = SwapBytes (sum);
+    }
+  sum += initialChecksum;
   while (sum >> 16)
-    sum = (sum & 0xffff) + (sum >> 16);
+    {
+      sum = (sum & 0xffff) + (sum >> 16);
+    }
   return ~sum;
 }
 
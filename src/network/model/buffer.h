@@ -24,6 +24,7 @@
 #include <vector>
 #include <ostream>
 #include "ns3/assert.h"
+#include "ns3/shared-value.h"
 
 #define BUFFER_FREE_LIST 1
 
@@ -59,6 +60,12 @@ namespace ns3 {
  * In every other case, the BufferData must be copied before
  * being modified.
  *
+ * With \c --enable-mt-packets, the reference count and the bounds of
+ * the dirty area are atomic, so that the Buffer instances sharing a
+ * BufferData can be used by different threads: a Buffer extends the
+ * dirty area with a compare-and-swap, and only writes the new bytes if
+ * it succeeded.
+ *
  * To understand the way the Buffer::Add and Buffer::Remove methods
  * work, you first need to understand the "virtual offsets" used to
  * keep track of the content of buffers. Each Buffer instance
@@ -88,6 +95,22 @@ namespace ns3 {
  * \endverbatim
  *
  * A simple state invariant is that m_start <= m_zeroStart <= m_zeroEnd <= m_end
+ *
+ * Appending a Buffer with AddAtEnd (Buffer const &) does not copy any
+ * byte: the appended Buffer instance is shared and recorded in a chain
+ * of fragments which logically follows the bytes described above.
+ * The chain is itself shared with the same copy-on-write technique.
+ * RemoveAtStart, RemoveAtEnd, CreateFragment and CopyData operate on
+ * the chain directly, so that concatenation and fragmentation cost
+ * O(number of fragments) regardless of the payload size. The chain is
+ * only merged back into a single BufferData instance ("materialized")
+ * when an Iterator is created (Begin, End), or by AddAtEnd (uint32_t)
+ * and PeekData.  GetSerializedSize, Serialize and CreateFullCopy
+ * read the chain without materializing it.  Materializing modifies a
+ * const Buffer, and is thus not thread-safe: with --enable-mt-packets,
+ * AddAtEnd (Buffer const &) materializes the chain at once, so that the
+ * packets shared by the threads of the multithreaded simulator never
+ * hold fragments.
  */
 class Buffer 
 {
@@ -566,6 +589,13 @@ private:
    */
   inline Buffer::Iterator End (void) const;
 
+  /**
+   * \return the number of pieces holding the bytes of this Buffer:
+   * 1 plus the number of fragments appended with AddAtEnd (Buffer const &)
+   * and not yet materialized.
+   */
+  uint32_t GetNFragments (void) const;
+
   /**
    * \brief Return the number of bytes required for serialization.
    * \return the number of bytes.
@@ -663,7 +693,7 @@ private:
      * The reference count of an instance of this data structure.
      * Each buffer which references an instance holds a count.
      */
-    uint32_t m_count;
+    SharedValue<uint32_t> m_count;
     /**
      * the size of the m_data field below.
      */
@@ -672,12 +702,12 @@ private:
      * offset from the start of the m_data field below to the
      * start of the area in which user bytes were written.
      */
-    uint32_t m_dirtyStart;
+    SharedValue<uint32_t> m_dirtyStart;
     /**
      * offset from the start of the m_data field below to the
      * end of the area in which user bytes were written.
      */
-    uint32_t m_dirtyEnd;
+    SharedValue<uint32_t> m_dirtyEnd;
     /**
      * The real data buffer holds _at least_ one byte.
      * Its real size is stored in the m_size field.
@@ -685,6 +715,51 @@ private:
     uint8_t m_data[1];
   };
 
+  struct FragmentList;
+
+  /**
+   * \brief Copy the m_data storage and offsets of another buffer,
+   * leaving the fragments untouched.
+   *
+   * \param o the buffer to copy
+   */
+  void AssignData (Buffer const &o);
+  /**
+   * \brief Drop the reference to the fragment list, if any.
+   */
+  void ReleaseFragments (void);
+  /**
+   * \brief Make sure the fragment list exists and is not shared
+   * with another Buffer.
+   */
+  void UnshareFragments (void);
+  /**
+   * \brief Append a buffer without fragments to the fragment list.
+   *
+   * \param o the buffer to append
+   */
+  void AppendFragment (Buffer const &o);
+  /**
+   * \brief Merge the fragments into a single, real BufferData.
+   */
+  void Materialize (void) const;
+  /**
+   * \brief Extend the dirty area of m_data before m_start,
+   * if no other Buffer has written there.
+   *
+   * \param start the number of bytes to claim
+   * \returns true if the bytes can be written by this Buffer
+   */
+  bool ClaimAtStart (uint32_t start);
+  /**
+   * \brief Extend the dirty area of m_data after m_end,
+   * if no other Buffer has written there.
+   *
+   * \param end the number of bytes to claim
+   * \returns true if the bytes can be written by this Buffer
+   */
+  bool ClaimAtEnd (uint32_t end);
+
   /**
    * \brief Create a full copy of the buffer, including
    * all the internal structures.
@@ -749,7 +824,18 @@ private:
    */
   static void Deallocate (struct Buffer::Data *data);
 
-  struct Data *m_data; //!< the buffer data storage
+  /*
+   * The storage and offsets below are mutable because the const
+   * accessors which need contiguous bytes (Begin, End and PeekData)
+   * materialize the fragment chain: they replace it with a single
+   * BufferData holding the same bytes, which changes how the Buffer
+   * stores its content, but not the content itself.  This is not
+   * thread-safe: with --enable-mt-packets, AddAtEnd (Buffer const &)
+   * materializes eagerly, so that the Buffers shared between threads
+   * never have fragments.
+   */
+  mutable struct Data *m_data; //!< the buffer data storage
+  mutable struct FragmentList *m_fragments; //!< the appended fragments, or 0
 
   /**
    * keep track of the maximum value of m_zeroAreaStart across
@@ -761,34 +847,35 @@ private:
    * the Buffer constructor to choose an initial value for 
    * m_zeroAreaStart.
    */
-  uint32_t m_maxZeroAreaStart;
+  mutable uint32_t m_maxZeroAreaStart;
   /**
    * location in a newly-allocated buffer where you should start
    * writing data. i.e., m_start should be initialized to this 
+   * value.  With \c --enable-mt-packets, each thread learns its own
    * value.
    */
-  static uint32_t g_recommendedStart;
+  static NS_MT_PACKETS_THREAD_LOCAL uint32_t g_recommendedStart;
 
   /**
    * offset to the start of the virtual zero area from the start
    * of m_data->m_data
    */
-  uint32_t m_zeroAreaStart;
+  mutable uint32_t m_zeroAreaStart;
   /**
    * offset to the end of the virtual zero area from the start
    * of m_data->m_data
    */
-  uint32_t m_zeroAreaEnd;
+  mutable uint32_t m_zeroAreaEnd;
   /**
    * offset to the start of the data referenced by this Buffer
    * instance from the start of m_data->m_data
    */
-  uint32_t m_start;
+  mutable uint32_t m_start;
   /**
    * offset to the end of the data referenced by this Buffer
    * instance from the start of m_data->m_data
    */
-  uint32_t m_end;
+  mutable uint32_t m_end;
 
 #ifdef BUFFER_FREE_LIST
   /// Container for buffer data
@@ -798,9 +885,9 @@ private:
   {
     ~LocalStaticDestructor ();
   };
-  static uint32_t g_maxSize; //!< Max observed data size
-  static FreeList *g_freeList; //!< Buffer data container
-  static struct LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
+  static NS_MT_PACKETS_THREAD_LOCAL uint32_t g_maxSize; //!< Max observed data size
+  static NS_MT_PACKETS_THREAD_LOCAL FreeList *g_freeList; //!< Buffer data container
+  static NS_MT_PACKETS_THREAD_LOCAL struct LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
 #endif
 };
 
@@ -811,6 +898,26 @@ private:
 
 namespace ns3 {
 
+/**
+ * The buffers appended after the bytes of m_data, shared
+ * between Buffer instances with a reference count.
+ */
+struct Buffer::FragmentList
+{
+  /**
+   * The reference count of an instance of this data structure.
+   */
+  SharedValue<uint32_t> m_count;
+  /**
+   * The total number of bytes in the fragments.
+   */
+  uint32_t m_size;
+  /**
+   * The fragments, none of which is empty or has fragments itself.
+   */
+  std::vector<Buffer> m_buffers;
+};
+
 Buffer::Iterator::Iterator ()
   : m_zeroStart (0),
     m_zeroEnd (0),
@@ -1049,6 +1156,7 @@ Buffer::Iterator::Read (Buffer::Iterator start, uint32_t size)
 
 Buffer::Buffer (Buffer const&o)
   : m_data (o.m_data),
+    m_fragments (o.m_fragments),
     m_maxZeroAreaStart (o.m_zeroAreaStart),
     m_zeroAreaStart (o.m_zeroAreaStart),
     m_zeroAreaEnd (o.m_zeroAreaEnd),
@@ -1056,12 +1164,20 @@ Buffer::Buffer (Buffer const&o)
     m_end (o.m_end)
 {
   m_data->m_count++;
+  if (m_fragments != 0)
+    {
+      m_fragments->m_count++;
+    }
   NS_ASSERT (CheckInternalState ());
 }
 
 uint32_t 
 Buffer::GetSize (void) const
 {
+  if (m_fragments != 0)
+    {
+      return m_end - m_start + m_fragments->m_size;
+    }
   return m_end - m_start;
 }
 
@@ -1069,12 +1185,20 @@ Buffer::Iterator
 Buffer::Begin (void) const
 {
   NS_ASSERT (CheckInternalState ());
+  if (m_fragments != 0)
+    {
+      Materialize ();
+    }
   return Buffer::Iterator (this);
 }
 Buffer::Iterator 
 Buffer::End (void) const
 {
   NS_ASSERT (CheckInternalState ());
+  if (m_fragments != 0)
+    {
+      Materialize ();
+    }
   return Buffer::Iterator (this, false);
 }
 
@@ -19,6 +19,7 @@
  */
 #include "byte-tag-list.h"
 #include "ns3/log.h"
+#include "ns3/shared-value.h"
 #include <vector>
 #include <cstring>
 #include <limits>
@@ -39,10 +40,10 @@ NS_LOG_COMPONENT_DEFINE ("ByteTagList");
  * This structure is only used by ByteTagList and should not be accessed directly.
  */
 struct ByteTagListData {
-  uint32_t size;   //!< size of the data
-  uint32_t count;  //!< use counter (for smart deallocation)
-  uint32_t dirty;  //!< number of bytes actually in use
-  uint8_t data[4]; //!< data
+  uint32_t size;                //!< size of the data
+  SharedValue<uint32_t> count;  //!< use counter (for smart deallocation)
+  SharedValue<uint32_t> dirty;  //!< number of bytes actually in use
+  uint8_t data[4];              //!< data
 };
 
 #ifdef USE_FREE_LIST
@@ -51,14 +52,22 @@ struct ByteTagListData {
  *
  * \brief Container class for struct ByteTagListData
  *
- * Internal use only.
+ * Internal use only.  With \c --enable-mt-packets, each thread has its
+ * own free list, so that packets can be created and destroyed
+ * concurrently, e.g., by the partitions of a multithreaded simulation.
  */
-static class ByteTagListDataFreeList : public std::vector<struct ByteTagListData *>
+static NS_MT_PACKETS_THREAD_LOCAL class ByteTagListDataFreeList : public std::vector<struct ByteTagListData *>
 {
 public:
   ~ByteTagListDataFreeList ();
 } g_freeList; //!< Container for struct ByteTagListData
-static uint32_t g_maxSize = 0; //!< maximum data size (used for allocation)
+static NS_MT_PACKETS_THREAD_LOCAL uint32_t g_maxSize = 0; //!< maximum data size (used for allocation)
+/**
+ * Has g_freeList been destroyed (at thread exit with
+ * \c --enable-mt-packets).  Packets released later, e.g., by static
+ * destructors, then bypass the free list.
+ */
+static NS_MT_PACKETS_THREAD_LOCAL bool g_freeListFinalized = false;
 
 ByteTagListDataFreeList::~ByteTagListDataFreeList ()
 {
@@ -69,6 +78,8 @@ ByteTagListDataFreeList::~ByteTagListDataFreeList ()
       uint8_t *buffer = (uint8_t *)(*i);
       delete [] buffer;
     }
+  clear ();
+  g_freeListFinalized = true;
 }
 #endif /* USE_FREE_LIST */
 
@@ -194,13 +205,15 @@ ByteTagList::Add (TypeId tid, uint32_t bufferSize, int32_t start, int32_t end)
   NS_LOG_FUNCTION (this << tid << bufferSize << start << end);
   uint32_t spaceNeeded = m_used + bufferSize + 4 + 4 + 4 + 4;
   NS_ASSERT (m_used <= spaceNeeded);
+  // Shared data can be used by other threads: the bytes after the
+  // dirty area are only free for the first list which claims them.
   if (m_data == 0)
     {
       m_data = Allocate (spaceNeeded);
       m_used = 0;
     } 
   else if (m_data->size < spaceNeeded ||
-           (m_data->count != 1 && m_data->dirty != m_used))
+           (m_data->count != 1 && !SharedValueClaim (m_data->dirty, m_used, spaceNeeded)))
     {
       struct ByteTagListData *newData = Allocate (spaceNeeded);
       std::memcpy (&newData->data, &m_data->data, m_used);
@@ -222,7 +235,10 @@ ByteTagList::Add (TypeId tid, uint32_t bufferSize, int32_t start, int32_t end)
       m_maxEnd = end - m_adjustment;
     }
   m_used = spaceNeeded;
-  m_data->dirty = m_used;
+  if (m_data->count == 1)
+    {
+      m_data->dirty = m_used;
+    }
   return tag;
 }
 
@@ -345,7 +361,7 @@ struct ByteTagListData *
 ByteTagList::Allocate (uint32_t size)
 {
   NS_LOG_FUNCTION (this << size);
-  while (!g_freeList.empty ())
+  while (!g_freeListFinalized && !g_freeList.empty ())
     {
       struct ByteTagListData *data = g_freeList.back ();
       g_freeList.pop_back ();
@@ -376,10 +392,10 @@ ByteTagList::Deallocate (struct ByteTagListData *data)
       return;
     }
   g_maxSize = std::max (g_maxSize, data->size);
-  data->count--;
-  if (data->count == 0)
+  if (--data->count == 0)
     {
-      if (g_freeList.size () > FREE_LIST_SIZE ||
+      if (g_freeListFinalized ||
+          g_freeList.size () > FREE_LIST_SIZE ||
           data->size < g_maxSize)
         {
           uint8_t *buffer = (uint8_t *)data;
@@ -414,8 +430,7 @@ ByteTagList::Deallocate (struct ByteTagListData *data)
     {
       return;
     }
-  data->count--;
-  if (data->count == 0)
+  if (--data->count == 0)
     {
       uint8_t *buffer = (uint8_t *)data;
       delete [] buffer;
@@ -359,6 +359,16 @@ public:
    */
   virtual bool SupportsSendFrom (void) const = 0;
 
+  /**
+   * \return true if this device transmits the packets tagged with a
+   *         SuperSegmentTag as the train of segments they stand for,
+   *         false otherwise.  The default implementation returns false.
+   *
+   * Called by the network layers to decide whether a super-segment can
+   * be handed down as is, or must be split into its segments first.
+   */
+  virtual bool SupportsSuperSegments (void) const;
+
 };
 
 } // namespace ns3
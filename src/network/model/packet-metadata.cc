@@ -33,10 +33,11 @@ NS_LOG_COMPONENT_DEFINE ("PacketMetadata");
 
 bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
-bool PacketMetadata::m_metadataSkipped = false;
-uint32_t PacketMetadata::m_maxSize = 0;
-uint16_t PacketMetadata::m_chunkUid = 0;
-PacketMetadata::DataFreeList PacketMetadata::m_freeList;
+SharedValue<bool> PacketMetadata::m_metadataSkipped (false);
+NS_MT_PACKETS_THREAD_LOCAL uint32_t PacketMetadata::m_maxSize = 0;
+SharedValue<uint16_t> PacketMetadata::m_chunkUid (0);
+NS_MT_PACKETS_THREAD_LOCAL PacketMetadata::DataFreeList PacketMetadata::m_freeList;
+NS_MT_PACKETS_THREAD_LOCAL bool PacketMetadata::m_freeListFinalized = false;
 
 PacketMetadata::DataFreeList::~DataFreeList ()
 {
@@ -45,7 +46,22 @@ PacketMetadata::DataFreeList::~DataFreeList ()
     {
       PacketMetadata::Deallocate (*i);
     }
-  PacketMetadata::m_enable = false;
+  clear ();
+  PacketMetadata::m_freeListFinalized = true;
+}
+
+void
+PacketMetadata::NoteMetadataSkipped (void)
+{
+#ifdef NS3_MT_PACKETS
+  // Only write the flag once, to keep its cache line shared between threads.
+  if (!m_metadataSkipped.load (std::memory_order_relaxed))
+    {
+      m_metadataSkipped.store (true, std::memory_order_relaxed);
+    }
+#else
+  m_metadataSkipped = true;
+#endif
 }
 
 void 
@@ -77,8 +93,7 @@ PacketMetadata::ReserveCopy (uint32_t size)
   struct PacketMetadata::Data *newData = PacketMetadata::Create (m_used + size);
   memcpy (newData->m_data, m_data->m_data, m_used);
   newData->m_dirtyEnd = m_used;
-  m_data->m_count--;
-  if (m_data->m_count == 0) 
+  if (--m_data->m_count == 0)
     {
       PacketMetadata::Recycle (m_data);
     }
@@ -95,15 +110,25 @@ PacketMetadata::ReserveCopy (uint32_t size)
       Append16 (0xffff, start);
     }
 }
+bool
+PacketMetadata::CanAppendInPlace (void) const
+{
+#ifdef NS3_MT_PACKETS
+  // shared data, possibly read by other threads, is never modified.
+  return m_data->m_count == 1;
+#else
+  return m_head == 0xffff ||
+         m_data->m_count == 1 ||
+         m_data->m_dirtyEnd == m_used;
+#endif
+}
 void
 PacketMetadata::Reserve (uint32_t size)
 {
   NS_LOG_FUNCTION (this << size);
   NS_ASSERT (m_data != 0);
   if (m_data->m_size >= m_used + size &&
-      (m_head == 0xffff ||
-       m_data->m_count == 1 ||
-       m_data->m_dirtyEnd == m_used))
+      CanAppendInPlace ())
     {
       /* enough room, not dirty. */
     }
@@ -380,9 +405,7 @@ PacketMetadata::AddSmall (const struct PacketMetadata::SmallItem *item)
   uint32_t sizeSize = GetUleb128Size (item->size);
   uint32_t n =  2 + 2 + typeUidSize + sizeSize + 2;
   if (m_used + n > m_data->m_size ||
-      (m_head != 0xffff &&
-       m_data->m_count != 1 &&
-       m_used != m_data->m_dirtyEnd))
+      !CanAppendInPlace ())
     {
       ReserveCopy (n);
     }
@@ -418,9 +441,7 @@ PacketMetadata::AddBig (uint32_t next, uint32_t prev,
   uint32_t n = 2 + 2 + typeUidSize + sizeSize + 2 + fragStartSize + fragEndSize + 4;
 
   if (m_used + n > m_data->m_size ||
-      (m_head != 0xffff &&
-       m_data->m_count != 1 &&
-       m_used != m_data->m_dirtyEnd))
+      !CanAppendInPlace ())
     {
       ReserveCopy (n);
     }
@@ -575,7 +596,7 @@ PacketMetadata::Create (uint32_t size)
     {
       m_maxSize = size;
     }
-  while (!m_freeList.empty ()) 
+  while (!m_freeListFinalized && !m_freeList.empty ()) 
     {
       struct PacketMetadata::Data *data = m_freeList.back ();
       m_freeList.pop_back ();
@@ -596,7 +617,7 @@ void
 PacketMetadata::Recycle (struct PacketMetadata::Data *data)
 {
   NS_LOG_FUNCTION (data);
-  if (!m_enable)
+  if (!m_enable || m_freeListFinalized)
     {
       PacketMetadata::Deallocate (data);
       return;
@@ -665,7 +686,7 @@ PacketMetadata::DoAddHeader (uint32_t uid, uint32_t size)
   NS_LOG_FUNCTION (this << uid << size);
   if (!m_enable)
     {
-      m_metadataSkipped = true;
+      NoteMetadataSkipped ();
       return;
     }
 
@@ -674,8 +695,7 @@ PacketMetadata::DoAddHeader (uint32_t uid, uint32_t size)
   item.prev = 0xffff;
   item.typeUid = uid;
   item.size = size;
-  item.chunkUid = m_chunkUid;
-  m_chunkUid++;
+  item.chunkUid = m_chunkUid++;
   uint16_t written = AddSmall (&item);
   UpdateHead (written);
 }
@@ -687,7 +707,7 @@ PacketMetadata::RemoveHeader (const Header &header, uint32_t size)
   NS_ASSERT (IsStateOk ());
   if (!m_enable) 
     {
-      m_metadataSkipped = true;
+      NoteMetadataSkipped ();
       return;
     }
   struct PacketMetadata::SmallItem item;
@@ -735,7 +755,7 @@ PacketMetadata::AddTrailer (const Trailer &trailer, uint32_t size)
   NS_ASSERT (IsStateOk ());
   if (!m_enable)
     {
-      m_metadataSkipped = true;
+      NoteMetadataSkipped ();
       return;
     }
   struct PacketMetadata::SmallItem item;
@@ -743,8 +763,7 @@ PacketMetadata::AddTrailer (const Trailer &trailer, uint32_t size)
   item.prev = m_tail;
   item.typeUid = uid;
   item.size = size;
-  item.chunkUid = m_chunkUid;
-  m_chunkUid++;
+  item.chunkUid = m_chunkUid++;
   uint16_t written = AddSmall (&item);
   UpdateTail (written);
   NS_ASSERT (IsStateOk ());
@@ -757,7 +776,7 @@ PacketMetadata::RemoveTrailer (const Trailer &trailer, uint32_t size)
   NS_ASSERT (IsStateOk ());
   if (!m_enable) 
     {
-      m_metadataSkipped = true;
+      NoteMetadataSkipped ();
       return;
     }
   struct PacketMetadata::SmallItem item;
@@ -804,7 +823,7 @@ PacketMetadata::AddAtEnd (PacketMetadata const&o)
   NS_ASSERT (IsStateOk ());
   if (!m_enable) 
     {
-      m_metadataSkipped = true;
+      NoteMetadataSkipped ();
       return;
     }
   if (m_tail == 0xffff)
@@ -881,7 +900,7 @@ PacketMetadata::AddPaddingAtEnd (uint32_t end)
   NS_LOG_FUNCTION (this << end);
   if (!m_enable)
     {
-      m_metadataSkipped = true;
+      NoteMetadataSkipped ();
       return;
     }
 }
@@ -892,7 +911,7 @@ PacketMetadata::RemoveAtStart (uint32_t start)
   NS_ASSERT (IsStateOk ());
   if (!m_enable) 
     {
-      m_metadataSkipped = true;
+      NoteMetadataSkipped ();
       return;
     }
   NS_ASSERT (m_data != 0);
@@ -955,7 +974,7 @@ PacketMetadata::RemoveAtEnd (uint32_t end)
   NS_ASSERT (IsStateOk ());
   if (!m_enable) 
     {
-      m_metadataSkipped = true;
+      NoteMetadataSkipped ();
       return;
     }
   NS_ASSERT (m_data != 0);
@@ -24,6 +24,7 @@
 #include <vector>
 #include <limits>
 #include "ns3/callback.h"
+#include "ns3/shared-value.h"
 #include "ns3/assert.h"
 #include "ns3/type-id.h"
 #include "buffer.h"
@@ -413,7 +414,7 @@ private:
    */
   struct Data {
     /** number of references to this struct Data instance. */
-    uint32_t m_count;
+    SharedValue<uint32_t> m_count;
     /** size (in bytes) of m_data buffer below */
     uint16_t m_size;
     /** max of the m_used field over all objects which
@@ -496,6 +497,10 @@ private:
 
   /**
    * \brief Class to hold all the metadata
+   *
+   * With \c --enable-mt-packets, each thread has its own free list, so
+   * that packets can be created and destroyed concurrently, e.g., by the
+   * partitions of a multithreaded simulation.
    */
   class DataFreeList : public std::vector<struct Data *>
   {
@@ -597,6 +602,16 @@ public:
    * \param n space to reserve
    */
   void ReserveCopy (uint32_t n);
+  /**
+   * \brief Check if items can be appended to m_data without a copy
+   *
+   * With \c --enable-mt-packets, shared data, which other threads may
+   * read, is never modified.  Otherwise, shared data can be extended
+   * by the copy whose end is the end of the dirty area.
+   *
+   * \returns true if m_data can be modified in place
+   */
+  inline bool CanAppendInPlace (void) const;
 
   /**
    * \brief Get the total size used by the metadata
@@ -661,7 +676,13 @@ public:
    */
   static void Deallocate (struct PacketMetadata::Data *data);
 
-  static DataFreeList m_freeList; //!< the metadata data storage
+  static NS_MT_PACKETS_THREAD_LOCAL DataFreeList m_freeList; //!< the metadata data storage
+  /**
+   * Has m_freeList been destroyed (at thread exit with
+   * \c --enable-mt-packets).  Metadata released later, e.g., by static
+   * destructors, then bypasses the free list.
+   */
+  static NS_MT_PACKETS_THREAD_LOCAL bool m_freeListFinalized;
   static bool m_enable; //!< Enable the packet metadata
   static bool m_enableChecking; //!< Enable the packet metadata checking
 
@@ -670,10 +691,14 @@ public:
    * m_enable is false; used to detect enabling of metadata in the
    * middle of a simulation, which isn't allowed.
    */
-  static bool m_metadataSkipped;
+  static SharedValue<bool> m_metadataSkipped;
+  /**
+   * Set m_metadataSkipped.
+   */
+  static void NoteMetadataSkipped (void);
 
-  static uint32_t m_maxSize; //!< maximum metadata size
-  static uint16_t m_chunkUid; //!< Chunk Uid
+  static NS_MT_PACKETS_THREAD_LOCAL uint32_t m_maxSize; //!< maximum metadata size
+  static SharedValue<uint16_t> m_chunkUid; //!< Chunk Uid
 
   struct Data *m_data; //!< Metadata storage
   /*
@@ -722,8 +747,7 @@ PacketMetadata::operator = (PacketMetadata const& o)
     {
       // not self assignment
       NS_ASSERT (m_data != 0);
-      m_data->m_count--;
-      if (m_data->m_count == 0) 
+      if (--m_data->m_count == 0)
         {
           PacketMetadata::Recycle (m_data);
         }
@@ -740,8 +764,7 @@ PacketMetadata::operator = (PacketMetadata const& o)
 PacketMetadata::~PacketMetadata ()
 {
   NS_ASSERT (m_data != 0);
-  m_data->m_count--;
-  if (m_data->m_count == 0) 
+  if (--m_data->m_count == 0)
     {
       PacketMetadata::Recycle (m_data);
     }
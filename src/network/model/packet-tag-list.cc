@@ -20,7 +20,7 @@
 
 /**
 \file   packet-tag-list.cc
-\brief  Implements a linked list of Packet tags, including copy-on-write semantics.
+\brief  Implements a flat array of Packet tags, including copy-on-write semantics.
 */
 
 #include "packet-tag-list.h"
@@ -28,276 +28,366 @@
 #include "tag.h"
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
+#include "ns3/unused.h"
+#include <atomic>
+#include <bitset>
 #include <cstring>
+#include <mutex>
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("PacketTagList");
 
-PacketTagList::TagData *
-PacketTagList::CreateTagData (size_t dataSize)
+/**
+ * \ingroup packet
+ * Unnamed namespace for the PacketTagList slots and free lists.
+ */
+namespace {
+
+/** Maximum number of released TagBlocks kept by each thread. */
+const uint32_t PACKET_TAG_FREE_LIST_SIZE = 1000;
+/** Number of tags a new TagBlock has room for. */
+const uint32_t PACKET_TAG_INITIAL_TAGS = 8;
+/** Number of serialized bytes a new TagBlock has room for. */
+const uint32_t PACKET_TAG_INITIAL_BYTES = 128;
+
+/**
+ * Slot of each tag type, indexed by TypeId uid:
+ * zero if not assigned yet, the slot plus one otherwise.
+ */
+std::atomic<uint8_t> g_slots[1 << 16];
+/** Next slot to assign. */
+uint32_t g_nextSlot = 0;
+/** Protects the slot assignment. */
+std::mutex g_slotMutex;
+
+/**
+ * Count the bits set in a slot mask.
+ * \param [in] mask The mask.
+ * \returns The number of bits set.
+ */
+inline uint32_t
+CountSlots (uint64_t mask)
 {
-  NS_ASSERT_MSG (dataSize
-                 < std::numeric_limits<decltype(TagData::size)>::max (),
-                 "Requested TagData size " << dataSize
-                 << " exceeds maximum "
-                 << std::numeric_limits<decltype(TagData::size)>::max () );
-
-  void * p = std::malloc (sizeof (TagData) + dataSize - 1);
-  // The matching frees are in RemoveAll and RemoveWriter
-
-  TagData * tag = new (p) TagData;
-  tag->size = dataSize;
-  return tag;
+  return std::bitset<PacketTagList::PACKET_TAG_SLOTS> (mask).count ();
 }
 
-bool
-PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
-{
-  TypeId tid = tag.GetInstanceTypeId ();
-  NS_LOG_FUNCTION (this << tid);
-  NS_LOG_INFO     ("looking for " << tid);
+}  // unnamed namespace
+
+NS_MT_PACKETS_THREAD_LOCAL PacketTagList::FreeList PacketTagList::m_freeList;
+NS_MT_PACKETS_THREAD_LOCAL PacketTagList::FreeListGuard PacketTagList::m_freeListGuard;
 
-  // trivial case when list is empty
-  if (m_next == 0)
+PacketTagList::FreeListGuard::~FreeListGuard ()
+{
+  TagBlock *block = m_freeList.head;
+  while (block != 0)
     {
-      return false;
+      TagBlock *next = block->next;
+      delete block;
+      block = next;
     }
+  m_freeList.head = 0;
+  m_freeList.size = 0;
+  m_freeList.finalized = true;
+}
 
-  bool found = false;
-
-  struct TagData ** prevNext = &m_next; // previous node's next pointer
-  struct TagData  * cur      =  m_next; // cursor to current node
-  struct TagData  * it = 0;             // utility
-
-  // Search from the head of the list until we find tid or a merge
-  while (cur != 0)
+uint32_t
+PacketTagList::GetSlot (TypeId tid)
+{
+  uint16_t uid = tid.GetUid ();
+  uint8_t slot = g_slots[uid].load (std::memory_order_acquire);
+  if (slot != 0)
     {
-      if (cur->count > 1)
-        {
-          // found merge
-          NS_LOG_INFO ("found initial merge before tid");
-          break;
-        }
-      else if (cur->tid == tid)
-        {
-          NS_LOG_INFO ("found tid before initial merge, calling writer");
-          found = (this->*Writer)(tag, true, cur, prevNext);
-          break;
-        }
-      else
+      return slot - 1;
+    }
+  std::lock_guard<std::mutex> lock (g_slotMutex);
+  slot = g_slots[uid].load (std::memory_order_relaxed);
+  if (slot == 0)
+    {
+      slot = g_nextSlot + 1;
+      if (g_nextSlot < PACKET_TAG_SLOTS)
         {
-          // no merge or tid found yet, move on
-          prevNext = &cur->next;
-          cur      =  cur->next;
+          NS_LOG_LOGIC ("tag " << tid << " gets slot " << g_nextSlot);
+          g_nextSlot++;
         }
-    }  // while !found && !cow
+      g_slots[uid].store (slot, std::memory_order_release);
+    }
+  return slot - 1;
+}
 
-  // did we find it or run out of tags?
-  if (cur == 0 || found)
+PacketTagList::TagBlock *
+PacketTagList::AllocateBlock (void)
+{
+  TagBlock *block = m_freeList.head;
+  if (block != 0)
     {
-      NS_LOG_INFO ("returning after header with found: " << found);
-      return found;
+      m_freeList.head = block->next;
+      m_freeList.size--;
+      block->tags.clear ();
+      block->bytes.clear ();
     }
+  else
+    {
+      block = new TagBlock;
+      block->tags.reserve (PACKET_TAG_INITIAL_TAGS);
+      block->bytes.reserve (PACKET_TAG_INITIAL_BYTES);
+    }
+  block->count = 1;
+  block->mask = 0;
+  block->garbage = 0;
+  block->next = 0;
+  return block;
+}
 
-  // From here on out, we have to copy the list
-  // until we find tid, then link past it
+void
+PacketTagList::ReleaseBlock (TagBlock *block)
+{
+  if (--block->count > 0)
+    {
+      return;
+    }
+  if (m_freeList.finalized || m_freeList.size >= PACKET_TAG_FREE_LIST_SIZE)
+    {
+      delete block;
+      return;
+    }
+  if (!m_freeList.registered)
+    {
+      // Odr-use the guard so that its destructor runs at thread exit.
+      FreeListGuard *guard = &m_freeListGuard;
+      NS_UNUSED (guard);
+      m_freeList.registered = true;
+    }
+  block->next = m_freeList.head;
+  m_freeList.head = block;
+  m_freeList.size++;
+}
 
-  // Before we do all that work, let's make sure tid really exists
-  for (it = cur; it != 0; it = it->next)
+uint32_t
+PacketTagList::AllocateBytes (TagBlock *block, uint32_t size)
+{
+  NS_ASSERT (block->count == 1);
+  std::vector<uint8_t> &bytes = block->bytes;
+  if (block->garbage > 0 && bytes.size () + size > bytes.capacity ())
     {
-      if (it->tid == tid)
+      // Compact the byte area in place rather than growing it, moving
+      // the tags down in order of increasing address.
+      NS_LOG_LOGIC ("compacting " << block->garbage << " bytes");
+      uint8_t *base = bytes.data ();
+      uint32_t used = 0;
+      uint8_t *last = 0;
+      for (uint32_t n = 0; n < block->tags.size (); ++n)
         {
-          break;
+          TagData *lowest = 0;
+          for (std::vector<TagData>::iterator i = block->tags.begin ();
+               i != block->tags.end (); ++i)
+            {
+              if (i->size > 0 && (last == 0 || i->data > last)
+                  && (lowest == 0 || i->data < lowest->data))
+                {
+                  lowest = &*i;
+                }
+            }
+          if (lowest == 0)
+            {
+              break;
+            }
+          last = lowest->data;
+          std::memmove (base + used, lowest->data, lowest->size);
+          lowest->data = base + used;
+          used += lowest->size;
         }
+      bytes.resize (used);
+      block->garbage = 0;
     }
-  if (it == 0)
+  uint32_t offset = bytes.size ();
+  uint8_t *old = bytes.data ();
+  bytes.resize (offset + size);
+  if (bytes.data () != old)
     {
-      // got to end of list without finding tid
-      NS_LOG_INFO ("tid not found after first merge");
-      return found;
+      for (std::vector<TagData>::iterator i = block->tags.begin ();
+           i != block->tags.end (); ++i)
+        {
+          i->data = bytes.data () + (i->data - old);
+        }
     }
+  return offset;
+}
 
-  // At this point cur is a merge, but untested for tid
-  NS_ASSERT (cur != 0);
-  NS_ASSERT (cur->count > 1);
-
-  /*
-     Walk the remainder of the list, copying, until we find tid
-     As we put a copy of the cur node onto our list,
-     we move the merge point down the list.
-
-     Starting position                  End position
-       T1 is a merge                     T1.count decremented
-                                         T2 is a merge
-                                         T1' is a copy of T1
-
-          other                             other
-               \                                 \
-      Prev  ->  T1  ->  T2  -> ...                T1  ->  T2  -> ...
-           /   /                                         /|
-      pNext cur                         Prev  ->  T1' --/ |
-                                                     /    |
-                                                pNext   cur
-
-     When we reach tid, we link past it, decrement count, and we're done.
-  */
-
-  // Should normally check for null cur pointer,
-  // but since we know tid exists, we'll skip this test
-  while ( /* cur && */ cur->tid != tid)
+void
+PacketTagList::Insert (TagBlock *block, TagData const &data)
+{
+  std::vector<TagData>::iterator position = block->tags.end ();
+  if (data.slot < PACKET_TAG_SLOTS)
     {
-      NS_ASSERT (cur != 0);
-      NS_ASSERT (cur->count > 1);
-      cur->count--;                       // unmerge cur
-      struct TagData * copy = CreateTagData (cur->size);
-      copy->tid = cur->tid;
-      copy->count = 1;
-      copy->size = cur->size;
-      memcpy (copy->data, cur->data, copy->size);
-      copy->next = cur->next;             // merge into tail
-      copy->next->count++;                // mark new merge
-      *prevNext = copy;                   // point prior list at copy
-      prevNext = &copy->next;             // advance
-      cur      =  copy->next;
+      uint64_t bit = static_cast<uint64_t> (1) << data.slot;
+      position = block->tags.begin () + CountSlots (block->mask & (bit - 1));
+      block->mask |= bit;
     }
-  // Sanity check:
-  NS_ASSERT (cur != 0);                 // cur should be non-zero
-  NS_ASSERT (cur->tid == tid);          // cur->tid should be tid
-  NS_ASSERT (cur->count > 1);           // cur should be a merge
-
-  // link around tid, removing it from our list
-  found = (this->*Writer)(tag, false, cur, prevNext);
-  return found;
-
+  block->tags.insert (position, data);
 }
 
-bool
-PacketTagList::Remove (Tag & tag)
+int32_t
+PacketTagList::Find (TypeId tid, uint32_t slot) const
 {
-  return COWTraverse (tag, &PacketTagList::RemoveWriter);
+  if (m_block == 0)
+    {
+      return -1;
+    }
+  if (slot < PACKET_TAG_SLOTS)
+    {
+      uint64_t bit = static_cast<uint64_t> (1) << slot;
+      if ((m_block->mask & bit) == 0)
+        {
+          return -1;
+        }
+      return CountSlots (m_block->mask & (bit - 1));
+    }
+  for (uint32_t i = CountSlots (m_block->mask); i < m_block->tags.size (); ++i)
+    {
+      if (m_block->tags[i].tid == tid)
+        {
+          return i;
+        }
+    }
+  return -1;
 }
 
-// COWWriter implementing Remove
-bool
-PacketTagList::RemoveWriter (Tag & tag, bool preMerge,
-                             struct PacketTagList::TagData  * cur,
-                             struct PacketTagList::TagData ** prevNext)
+void
+PacketTagList::MakeUnique (void)
 {
-  NS_LOG_FUNCTION_NOARGS ();
-
-  // found tid
-  bool found = true;
-  tag.Deserialize (TagBuffer (cur->data, cur->data + cur->size));
-  *prevNext = cur->next;            // link around cur
-
-  if (preMerge)
+  if (m_block == 0)
     {
-      // found tid before first merge, so delete cur
-      cur->~TagData ();
-      std::free (cur);
+      m_block = AllocateBlock ();
+      return;
     }
-  else
+  if (m_block->count == 1)
     {
-      // cur is always a merge at this point
-      // unmerge cur, since we linked around it already
-      cur->count--;
-      if (cur->next != 0)
-        {
-          // there's a next, so make it a merge
-          cur->next->count++;
-        }
+      return;
+    }
+  NS_LOG_LOGIC ("copying " << m_block->tags.size () << " shared tags");
+  TagBlock *copy = AllocateBlock ();
+  copy->mask = m_block->mask;
+  copy->tags = m_block->tags;
+  uint32_t size = m_block->bytes.size () - m_block->garbage;
+  copy->bytes.resize (size);
+  uint32_t offset = 0;
+  for (std::vector<TagData>::iterator i = copy->tags.begin ();
+       i != copy->tags.end (); ++i)
+    {
+      std::memcpy (copy->bytes.data () + offset, i->data, i->size);
+      i->data = copy->bytes.data () + offset;
+      offset += i->size;
     }
-  return found;
+  NS_ASSERT (offset == size);
+  ReleaseBlock (m_block);
+  m_block = copy;
 }
 
 bool
-PacketTagList::Replace (Tag & tag)
+PacketTagList::Remove (Tag & tag)
 {
-  bool found = COWTraverse (tag, &PacketTagList::ReplaceWriter);
-  if (!found)
+  TypeId tid = tag.GetInstanceTypeId ();
+  NS_LOG_FUNCTION (this << tid);
+  int32_t index = Find (tid, GetSlot (tid));
+  if (index < 0)
     {
-      Add (tag);
+      return false;
     }
-  return found;
+  TagData *cur = &m_block->tags[index];
+  tag.Deserialize (TagBuffer (cur->data, cur->data + cur->size));
+  if (m_block->tags.size () == 1)
+    {
+      RemoveAll ();
+      return true;
+    }
+  MakeUnique ();
+  cur = &m_block->tags[index];
+  if (cur->slot < PACKET_TAG_SLOTS)
+    {
+      m_block->mask &= ~(static_cast<uint64_t> (1) << cur->slot);
+    }
+  m_block->garbage += cur->size;
+  m_block->tags.erase (m_block->tags.begin () + index);
+  return true;
 }
 
-// COWWriter implementing Replace
 bool
-PacketTagList::ReplaceWriter (Tag & tag, bool preMerge,
-                              struct PacketTagList::TagData  * cur,
-                              struct PacketTagList::TagData ** prevNext)
+PacketTagList::Replace (Tag & tag)
 {
-  NS_LOG_FUNCTION_NOARGS ();
-
-  // found tid
-  bool found = true;
-  if (preMerge)
+  TypeId tid = tag.GetInstanceTypeId ();
+  NS_LOG_FUNCTION (this << tid);
+  int32_t index = Find (tid, GetSlot (tid));
+  if (index < 0)
     {
-      // found tid before first merge, so just rewrite
-      tag.Serialize (TagBuffer (cur->data, cur->data + cur->size));
+      Add (tag);
+      return false;
     }
-  else
+  MakeUnique ();
+  uint32_t size = tag.GetSerializedSize ();
+  if (m_block->tags[index].size != size)
     {
-      // cur is always a merge at this point
-      // need to copy, replace, and link past cur
-      cur->count--;                     // unmerge cur
-      struct TagData * copy = CreateTagData (tag.GetSerializedSize ());
-      copy->tid = tag.GetInstanceTypeId ();
-      copy->count = 1;
-      tag.Serialize (TagBuffer (copy->data, copy->data + copy->size));
-      copy->next = cur->next;           // merge into tail
-      if (copy->next != 0)
-        {
-          copy->next->count++;          // mark new merge
-        }
-      *prevNext = copy;                 // point prior list at copy
+      uint32_t offset = AllocateBytes (m_block, size);
+      TagData *cur = &m_block->tags[index];
+      m_block->garbage += cur->size;
+      cur->data = m_block->bytes.data () + offset;
+      cur->size = size;
     }
-  return found;
+  TagData *cur = &m_block->tags[index];
+  tag.Serialize (TagBuffer (cur->data, cur->data + cur->size));
+  return true;
 }
 
 void
 PacketTagList::Add (const Tag &tag) const
 {
-  NS_LOG_FUNCTION (this << tag.GetInstanceTypeId ());
-  // ensure this id was not yet added
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next)
-    {
-      NS_ASSERT_MSG (cur->tid != tag.GetInstanceTypeId (),
-                     "Error: cannot add the same kind of tag twice.");
-    }
-  struct TagData * head = CreateTagData (tag.GetSerializedSize ());
-  head->count = 1;
-  head->next = 0;
-  head->tid = tag.GetInstanceTypeId ();
-  head->next = m_next;
-  tag.Serialize (TagBuffer (head->data, head->data + head->size));
-
-  const_cast<PacketTagList *> (this)->m_next = head;
+  TypeId tid = tag.GetInstanceTypeId ();
+  NS_LOG_FUNCTION (this << tid);
+  uint32_t slot = GetSlot (tid);
+  NS_ASSERT_MSG (Find (tid, slot) < 0,
+                 "Error: cannot add the same kind of tag twice.");
+
+  PacketTagList *self = const_cast<PacketTagList *> (this);
+  self->MakeUnique ();
+  TagBlock *block = self->m_block;
+  uint32_t size = tag.GetSerializedSize ();
+  uint32_t offset = AllocateBytes (block, size);
+
+  TagData data;
+  data.tid = tid;
+  data.slot = slot;
+  data.size = size;
+  data.data = block->bytes.data () + offset;
+  tag.Serialize (TagBuffer (data.data, data.data + data.size));
+  Insert (block, data);
 }
 
 bool
 PacketTagList::Peek (Tag &tag) const
 {
-  NS_LOG_FUNCTION (this << tag.GetInstanceTypeId ());
   TypeId tid = tag.GetInstanceTypeId ();
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next)
+  NS_LOG_FUNCTION (this << tid);
+  int32_t index = Find (tid, GetSlot (tid));
+  if (index < 0)
     {
-      if (cur->tid == tid)
-        {
-          /* found tag */
-          tag.Deserialize (TagBuffer (cur->data, cur->data + cur->size));
-          return true;
-        }
+      /* no tag found */
+      return false;
     }
-  /* no tag found */
-  return false;
+  const TagData *cur = &m_block->tags[index];
+  tag.Deserialize (TagBuffer (cur->data, cur->data + cur->size));
+  return true;
 }
 
 const struct PacketTagList::TagData *
-PacketTagList::Head (void) const
+PacketTagList::Begin (void) const
 {
-  return m_next;
+  return m_block == 0 ? 0 : m_block->tags.data ();
+}
+
+const struct PacketTagList::TagData *
+PacketTagList::End (void) const
+{
+  return m_block == 0 ? 0 : m_block->tags.data () + m_block->tags.size ();
 }
 
 uint32_t
@@ -309,7 +399,7 @@ PacketTagList::GetSerializedSize (void) const
 
   size = 4; // numberOfTags
 
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next)
+  for (const TagData *cur = Begin (); cur != End (); ++cur)
     {
       size += 4; // TagData -> size
 
@@ -346,7 +436,7 @@ PacketTagList::Serialize (uint32_t* buffer, uint32_t maxSize) const
       return 0;
     }
 
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next)
+  for (const TagData *cur = Begin (); cur != End (); ++cur)
     {
       if (size + 4 <= maxSize)
         {
@@ -407,7 +497,11 @@ PacketTagList::Deserialize (const uint32_t* buffer, uint32_t size)
 
   NS_LOG_INFO("Deserializing number of tags " << numberOfTags);
 
-  struct TagData * prevTag = 0;
+  RemoveAll ();
+  if (numberOfTags > 0)
+    {
+      m_block = AllocateBlock ();
+    }
   for (uint32_t i = 0; i < numberOfTags; ++i)
     {
       NS_ASSERT (sizeCheck >= 4);
@@ -425,30 +519,19 @@ PacketTagList::Deserialize (const uint32_t* buffer, uint32_t size)
 
       NS_LOG_INFO ("Deserializing tag of type " << tid);
 
-      struct TagData * newTag = CreateTagData (tagSize);
-      newTag->count = 1;
-      newTag->next = 0;
-      newTag->tid = tid;
-
       NS_ASSERT (sizeCheck >= tagSize);
-      memcpy (newTag->data, p, tagSize);
+      TagData data;
+      data.tid = tid;
+      data.slot = GetSlot (tid);
+      data.size = tagSize;
+      data.data = m_block->bytes.data () + AllocateBytes (m_block, tagSize);
+      memcpy (data.data, p, tagSize);
 
       // ensure 4 byte boundary
       uint32_t tagWordSize = (tagSize+3) & (~3);
       p += tagWordSize / 4;
       sizeCheck -= tagWordSize;
-
-      // Set link list pointers.
-      if (i==0)
-        {
-          m_next = newTag;
-        }
-      else
-        {
-          prevTag->next = newTag;
-        }
-
-      prevTag = newTag;
+      Insert (m_block, data);
     }
 
   NS_ASSERT (sizeCheck == 0);
@@ -460,4 +543,3 @@ PacketTagList::Deserialize (const uint32_t* buffer, uint32_t size)
 
 
 } /* namespace ns3 */
-
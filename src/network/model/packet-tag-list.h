@@ -22,12 +22,14 @@
 
 /**
 \file   packet-tag-list.h
-\brief  Defines a linked list of Packet tags, including copy-on-write semantics.
+\brief  Defines a flat array of Packet tags, including copy-on-write semantics.
 */
 
 #include <stdint.h>
 #include <ostream>
+#include <vector>
 #include "ns3/type-id.h"
+#include "ns3/shared-value.h"
 
 namespace ns3 {
 
@@ -43,110 +45,60 @@ class Tag;
  *
  * \internal
  *
- * The implementation of this class is a bit tricky.  Refer to this
- * diagram in the discussion that follows.
+ * The tags are stored in serialized form in a reference-counted
+ * TagBlock, which holds a flat array of TagData entries and a single
+ * byte area for the serialized tags.
  *
- * \dot
- *    digraph {
- *        rankdir = "LR";
- *        clusterrank = local;
- *        node [ shape = record, fontname="FreeSans", fontsize="10" ];
- *        oth  [ label="<l> Other branch | <n> next | <c> ..." ];
- *        PTL1 [ label="<l> PacketTagList A | <n> m_next" , shape=Mrecord];
- *        PTL2 [ label="<l> PacketTagList B | <n> m_next" , shape=Mrecord];
- *        oth:n  -> T7:l ;
- *        PTL2:n -> T6:l ;
- *        PTL1:n -> T5:l ;
- *        T1   [ label="<l> T1  | <n> next | <c> count = 1" ];
- *        T2   [ label="<l> T2  | <n> next | <c> count = 1" ];
- *        T3   [ label="<l> T3  | <n> next | <c> count = 2" ];
- *        T4   [ label="<l> T4  | <n> next | <c> count = 1" ];
- *        T5   [ label="<l> T5  | <n> next | <c> count = 2" ];
- *        T6   [ label="<l> T6  | <n> next | <c> count = 1" ];
- *        T7   [ label="<l> T7  | <n> next | <c> count = 1" ];
- *        NULL [ label="0", shape = ellipse ];
- *        subgraph cluster_list {
- *          penwidth = 0;
- *          T6:n -> T5:l ;
- *          T5:n -> T4:l ;
- *          T4:n -> T3:l ;
- *          T7:n -> T3:l ;
- *          T3:n -> T2:l ;
- *          T2:n -> T1:l ;
- *          T1:n -> NULL ;
- *        };
- *      }
- * \enddot
+ *   - Each tag TypeId is given a compact slot index the first time a
+ *     tag of this type is added to any packet.  The first
+ *     #PACKET_TAG_SLOTS tag types get a slot each; the slot of any
+ *     further tag type is #PACKET_TAG_SLOTS.
  *
- *   - Tags are stored in serialized form in a tree of TagData
- *     structures. (<tt>T1-T7</tt> in the diagram)
+ *   - The entries of a TagBlock are sorted by slot, and the block keeps
+ *     a bitmask of the slots it contains.  The index of the entry of a
+ *     slot is then the number of bits set below it in the mask, so that
+ *     #Peek, #Remove and #Replace find a tag, or find that it is
+ *     missing, in constant time.  The tags without a slot of their own
+ *     are stored after all the others, and are searched linearly.
  *
- *   - Each TagData points (\c next pointers in the diagram)
- *     toward the root of the tree, which is a null pointer.
- *
- *   - \c count is the number of incoming pointers to this
- *     TagData.  Branch points, where branches merge or join, have
- *     <tt>count \> 1</tt> (\c T3, \c T5); successive links along
- *     a branch have <tt>count = 1</tt> (\c T1, \c T2, \c T4, \c T6, \c T7).
- *
- *   - Each PacketTagList points to a specific TagData,
- *     which is the most recent Tag added to the packet. (<tt>T5-T7</tt>)
- *
- *   - Conceptually, therefore, each Packet has a PacketTagList which
- *     points to a singly-linked list of TagData.
+ *   - Released TagBlocks are kept, with their arrays, on a per-thread
+ *     free list, so that in steady state adding tags to packets does not
+ *     allocate memory.
  *
  * \par <b> Copy-on-write </b> is implemented as follows:
  *
- *   - #Add prepends the new tag to the list (growing that branch of the tree,
- *     as \c T6). This is a constant time operation, and does not affect
- *     any other #PacketTagList's, hence this is a \c const function.
- *
  *   - Copy constructor (PacketTagList(const PacketTagList & o))
  *     and assignment (#operator=(const PacketTagList & o))
- *     simply join the tree at the same place as the original
- *     PacketTagList \c o, incrementing the \c count.
- *     For assignment, the old branch is deleted, up to
- *     the first branch point, which has its \c count decremented.
- *     (PacketTagList \c B started as a copy of PacketTagList \c A,
- *     before \c T6 was added to \c B).
+ *     simply share the TagBlock of the original PacketTagList \c o,
+ *     incrementing its \c count.
  *
- *   - #Remove and #Replace are a little tricky, depending on where the
- *     target tag is found relative to the first branch point:
- *     - \e Target before <em> the first branch point: </em> \n
- *       The target is just dealt with in place (linked around and deleted,
- *       in the case of #Remove; rewritten in the case of #Replace).
- *     - \e Target at or after <em> the first branch point: </em> \n
- *       The portion of the list between the first branch and the target is
- *       shared. This portion is copied before the #Remove or #Replace is
- *       performed.
+ *   - #Add, #Remove and #Replace first copy the TagBlock if it is
+ *     shared with another PacketTagList, then modify it in place.
+ *     #Remove of a missing tag never copies the TagBlock.
  */
 class PacketTagList 
 {
 public:
   /**
-   * Tree node for sharing serialized tags.
-   *
-   * See PacketTagList for a discussion of the data structure.
+   * A serialized tag.
    *
    * \internal
    * Unfortunately this has to be public, because
    * PacketTagIterator::Item::GetTag() needs the data and size values.
    * The Item nested class can't be forward declared, so friending isn't
    * possible.
-   *
-   * We use placement new so we can allocate enough room for the Tag
-   * type which will be serialized into data.  See Object::Aggregates
-   * for a similar construction.
    */
   struct TagData
   {
-    struct TagData * next;      /**< Pointer to next in list */
-    uint32_t count;             /**< Number of incoming links */
     TypeId tid;                 /**< Type of the tag serialized into #data */
+    uint32_t slot;              /**< Slot index of #tid */
     uint32_t size;              /**< Size of the \c data buffer */
-    uint8_t data[1];            /**< Serialization buffer */
+    uint8_t *data;              /**< Serialization buffer */
   };  /* struct TagData */
 
+  /** Number of tag types which get a slot of their own. */
+  static const uint32_t PACKET_TAG_SLOTS = 64;
+
   /**
    * Create a new PacketTagList.
    */
@@ -156,8 +108,7 @@ public:
    *
    * \param [in] o The PacketTagList to copy.
    *
-   * This makes a light-weight copy by #RemoveAll, then
-   * pointing to the same \ref TagData as \pname{o}.
+   * This makes a light-weight copy, sharing the TagBlock of \pname{o}.
    */
   inline PacketTagList (PacketTagList const &o);
   /**
@@ -167,18 +118,18 @@ public:
    * \returns the copied object
    *
    * This makes a light-weight copy by #RemoveAll, then
-   * pointing to the same \ref TagData as \pname{o}.
+   * sharing the TagBlock of \pname{o}.
    */
   inline PacketTagList &operator = (PacketTagList const &o);
   /**
    * Destructor
    *
-   * #RemoveAll's the tags up to the first merge.
+   * #RemoveAll's the tags.
    */
   inline ~PacketTagList ();
 
   /**
-   * Add a tag to the head of this branch.
+   * Add a tag to the list.
    *
    * \param [in] tag The tag to add
    */
@@ -210,13 +161,17 @@ public:
    */
   bool Peek (Tag &tag) const;
   /**
-   * Remove all tags from this list (up to the first merge).
+   * Remove all tags from this list.
    */
   inline void RemoveAll (void);
   /**
-   * \returns pointer to head of tag list
+   * \returns pointer to the first tag of the list
    */
-  const struct PacketTagList::TagData *Head (void) const;
+  const struct PacketTagList::TagData *Begin (void) const;
+  /**
+   * \returns pointer past the last tag of the list
+   */
+  const struct PacketTagList::TagData *End (void) const;
   /**
    * Returns number of bytes required for packet serialization.
    *
@@ -244,68 +199,88 @@ public:
 
 private:
   /**
-   * Allocate and construct a TagData struct, sizing the data area
-   * large enough to serialize dataSize bytes from a Tag.
-   *
-   * \param [in] dataSize The serialized size of the Tag.
-   * \returns The newly constructed TagData object.
+   * The reference-counted storage of the tags of one or more
+   * PacketTagList.
    */
-  static
-  TagData * CreateTagData (size_t dataSize);
-  
+  struct TagBlock
+  {
+    SharedValue<uint32_t> count;   /**< Number of PacketTagList sharing this block */
+    uint64_t mask;                 /**< Bitmask of the slots present */
+    std::vector<TagData> tags;     /**< The tags, sorted by slot */
+    std::vector<uint8_t> bytes;    /**< The serialized tags */
+    uint32_t garbage;              /**< Bytes no longer used by any tag */
+    TagBlock *next;                /**< Next block on the free list */
+  };
+
   /**
-   * Typedef of method function pointer for copy-on-write operations
+   * The released TagBlocks (of one thread with \c --enable-mt-packets).
    *
-   * \param [in] tag The tag type to operate on.
-   * \param [in] preMerge True if \pname{tag} was found before the first merge,
-   *             false otherwise.
-   * \param [in] cur Pointer to the tag.
-   * \param [in] prevNext Pointer to the struct TagData.next pointer
-   *          pointing to \pname{cur}.
-   * \returns True if operation successful, false otherwise
+   * This is trivially destructible, so it remains usable until the thread
+   * exits, even after FreeListGuard has released its content.
    */
-  typedef bool (PacketTagList::*COWWriter)
-    (Tag       & tag, bool         preMerge,
-    struct TagData * cur, struct TagData ** prevNext);
+  struct FreeList
+  {
+    TagBlock *head;                /**< Last released block */
+    uint32_t size;                 /**< Number of released blocks */
+    bool registered;               /**< Has the FreeListGuard been created */
+    bool finalized;                /**< Has the thread started exiting */
+  };
+  /** Release the free list when the owning thread (or the program) exits. */
+  struct FreeListGuard
+  {
+    ~FreeListGuard ();
+  };
+  /** The free list (of the current thread with \c --enable-mt-packets). */
+  static NS_MT_PACKETS_THREAD_LOCAL FreeList m_freeList;
+  /** The guard of m_freeList, created on first release. */
+  static NS_MT_PACKETS_THREAD_LOCAL FreeListGuard m_freeListGuard;
+
   /**
-   * Traverse the list implementing copy-on-write, using \pname{Writer}.
-   *
-   * \param [in] tag The tag type to operate on.
-   * \param [in] Writer The copy-on-write function to use.
-   * \returns True if \pname{tag} found, false otherwise.
+   * Get the slot index of a tag type.
+   * \param [in] tid The tag type.
+   * \returns The slot index, assigned on first use.
    */
-  bool COWTraverse   (Tag & tag, PacketTagList::COWWriter Writer);
+  static uint32_t GetSlot (TypeId tid);
   /**
-   * Copy-on-write implementing Remove.
-   *
-   * \param [in] tag The target tag type to remove.
-   * \param [in] preMerge True if \pname{tag} was found before the first merge,
-   *             false otherwise.
-   * \param [in] cur Pointer to the tag.
-   * \param [in] prevNext Pointer to the struct TagData.next pointer
-   *          pointing to \pname{cur}.
-   * \returns True, since tag will definitely be removed.
+   * Allocate an empty TagBlock, from the free list if possible.
+   * \returns The TagBlock, with a count of 1.
    */
-  bool RemoveWriter  (Tag & tag, bool preMerge,
-                      struct TagData * cur, struct TagData ** prevNext);
+  static TagBlock * AllocateBlock (void);
   /**
-   * Copy-on-write implementing Replace
-   *
-   * \param [in] tag The target tag type to replace
-   * \param [in] preMerge True if \pname{tag} was found before the first merge,
-   *          false otherwise.
-   * \param [in] cur Pointer to the tag
-   * \param [in] prevNext Pointer to the struct TagData.next pointer
-   *          pointing to \pname{cur}.
-   * \returns True, since tag value will definitely be replaced.
+   * Release a reference to a TagBlock, and recycle it if it was the last.
+   * \param [in] block The TagBlock.
+   */
+  static void ReleaseBlock (TagBlock *block);
+  /**
+   * Reserve room for the serialized data of a tag.
+   * \param [in] block The TagBlock, which must not be shared.
+   * \param [in] size The number of bytes.
+   * \returns The offset of the room in the byte area.
+   */
+  static uint32_t AllocateBytes (TagBlock *block, uint32_t size);
+  /**
+   * Insert a tag at its position in a TagBlock.
+   * \param [in] block The TagBlock, which must not be shared.
+   * \param [in] data The tag, whose data is already in the block.
+   */
+  static void Insert (TagBlock *block, TagData const &data);
+  /**
+   * Find a tag.
+   * \param [in] tid The tag type.
+   * \param [in] slot The slot index of \pname{tid}.
+   * \returns The index of the tag, or -1 if it is missing.
    */
-  bool ReplaceWriter (Tag & tag, bool preMerge,
-                      struct TagData * cur, struct TagData ** prevNext);
+  int32_t Find (TypeId tid, uint32_t slot) const;
+  /**
+   * Make sure the TagBlock is not shared with another PacketTagList,
+   * copying it if needed.
+   */
+  void MakeUnique (void);
 
   /**
-   * Pointer to first \ref TagData on the list
+   * The tags, or 0 if the list is empty.
    */
-  struct TagData *m_next;
+  struct TagBlock *m_block;
 };
 
 } // namespace ns3
@@ -317,16 +292,16 @@ private:
 namespace ns3 {
 
 PacketTagList::PacketTagList ()
-  : m_next ()
+  : m_block (0)
 {
 }
 
 PacketTagList::PacketTagList (PacketTagList const &o)
-  : m_next (o.m_next)
+  : m_block (o.m_block)
 {
-  if (m_next != 0)
+  if (m_block != 0)
     {
-      m_next->count++;
+      m_block->count++;
     }
 }
 
@@ -334,15 +309,15 @@ PacketTagList &
 PacketTagList::operator = (PacketTagList const &o)
 {
   // self assignment
-  if (m_next == o.m_next) 
+  if (m_block == o.m_block) 
     {
       return *this;
     }
   RemoveAll ();
-  m_next = o.m_next;
-  if (m_next != 0) 
+  m_block = o.m_block;
+  if (m_block != 0) 
     {
-      m_next->count++;
+      m_block->count++;
     }
   return *this;
 }
@@ -355,27 +330,11 @@ PacketTagList::~PacketTagList ()
 void
 PacketTagList::RemoveAll (void)
 {
-  struct TagData *prev = 0;
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next)
-    {
-      cur->count--;
-      if (cur->count > 0) 
-        {
-          break;
-        }
-      if (prev != 0) 
-        {
-          prev->~TagData ();
-          std::free (prev);
-        }
-      prev = cur;
-    }
-  if (prev != 0) 
+  if (m_block != 0)
     {
-      prev->~TagData ();
-      std::free (prev);
+      ReleaseBlock (m_block);
+      m_block = 0;
     }
-  m_next = 0;
 }
 
 } // namespace ns3
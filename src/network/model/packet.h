@@ -173,10 +173,13 @@ private:
   friend class Packet;
   /**
    * Constructor
-   * \param head head of the items
+   * \param begin first item
+   * \param end past the last item
    */
-  PacketTagIterator (const struct PacketTagList::TagData *head);
+  PacketTagIterator (const struct PacketTagList::TagData *begin,
+                     const struct PacketTagList::TagData *end);
   const struct PacketTagList::TagData *m_current;  //!< actual position over the set of tags in a packet
+  const struct PacketTagList::TagData *m_end;      //!< past the last tag in the packet
 };
 
 /**
@@ -787,7 +790,12 @@ private:
   /* Please see comments above about nix-vector */
   Ptr<NixVector> m_nixVector; //!< the packet's Nix vector
 
-  static uint32_t m_globalUid; //!< Global counter of packets Uid
+  /**
+   * Global counter of packets Uid.  With \c --enable-mt-packets, it is
+   * atomic so that the packets can be created concurrently, e.g., by the
+   * partitions of a multithreaded simulation.
+   */
+  static SharedValue<uint32_t> m_globalUid;
 };
 
 /**
@@ -816,11 +824,11 @@ std::ostream& operator<< (std::ostream& os, const Packet &packet);
  *   - ns3::Packet::AddHeader
  *   - ns3::Packet::AddTrailer
  *   - both versions of ns3::Packet::AddAtEnd
+ *   - ns3::Packet::AddPacketTag
  *   - ns3::Packet::RemovePacketTag
  *   - ns3::Packet::ReplacePacketTag
  *
  * Non-dirty operations:
- *   - ns3::Packet::AddPacketTag
  *   - ns3::Packet::PeekPacketTag
  *   - ns3::Packet::RemoveAllPacketTags
  *   - ns3::Packet::AddByteTag
@@ -0,0 +1,192 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/binary-trace.h"
+#include "ns3/output-stream-wrapper.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-helper.h"
+
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Check that the records of a binary trace are read as written.
+ */
+class BinaryTraceFormatTestCase : public TestCase
+{
+public:
+  BinaryTraceFormatTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+BinaryTraceFormatTestCase::BinaryTraceFormatTestCase ()
+  : TestCase ("Check the binary trace format")
+{}
+
+void
+BinaryTraceFormatTestCase::DoRun (void)
+{
+  BinaryTrace::Record record;
+  record.time = 0x123456789abLL;
+  record.node = 7;
+  record.device = BinaryTrace::UNKNOWN_ID;
+  record.event = BinaryTrace::DROP;
+  record.size = 1500;
+  record.uid = 0x100000002ULL;
+  record.source = 0x0a010101;
+  record.destination = 0x0a020202;
+  record.sourcePort = 49153;
+  record.destinationPort = 80;
+  record.protocol = 6;
+
+  for (uint32_t flows = 0; flows < 2; flows++)
+    {
+      std::stringstream ss;
+      BinaryTrace::WriteHeader (ss, flows);
+      BinaryTrace::Write (ss, record, flows);
+      BinaryTrace::Write (ss, record, flows);
+      uint32_t recordSize = flows ? BinaryTrace::FLOW_RECORD_SIZE : BinaryTrace::RECORD_SIZE;
+      NS_TEST_EXPECT_MSG_EQ (ss.str ().size (), BinaryTrace::HEADER_SIZE + 2 * recordSize, "Wrong file size");
+      // The fields are little-endian
+      NS_TEST_EXPECT_MSG_EQ (static_cast<uint8_t> (ss.str ()[BinaryTrace::HEADER_SIZE]), 0xab, "Wrong time");
+      NS_TEST_EXPECT_MSG_EQ (ss.str ()[BinaryTrace::HEADER_SIZE + 16], 'd', "Wrong event");
+
+      bool readFlows = !flows;
+      NS_TEST_ASSERT_MSG_EQ (BinaryTrace::ReadHeader (ss, readFlows), true, "Header not read");
+      NS_TEST_EXPECT_MSG_EQ (readFlows, static_cast<bool> (flows), "Wrong flow columns flag");
+      for (uint32_t i = 0; i < 2; i++)
+        {
+          BinaryTrace::Record read;
+          NS_TEST_ASSERT_MSG_EQ (BinaryTrace::Read (ss, read, readFlows), true, "Record not read");
+          NS_TEST_EXPECT_MSG_EQ (read.time, record.time, "Wrong time");
+          NS_TEST_EXPECT_MSG_EQ (read.node, record.node, "Wrong node");
+          NS_TEST_EXPECT_MSG_EQ (read.device, record.device, "Wrong device");
+          NS_TEST_EXPECT_MSG_EQ (read.event, record.event, "Wrong event");
+          NS_TEST_EXPECT_MSG_EQ (read.size, record.size, "Wrong size");
+          NS_TEST_EXPECT_MSG_EQ (read.uid, record.uid, "Wrong uid");
+          NS_TEST_EXPECT_MSG_EQ (read.source, (flows ? record.source : 0), "Wrong source");
+          NS_TEST_EXPECT_MSG_EQ (read.destination, (flows ? record.destination : 0), "Wrong destination");
+          NS_TEST_EXPECT_MSG_EQ (read.sourcePort, (flows ? record.sourcePort : 0), "Wrong source port");
+          NS_TEST_EXPECT_MSG_EQ (read.destinationPort, (flows ? record.destinationPort : 0), "Wrong destination port");
+          NS_TEST_EXPECT_MSG_EQ (read.protocol, (flows ? record.protocol : 0), "Wrong protocol");
+        }
+      BinaryTrace::Record read;
+      NS_TEST_EXPECT_MSG_EQ (BinaryTrace::Read (ss, read, readFlows), false, "Record read past the end");
+    }
+
+  std::stringstream text ("+ 1.5 /NodeList/0/DeviceList/0 ns3::PppHeader");
+  bool flows;
+  NS_TEST_EXPECT_MSG_EQ (BinaryTrace::ReadHeader (text, flows), false, "Text trace read as a binary trace");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Check that the default trace sinks of AsciiTraceHelper write binary
+ * records to the binary streams.
+ */
+class BinaryTraceSinkTestCase : public TestCase
+{
+public:
+  BinaryTraceSinkTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Trace some events to a stream.
+   * \param stream the stream
+   * \param p the packet
+   */
+  void Trace (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p);
+};
+
+BinaryTraceSinkTestCase::BinaryTraceSinkTestCase ()
+  : TestCase ("Check the binary trace sinks")
+{}
+
+void
+BinaryTraceSinkTestCase::Trace (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
+{
+  AsciiTraceHelper::DefaultEnqueueSinkWithContext (stream, "/NodeList/12/DeviceList/3/$ns3::SimpleNetDevice/TxQueue/Enqueue", p);
+  AsciiTraceHelper::DefaultDequeueSinkWithContext (stream, "/NodeList/12/DeviceList/3/$ns3::SimpleNetDevice/TxQueue/Dequeue", p);
+  AsciiTraceHelper::DefaultDropSinkWithoutContext (stream, p);
+  AsciiTraceHelper::DefaultReceiveSinkWithContext (stream, "/NodeList/4/DeviceList/0/$ns3::SimpleNetDevice/MacRx", p);
+}
+
+void
+BinaryTraceSinkTestCase::DoRun (void)
+{
+  std::stringstream ss;
+  Ptr<OutputStreamWrapper> stream = Create<OutputStreamWrapper> (&ss);
+  stream->SetTraceFormat (OutputStreamWrapper::BINARY);
+  BinaryTrace::WriteHeader (ss, false);
+  Ptr<Packet> p = Create<Packet> (1000);
+  Simulator::Schedule (MilliSeconds (1500), &BinaryTraceSinkTestCase::Trace, this, stream, p);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  bool flows;
+  NS_TEST_ASSERT_MSG_EQ (BinaryTrace::ReadHeader (ss, flows), true, "Header not read");
+  NS_TEST_EXPECT_MSG_EQ (flows, false, "Flow columns written");
+  const uint8_t events[] = { BinaryTrace::ENQUEUE, BinaryTrace::DEQUEUE, BinaryTrace::DROP, BinaryTrace::RECEIVE };
+  const uint32_t nodes[] = { 12, 12, BinaryTrace::UNKNOWN_ID, 4 };
+  const uint32_t devices[] = { 3, 3, BinaryTrace::UNKNOWN_ID, 0 };
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      BinaryTrace::Record record;
+      NS_TEST_ASSERT_MSG_EQ (BinaryTrace::Read (ss, record, flows), true, "Record " << i << " not read");
+      NS_TEST_EXPECT_MSG_EQ (record.event, events[i], "Wrong event of record " << i);
+      NS_TEST_EXPECT_MSG_EQ (record.time, 1500000000, "Wrong time of record " << i);
+      NS_TEST_EXPECT_MSG_EQ (record.node, nodes[i], "Wrong node of record " << i);
+      NS_TEST_EXPECT_MSG_EQ (record.device, devices[i], "Wrong device of record " << i);
+      NS_TEST_EXPECT_MSG_EQ (record.size, 1000, "Wrong size of record " << i);
+      NS_TEST_EXPECT_MSG_EQ (record.uid, p->GetUid (), "Wrong uid of record " << i);
+    }
+  BinaryTrace::Record record;
+  NS_TEST_EXPECT_MSG_EQ (BinaryTrace::Read (ss, record, flows), false, "Extra record written");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Binary trace test suite.
+ */
+class BinaryTraceTestSuite : public TestSuite
+{
+public:
+  BinaryTraceTestSuite ();
+};
+
+BinaryTraceTestSuite::BinaryTraceTestSuite ()
+  : TestSuite ("binary-trace", UNIT)
+{
+  AddTestCase (new BinaryTraceFormatTestCase, TestCase::QUICK);
+  AddTestCase (new BinaryTraceSinkTestCase, TestCase::QUICK);
+}
+
+static BinaryTraceTestSuite g_binaryTraceTestSuite; //!< Static variable for test initialization
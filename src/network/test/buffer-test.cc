@@ -22,6 +22,9 @@
 #include "ns3/random-variable-stream.h"
 #include "ns3/double.h"
 #include "ns3/test.h"
+#include <sstream>
+#include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -389,6 +392,281 @@ BufferTest::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (val1, val2, "Bad ReadNtohU16()");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Buffer fragment chain unit tests.
+ */
+class BufferFragmentsTest : public TestCase {
+private:
+  /**
+   * Create a buffer holding consecutive byte values.
+   * \param first The value of the first byte
+   * \param n The number of bytes
+   * \returns The buffer
+   */
+  Buffer MakeBuffer (uint8_t first, uint32_t n);
+  /**
+   * Checks the buffer content with CopyData, without materializing it.
+   * \param b The buffer to check
+   * \param n The number of bytes to check
+   * \param array The array of bytes that should be in the buffer
+   * \param file The file name
+   * \param line The line number
+   */
+  void EnsureCopiedBytes (const Buffer &b, uint32_t n, uint8_t array[], const char *file, int line);
+public:
+  virtual void DoRun (void);
+  BufferFragmentsTest ();
+};
+
+BufferFragmentsTest::BufferFragmentsTest ()
+  : TestCase ("Buffer fragment chains")
+{
+}
+
+Buffer
+BufferFragmentsTest::MakeBuffer (uint8_t first, uint32_t n)
+{
+  Buffer b;
+  b.AddAtStart (n);
+  Buffer::Iterator i = b.Begin ();
+  for (uint32_t j = 0; j < n; j++)
+    {
+      i.WriteU8 (first + j);
+    }
+  return b;
+}
+
+void
+BufferFragmentsTest::EnsureCopiedBytes (const Buffer &b, uint32_t n, uint8_t array[], const char *file, int line)
+{
+  NS_TEST_ASSERT_MSG_EQ_INTERNAL (b.GetSize (), n, "Buffer -- bad size", file, line);
+  std::vector<uint8_t> got (n + 1, 0xee);
+  uint32_t copied = b.CopyData (&got[0], n + 1);
+  NS_TEST_ASSERT_MSG_EQ_INTERNAL (copied, n, "Buffer -- bad CopyData size", file, line);
+  for (uint32_t j = 0; j < n; j++)
+    {
+      NS_TEST_ASSERT_MSG_EQ_INTERNAL ((uint16_t)got[j], (uint16_t)array[j],
+                                      "Buffer -- bad byte " << j, file, line);
+    }
+  std::ostringstream os;
+  b.CopyData (&os, n);
+  NS_TEST_ASSERT_MSG_EQ_INTERNAL (os.str (), std::string ((char *)array, n),
+                                  "Buffer -- bad CopyData to stream", file, line);
+}
+
+/**
+ * \param n The number of pieces of a fragment chain
+ * \returns n, or 1 with --enable-mt-packets, where the chains are
+ * materialized as soon as they are created
+ */
+static uint32_t
+ChainPieces (uint32_t n)
+{
+#ifdef NS3_MT_PACKETS
+  return 1;
+#else
+  return n;
+#endif
+}
+
+/**
+ * Check the content of a buffer with CopyData.
+ */
+#define ENSURE_COPIED_BYTES(buffer, n, ...)                     \
+  {                                                             \
+    uint8_t bytes[] = { __VA_ARGS__};                            \
+    EnsureCopiedBytes (buffer, n, bytes, __FILE__, __LINE__);   \
+  }
+
+void
+BufferFragmentsTest::DoRun (void)
+{
+  Buffer a = MakeBuffer (1, 4);
+  Buffer b = Buffer (3);
+  b.AddAtEnd (2);
+  Buffer::Iterator i = b.End ();
+  i.Prev (2);
+  i.WriteU8 (5);
+  i.WriteU8 (6);
+  Buffer c = MakeBuffer (7, 3);
+
+  // Concatenation shares the fragments.
+  Buffer chain = a;
+  chain.AddAtEnd (b);
+  chain.AddAtEnd (c);
+  NS_TEST_ASSERT_MSG_EQ (chain.GetNFragments (), ChainPieces (3), "Fragments not chained");
+  ENSURE_COPIED_BYTES (chain, 12, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9);
+  ENSURE_COPIED_BYTES (a, 4, 1, 2, 3, 4);
+  uint8_t partial[6];
+  NS_TEST_ASSERT_MSG_EQ (chain.CopyData (partial, 6), 6, "Bad partial CopyData");
+  NS_TEST_ASSERT_MSG_EQ ((uint16_t)partial[5], 0, "Bad partial CopyData");
+
+  // Fragmentation does not materialize the chain.
+  Buffer frag = chain.CreateFragment (2, 8);
+  ENSURE_COPIED_BYTES (frag, 8, 3, 4, 0, 0, 0, 5, 6, 7);
+  NS_TEST_ASSERT_MSG_EQ (chain.GetNFragments (), ChainPieces (3), "Chain materialized");
+  frag = chain.CreateFragment (5, 3);
+  NS_TEST_ASSERT_MSG_EQ (frag.GetNFragments (), 1, "Fragment in a single piece");
+  ENSURE_COPIED_BYTES (frag, 3, 0, 0, 5);
+
+  // Copies of a chain are independent.
+  Buffer copy = chain;
+  copy.RemoveAtStart (5);
+  ENSURE_COPIED_BYTES (copy, 7, 0, 0, 5, 6, 7, 8, 9);
+  copy.RemoveAtEnd (2);
+  ENSURE_COPIED_BYTES (copy, 5, 0, 0, 5, 6, 7);
+  copy.RemoveAtEnd (4);
+  ENSURE_COPIED_BYTES (copy, 1, 0);
+  NS_TEST_ASSERT_MSG_EQ (copy.GetNFragments (), 1, "Fragments not released");
+  ENSURE_COPIED_BYTES (chain, 12, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9);
+  copy = chain;
+  NS_TEST_ASSERT_MSG_EQ ((uint16_t)copy.PeekData ()[10], 8, "PeekData did not materialize");
+  NS_TEST_ASSERT_MSG_EQ (copy.GetNFragments (), 1, "PeekData did not materialize");
+  copy = chain;
+  copy.RemoveAtStart (12);
+  NS_TEST_ASSERT_MSG_EQ (copy.GetSize (), 0, "Buffer not emptied");
+
+  // Chains are flattened when appended to another chain.
+  Buffer other = c;
+  other.AddAtEnd (a);
+  Buffer nested = chain;
+  nested.AddAtEnd (other);
+  NS_TEST_ASSERT_MSG_EQ (nested.GetNFragments (), ChainPieces (5), "Nested chain not flattened");
+  ENSURE_COPIED_BYTES (nested, 19, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9, 7, 8, 9, 1, 2, 3, 4);
+  Buffer self = nested;
+  self.AddAtEnd (self);
+  NS_TEST_ASSERT_MSG_EQ (self.GetSize (), 38, "Bad self concatenation");
+  frag = self.CreateFragment (17, 4);
+  ENSURE_COPIED_BYTES (frag, 4, 3, 4, 1, 2);
+
+  // Headers can be added to a chain, which is materialized.
+  Buffer header = chain;
+  header.AddAtStart (1);
+  NS_TEST_ASSERT_MSG_EQ (header.GetNFragments (), ChainPieces (3), "Chain materialized");
+  header.Begin ().WriteU8 (0xff);
+  NS_TEST_ASSERT_MSG_EQ (header.GetNFragments (), 1, "Chain not materialized");
+  ENSURE_COPIED_BYTES (header, 13, 0xff, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9);
+  Buffer trailer = chain;
+  trailer.AddAtEnd (1);
+  i = trailer.End ();
+  i.Prev ();
+  i.WriteU8 (0xfe);
+  ENSURE_COPIED_BYTES (trailer, 13, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9, 0xfe);
+  ENSURE_COPIED_BYTES (chain, 12, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9);
+
+  // Serialization does not materialize the chain.
+  const Buffer serialized = chain;
+  std::vector<uint8_t> raw (serialized.GetSerializedSize ());
+  NS_TEST_ASSERT_MSG_EQ (serialized.Serialize (&raw[0], raw.size ()), 1, "Serialization failed");
+  NS_TEST_ASSERT_MSG_EQ (serialized.GetNFragments (), ChainPieces (3), "Chain materialized");
+  Buffer materialized = chain;
+  materialized.Begin ();
+  NS_TEST_ASSERT_MSG_EQ (serialized.GetSerializedSize (), materialized.GetSerializedSize (),
+                         "Bad serialized size");
+  Buffer deserialized (0, false);
+  // As in Packet::Serialize, the size includes its own 4-byte field.
+  deserialized.Deserialize (&raw[0], raw.size () + 4);
+  ENSURE_COPIED_BYTES (deserialized, 12, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9);
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Buffer checksum unit tests: the checksum is compared with a sum of
+ * the bytes read one by one, at all offsets, across the zero area.
+ */
+class BufferChecksumTest : public TestCase {
+private:
+  /**
+   * Calculate the checksum by reading the bytes one by one.
+   * \param i The iterator at the start of the bytes
+   * \param size The number of bytes
+   * \param initialChecksum The initial value
+   * \returns The checksum
+   */
+  uint16_t ReferenceChecksum (Buffer::Iterator i, uint16_t size, uint32_t initialChecksum);
+public:
+  virtual void DoRun (void);
+  BufferChecksumTest ();
+};
+
+BufferChecksumTest::BufferChecksumTest ()
+  : TestCase ("Buffer checksum")
+{
+}
+
+uint16_t
+BufferChecksumTest::ReferenceChecksum (Buffer::Iterator i, uint16_t size, uint32_t initialChecksum)
+{
+  uint32_t sum = initialChecksum;
+  for (uint32_t j = 0; j < size; j++)
+    {
+      uint32_t byte = i.ReadU8 ();
+      sum += (j & 1) ? byte << 8 : byte;
+    }
+  while (sum >> 16)
+    {
+      sum = (sum & 0xffff) + (sum >> 16);
+    }
+  return ~sum;
+}
+
+void
+BufferChecksumTest::DoRun (void)
+{
+  // 37 bytes, 23 zeroes, 41 bytes
+  Buffer buffer (23);
+  buffer.AddAtStart (37);
+  buffer.AddAtEnd (41);
+  Buffer::Iterator i = buffer.Begin ();
+  for (uint32_t j = 0; j < 37; j++)
+    {
+      i.WriteU8 (0xf0 + j * 7);
+    }
+  i = buffer.End ();
+  i.Prev (41);
+  for (uint32_t j = 0; j < 41; j++)
+    {
+      i.WriteU8 (0xff - j * 13);
+    }
+
+  for (uint32_t start = 0; start < buffer.GetSize (); start++)
+    {
+      for (uint32_t size = 0; start + size <= buffer.GetSize (); size++)
+        {
+          Buffer::Iterator it = buffer.Begin ();
+          it.Next (start);
+          uint16_t expected = ReferenceChecksum (it, size, 0x1234);
+          uint16_t checksum = it.CalculateIpChecksum (size, 0x1234);
+          NS_TEST_ASSERT_MSG_EQ (checksum, expected, "Bad checksum of " << size << " bytes at " << start);
+          NS_TEST_ASSERT_MSG_EQ (it.GetDistanceFrom (buffer.Begin ()), start + size, "Iterator not advanced");
+        }
+    }
+
+  // A checksum written in the bytes sums to zero
+  Buffer header;
+  header.AddAtStart (21);
+  i = header.Begin ();
+  for (uint32_t j = 0; j < 21; j++)
+    {
+      i.WriteU8 (j * 31);
+    }
+  i = header.Begin ();
+  i.Next (4);
+  i.WriteU16 (0);
+  i = header.Begin ();
+  uint16_t checksum = i.CalculateIpChecksum (21);
+  i = header.Begin ();
+  i.Next (4);
+  i.WriteU16 (checksum);
+  i = header.Begin ();
+  NS_TEST_EXPECT_MSG_EQ (i.CalculateIpChecksum (21), 0, "Checksum not verified");
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -405,6 +683,8 @@ BufferTestSuite::BufferTestSuite ()
   : TestSuite ("buffer", UNIT)
 {
   AddTestCase (new BufferTest, TestCase::QUICK);
+  AddTestCase (new BufferFragmentsTest, TestCase::QUICK);
+  AddTestCase (new BufferChecksumTest, TestCase::QUICK);
 }
 
 static BufferTestSuite g_bufferTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,451 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/packet.h"
+#include "ns3/header.h"
+#include "ns3/tag.h"
+#include "ns3/simulator.h"
+#include "ns3/simulator-impl.h"
+#include "ns3/object-factory.h"
+#include "ns3/uinteger.h"
+#include "ns3/nstime.h"
+
+#include <algorithm>
+#include <deque>
+#include <set>
+#include <tuple>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Packets exchanged between the partitions of a multithreaded simulation.
+ */
+
+using namespace ns3;
+
+namespace {
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Header identifying a test packet and the hops it went through.
+ */
+class MultithreadedTestHeader : public Header
+{
+public:
+  MultithreadedTestHeader ()
+    : m_source (0),
+      m_seq (0),
+      m_hops (0)
+  {}
+  /**
+   * Constructor.
+   * \param [in] source The context which created the packet.
+   * \param [in] seq The sequence number of the packet in its source.
+   * \param [in] hops The number of hops so far.
+   */
+  MultithreadedTestHeader (uint32_t source, uint32_t seq, uint32_t hops)
+    : m_source (source),
+      m_seq (seq),
+      m_hops (hops)
+  {}
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("anon::MultithreadedTestHeader")
+      .SetParent<Header> ()
+      .SetGroupName ("Network")
+      .HideFromDocumentation ()
+      .AddConstructor<MultithreadedTestHeader> ()
+    ;
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+  virtual void Print (std::ostream &os) const
+  {
+    os << m_source << "/" << m_seq << "/" << m_hops;
+  }
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return 12;
+  }
+  virtual void Serialize (Buffer::Iterator start) const
+  {
+    start.WriteHtonU32 (m_source);
+    start.WriteHtonU32 (m_seq);
+    start.WriteHtonU32 (m_hops);
+  }
+  virtual uint32_t Deserialize (Buffer::Iterator start)
+  {
+    m_source = start.ReadNtohU32 ();
+    m_seq = start.ReadNtohU32 ();
+    m_hops = start.ReadNtohU32 ();
+    return 12;
+  }
+
+  uint32_t m_source; //!< The context which created the packet.
+  uint32_t m_seq;    //!< The sequence number of the packet in its source.
+  uint32_t m_hops;   //!< The number of hops so far.
+};
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Tag carrying a value, used both as packet tag and as byte tag.
+ */
+class MultithreadedTestTag : public Tag
+{
+public:
+  MultithreadedTestTag ()
+    : m_value (0)
+  {}
+  /**
+   * Constructor.
+   * \param [in] value The value.
+   */
+  MultithreadedTestTag (uint32_t value)
+    : m_value (value)
+  {}
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("anon::MultithreadedTestTag")
+      .SetParent<Tag> ()
+      .SetGroupName ("Network")
+      .HideFromDocumentation ()
+      .AddConstructor<MultithreadedTestTag> ()
+    ;
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return 4;
+  }
+  virtual void Serialize (TagBuffer buf) const
+  {
+    buf.WriteU32 (m_value);
+  }
+  virtual void Deserialize (TagBuffer buf)
+  {
+    m_value = buf.ReadU32 ();
+  }
+  virtual void Print (std::ostream &os) const
+  {
+    os << m_value;
+  }
+
+  uint32_t m_value; //!< The value.
+};
+
+}  // unnamed namespace
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Check that packets can be exchanged between the partitions of a
+ * multithreaded simulation.
+ *
+ * Each context creates packets with a header, a packet tag and a byte
+ * tag, and sends them to other contexts, which check and forward them
+ * for a few hops.  The senders keep copies of the packets they sent,
+ * which share their data with the packets handled by the receivers,
+ * and add headers to these copies while the receivers run: the
+ * reference counts and the dirty areas of the shared data are thus
+ * updated concurrently by several threads.
+ *
+ * The events only record what they see; everything is checked in
+ * the main thread, against a run with the default simulator.
+ */
+class MultithreadedPacketTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param [in] threads The number of partitions.
+   */
+  MultithreadedPacketTestCase (uint32_t threads);
+  virtual void DoRun (void);
+
+private:
+  /**
+   * What a context saw of a received packet: time, source,
+   * sequence number, hops, and whether its content was right.
+   */
+  typedef std::tuple<int64_t, uint32_t, uint32_t, uint32_t, bool> Record;
+
+  /**
+   * Run the scenario with a simulator implementation.
+   * \param [in] factory The simulator implementation factory.
+   * \param [out] log The packets received by each context.
+   * \param [out] uids The uids of the packets created by each context.
+   */
+  void RunScenario (ObjectFactory factory, std::vector<std::vector<Record> > &log,
+                    std::vector<std::vector<uint64_t> > &uids);
+  /**
+   * Create and send a packet.
+   * \param [in] context The context.
+   * \param [in] seq The sequence number of the packet.
+   */
+  void Send (uint32_t context, uint32_t seq);
+  /**
+   * Check, record, and forward a received packet.
+   * \param [in] context The context.
+   * \param [in] packet The packet.
+   */
+  void Receive (uint32_t context, Ptr<Packet> packet);
+  /**
+   * Keep a copy of a sent packet, and modify and release an older one.
+   * \param [in] context The context.
+   * \param [in] packet The packet.
+   */
+  void Keep (uint32_t context, Ptr<const Packet> packet);
+
+  uint32_t m_threads;                             //!< Number of partitions.
+  std::vector<std::vector<Record> > *m_log;       //!< Current log.
+  std::vector<std::vector<uint64_t> > *m_uids;    //!< Current packet uids.
+  std::vector<std::deque<Ptr<Packet> > > m_kept;  //!< Copies of the sent packets, per context.
+};
+
+/** Number of contexts. */
+static const uint32_t N_CONTEXTS = 11;
+/** Number of packets created by each context. */
+static const uint32_t N_PACKETS = 300;
+/** Number of hops of each packet. */
+static const uint32_t N_HOPS = 3;
+/** Number of sent packets kept by each context. */
+static const uint32_t N_KEPT = 4;
+
+/**
+ * Get the expected payload byte of a packet.
+ * \param [in] source The context which created the packet.
+ * \param [in] seq The sequence number of the packet.
+ * \param [in] i The byte index.
+ * \returns The byte.
+ */
+static uint8_t
+PayloadByte (uint32_t source, uint32_t seq, uint32_t i)
+{
+  return (source * 31 + seq * 7 + i) & 0xff;
+}
+
+/**
+ * Get the expected payload size of a packet.
+ * \param [in] seq The sequence number of the packet.
+ * \returns The payload size.
+ */
+static uint32_t
+PayloadSize (uint32_t seq)
+{
+  return 40 + (seq % 7) * 30;
+}
+
+MultithreadedPacketTestCase::MultithreadedPacketTestCase (uint32_t threads)
+  : TestCase ("Exchange packets between partitions with "
+              + std::to_string (threads) + " threads"),
+    m_threads (threads),
+    m_log (0),
+    m_uids (0)
+{}
+
+void
+MultithreadedPacketTestCase::Keep (uint32_t context, Ptr<const Packet> packet)
+{
+  m_kept[context].push_back (packet->Copy ());
+  if (m_kept[context].size () > N_KEPT)
+    {
+      // Write at both ends of the data, which may be shared with a
+      // packet handled by another thread right now.
+      Ptr<Packet> old = m_kept[context].front ();
+      m_kept[context].pop_front ();
+      old->AddHeader (MultithreadedTestHeader (context, 0, 99));
+      uint8_t trailer[8] = { 0 };
+      old->AddAtEnd (Create<Packet> (trailer, sizeof (trailer)));
+    }
+}
+
+void
+MultithreadedPacketTestCase::Send (uint32_t context, uint32_t seq)
+{
+  std::vector<uint8_t> payload (PayloadSize (seq));
+  for (uint32_t i = 0; i < payload.size (); ++i)
+    {
+      payload[i] = PayloadByte (context, seq, i);
+    }
+  Ptr<Packet> packet = Create<Packet> (payload.data (), payload.size ());
+  (*m_uids)[context].push_back (packet->GetUid ());
+  packet->AddByteTag (MultithreadedTestTag (seq));
+  packet->AddHeader (MultithreadedTestHeader (context, seq, 0));
+  packet->AddPacketTag (MultithreadedTestTag (context * 1000 + seq));
+  Keep (context, packet);
+
+  uint32_t next = (context + 1 + seq % 3) % N_CONTEXTS;
+  Simulator::ScheduleWithContext (next, MicroSeconds (1) + NanoSeconds (seq % 97),
+                                  &MultithreadedPacketTestCase::Receive, this, next, packet);
+  if (seq + 1 < N_PACKETS)
+    {
+      Simulator::Schedule (NanoSeconds (200 + 13 * context), &MultithreadedPacketTestCase::Send,
+                           this, context, seq + 1);
+    }
+}
+
+void
+MultithreadedPacketTestCase::Receive (uint32_t context, Ptr<Packet> packet)
+{
+  MultithreadedTestHeader header;
+  packet->RemoveHeader (header);
+  uint32_t source = header.m_source;
+  uint32_t seq = header.m_seq;
+
+  bool ok = packet->GetSize () == PayloadSize (seq);
+  std::vector<uint8_t> payload (packet->GetSize ());
+  packet->CopyData (payload.data (), payload.size ());
+  for (uint32_t i = 0; ok && i < payload.size (); ++i)
+    {
+      ok = payload[i] == PayloadByte (source, seq, i);
+    }
+  MultithreadedTestTag tag;
+  ok = ok && packet->PeekPacketTag (tag) && tag.m_value == source * 1000 + seq;
+  ByteTagIterator i = packet->GetByteTagIterator ();
+  ok = ok && i.HasNext ();
+  if (ok)
+    {
+      i.Next ().GetTag (tag);
+      ok = tag.m_value == seq && !i.HasNext ();
+    }
+  (*m_log)[context].push_back (Record (Simulator::Now ().GetTimeStep (), source, seq,
+                                       header.m_hops, ok));
+
+  if (header.m_hops < N_HOPS)
+    {
+      packet->AddHeader (MultithreadedTestHeader (source, seq, header.m_hops + 1));
+      Keep (context, packet);
+      uint32_t next = (context + source + header.m_hops + 1) % N_CONTEXTS;
+      Simulator::ScheduleWithContext (next, MicroSeconds (1) + NanoSeconds (seq % 89),
+                                      &MultithreadedPacketTestCase::Receive, this, next, packet);
+    }
+}
+
+void
+MultithreadedPacketTestCase::RunScenario (ObjectFactory factory,
+                                          std::vector<std::vector<Record> > &log,
+                                          std::vector<std::vector<uint64_t> > &uids)
+{
+  log.assign (N_CONTEXTS, std::vector<Record> ());
+  uids.assign (N_CONTEXTS, std::vector<uint64_t> ());
+  m_kept.assign (N_CONTEXTS, std::deque<Ptr<Packet> > ());
+  m_log = &log;
+  m_uids = &uids;
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+  for (uint32_t context = 0; context < N_CONTEXTS; ++context)
+    {
+      Simulator::ScheduleWithContext (context, NanoSeconds (context),
+                                      &MultithreadedPacketTestCase::Send,
+                                      this, context, 0);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+  m_kept.clear ();
+  m_log = 0;
+  m_uids = 0;
+}
+
+void
+MultithreadedPacketTestCase::DoRun (void)
+{
+  std::vector<std::vector<Record> > expected;
+  std::vector<std::vector<uint64_t> > expectedUids;
+  RunScenario (ObjectFactory ("ns3::DefaultSimulatorImpl"), expected, expectedUids);
+
+  ObjectFactory factory ("ns3::MultithreadedSimulatorImpl");
+  factory.Set ("ThreadCount", UintegerValue (m_threads));
+  factory.Set ("LookAhead", TimeValue (MicroSeconds (1)));
+  std::vector<std::vector<Record> > actual;
+  std::vector<std::vector<uint64_t> > uids;
+  RunScenario (factory, actual, uids);
+
+  std::set<uint64_t> allUids;
+  uint32_t received = 0;
+  for (uint32_t context = 0; context < N_CONTEXTS; ++context)
+    {
+      NS_TEST_ASSERT_MSG_EQ (uids[context].size (), N_PACKETS,
+                             "Wrong number of packets created by context " << context);
+      allUids.insert (uids[context].begin (), uids[context].end ());
+
+      // Simultaneous packets received from other partitions may be
+      // handled in a different order than with the default simulator.
+      std::sort (expected[context].begin (), expected[context].end ());
+      std::sort (actual[context].begin (), actual[context].end ());
+      NS_TEST_ASSERT_MSG_EQ (actual[context].size (), expected[context].size (),
+                             "Wrong number of packets received by context " << context);
+      for (uint32_t i = 0; i < actual[context].size (); ++i)
+        {
+          NS_TEST_EXPECT_MSG_EQ (std::get<4> (actual[context][i]), true,
+                                 "Wrong content of packet " << i << " received by context " << context);
+          NS_TEST_ASSERT_MSG_EQ ((actual[context][i] == expected[context][i]), true,
+                                 "Wrong packet " << i << " received by context " << context);
+        }
+      received += actual[context].size ();
+    }
+  NS_TEST_ASSERT_MSG_EQ (received, N_CONTEXTS * N_PACKETS * (N_HOPS + 1),
+                         "Wrong number of packets received");
+  NS_TEST_ASSERT_MSG_EQ (allUids.size (), N_CONTEXTS * N_PACKETS, "Packet uids are not unique");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Packets exchanged between the partitions of a multithreaded simulation.
+ */
+class MultithreadedPacketTestSuite : public TestSuite
+{
+public:
+  MultithreadedPacketTestSuite ()
+    : TestSuite ("multithreaded-packet", UNIT)
+  {
+    // Register the types before the threads use them.
+    MultithreadedTestHeader::GetTypeId ();
+    MultithreadedTestTag::GetTypeId ();
+    AddTestCase (new MultithreadedPacketTestCase (1), TestCase::QUICK);
+    AddTestCase (new MultithreadedPacketTestCase (4), TestCase::QUICK);
+    AddTestCase (new MultithreadedPacketTestCase (11), TestCase::QUICK);
+  }
+};
+
+/** Static variable for test initialization. */
+static MultithreadedPacketTestSuite g_multithreadedPacketTestSuite;
@@ -1108,6 +1108,21 @@ PacketTagListTest::DoRun (void)
     ReplaceCheck (6);
     ReplaceCheck (7);
   }
+
+  { // Reuse of the space of removed tags
+    std::cout << GetName () << "check removing and adding tags again"
+              << std::endl;
+    PacketTagList ptl = ref;
+    for (int i = 0; i < 100; ++i)
+      {
+        ptl.Remove (t3);
+        ptl.Remove (t6);
+        ptl.Add (t6);
+        ptl.Add (t3);
+      }
+    CheckRefList (ref, "re-add orig");
+    CheckRefList (ptl, "re-add copy");
+  }
   
   { // Timing
     std::cout << GetName () << "add+remove timing" << std::endl;
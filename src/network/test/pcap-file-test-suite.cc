@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <sstream>
 #include <cstring>
+#include <vector>
 
 #include "ns3/log.h"
 #include "ns3/test.h"
@@ -1144,6 +1145,89 @@ DiffTestCase::DoRun (void)
   NS_TEST_EXPECT_MSG_EQ (usec, 3696, "Files are different from 2.3696 seconds");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Test case to make sure that the records written in batches,
+ * possibly by a background thread, are the records written one by one.
+ */
+class BatchedWriteTestCase : public TestCase
+{
+public:
+  BatchedWriteTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+BatchedWriteTestCase::BatchedWriteTestCase ()
+  : TestCase ("Check that PcapFile writes the same records in batches")
+{
+}
+
+void
+BatchedWriteTestCase::DoRun (void)
+{
+  //
+  // Read the records of a known file
+  //
+  std::string filename = CreateDataDirFilename ("known.pcap");
+  PcapFile known;
+  known.Open (filename, std::ios::in);
+  NS_TEST_ASSERT_MSG_EQ (known.Fail (), false, "Open (" << filename << ", \"std::ios::in\") returns error");
+  std::vector<std::vector<uint8_t> > records (N_KNOWN_PACKETS);
+  for (uint32_t i = 0; i < N_KNOWN_PACKETS; ++i)
+    {
+      uint32_t tsSec, tsUsec, inclLen, origLen, readLen;
+      records[i].resize (2000);
+      known.Read (&records[i][0], records[i].size (), tsSec, tsUsec, inclLen, origLen, readLen);
+      NS_TEST_ASSERT_MSG_EQ (readLen, knownPackets[i].inclLen, "Record not read");
+      records[i].resize (readLen);
+    }
+
+  //
+  // Write them in batches of various sizes, with and without the background
+  // writer, and compare the files
+  //
+  uint32_t batchSizes[] = { 0, 1, 100, 1500, 100000 };
+  for (uint32_t j = 0; j < 2 * sizeof (batchSizes) / sizeof (batchSizes[0]); ++j)
+    {
+      uint32_t batchSize = batchSizes[j / 2];
+      bool asynchronous = j % 2;
+      std::string filename2 = CreateTempDirFilename ("batched.pcap");
+      PcapFile f;
+      f.Open (filename2, std::ios::out);
+      NS_TEST_ASSERT_MSG_EQ (f.Fail (), false, "Open (" << filename2 << ", \"std::ios::out\") returns error");
+      f.SetWriteBatching (batchSize, asynchronous);
+      f.Init (known.GetDataLinkType (), known.GetSnapLen ());
+      uint64_t size = 24;
+      for (uint32_t i = 0; i < N_KNOWN_PACKETS; ++i)
+        {
+          PacketEntry const & p = knownPackets[i];
+          f.Write (p.tsSec, p.tsUsec, &records[i][0], p.origLen);
+          size += 16 + p.inclLen;
+          if (i == N_KNOWN_PACKETS / 2)
+            {
+              f.Flush ();
+              NS_TEST_EXPECT_MSG_EQ (CheckFileLength (filename2, size), true,
+                                     "Records not flushed with batches of " << batchSize);
+            }
+        }
+      NS_TEST_EXPECT_MSG_EQ (f.Fail (), false, "Write must not fail");
+      f.Close ();
+
+      uint32_t sec (0), usec (0), packets (0);
+      bool diff = PcapFile::Diff (filename, filename2, sec, usec, packets);
+      NS_TEST_EXPECT_MSG_EQ (diff, false, "Different records written with batches of " << batchSize
+                             << (asynchronous ? " in the background" : ""));
+      NS_TEST_EXPECT_MSG_EQ (packets, N_KNOWN_PACKETS, "Records missing with batches of " << batchSize);
+      NS_TEST_EXPECT_MSG_EQ (CheckFileLength (filename2, size), true, "Bad file length");
+      remove (filename2.c_str ());
+    }
+  known.Close ();
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -1167,6 +1251,7 @@ PcapFileTestSuite::PcapFileTestSuite ()
   AddTestCase (new RecordHeaderTestCase, TestCase::QUICK);
   AddTestCase (new ReadFileTestCase, TestCase::QUICK);
   AddTestCase (new DiffTestCase, TestCase::QUICK);
+  AddTestCase (new BatchedWriteTestCase, TestCase::QUICK);
 }
 
 static PcapFileTestSuite pcapFileTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "binary-trace.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/type-id.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace ns3 {
+
+namespace {
+
+/// The magic number of a binary trace
+const char MAGIC[8] = { 'n', 's', '3', 't', 'r', 'a', 'c', 'e' };
+/// The version of the format
+const uint32_t VERSION = 1;
+/// The flag of the records with the flow columns
+const uint32_t FLOWS_FLAG = 1;
+
+/**
+ * \brief Write an integer, little-endian.
+ * \param buffer the buffer
+ * \param value the value
+ * \param size the size of the integer, in bytes
+ */
+void
+WriteLe (uint8_t *buffer, uint64_t value, uint32_t size)
+{
+  for (uint32_t i = 0; i < size; i++)
+    {
+      buffer[i] = value >> (8 * i);
+    }
+}
+
+/**
+ * \brief Read an integer, little-endian.
+ * \param buffer the buffer
+ * \param size the size of the integer, in bytes
+ * \returns the value
+ */
+uint64_t
+ReadLe (const uint8_t *buffer, uint32_t size)
+{
+  uint64_t value = 0;
+  for (uint32_t i = 0; i < size; i++)
+    {
+      value |= static_cast<uint64_t> (buffer[i]) << (8 * i);
+    }
+  return value;
+}
+
+/**
+ * \brief Find a node or device id in a trace context.
+ * \param context the context
+ * \param list the list, e.g., "/NodeList/"
+ * \returns the id following the list, BinaryTrace::UNKNOWN_ID if none
+ */
+uint32_t
+GetContextId (const std::string &context, const char *list)
+{
+  std::string::size_type pos = context.find (list);
+  if (pos == std::string::npos)
+    {
+      return BinaryTrace::UNKNOWN_ID;
+    }
+  const char *start = context.c_str () + pos + std::strlen (list);
+  char *end;
+  unsigned long id = std::strtoul (start, &end, 10);
+  return end == start ? BinaryTrace::UNKNOWN_ID : id;
+}
+
+} // anonymous namespace
+
+void
+BinaryTrace::WriteHeader (std::ostream &os, bool flows)
+{
+  uint8_t buffer[HEADER_SIZE];
+  std::memcpy (buffer, MAGIC, sizeof (MAGIC));
+  WriteLe (buffer + 8, VERSION, 4);
+  WriteLe (buffer + 12, flows ? FLOWS_FLAG : 0, 4);
+  os.write (reinterpret_cast<const char *> (buffer), HEADER_SIZE);
+}
+
+bool
+BinaryTrace::ReadHeader (std::istream &is, bool &flows)
+{
+  uint8_t buffer[HEADER_SIZE];
+  if (!is.read (reinterpret_cast<char *> (buffer), HEADER_SIZE)
+      || std::memcmp (buffer, MAGIC, sizeof (MAGIC)) != 0
+      || ReadLe (buffer + 8, 4) != VERSION)
+    {
+      return false;
+    }
+  flows = ReadLe (buffer + 12, 4) & FLOWS_FLAG;
+  return true;
+}
+
+void
+BinaryTrace::Write (std::ostream &os, const Record &record, bool flows)
+{
+  uint8_t buffer[FLOW_RECORD_SIZE];
+  std::memset (buffer, 0, sizeof (buffer));
+  WriteLe (buffer, record.time, 8);
+  WriteLe (buffer + 8, record.node, 4);
+  WriteLe (buffer + 12, record.device, 4);
+  buffer[16] = record.event;
+  WriteLe (buffer + 20, record.size, 4);
+  WriteLe (buffer + 24, record.uid, 8);
+  if (flows)
+    {
+      WriteLe (buffer + 32, record.source, 4);
+      WriteLe (buffer + 36, record.destination, 4);
+      WriteLe (buffer + 40, record.sourcePort, 2);
+      WriteLe (buffer + 42, record.destinationPort, 2);
+      buffer[44] = record.protocol;
+    }
+  os.write (reinterpret_cast<const char *> (buffer), flows ? FLOW_RECORD_SIZE : RECORD_SIZE);
+}
+
+bool
+BinaryTrace::Read (std::istream &is, Record &record, bool flows)
+{
+  uint8_t buffer[FLOW_RECORD_SIZE];
+  std::memset (buffer, 0, sizeof (buffer));
+  if (!is.read (reinterpret_cast<char *> (buffer), flows ? FLOW_RECORD_SIZE : RECORD_SIZE))
+    {
+      return false;
+    }
+  record.time = ReadLe (buffer, 8);
+  record.node = ReadLe (buffer + 8, 4);
+  record.device = ReadLe (buffer + 12, 4);
+  record.event = buffer[16];
+  record.size = ReadLe (buffer + 20, 4);
+  record.uid = ReadLe (buffer + 24, 8);
+  record.source = ReadLe (buffer + 32, 4);
+  record.destination = ReadLe (buffer + 36, 4);
+  record.sourcePort = ReadLe (buffer + 40, 2);
+  record.destinationPort = ReadLe (buffer + 42, 2);
+  record.protocol = buffer[44];
+  return true;
+}
+
+BinaryTrace::Record
+BinaryTrace::MakeRecord (Event event, const std::string &context, Ptr<const Packet> p, bool flows)
+{
+  Record record;
+  std::memset (&record, 0, sizeof (record));
+  record.time = Simulator::Now ().GetNanoSeconds ();
+  record.node = GetContextId (context, "/NodeList/");
+  record.device = GetContextId (context, "/DeviceList/");
+  record.event = event;
+  record.size = p->GetSize ();
+  record.uid = p->GetUid ();
+  if (!flows)
+    {
+      return record;
+    }
+
+  // The headers are looked up by name, as the network module does not
+  // depend on the internet module.
+  static TypeId ipv4;
+  static TypeId tcp;
+  static TypeId udp;
+  static bool found = TypeId::LookupByNameFailSafe ("ns3::Ipv4Header", &ipv4)
+    && TypeId::LookupByNameFailSafe ("ns3::TcpHeader", &tcp)
+    && TypeId::LookupByNameFailSafe ("ns3::UdpHeader", &udp);
+  if (!found)
+    {
+      return record;
+    }
+  PacketMetadata::ItemIterator it = p->BeginItem ();
+  while (it.HasNext ())
+    {
+      PacketMetadata::Item item = it.Next ();
+      if (item.type != PacketMetadata::Item::HEADER || item.isFragment || item.tid != ipv4)
+        {
+          continue;
+        }
+      Buffer::Iterator header = item.current;
+      header.Next (9);
+      record.protocol = header.ReadU8 ();
+      header.Next (2);
+      record.source = header.ReadNtohU32 ();
+      record.destination = header.ReadNtohU32 ();
+      if (it.HasNext ())
+        {
+          item = it.Next ();
+          if (item.type == PacketMetadata::Item::HEADER && !item.isFragment
+              && (item.tid == tcp || item.tid == udp))
+            {
+              Buffer::Iterator ports = item.current;
+              record.sourcePort = ports.ReadNtohU16 ();
+              record.destinationPort = ports.ReadNtohU16 ();
+            }
+        }
+      break;
+    }
+  return record;
+}
+
+} // namespace ns3
@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BINARY_TRACE_H
+#define BINARY_TRACE_H
+
+#include <iostream>
+#include <string>
+#include <stdint.h>
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+class Packet;
+
+/**
+ * \ingroup network
+ *
+ * \brief The binary format of the traces of the default ascii trace sinks.
+ *
+ * The text traces of AsciiTraceHelper print each packet, which is costly
+ * to write and to parse again.  A binary trace only keeps, for each event,
+ * a fixed-width record: it can be loaded directly as an array of records,
+ * or converted to text with the binary-trace-convert utility.
+ *
+ * A binary trace starts with a 16 bytes header:
+ *
+ * \verbatim
+   offset  size  field
+        0     8  magic, "ns3trace"
+        8     4  version, 1
+       12     4  flags, 1 if the records have the flow columns
+   \endverbatim
+ *
+ * followed by the records, of 32 bytes, or 48 bytes with the flow columns:
+ *
+ * \verbatim
+   offset  size  field
+        0     8  time, in nanoseconds (signed)
+        8     4  node id, 0xffffffff if unknown
+       12     4  device id, 0xffffffff if unknown
+       16     1  event: '+' enqueue, '-' dequeue, 'd' drop, 'r' receive
+       17     3  padding, 0
+       20     4  packet size, in bytes
+       24     8  packet uid
+       32     4  IPv4 source address
+       36     4  IPv4 destination address
+       40     2  source port
+       42     2  destination port
+       44     1  IP protocol
+       45     3  padding, 0
+   \endverbatim
+ *
+ * All the fields are little-endian.  The node and device ids are taken from
+ * the trace context, so they are only known for the sinks with a context.
+ * The flow columns are found from the packet metadata, so they are only
+ * filled when Packet::EnablePrinting or Packet::EnableChecking was called,
+ * and are 0 for the packets without an IPv4 header.
+ */
+class BinaryTrace
+{
+public:
+  /**
+   * The traced events, with the characters of the text traces.
+   */
+  enum Event
+  {
+    ENQUEUE = '+',  //!< the packet was enqueued for transmission
+    DEQUEUE = '-',  //!< the packet was dequeued for transmission
+    DROP = 'd',     //!< the packet was dropped
+    RECEIVE = 'r'   //!< the packet was received
+  };
+
+  /**
+   * A record of a binary trace.
+   */
+  struct Record
+  {
+    int64_t time;             //!< the time, in nanoseconds
+    uint32_t node;            //!< the node id
+    uint32_t device;          //!< the device id
+    uint8_t event;            //!< the event
+    uint32_t size;            //!< the packet size
+    uint64_t uid;             //!< the packet uid
+    uint32_t source;          //!< the IPv4 source address
+    uint32_t destination;     //!< the IPv4 destination address
+    uint16_t sourcePort;      //!< the source port
+    uint16_t destinationPort; //!< the destination port
+    uint8_t protocol;         //!< the IP protocol
+  };
+
+  static const uint32_t UNKNOWN_ID = 0xffffffff; //!< the node or device id of the sinks without a context
+  static const uint32_t HEADER_SIZE = 16;        //!< the size of the file header
+  static const uint32_t RECORD_SIZE = 32;        //!< the size of a record, without the flow columns
+  static const uint32_t FLOW_RECORD_SIZE = 48;   //!< the size of a record, with the flow columns
+
+  /**
+   * \brief Write the file header.
+   * \param os the output stream
+   * \param flows whether the records have the flow columns
+   */
+  static void WriteHeader (std::ostream &os, bool flows);
+  /**
+   * \brief Read the file header.
+   * \param is the input stream
+   * \param flows [out] whether the records have the flow columns
+   * \returns true if the header is the header of a binary trace
+   */
+  static bool ReadHeader (std::istream &is, bool &flows);
+  /**
+   * \brief Write a record.
+   * \param os the output stream
+   * \param record the record
+   * \param flows whether the records have the flow columns
+   */
+  static void Write (std::ostream &os, const Record &record, bool flows);
+  /**
+   * \brief Read a record.
+   * \param is the input stream
+   * \param record [out] the record
+   * \param flows whether the records have the flow columns
+   * \returns true if a whole record was read
+   */
+  static bool Read (std::istream &is, Record &record, bool flows);
+  /**
+   * \brief Build the record of a traced event.
+   * \param event the event
+   * \param context the trace context, empty if unknown
+   * \param p the packet
+   * \param flows whether to find the flow columns
+   * \returns the record, at the current simulation time
+   */
+  static Record MakeRecord (Event event, const std::string &context, Ptr<const Packet> p, bool flows);
+};
+
+} // namespace ns3
+
+#endif /* BINARY_TRACE_H */
@@ -70,6 +70,17 @@ namespace ns3 {
 class OutputStreamWrapper : public SimpleRefCount<OutputStreamWrapper>
 {
 public:
+  /**
+   * The formats of the traces written to the stream by the default trace
+   * sinks of AsciiTraceHelper.
+   */
+  enum TraceFormat
+  {
+    TEXT,              //!< text lines, with the packets printed
+    BINARY,            //!< BinaryTrace records
+    BINARY_WITH_FLOWS  //!< BinaryTrace records, with the flow columns
+  };
+
   /**
    * Constructor
    * \param filename file name
@@ -92,9 +103,22 @@ public:
    */
   std::ostream *GetStream (void);
 
+  /**
+   * Set the format of the traces written by the default trace sinks.
+   *
+   * \param format the trace format
+   */
+  void SetTraceFormat (TraceFormat format);
+
+  /**
+   * \returns the format of the traces written by the default trace sinks
+   */
+  TraceFormat GetTraceFormat (void) const;
+
 private:
   std::ostream *m_ostream; //!< The output stream
   bool m_destroyable; //!< Can be destroyed
+  TraceFormat m_traceFormat; //!< The format of the traces
 };
 
 } // namespace ns3
@@ -46,6 +46,17 @@ PcapFileWrapper::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&PcapFileWrapper::m_nanosecMode),
                    MakeBooleanChecker())
+    .AddAttribute ("WriteBatchSize",
+                   "Size in bytes of the batches in which the packets are written, "
+                   "0 means that each packet is written as it comes.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&PcapFileWrapper::m_writeBatchSize),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("AsynchronousWrite",
+                   "Whether the batches of packets are written by a background thread.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&PcapFileWrapper::m_asynchronousWrite),
+                   MakeBooleanChecker())
   ;
   return tid;
 }
@@ -89,11 +100,19 @@ PcapFileWrapper::Close (void)
   m_file.Close ();
 }
 
+void
+PcapFileWrapper::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_file.Flush ();
+}
+
 void
 PcapFileWrapper::Open (std::string const &filename, std::ios::openmode mode)
 {
   NS_LOG_FUNCTION (this << filename << mode);
   m_file.Open (filename, mode);
+  m_file.SetWriteBatching (m_writeBatchSize, m_asynchronousWrite);
 }
 
 void
@@ -82,6 +82,14 @@ public:
    */
   void Close (void);
 
+  /**
+   * Write the pending packets to the underlying pcap file.  The packets are
+   * kept in memory, if written in batches (see the WriteBatchSize and
+   * AsynchronousWrite attributes), until a batch is full or the file is
+   * flushed or closed.
+   */
+  void Flush (void);
+
   /**
    * Initialize the pcap file associated with this wrapper.  This file must have
    * been previously opened with write permissions.
@@ -224,6 +232,8 @@ private:
   PcapFile m_file; //!< Pcap file
   uint32_t m_snapLen; //!< max length of saved packets
   bool     m_nanosecMode; //!< Timestamps in nanosecond mode
+  uint32_t m_writeBatchSize; //!< size of the batches of packets written, 0 if not batched
+  bool     m_asynchronousWrite; //!< whether the batches are written by a background thread
 };
 
 } // namespace ns3
@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <cstring>
+#include <deque>
 #include "ns3/assert.h"
 #include "ns3/packet.h"
 #include "ns3/fatal-error.h"
@@ -29,6 +30,12 @@
 #include "pcap-file.h"
 #include "ns3/log.h"
 #include "ns3/build-profile.h"
+#include "ns3/core-config.h"
+#ifdef HAVE_PTHREAD_H
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 //
 // This file is used as part of the ns-3 test framework, so please refrain from 
 // adding any ns-3 specific constructs such as Packet to this file.
@@ -47,10 +54,132 @@ const uint32_t NS_SWAPPED_MAGIC = 0x4d3cb2a1; /**< Looks this way if byte swappi
 const uint16_t VERSION_MAJOR = 2;             /**< Major version of supported pcap file format */
 const uint16_t VERSION_MINOR = 4;             /**< Minor version of supported pcap file format */
 
+#ifdef HAVE_PTHREAD_H
+/**
+ * \brief Background thread writing the batches of records of a pcap file.
+ *
+ * The batches are written in order.  At most MAX_BATCHES batches wait to be
+ * written: beyond, the simulation waits for the writer.
+ */
+class PcapFileWriter
+{
+public:
+  /**
+   * Constructor.
+   * \param file the file stream, which is only used by the writer until Wait
+   */
+  PcapFileWriter (std::fstream *file);
+  /**
+   * Destructor: write the pending batches and stop the thread.
+   */
+  ~PcapFileWriter ();
+  /**
+   * \brief Give a batch to write.
+   * \param batch the batch, emptied
+   */
+  void Push (std::vector<char> &batch);
+  /**
+   * \brief Wait until all the batches are written.
+   */
+  void Wait (void);
+
+private:
+  /**
+   * \brief Write the batches, until stopped.
+   */
+  void Run (void);
+
+  static const uint32_t MAX_BATCHES = 16;   //!< maximum number of batches waiting
+  std::fstream *m_file;                     //!< the file stream
+  std::deque<std::vector<char> > m_batches; //!< the batches waiting
+  bool m_busy;                              //!< whether a batch is being written
+  bool m_stop;                              //!< whether the thread must stop
+  std::mutex m_mutex;                       //!< protects the state above
+  std::condition_variable m_cond;           //!< signals the changes of the state
+  std::thread m_thread;                     //!< the writer thread
+};
+
+PcapFileWriter::PcapFileWriter (std::fstream *file)
+  : m_file (file),
+    m_busy (false),
+    m_stop (false)
+{
+  m_thread = std::thread (&PcapFileWriter::Run, this);
+}
+
+PcapFileWriter::~PcapFileWriter ()
+{
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_stop = true;
+  }
+  m_cond.notify_all ();
+  m_thread.join ();
+}
+
+void
+PcapFileWriter::Push (std::vector<char> &batch)
+{
+  std::unique_lock<std::mutex> lock (m_mutex);
+  m_cond.wait (lock, [this] () { return m_batches.size () < MAX_BATCHES; });
+  m_batches.push_back (std::vector<char> ());
+  m_batches.back ().swap (batch);
+  m_cond.notify_all ();
+}
+
+void
+PcapFileWriter::Wait (void)
+{
+  std::unique_lock<std::mutex> lock (m_mutex);
+  m_cond.wait (lock, [this] () { return m_batches.empty () && !m_busy; });
+}
+
+void
+PcapFileWriter::Run (void)
+{
+  std::unique_lock<std::mutex> lock (m_mutex);
+  while (true)
+    {
+      m_cond.wait (lock, [this] () { return m_stop || !m_batches.empty (); });
+      if (m_batches.empty ())
+        {
+          return;
+        }
+      std::vector<char> batch;
+      batch.swap (m_batches.front ());
+      m_batches.pop_front ();
+      m_busy = true;
+      m_cond.notify_all ();
+      lock.unlock ();
+      m_file->write (&batch[0], batch.size ());
+      lock.lock ();
+      m_busy = false;
+      m_cond.notify_all ();
+    }
+}
+#else
+/**
+ * \brief Placeholder of the background writer, when threads are not
+ * available: the batches are written synchronously.
+ */
+class PcapFileWriter
+{
+public:
+  /**
+   * \brief Wait until all the batches are written.
+   */
+  void Wait (void)
+  {}
+};
+#endif
+
 PcapFile::PcapFile ()
   : m_file (),
     m_swapMode (false),
-    m_nanosecMode (false)
+    m_nanosecMode (false),
+    m_batchSize (0),
+    m_asynchronous (false),
+    m_writer (0)
 {
   NS_LOG_FUNCTION (this);
   FatalImpl::RegisterStream (&m_file); 
@@ -68,18 +197,27 @@ bool
 PcapFile::Fail (void) const
 {
   NS_LOG_FUNCTION (this);
+  if (m_writer != 0)
+    {
+      m_writer->Wait ();
+    }
   return m_file.fail ();
 }
 bool 
 PcapFile::Eof (void) const
 {
   NS_LOG_FUNCTION (this);
+  if (m_writer != 0)
+    {
+      m_writer->Wait ();
+    }
   return m_file.eof ();
 }
 void 
 PcapFile::Clear (void)
 {
   NS_LOG_FUNCTION (this);
+  Flush ();
   m_file.clear ();
 }
 
@@ -88,9 +226,98 @@ void
 PcapFile::Close (void)
 {
   NS_LOG_FUNCTION (this);
+  Flush ();
+  delete m_writer;
+  m_writer = 0;
   m_file.close ();
 }
 
+void
+PcapFile::SetWriteBatching (uint32_t batchSize, bool asynchronous)
+{
+  NS_LOG_FUNCTION (this << batchSize << asynchronous);
+  Flush ();
+  m_batchSize = batchSize;
+  m_asynchronous = asynchronous && batchSize > 0;
+}
+
+void
+PcapFile::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_batch.empty ())
+    {
+      WriteBatch ();
+    }
+  if (m_writer != 0)
+    {
+      m_writer->Wait ();
+    }
+  m_file.flush ();
+}
+
+void
+PcapFile::WriteBytes (const void *data, uint32_t size)
+{
+  if (m_batchSize == 0)
+    {
+      m_file.write (static_cast<const char *> (data), size);
+    }
+  else
+    {
+      const char *bytes = static_cast<const char *> (data);
+      m_batch.insert (m_batch.end (), bytes, bytes + size);
+    }
+}
+
+void
+PcapFile::WritePacketBytes (Ptr<const Packet> p, uint32_t size)
+{
+  if (m_batchSize == 0)
+    {
+      p->CopyData (&m_file, size);
+    }
+  else
+    {
+      uint32_t offset = m_batch.size ();
+      m_batch.resize (offset + size);
+      p->CopyData (reinterpret_cast<uint8_t *> (&m_batch[offset]), size);
+    }
+}
+
+void
+PcapFile::EndRecord (void)
+{
+  if (m_batchSize == 0)
+    {
+      NS_BUILD_DEBUG (m_file.flush ());
+    }
+  else if (m_batch.size () >= m_batchSize)
+    {
+      WriteBatch ();
+    }
+}
+
+void
+PcapFile::WriteBatch (void)
+{
+  NS_LOG_FUNCTION (this << m_batch.size ());
+#ifdef HAVE_PTHREAD_H
+  if (m_asynchronous)
+    {
+      if (m_writer == 0)
+        {
+          m_writer = new PcapFileWriter (&m_file);
+        }
+      m_writer->Push (m_batch);
+      m_batch.reserve (m_batchSize);
+      return;
+    }
+#endif
+  m_file.write (&m_batch[0], m_batch.size ());
+  m_batch.clear ();
+}
+
 uint32_t
 PcapFile::GetMagic (void)
 {
@@ -345,6 +572,7 @@ void
 PcapFile::Init (uint32_t dataLinkType, uint32_t snapLen, int32_t timeZoneCorrection, bool swapMode, bool nanosecMode)
 {
   NS_LOG_FUNCTION (this << dataLinkType << snapLen << timeZoneCorrection << swapMode);
+  Flush ();
 
   //
   // Initialize the magic number and nanosecond mode flag
@@ -403,7 +631,8 @@ uint32_t
 PcapFile::WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
 {
   NS_LOG_FUNCTION (this << tsSec << tsUsec << totalLen);
-  NS_ASSERT (m_file.good ());
+  // The file stream is used by the background writer, if any
+  NS_ASSERT (m_writer != 0 || m_file.good ());
 
   uint32_t inclLen = totalLen > m_fileHeader.m_snapLen ? m_fileHeader.m_snapLen : totalLen;
 
@@ -422,11 +651,10 @@ PcapFile::WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
   // Watch out for memory alignment differences between machines, so write
   // them all individually.
   //
-  m_file.write ((const char *)&header.m_tsSec, sizeof(header.m_tsSec));
-  m_file.write ((const char *)&header.m_tsUsec, sizeof(header.m_tsUsec));
-  m_file.write ((const char *)&header.m_inclLen, sizeof(header.m_inclLen));
-  m_file.write ((const char *)&header.m_origLen, sizeof(header.m_origLen));
-  NS_BUILD_DEBUG(m_file.flush());
+  WriteBytes (&header.m_tsSec, sizeof(header.m_tsSec));
+  WriteBytes (&header.m_tsUsec, sizeof(header.m_tsUsec));
+  WriteBytes (&header.m_inclLen, sizeof(header.m_inclLen));
+  WriteBytes (&header.m_origLen, sizeof(header.m_origLen));
   return inclLen;
 }
 
@@ -435,8 +663,8 @@ PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, uint8_t const * const data, ui
 {
   NS_LOG_FUNCTION (this << tsSec << tsUsec << &data << totalLen);
   uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, totalLen);
-  m_file.write ((const char *)data, inclLen);
-  NS_BUILD_DEBUG(m_file.flush());
+  WriteBytes (data, inclLen);
+  EndRecord ();
 }
 
 void 
@@ -444,8 +672,8 @@ PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this << tsSec << tsUsec << p);
   uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, p->GetSize ());
-  p->CopyData (&m_file, inclLen);
-  NS_BUILD_DEBUG(m_file.flush());
+  WritePacketBytes (p, inclLen);
+  EndRecord ();
 }
 
 void 
@@ -460,9 +688,10 @@ PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, const Header &header, Ptr<cons
   headerBuffer.AddAtStart (headerSize);
   header.Serialize (headerBuffer.Begin ());
   uint32_t toCopy = std::min (headerSize, inclLen);
-  headerBuffer.CopyData (&m_file, toCopy);
+  WriteBytes (headerBuffer.PeekData (), toCopy);
   inclLen -= toCopy;
-  p->CopyData (&m_file, inclLen);
+  WritePacketBytes (p, inclLen);
+  EndRecord ();
 }
 
 void
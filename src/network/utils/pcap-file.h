@@ -23,6 +23,7 @@
 
 #include <string>
 #include <fstream>
+#include <vector>
 #include <stdint.h>
 #include "ns3/ptr.h"
 
@@ -30,6 +31,7 @@ namespace ns3 {
 
 class Packet;
 class Header;
+class PcapFileWriter;
 
 
 /**
@@ -154,6 +156,25 @@ public:
   void Write (uint32_t tsSec, uint32_t tsUsec, const Header &header, Ptr<const Packet> p);
 
 
+  /**
+   * \brief Write the next records in batches.
+   *
+   * The records are accumulated in memory, and written to the file when
+   * they reach the batch size, rather than one by one.  In asynchronous
+   * mode, the batches are written by a background thread while the
+   * simulation goes on.  The pending records are written when the file
+   * is flushed or closed.
+   *
+   * \param batchSize The batch size in bytes, 0 to write the records one by one
+   * \param asynchronous Whether the batches are written by a background thread
+   */
+  void SetWriteBatching (uint32_t batchSize, bool asynchronous);
+
+  /**
+   * \brief Write the pending records to the file.
+   */
+  void Flush (void);
+
   /**
    * \brief Read next packet from file
    * 
@@ -366,11 +387,36 @@ private:
    */
   void ReadAndVerifyFileHeader (void);
 
+  /**
+   * \brief Write bytes of a record, in the file or in the current batch
+   * \param data the bytes
+   * \param size the number of bytes
+   */
+  void WriteBytes (const void *data, uint32_t size);
+  /**
+   * \brief Write the bytes of a packet, in the file or in the current batch
+   * \param p the packet
+   * \param size the number of bytes to write
+   */
+  void WritePacketBytes (Ptr<const Packet> p, uint32_t size);
+  /**
+   * \brief End a record, and write the current batch if it is full
+   */
+  void EndRecord (void);
+  /**
+   * \brief Write the current batch, or give it to the background writer
+   */
+  void WriteBatch (void);
+
   std::string    m_filename;    //!< file name
   std::fstream   m_file;        //!< file stream
   PcapFileHeader m_fileHeader;  //!< file header
   bool m_swapMode;              //!< swap mode
   bool m_nanosecMode;           //!< nanosecond timestamp mode
+  uint32_t m_batchSize;         //!< size of the batches of records, 0 if not batched
+  bool m_asynchronous;          //!< whether the batches are written by a background thread
+  std::vector<char> m_batch;    //!< current batch of records
+  PcapFileWriter *m_writer;     //!< background writer, or 0
 };
 
 } // namespace ns3
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "super-segment-tag.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SuperSegmentTag");
+
+NS_OBJECT_ENSURE_REGISTERED (SuperSegmentTag);
+
+TypeId
+SuperSegmentTag::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SuperSegmentTag")
+    .SetParent<Tag> ()
+    .SetGroupName ("Network")
+    .AddConstructor<SuperSegmentTag> ()
+  ;
+  return tid;
+}
+
+TypeId
+SuperSegmentTag::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+uint32_t
+SuperSegmentTag::GetSerializedSize (void) const
+{
+  return 6;
+}
+
+void
+SuperSegmentTag::Serialize (TagBuffer buf) const
+{
+  buf.WriteU16 (m_segments);
+  buf.WriteU32 (m_payloadSize);
+}
+
+void
+SuperSegmentTag::Deserialize (TagBuffer buf)
+{
+  m_segments = buf.ReadU16 ();
+  m_payloadSize = buf.ReadU32 ();
+}
+
+void
+SuperSegmentTag::Print (std::ostream &os) const
+{
+  os << "Segments=" << m_segments << " PayloadSize=" << m_payloadSize;
+}
+
+SuperSegmentTag::SuperSegmentTag ()
+  : Tag (),
+    m_segments (1),
+    m_payloadSize (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SuperSegmentTag::SuperSegmentTag (uint16_t segments, uint32_t payloadSize)
+  : Tag (),
+    m_segments (segments),
+    m_payloadSize (payloadSize)
+{
+  NS_LOG_FUNCTION (this << segments << payloadSize);
+  NS_ASSERT (segments > 0);
+}
+
+uint16_t
+SuperSegmentTag::GetSegments (void) const
+{
+  return m_segments;
+}
+
+uint32_t
+SuperSegmentTag::GetPayloadSize (void) const
+{
+  return m_payloadSize;
+}
+
+uint32_t
+SuperSegmentTag::GetWireSize (uint32_t size) const
+{
+  NS_ASSERT_MSG (size >= m_payloadSize, "Packet smaller than its payload");
+  return size + (m_segments - 1) * (size - m_payloadSize);
+}
+
+} // namespace ns3
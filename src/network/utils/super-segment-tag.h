@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SUPER_SEGMENT_TAG_H
+#define SUPER_SEGMENT_TAG_H
+
+#include "ns3/tag.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup network
+ *
+ * \brief Mark a packet as a super-segment, that is a packet which stands
+ * for a train of segments on the wire.
+ *
+ * A transport protocol doing segmentation offload hands down a single
+ * packet carrying the payload of several segments, with the headers of
+ * the first one only.  The devices which support it (see
+ * NetDevice::SupportsSuperSegments) transmit it as one packet, but for the
+ * time the train of segments, each with its own copy of the headers,
+ * would take on the wire, and the network layers do not fragment it.  The
+ * network layers split it into its segments before handing it down to
+ * the other devices.
+ */
+class SuperSegmentTag : public Tag
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (TagBuffer buf) const;
+  virtual void Deserialize (TagBuffer buf);
+  virtual void Print (std::ostream &os) const;
+  SuperSegmentTag ();
+
+  /**
+   * Constructs a SuperSegmentTag.
+   *
+   * \param segments the number of segments of the train
+   * \param payloadSize the total size of the payload of the segments
+   */
+  SuperSegmentTag (uint16_t segments, uint32_t payloadSize);
+  /**
+   * \returns the number of segments of the train
+   */
+  uint16_t GetSegments (void) const;
+  /**
+   * \returns the total size of the payload of the segments
+   */
+  uint32_t GetPayloadSize (void) const;
+  /**
+   * Get the size of the train on the wire: each segment after the first
+   * one repeats the headers of the packet.
+   *
+   * \param size the size of the packet, with all its headers
+   * \returns the total size of the segments
+   */
+  uint32_t GetWireSize (uint32_t size) const;
+
+private:
+  uint16_t m_segments;     //!< Number of segments
+  uint32_t m_payloadSize;  //!< Size of the payload of all the segments
+};
+
+} // namespace ns3
+
+#endif /* SUPER_SEGMENT_TAG_H */
@@ -20,11 +20,16 @@
 
 #include <queue>
 #include <iomanip>
+#include <algorithm>
 
 #include "ns3/log.h"
 #include "ns3/abort.h"
 #include "ns3/names.h"
+#include "ns3/global-value.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
 #include "ns3/ipv4-list-routing.h"
+#include "ns3/ipv4-l3-protocol.h"
 #include "ns3/loopback-net-device.h"
 
 #include "ipv4-nix-vector-routing.h"
@@ -35,7 +40,34 @@ NS_LOG_COMPONENT_DEFINE ("Ipv4NixVectorRouting");
 
 NS_OBJECT_ENSURE_REGISTERED (Ipv4NixVectorRouting);
 
+/**
+ * \ingroup nix-vector-routing
+ * Whether the routes are computed at once for all the nodes, in a next-hop
+ * table shared by all of them.
+ */
+static GlobalValue g_nixGlobalTable ("NixVectorRoutingGlobalTable",
+                                     "Compute the next hops from every node to every "
+                                     "destination once, in a table shared by all the "
+                                     "nix-vector routing protocols created afterwards, "
+                                     "instead of searching the path on every cache miss",
+                                     BooleanValue (false),
+                                     MakeBooleanChecker ());
+
+/**
+ * \ingroup nix-vector-routing
+ * The number of threads computing the next-hop table.
+ */
+static GlobalValue g_nixThreads ("NixVectorRoutingThreads",
+                                 "The number of threads computing the next-hop table "
+                                 "of NixVectorRoutingGlobalTable, 0 for the number of "
+                                 "hardware threads",
+                                 UintegerValue (1),
+                                 MakeUintegerChecker<uint32_t> ());
+
 bool Ipv4NixVectorRouting::g_isCacheDirty = false;
+NixVectorTable Ipv4NixVectorRouting::g_nixTable;
+uint32_t Ipv4NixVectorRouting::g_nixTableUsers = 0;
+bool Ipv4NixVectorRouting::g_isNixTableStale = false;
 Ipv4NixVectorRouting::Ipv4AddressToNodeMap Ipv4NixVectorRouting::g_ipv4AddressToNodeMap;
 
 TypeId 
@@ -53,6 +85,14 @@ Ipv4NixVectorRouting::Ipv4NixVectorRouting ()
   : m_totalNeighbors (0)
 {
   NS_LOG_FUNCTION_NOARGS ();
+
+  BooleanValue useGlobalTable;
+  g_nixGlobalTable.GetValue (useGlobalTable);
+  m_useGlobalTable = useGlobalTable.Get ();
+  if (m_useGlobalTable)
+    {
+      g_nixTableUsers++;
+    }
 }
 
 Ipv4NixVectorRouting::~Ipv4NixVectorRouting ()
@@ -77,6 +117,15 @@ Ipv4NixVectorRouting::DoDispose ()
 
   m_node = 0;
   m_ipv4 = 0;
+  if (m_useGlobalTable)
+    {
+      // the table is shared by all the users, the last one clears it
+      NS_ASSERT (g_nixTableUsers > 0);
+      if (--g_nixTableUsers == 0)
+        {
+          g_nixTable.Clear ();
+        }
+    }
 
   Ipv4RoutingProtocol::DoDispose ();
 }
@@ -111,6 +160,33 @@ Ipv4NixVectorRouting::FlushGlobalNixRoutingCache (void) const
   // IPv4 address to node mapping is potentially invalid so clear it.
   // Will be repopulated in lazy evaluation when mapping is needed.
   g_ipv4AddressToNodeMap.clear ();
+
+  // The next-hop table is updated lazily too, for the affected
+  // destinations only.
+  g_isNixTableStale = true;
+}
+
+uint32_t
+Ipv4NixVectorRouting::UpdateGlobalNixTable (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  if (!m_useGlobalTable)
+    {
+      return 0;
+    }
+
+  NixVectorTable::Neighbors neighbors;
+  NixVectorTable::Neighbors links;
+  GetTopology (neighbors, links);
+
+  UintegerValue nThreads;
+  g_nixThreads.GetValue (nThreads);
+  g_isNixTableStale = false;
+  uint32_t computed = g_nixTable.Update (neighbors, links, nThreads.Get ());
+  NS_LOG_LOGIC ("Computed the next hops to " << computed << " destinations, table of "
+                << g_nixTable.GetMemoryUsage () << " bytes");
+  return computed;
 }
 
 void
@@ -125,6 +201,11 @@ Ipv4NixVectorRouting::FlushIpv4RouteCache (void) const
 {
   NS_LOG_FUNCTION_NOARGS ();
   m_ipv4RouteCache.clear ();
+  Ptr<Ipv4L3Protocol> ipv4 = DynamicCast<Ipv4L3Protocol> (m_ipv4);
+  if (ipv4 != 0)
+    {
+      ipv4->FlushFlowCache ();
+    }
 }
 
 Ptr<NixVector>
@@ -172,6 +253,124 @@ Ipv4NixVectorRouting::GetNixVector (Ptr<Node> source, Ipv4Address dest, Ptr<NetD
     }
 }
 
+Ptr<NixVector>
+Ipv4NixVectorRouting::GetNixVectorInTable (Ptr<Node> source, Ipv4Address dest)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  Ptr<Node> destNode = GetNodeByIp (dest);
+  if (destNode == 0)
+    {
+      NS_LOG_ERROR ("No routing path exists");
+      return 0;
+    }
+  if (source == destNode)
+    {
+      NS_LOG_DEBUG ("Do not process packets to self");
+      return 0;
+    }
+
+  if (g_isNixTableStale || g_nixTable.GetNNodes () != NodeList::GetNNodes ())
+    {
+      UpdateGlobalNixTable ();
+    }
+
+  // Follow the next hops, and add them to the nix-vector from the
+  // destination back to the source, as BuildNixVector does
+  std::vector<std::pair<uint32_t, uint32_t> > hops;
+  uint32_t node = source->GetId ();
+  while (node != destNode->GetId ())
+    {
+      uint32_t index;
+      uint32_t next;
+      if (!g_nixTable.GetNextHop (node, destNode->GetId (), index, next))
+        {
+          NS_LOG_ERROR ("No routing path exists");
+          return 0;
+        }
+      hops.push_back (std::make_pair (index, g_nixTable.GetNNeighbors (node)));
+      node = next;
+    }
+
+  Ptr<NixVector> nixVector = Create<NixVector> ();
+  for (std::vector<std::pair<uint32_t, uint32_t> >::reverse_iterator it = hops.rbegin (); it != hops.rend (); it++)
+    {
+      nixVector->AddNeighborIndex (it->first, nixVector->BitCount (it->second));
+    }
+  return nixVector;
+}
+
+void
+Ipv4NixVectorRouting::GetTopology (NixVectorTable::Neighbors &neighbors, NixVectorTable::Neighbors &links)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  neighbors.assign (NodeList::GetNNodes (), std::vector<uint32_t> ());
+  links.assign (NodeList::GetNNodes (), std::vector<uint32_t> ());
+  for (NodeList::Iterator it = NodeList::Begin (); it != NodeList::End (); ++it)
+    {
+      Ptr<Node> node = *it;
+      Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+      std::vector<uint32_t> &nodeNeighbors = neighbors[node->GetId ()];
+      std::vector<uint32_t> &nodeLinks = links[node->GetId ()];
+
+      for (uint32_t i = 0; i < node->GetNDevices (); i++)
+        {
+          Ptr<NetDevice> localNetDevice = node->GetDevice (i);
+          Ptr<Channel> channel = localNetDevice->GetChannel ();
+          if (channel == 0)
+            {
+              continue;
+            }
+          NetDeviceContainer netDeviceContainer;
+          GetAdjacentNetDevices (localNetDevice, channel, netDeviceContainer);
+
+          // the neighbor indexes, as in BuildNixVector
+          if (!localNetDevice->IsBridge ())
+            {
+              for (NetDeviceContainer::Iterator iter = netDeviceContainer.Begin (); iter != netDeviceContainer.End (); iter++)
+                {
+                  nodeNeighbors.push_back ((*iter)->GetNode ()->GetId ());
+                }
+            }
+
+          // the devices the BFS goes through
+          if (ipv4)
+            {
+              int32_t interfaceIndex = ipv4->GetInterfaceForDevice (localNetDevice);
+              if (interfaceIndex == -1 || !ipv4->IsUp (interfaceIndex))
+                {
+                  continue;
+                }
+            }
+          if (!localNetDevice->IsLinkUp ())
+            {
+              continue;
+            }
+          for (NetDeviceContainer::Iterator iter = netDeviceContainer.Begin (); iter != netDeviceContainer.End (); iter++)
+            {
+              nodeLinks.push_back ((*iter)->GetNode ()->GetId ());
+            }
+        }
+
+      // Only keep the links to the nodes a nix-vector can lead to
+      std::vector<uint32_t> sorted = nodeNeighbors;
+      std::sort (sorted.begin (), sorted.end ());
+      std::sort (nodeLinks.begin (), nodeLinks.end ());
+      nodeLinks.erase (std::unique (nodeLinks.begin (), nodeLinks.end ()), nodeLinks.end ());
+      std::vector<uint32_t> valid;
+      for (uint32_t i = 0; i < nodeLinks.size (); i++)
+        {
+          if (nodeLinks[i] != node->GetId ()
+              && std::binary_search (sorted.begin (), sorted.end (), nodeLinks[i]))
+            {
+              valid.push_back (nodeLinks[i]);
+            }
+        }
+      nodeLinks.swap (valid);
+    }
+}
+
 Ptr<NixVector>
 Ipv4NixVectorRouting::GetNixVectorInCache (Ipv4Address address)
 {
@@ -543,19 +742,28 @@ Ipv4NixVectorRouting::RouteOutput (Ptr<Packet> p, const Ipv4Header &header, Ptr<
   CheckCacheStateAndFlush ();
 
   NS_LOG_DEBUG ("Dest IP from header: " << header.GetDestination ());
-  // check if cache
-  nixVectorInCache = GetNixVectorInCache (header.GetDestination ());
-
-  // not in cache
-  if (!nixVectorInCache)
+  if (m_useGlobalTable && !oif)
     {
-      NS_LOG_LOGIC ("Nix-vector not in cache, build: ");
-      // Build the nix-vector, given this node and the
-      // dest IP address
-      nixVectorInCache = GetNixVector (m_node, header.GetDestination (), oif);
+      // the shared next-hop table replaces the cache, unless
+      // a specific output interface is given
+      nixVectorInCache = GetNixVectorInTable (m_node, header.GetDestination ());
+    }
+  else
+    {
+      // check if cache
+      nixVectorInCache = GetNixVectorInCache (header.GetDestination ());
 
-      // cache it
-      m_nixCache.insert (NixMap_t::value_type (header.GetDestination (), nixVectorInCache));
+      // not in cache
+      if (!nixVectorInCache)
+        {
+          NS_LOG_LOGIC ("Nix-vector not in cache, build: ");
+          // Build the nix-vector, given this node and the
+          // dest IP address
+          nixVectorInCache = GetNixVector (m_node, header.GetDestination (), oif);
+
+          // cache it
+          m_nixCache.insert (NixMap_t::value_type (header.GetDestination (), nixVectorInCache));
+        }
     }
 
   // path exists
@@ -30,10 +30,13 @@
 #include "ns3/nix-vector.h"
 #include "ns3/bridge-net-device.h"
 #include "ns3/nstime.h"
+#include "nix-vector-table.h"
 
 #include <map>
 #include <unordered_map>
 
+class NixVectorRoutingTableTestCase;
+
 namespace ns3 {
 
 /**
@@ -60,6 +63,9 @@ typedef std::map<Ipv4Address, Ptr<Ipv4Route> > Ipv4RouteMap_t;
  */
 class Ipv4NixVectorRouting : public Ipv4RoutingProtocol
 {
+  /// allow NixVectorRoutingTableTestCase to compare the nix-vectors
+  friend class ::NixVectorRoutingTableTestCase;
+
 public:
   Ipv4NixVectorRouting ();
   ~Ipv4NixVectorRouting ();
@@ -89,6 +95,23 @@ public:
    */
   void FlushGlobalNixRoutingCache (void) const;
 
+  /**
+   * @brief Bring the next-hop table shared by all the nodes up to date
+   * with the topology, when the NixVectorRoutingGlobalTable global value
+   * is set.
+   *
+   * Only the destinations whose routes may be affected by the links which
+   * went up or down since the last update are computed again; the whole
+   * table is computed if it is empty, or if nodes, devices or channels
+   * were added.  This is done lazily after a call to
+   * FlushGlobalNixRoutingCache, and can be called directly after a
+   * topology change which is not notified to the routing protocols, such
+   * as a link going down.
+   *
+   * \returns the number of destinations computed
+   */
+  uint32_t UpdateGlobalNixTable (void);
+
 private:
 
   /**
@@ -99,7 +122,8 @@ private:
 
   /**
    * Flushes the cache which stores the Ipv4 route
-   * based on the destination IP
+   * based on the destination IP, and the routes cached
+   * by IPv4 for the forwarded flows
    */
   void FlushIpv4RouteCache (void) const;
 
@@ -122,6 +146,26 @@ private:
    */
   Ptr<NixVector> GetNixVector (Ptr<Node> source, Ipv4Address dest, Ptr<NetDevice> oif);
 
+  /**
+   * Build the nix-vector from a node to a destination from the next-hop
+   * table shared by all the nodes.
+   *
+   * \param source Source node
+   * \param dest Destination node address
+   * \returns The NixVector to be used in routing.
+   */
+  Ptr<NixVector> GetNixVectorInTable (Ptr<Node> source, Ipv4Address dest);
+
+  /**
+   * Extract the graph of all the nodes for the next-hop table.
+   *
+   * \param [out] neighbors the neighbors of each node, in the order of
+   *        their neighbor index
+   * \param [out] links the neighbors each node can send to, through the
+   *        devices and interfaces which are up
+   */
+  void GetTopology (NixVectorTable::Neighbors &neighbors, NixVectorTable::Neighbors &links);
+
   /**
    * Checks the cache based on dest IP for the nix-vector
    * \param address Address to check
@@ -239,6 +283,24 @@ private:
    */
   static bool g_isCacheDirty;
 
+  /**
+   * Next hops from every node to every destination, shared by all the
+   * nodes when the NixVectorRoutingGlobalTable global value is set.
+   */
+  static NixVectorTable g_nixTable;
+
+  /**
+   * Number of routing protocols using the next-hop table, which is
+   * cleared when the last one is disposed of.
+   */
+  static uint32_t g_nixTableUsers;
+
+  /** Flag to mark when the next-hop table must be updated */
+  static bool g_isNixTableStale;
+
+  /** Whether the next-hop table shared by all the nodes is used */
+  bool m_useGlobalTable;
+
   /** Cache stores nix-vectors based on destination ip */
   mutable NixMap_t m_nixCache;
 
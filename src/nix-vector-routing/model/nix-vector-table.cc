@@ -0,0 +1,325 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "nix-vector-table.h"
+#include "ns3/assert.h"
+#include "ns3/core-config.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <map>
+#ifdef HAVE_PTHREAD_H
+#include <atomic>
+#include <thread>
+#endif
+
+namespace ns3 {
+
+NixVectorTable::NixVectorTable ()
+  : m_rowWords (0)
+{}
+
+void
+NixVectorTable::Clear (void)
+{
+  m_neighbors.clear ();
+  m_links.clear ();
+  m_offsets.clear ();
+  m_widths.clear ();
+  m_rowWords = 0;
+  m_entries.clear ();
+}
+
+void
+NixVectorTable::Build (const Neighbors &neighbors, const Neighbors &links, uint32_t nThreads)
+{
+  NS_ASSERT (neighbors.size () == links.size ());
+  uint32_t nNodes = neighbors.size ();
+  m_neighbors = neighbors;
+  m_links = links;
+  m_offsets.resize (nNodes);
+  m_widths.resize (nNodes);
+  uint64_t offset = 0;
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      // The entries go from 0 (unreachable) to the number of neighbors
+      uint8_t width = 1;
+      while (width < 32 && (static_cast<uint64_t> (1) << width) <= neighbors[i].size ())
+        {
+          width++;
+        }
+      m_offsets[i] = offset;
+      m_widths[i] = width;
+      offset += width;
+    }
+  m_rowWords = (offset + 31) / 32;
+  m_entries.assign (static_cast<uint64_t> (nNodes) * m_rowWords, 0);
+
+  std::vector<uint32_t> dests (nNodes);
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      dests[i] = i;
+    }
+  Compute (dests, nThreads);
+}
+
+uint32_t
+NixVectorTable::Update (const Neighbors &neighbors, const Neighbors &links, uint32_t nThreads)
+{
+  if (m_entries.empty () || neighbors != m_neighbors)
+    {
+      Build (neighbors, links, nThreads);
+      return neighbors.size ();
+    }
+  NS_ASSERT (links.size () == m_links.size ());
+
+  typedef std::vector<std::pair<uint32_t, uint32_t> > LinkList;
+  LinkList removed;
+  LinkList added;
+  for (uint32_t i = 0; i < links.size (); i++)
+    {
+      if (links[i] == m_links[i])
+        {
+          continue;
+        }
+      std::vector<uint32_t> before = m_links[i];
+      std::vector<uint32_t> after = links[i];
+      std::sort (before.begin (), before.end ());
+      std::sort (after.begin (), after.end ());
+      std::vector<uint32_t> diff;
+      std::set_difference (before.begin (), before.end (), after.begin (), after.end (),
+                           std::back_inserter (diff));
+      for (uint32_t j = 0; j < diff.size (); j++)
+        {
+          removed.push_back (std::make_pair (i, diff[j]));
+        }
+      diff.clear ();
+      std::set_difference (after.begin (), after.end (), before.begin (), before.end (),
+                           std::back_inserter (diff));
+      for (uint32_t j = 0; j < diff.size (); j++)
+        {
+          added.push_back (std::make_pair (i, diff[j]));
+        }
+    }
+
+  // A search from a destination only changes if a removed link was in its
+  // tree, or if an added link leads to a node at most as far from the
+  // destination as the next hop of the node the link starts from.
+  const uint32_t unreachable = std::numeric_limits<uint32_t>::max ();
+  std::vector<uint32_t> dests;
+  for (uint32_t dest = 0; dest < m_neighbors.size (); dest++)
+    {
+      bool affected = false;
+      for (LinkList::const_iterator it = removed.begin (); !affected && it != removed.end (); it++)
+        {
+          uint32_t index;
+          uint32_t next;
+          affected = it->first != dest && GetNextHop (it->first, dest, index, next)
+            && next == it->second;
+        }
+      for (LinkList::const_iterator it = added.begin (); !affected && it != added.end (); it++)
+        {
+          if (it->first == dest)
+            {
+              continue;
+            }
+          uint32_t from = GetDistance (it->first, dest);
+          uint32_t to = GetDistance (it->second, dest);
+          affected = to != unreachable && (from == unreachable || to + 1 <= from);
+        }
+      if (affected)
+        {
+          dests.push_back (dest);
+        }
+    }
+
+  m_links = links;
+  Compute (dests, nThreads);
+  return dests.size ();
+}
+
+uint32_t
+NixVectorTable::GetNNodes (void) const
+{
+  return m_entries.empty () ? 0 : m_neighbors.size ();
+}
+
+uint32_t
+NixVectorTable::GetNNeighbors (uint32_t node) const
+{
+  return m_neighbors.at (node).size ();
+}
+
+bool
+NixVectorTable::GetNextHop (uint32_t source, uint32_t dest, uint32_t &index, uint32_t &next) const
+{
+  NS_ASSERT (source != dest);
+  uint32_t entry = GetEntry (source, dest);
+  if (entry == 0)
+    {
+      return false;
+    }
+  index = entry - 1;
+  next = m_neighbors[source][index];
+  return true;
+}
+
+uint64_t
+NixVectorTable::GetMemoryUsage (void) const
+{
+  return m_entries.size () * sizeof (uint32_t);
+}
+
+void
+NixVectorTable::Compute (uint32_t dest, const Reverse &reverse,
+                         std::vector<uint32_t> &queue, std::vector<bool> &visited)
+{
+  std::fill (m_entries.begin () + static_cast<uint64_t> (dest) * m_rowWords,
+             m_entries.begin () + static_cast<uint64_t> (dest + 1) * m_rowWords, 0);
+  visited.assign (m_neighbors.size (), false);
+  queue.clear ();
+  queue.push_back (dest);
+  visited[dest] = true;
+  for (uint32_t i = 0; i < queue.size (); i++)
+    {
+      const std::vector<std::pair<uint32_t, uint32_t> > &senders = reverse[queue[i]];
+      for (uint32_t j = 0; j < senders.size (); j++)
+        {
+          uint32_t node = senders[j].first;
+          if (!visited[node])
+            {
+              visited[node] = true;
+              SetEntry (node, dest, senders[j].second + 1);
+              queue.push_back (node);
+            }
+        }
+    }
+}
+
+void
+NixVectorTable::Compute (const std::vector<uint32_t> &dests, uint32_t nThreads)
+{
+  // Reverse the links, with the neighbor index of the last occurrence of
+  // each neighbor, as nix-vectors are built.
+  Reverse reverse (m_neighbors.size ());
+  for (uint32_t i = 0; i < m_links.size (); i++)
+    {
+      std::map<uint32_t, uint32_t> indexes;
+      for (uint32_t j = 0; j < m_neighbors[i].size (); j++)
+        {
+          indexes[m_neighbors[i][j]] = j;
+        }
+      for (uint32_t j = 0; j < m_links[i].size (); j++)
+        {
+          std::map<uint32_t, uint32_t>::const_iterator it = indexes.find (m_links[i][j]);
+          NS_ASSERT_MSG (it != indexes.end (), "Link to node " << m_links[i][j]
+                         << " which is not a neighbor of node " << i);
+          reverse[it->first].push_back (std::make_pair (i, it->second));
+        }
+    }
+
+#ifdef HAVE_PTHREAD_H
+  if (nThreads == 0)
+    {
+      nThreads = std::max (std::thread::hardware_concurrency (), 1u);
+    }
+#else
+  nThreads = 1;
+#endif
+  nThreads = std::min<uint32_t> (nThreads, dests.size ());
+
+  if (nThreads <= 1)
+    {
+      std::vector<uint32_t> queue;
+      std::vector<bool> visited;
+      for (uint32_t i = 0; i < dests.size (); i++)
+        {
+          Compute (dests[i], reverse, queue, visited);
+        }
+      return;
+    }
+
+#ifdef HAVE_PTHREAD_H
+  // The rows are word aligned, so that each thread writes its own words
+  std::atomic<uint32_t> next (0);
+  auto work = [this, &dests, &reverse, &next] ()
+    {
+      std::vector<uint32_t> queue;
+      std::vector<bool> visited;
+      for (uint32_t i = next++; i < dests.size (); i = next++)
+        {
+          Compute (dests[i], reverse, queue, visited);
+        }
+    };
+  std::vector<std::thread> threadList;
+  for (uint32_t i = 1; i < nThreads; i++)
+    {
+      threadList.push_back (std::thread (work));
+    }
+  work ();
+  for (uint32_t i = 0; i < threadList.size (); i++)
+    {
+      threadList[i].join ();
+    }
+#endif
+}
+
+uint32_t
+NixVectorTable::GetDistance (uint32_t source, uint32_t dest) const
+{
+  uint32_t distance = 0;
+  while (source != dest)
+    {
+      uint32_t index;
+      if (!GetNextHop (source, dest, index, source))
+        {
+          return std::numeric_limits<uint32_t>::max ();
+        }
+      distance++;
+      NS_ASSERT (distance < m_neighbors.size ());
+    }
+  return distance;
+}
+
+uint32_t
+NixVectorTable::GetEntry (uint32_t source, uint32_t dest) const
+{
+  uint64_t bit = static_cast<uint64_t> (dest) * m_rowWords * 32 + m_offsets[source];
+  uint64_t word = m_entries[bit / 32];
+  if (bit % 32 + m_widths[source] > 32)
+    {
+      word |= static_cast<uint64_t> (m_entries[bit / 32 + 1]) << 32;
+    }
+  return (word >> (bit % 32)) & ((static_cast<uint64_t> (1) << m_widths[source]) - 1);
+}
+
+void
+NixVectorTable::SetEntry (uint32_t source, uint32_t dest, uint32_t entry)
+{
+  uint64_t bit = static_cast<uint64_t> (dest) * m_rowWords * 32 + m_offsets[source];
+  uint64_t mask = ((static_cast<uint64_t> (1) << m_widths[source]) - 1) << (bit % 32);
+  uint64_t value = static_cast<uint64_t> (entry) << (bit % 32);
+  m_entries[bit / 32] = (m_entries[bit / 32] & ~mask) | value;
+  if (bit % 32 + m_widths[source] > 32)
+    {
+      m_entries[bit / 32 + 1] = (m_entries[bit / 32 + 1] & ~(mask >> 32)) | (value >> 32);
+    }
+}
+
+} // namespace ns3
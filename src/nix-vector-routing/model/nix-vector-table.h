@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NIX_VECTOR_TABLE_H
+#define NIX_VECTOR_TABLE_H
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup nix-vector-routing
+ *
+ * \brief The next hops from every node to every destination, shared by
+ * all the nix-vector routing protocols.
+ *
+ * The table is computed from a graph of node indexes, extracted from the
+ * simulation beforehand, with one breadth-first search rooted at each
+ * destination.  The searches do not touch any ns-3 object, so that they
+ * can run in several threads.
+ *
+ * Each entry holds the neighbor index (as encoded in a nix-vector) of the
+ * next hop, plus one, and zero when the destination is unreachable.  The
+ * entries of a node use just the bits needed by its number of neighbors,
+ * and the entries of a destination are packed in a row of words.
+ *
+ * When only the links which are up change, Update recomputes only the
+ * destinations whose shortest path tree may be different, and gives the
+ * same table as a full computation.
+ */
+class NixVectorTable
+{
+public:
+  /// The neighbors of each node, as node indexes
+  typedef std::vector<std::vector<uint32_t> > Neighbors;
+
+  NixVectorTable ();
+
+  /**
+   * Remove all the entries.
+   */
+  void Clear (void);
+  /**
+   * Compute the entries of all the destinations.
+   *
+   * \param neighbors the neighbors of each node, in the order of their
+   *        neighbor index
+   * \param links the neighbors each node can currently send to, a subset
+   *        of its neighbors
+   * \param nThreads the number of threads, 0 for the number of hardware
+   *        threads
+   */
+  void Build (const Neighbors &neighbors, const Neighbors &links, uint32_t nThreads);
+  /**
+   * Recompute the destinations affected by a change of the links.  The
+   * whole table is computed if it is empty or if the neighbors changed.
+   *
+   * \param neighbors the neighbors of each node
+   * \param links the neighbors each node can currently send to
+   * \param nThreads the number of threads, 0 for the number of hardware
+   *        threads
+   * \returns the number of destinations computed
+   */
+  uint32_t Update (const Neighbors &neighbors, const Neighbors &links, uint32_t nThreads);
+  /**
+   * \returns the number of nodes of the table, 0 if it is empty
+   */
+  uint32_t GetNNodes (void) const;
+  /**
+   * \param node the node index
+   * \returns the number of neighbors of the node
+   */
+  uint32_t GetNNeighbors (uint32_t node) const;
+  /**
+   * Find the next hop from a node to a destination.
+   *
+   * \param [in] source the node index
+   * \param [in] dest the destination index, different from source
+   * \param [out] index the neighbor index of the next hop
+   * \param [out] next the node index of the next hop
+   * \returns false if the destination is unreachable
+   */
+  bool GetNextHop (uint32_t source, uint32_t dest, uint32_t &index, uint32_t &next) const;
+  /**
+   * \returns the size of the entries, in bytes
+   */
+  uint64_t GetMemoryUsage (void) const;
+
+private:
+  /// The nodes which can send to each node, with the neighbor index of the node
+  typedef std::vector<std::vector<std::pair<uint32_t, uint32_t> > > Reverse;
+
+  /**
+   * Compute the entries of a destination.
+   *
+   * \param dest the destination index
+   * \param reverse the nodes which can send to each node
+   * \param queue the search queue, as scratch space
+   * \param visited the nodes already visited, as scratch space
+   */
+  void Compute (uint32_t dest, const Reverse &reverse,
+                std::vector<uint32_t> &queue, std::vector<bool> &visited);
+  /**
+   * Compute the entries of some destinations.
+   *
+   * \param dests the destination indexes
+   * \param nThreads the number of threads
+   */
+  void Compute (const std::vector<uint32_t> &dests, uint32_t nThreads);
+  /**
+   * \param source the node index
+   * \param dest the destination index
+   * \returns the hops from a node to a destination, or the maximum value
+   *          if it is unreachable
+   */
+  uint32_t GetDistance (uint32_t source, uint32_t dest) const;
+  /**
+   * \param source the node index
+   * \param dest the destination index
+   * \returns the entry of a node for a destination
+   */
+  uint32_t GetEntry (uint32_t source, uint32_t dest) const;
+  /**
+   * \param source the node index
+   * \param dest the destination index
+   * \param entry the entry of the node for the destination
+   */
+  void SetEntry (uint32_t source, uint32_t dest, uint32_t entry);
+
+  Neighbors m_neighbors;            //!< the neighbors of each node
+  Neighbors m_links;                //!< the neighbors each node can send to
+  std::vector<uint64_t> m_offsets;  //!< the bit offset of each node in a row
+  std::vector<uint8_t> m_widths;    //!< the entry width of each node, in bits
+  uint32_t m_rowWords;              //!< the number of words of a row
+  std::vector<uint32_t> m_entries;  //!< the rows, one per destination
+};
+
+} // namespace ns3
+
+#endif /* NIX_VECTOR_TABLE_H */
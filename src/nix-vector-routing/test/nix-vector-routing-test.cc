@@ -0,0 +1,486 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4.h"
+#include "ns3/ipv4-nix-vector-helper.h"
+#include "ns3/ipv4-nix-vector-routing.h"
+#include "ns3/nix-vector-table.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup nix-vector-routing
+ * \ingroup tests
+ *
+ * Check that the incremental updates and the multi-threaded computations
+ * of NixVectorTable give the same next hops as a full computation, and
+ * that these next hops follow shortest paths.
+ */
+class NixVectorTableTestCase : public TestCase
+{
+public:
+  NixVectorTableTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Check the next hops of a table.
+   * \param table the table
+   * \param expected a table computed from scratch, with the same links
+   * \param links the neighbors each node can send to
+   * \param step the step of the test, for the messages
+   */
+  void Check (const NixVectorTable &table, const NixVectorTable &expected,
+              const NixVectorTable::Neighbors &links, std::string step);
+  /**
+   * \returns a pseudo-random number, the same ones on every run
+   */
+  uint32_t Next (void);
+
+  uint32_t m_seed;  //!< the state of the pseudo-random numbers
+};
+
+NixVectorTableTestCase::NixVectorTableTestCase ()
+  : TestCase ("Check the full and incremental computations of NixVectorTable"),
+    m_seed (1)
+{}
+
+uint32_t
+NixVectorTableTestCase::Next (void)
+{
+  m_seed = m_seed * 1103515245 + 12345;
+  return m_seed >> 16;
+}
+
+void
+NixVectorTableTestCase::Check (const NixVectorTable &table, const NixVectorTable &expected,
+                               const NixVectorTable::Neighbors &links, std::string step)
+{
+  const uint32_t unreachable = std::numeric_limits<uint32_t>::max ();
+  uint32_t nNodes = links.size ();
+  NS_TEST_ASSERT_MSG_EQ (table.GetNNodes (), nNodes, step << ": wrong number of nodes");
+  for (uint32_t dest = 0; dest < nNodes; dest++)
+    {
+      // the distances to the destination, with a search over the links
+      std::vector<uint32_t> distances (nNodes, unreachable);
+      std::queue<uint32_t> queue;
+      distances[dest] = 0;
+      queue.push (dest);
+      while (!queue.empty ())
+        {
+          uint32_t node = queue.front ();
+          queue.pop ();
+          for (uint32_t source = 0; source < nNodes; source++)
+            {
+              if (distances[source] == unreachable
+                  && std::find (links[source].begin (), links[source].end (), node) != links[source].end ())
+                {
+                  distances[source] = distances[node] + 1;
+                  queue.push (source);
+                }
+            }
+        }
+
+      for (uint32_t source = 0; source < nNodes; source++)
+        {
+          if (source == dest)
+            {
+              continue;
+            }
+          uint32_t index = 0;
+          uint32_t next = 0;
+          uint32_t expectedIndex = 0;
+          uint32_t expectedNext = 0;
+          bool found = table.GetNextHop (source, dest, index, next);
+          bool expectedFound = expected.GetNextHop (source, dest, expectedIndex, expectedNext);
+          NS_TEST_ASSERT_MSG_EQ (found, expectedFound, step << ": wrong reachability from "
+                                 << source << " to " << dest);
+          NS_TEST_ASSERT_MSG_EQ (found, (distances[source] != unreachable), step
+                                 << ": wrong reachability from " << source << " to " << dest);
+          if (found)
+            {
+              NS_TEST_ASSERT_MSG_EQ (next, expectedNext, step << ": wrong next hop from "
+                                     << source << " to " << dest);
+              NS_TEST_ASSERT_MSG_EQ (index, expectedIndex, step << ": wrong neighbor index from "
+                                     << source << " to " << dest);
+              NS_TEST_ASSERT_MSG_EQ (distances[next] + 1, distances[source], step
+                                     << ": next hop from " << source << " to " << dest
+                                     << " not on a shortest path");
+            }
+        }
+    }
+}
+
+void
+NixVectorTableTestCase::DoRun (void)
+{
+  // A sparse random graph, with parallel links and more than 15 neighbors
+  // for some nodes, so that the entries have different widths
+  const uint32_t nNodes = 60;
+  NixVectorTable::Neighbors neighbors (nNodes);
+  for (uint32_t i = 0; i < 2 * nNodes; i++)
+    {
+      uint32_t a = Next () % nNodes;
+      uint32_t b = (i < nNodes) ? i : Next () % nNodes;
+      if (a != b)
+        {
+          neighbors[a].push_back (b);
+          neighbors[b].push_back (a);
+        }
+    }
+  for (uint32_t i = 1; i < 20; i++)
+    {
+      neighbors[0].push_back (i);
+      neighbors[i].push_back (0);
+    }
+  NixVectorTable::Neighbors links = neighbors;
+
+  NixVectorTable table;
+  table.Build (neighbors, links, 1);
+  NixVectorTable threaded;
+  threaded.Build (neighbors, links, 4);
+  Check (threaded, table, links, "build with 4 threads");
+  Check (table, table, links, "build");
+
+  // Take links down, one way or both ways, and then up again
+  for (uint32_t step = 0; step < 20; step++)
+    {
+      for (uint32_t i = 0; i < 5; i++)
+        {
+          uint32_t a = Next () % nNodes;
+          if (links[a].empty ())
+            {
+              continue;
+            }
+          uint32_t b = links[a][Next () % links[a].size ()];
+          links[a].erase (std::find (links[a].begin (), links[a].end (), b));
+          if (Next () % 2)
+            {
+              std::vector<uint32_t>::iterator it = std::find (links[b].begin (), links[b].end (), a);
+              if (it != links[b].end ())
+                {
+                  links[b].erase (it);
+                }
+            }
+        }
+      if (step % 5 == 4)
+        {
+          links = neighbors;
+        }
+
+      std::ostringstream oss;
+      oss << "update " << step;
+      NixVectorTable expected;
+      expected.Build (neighbors, links, 1);
+      uint32_t computed = table.Update (neighbors, links, 1);
+      NS_TEST_EXPECT_MSG_LT_OR_EQ (computed, nNodes, oss.str () << ": too many destinations");
+      Check (table, expected, links, oss.str ());
+      threaded.Update (neighbors, links, 4);
+      Check (threaded, expected, links, oss.str () + " with 4 threads");
+    }
+
+  // Adding a neighbor computes the whole table
+  neighbors[1].push_back (2);
+  neighbors[2].push_back (1);
+  links = neighbors;
+  NixVectorTable expected;
+  expected.Build (neighbors, links, 1);
+  NS_TEST_EXPECT_MSG_EQ (table.Update (neighbors, links, 1), nNodes, "Table not computed again");
+  Check (table, expected, links, "new neighbors");
+
+  table.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (table.GetNNodes (), 0, "Table not cleared");
+}
+
+/**
+ * \ingroup nix-vector-routing
+ * \ingroup tests
+ *
+ * Check that the nix-vectors built from the next-hop table shared by the
+ * nodes lead to the same destinations as the ones built by a search, in
+ * as many hops, before and after a link goes down, and that the table is
+ * only cleared when its last user is disposed of.
+ */
+class NixVectorRoutingTableTestCase : public TestCase
+{
+public:
+  /// The topologies
+  enum Topology
+  {
+    CHAIN,  //!< 6 nodes on a chain of point-to-point links
+    RING,   //!< 7 nodes on a ring of point-to-point links
+    GRID,   //!< 4x4 nodes on a grid of point-to-point links
+    BUS     //!< 5 nodes on a shared channel, with a chain behind each of them
+  };
+
+  /**
+   * Constructor.
+   * \param topology the topology
+   * \param nThreads the number of threads computing the table
+   */
+  NixVectorRoutingTableTestCase (Topology topology, uint32_t nThreads);
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Create the nodes and their links.
+   * \param [out] devices the devices of each link
+   * \returns the nodes
+   */
+  NodeContainer CreateTopology (std::vector<NetDeviceContainer> &devices);
+  /**
+   * Compare the nix-vectors of every pair of nodes.
+   * \param nodes the nodes
+   * \param step the step of the test, for the messages
+   */
+  void Check (NodeContainer nodes, std::string step);
+  /**
+   * Follow a nix-vector, as the packets carrying it are forwarded.
+   * \param source the source node
+   * \param dest the destination node
+   * \param nixVector the nix-vector
+   * \returns the number of hops to the destination, or the maximum value
+   *          if the nix-vector leads elsewhere
+   */
+  uint32_t Follow (Ptr<Node> source, Ptr<Node> dest, Ptr<NixVector> nixVector);
+
+  Topology m_topology;  //!< the topology
+  uint32_t m_nThreads;  //!< the number of threads computing the table
+};
+
+/**
+ * \param topology the topology
+ * \param nThreads the number of threads
+ * \returns the name of the test
+ */
+static std::string
+GetTestName (NixVectorRoutingTableTestCase::Topology topology, uint32_t nThreads)
+{
+  const char *names[] = { "chain", "ring", "grid", "bus" };
+  std::ostringstream oss;
+  oss << "Check the nix-vectors of the next-hop table on a " << names[topology]
+      << " with " << nThreads << " thread(s)";
+  return oss.str ();
+}
+
+NixVectorRoutingTableTestCase::NixVectorRoutingTableTestCase (Topology topology, uint32_t nThreads)
+  : TestCase (GetTestName (topology, nThreads)),
+    m_topology (topology),
+    m_nThreads (nThreads)
+{}
+
+NodeContainer
+NixVectorRoutingTableTestCase::CreateTopology (std::vector<NetDeviceContainer> &devices)
+{
+  SimpleNetDeviceHelper simple;
+  NodeContainer nodes;
+  switch (m_topology)
+    {
+    case CHAIN:
+    case RING:
+      nodes.Create (m_topology == CHAIN ? 6 : 7);
+      for (uint32_t i = 0; i + 1 < nodes.GetN (); i++)
+        {
+          devices.push_back (simple.Install (NodeContainer (nodes.Get (i), nodes.Get (i + 1))));
+        }
+      if (m_topology == RING)
+        {
+          devices.push_back (simple.Install (NodeContainer (nodes.Get (nodes.GetN () - 1), nodes.Get (0))));
+        }
+      break;
+    case GRID:
+      nodes.Create (16);
+      for (uint32_t i = 0; i < 16; i++)
+        {
+          if (i % 4 != 3)
+            {
+              devices.push_back (simple.Install (NodeContainer (nodes.Get (i), nodes.Get (i + 1))));
+            }
+          if (i < 12)
+            {
+              devices.push_back (simple.Install (NodeContainer (nodes.Get (i), nodes.Get (i + 4))));
+            }
+        }
+      break;
+    case BUS:
+      nodes.Create (15);
+      devices.push_back (simple.Install (NodeContainer (nodes.Get (0), nodes.Get (1), nodes.Get (2),
+                                                        nodes.Get (3), nodes.Get (4))));
+      for (uint32_t i = 0; i < 5; i++)
+        {
+          devices.push_back (simple.Install (NodeContainer (nodes.Get (i), nodes.Get (5 + 2 * i))));
+          devices.push_back (simple.Install (NodeContainer (nodes.Get (5 + 2 * i), nodes.Get (6 + 2 * i))));
+        }
+      break;
+    }
+  return nodes;
+}
+
+uint32_t
+NixVectorRoutingTableTestCase::Follow (Ptr<Node> source, Ptr<Node> dest, Ptr<NixVector> nixVector)
+{
+  Ptr<Node> node = source;
+  uint32_t hops = 0;
+  while (node != dest && nixVector->GetRemainingBits () > 0)
+    {
+      Ptr<Ipv4NixVectorRouting> routing = node->GetObject<Ipv4NixVectorRouting> ();
+      uint32_t index = nixVector->ExtractNeighborIndex (nixVector->BitCount (routing->FindTotalNeighbors ()));
+      Ipv4Address gateway;
+      routing->FindNetDeviceForNixIndex (index, gateway);
+      node = routing->GetNodeByIp (gateway);
+      hops++;
+      if (node == 0)
+        {
+          break;
+        }
+    }
+  if (node != dest || nixVector->GetRemainingBits () > 0)
+    {
+      return std::numeric_limits<uint32_t>::max ();
+    }
+  return hops;
+}
+
+void
+NixVectorRoutingTableTestCase::Check (NodeContainer nodes, std::string step)
+{
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      Ptr<Node> source = nodes.Get (i);
+      Ptr<Ipv4NixVectorRouting> routing = source->GetObject<Ipv4NixVectorRouting> ();
+      for (uint32_t j = 0; j < nodes.GetN (); j++)
+        {
+          if (i == j)
+            {
+              continue;
+            }
+          Ptr<Node> dest = nodes.Get (j);
+          Ipv4Address address = dest->GetObject<Ipv4> ()->GetAddress (1, 0).GetLocal ();
+          Ptr<NixVector> searched = routing->GetNixVector (source, address, 0);
+          Ptr<NixVector> looked = routing->GetNixVectorInTable (source, address);
+          NS_TEST_ASSERT_MSG_EQ ((searched == 0), (looked == 0), step << ": wrong reachability from "
+                                 << i << " to " << j);
+          if (searched)
+            {
+              uint32_t hops = Follow (source, dest, searched);
+              NS_TEST_ASSERT_MSG_NE (hops, std::numeric_limits<uint32_t>::max (),
+                                     step << ": wrong searched nix-vector from " << i << " to " << j);
+              NS_TEST_ASSERT_MSG_EQ (Follow (source, dest, looked), hops,
+                                     step << ": wrong table nix-vector from " << i << " to " << j);
+            }
+        }
+    }
+}
+
+void
+NixVectorRoutingTableTestCase::DoRun (void)
+{
+  Config::SetGlobal ("NixVectorRoutingGlobalTable", BooleanValue (true));
+  Config::SetGlobal ("NixVectorRoutingThreads", UintegerValue (m_nThreads));
+
+  std::vector<NetDeviceContainer> devices;
+  NodeContainer nodes = CreateTopology (devices);
+  Ipv4NixVectorHelper nixRouting;
+  InternetStackHelper stack;
+  stack.SetRoutingHelper (nixRouting);
+  stack.Install (nodes);
+  Ipv4AddressHelper address ("10.0.0.0", "255.255.255.0");
+  for (uint32_t i = 0; i < devices.size (); i++)
+    {
+      address.Assign (devices[i]);
+      address.NewNetwork ();
+    }
+  Ptr<Ipv4NixVectorRouting> routing = nodes.Get (0)->GetObject<Ipv4NixVectorRouting> ();
+  routing->CheckCacheStateAndFlush ();
+  Check (nodes, "initial");
+  NS_TEST_ASSERT_MSG_EQ (Ipv4NixVectorRouting::g_nixTable.GetNNodes (), nodes.GetN (), "Table not built");
+
+  // Disposing of another user of the table keeps it
+  Ptr<Ipv4NixVectorRouting> other = CreateObject<Ipv4NixVectorRouting> ();
+  other->Dispose ();
+  NS_TEST_ASSERT_MSG_EQ (Ipv4NixVectorRouting::g_nixTable.GetNNodes (), nodes.GetN (),
+                         "Table cleared by another protocol");
+
+  // Take down the first interface of a link in the middle, which may
+  // split the topology
+  Ptr<NetDevice> device = devices[devices.size () / 2].Get (0);
+  Ptr<Ipv4> ipv4 = device->GetNode ()->GetObject<Ipv4> ();
+  ipv4->SetDown (ipv4->GetInterfaceForDevice (device));
+  routing->CheckCacheStateAndFlush ();
+  uint32_t computed = routing->UpdateGlobalNixTable ();
+  NS_TEST_EXPECT_MSG_GT (computed, 0, "No destination computed after a link went down");
+  NS_TEST_EXPECT_MSG_LT (computed, nodes.GetN (), "All the destinations computed after a link went down");
+  Check (nodes, "link down");
+
+  ipv4->SetUp (ipv4->GetInterfaceForDevice (device));
+  routing->CheckCacheStateAndFlush ();
+  Check (nodes, "link up");
+
+  Simulator::Destroy ();
+  NS_TEST_EXPECT_MSG_EQ (Ipv4NixVectorRouting::g_nixTable.GetNNodes (), 0, "Table not cleared");
+
+  Config::SetGlobal ("NixVectorRoutingGlobalTable", BooleanValue (false));
+  Config::SetGlobal ("NixVectorRoutingThreads", UintegerValue (1));
+}
+
+/**
+ * \ingroup nix-vector-routing
+ * \ingroup tests
+ *
+ * Nix-vector routing next-hop table test suite.
+ */
+class NixVectorRoutingTableTestSuite : public TestSuite
+{
+public:
+  NixVectorRoutingTableTestSuite ();
+};
+
+NixVectorRoutingTableTestSuite::NixVectorRoutingTableTestSuite ()
+  : TestSuite ("nix-vector-routing-table", UNIT)
+{
+  AddTestCase (new NixVectorTableTestCase, TestCase::QUICK);
+  NixVectorRoutingTableTestCase::Topology topologies[] = {
+    NixVectorRoutingTableTestCase::CHAIN,
+    NixVectorRoutingTableTestCase::RING,
+    NixVectorRoutingTableTestCase::GRID,
+    NixVectorRoutingTableTestCase::BUS
+  };
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      AddTestCase (new NixVectorRoutingTableTestCase (topologies[i], 1), TestCase::QUICK);
+      AddTestCase (new NixVectorRoutingTableTestCase (topologies[i], 4), TestCase::QUICK);
+    }
+}
+
+/// Static variable for test initialization
+static NixVectorRoutingTableTestSuite g_nixVectorRoutingTableTestSuite;
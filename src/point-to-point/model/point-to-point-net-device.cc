@@ -25,6 +25,7 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 #include "ns3/pointer.h"
+#include "ns3/super-segment-tag.h"
 #include "point-to-point-net-device.h"
 #include "point-to-point-channel.h"
 #include "ppp-header.h"
@@ -246,9 +247,16 @@ PointToPointNetDevice::TransmitStart (Ptr<Packet> p)
   NS_ASSERT_MSG (m_txMachineState == READY, "Must be READY to transmit");
   m_txMachineState = BUSY;
   m_currentPkt = p;
-  m_phyTxBeginTrace (m_currentPkt);
+  NS_HOT_TRACE (m_phyTxBeginTrace, m_currentPkt);
 
   Time txTime = m_bps.CalculateBytesTxTime (p->GetSize ());
+  SuperSegmentTag superSegment;
+  if (p->PeekPacketTag (superSegment))
+    {
+      // A super-segment is sent as a train of segments
+      txTime = m_bps.CalculateBytesTxTime (superSegment.GetWireSize (p->GetSize ()))
+        + (superSegment.GetSegments () - 1) * m_tInterframeGap;
+    }
   Time txCompleteTime = txTime + m_tInterframeGap;
 
   NS_LOG_LOGIC ("Schedule TransmitCompleteEvent in " << txCompleteTime.As (Time::S));
@@ -278,7 +286,7 @@ PointToPointNetDevice::TransmitComplete (void)
 
   NS_ASSERT_MSG (m_currentPkt != 0, "PointToPointNetDevice::TransmitComplete(): m_currentPkt zero");
 
-  m_phyTxEndTrace (m_currentPkt);
+  NS_HOT_TRACE (m_phyTxEndTrace, m_currentPkt);
   m_currentPkt = 0;
 
   Ptr<Packet> p = m_queue->Dequeue ();
@@ -351,7 +359,7 @@ PointToPointNetDevice::Receive (Ptr<Packet> packet)
       //
       m_snifferTrace (packet);
       m_promiscSnifferTrace (packet);
-      m_phyRxEndTrace (packet);
+      NS_HOT_TRACE (m_phyRxEndTrace, packet);
 
       //
       // Trace sinks will expect complete packets, not packets without some of the
@@ -529,7 +537,7 @@ PointToPointNetDevice::Send (
   //
   AddHeader (packet, protocolNumber);
 
-  m_macTxTrace (packet);
+  NS_HOT_TRACE (m_macTxTrace, packet);
 
   //
   // We should enqueue and dequeue the packet to hit the tracing hooks.
@@ -605,6 +613,13 @@ PointToPointNetDevice::SupportsSendFrom (void) const
   return false;
 }
 
+bool
+PointToPointNetDevice::SupportsSuperSegments (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return true;
+}
+
 void
 PointToPointNetDevice::DoMpiReceive (Ptr<Packet> p)
 {
@@ -24,6 +24,7 @@
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/point-to-point-channel.h"
 #include "ns3/net-device-queue-interface.h"
+#include "ns3/super-segment-tag.h"
 
 using namespace ns3;
 
@@ -94,6 +95,88 @@ PointToPointTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \brief Test class for the transmission of super-segments
+ *
+ * It sends a packet tagged as a super-segment, and checks that it takes the
+ * time of the train of segments it stands for.
+ */
+class PointToPointSuperSegmentTest : public TestCase
+{
+public:
+  /**
+   * \brief Create the test
+   */
+  PointToPointSuperSegmentTest ();
+
+  /**
+   * \brief Run the test
+   */
+  virtual void DoRun (void);
+
+private:
+  /**
+   * \brief Receive a packet
+   *
+   * \param device the receiving device
+   * \param p the packet
+   * \param protocol the protocol number
+   * \param sender the sender address
+   * \returns true
+   */
+  bool Receive (Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol, const Address &sender);
+
+  Time m_received; //!< The time the packet was received
+};
+
+PointToPointSuperSegmentTest::PointToPointSuperSegmentTest ()
+  : TestCase ("PointToPoint super-segment")
+{
+}
+
+bool
+PointToPointSuperSegmentTest::Receive (Ptr<NetDevice> device, Ptr<const Packet> p,
+                                       uint16_t protocol, const Address &sender)
+{
+  m_received = Simulator::Now ();
+  return true;
+}
+
+void
+PointToPointSuperSegmentTest::DoRun (void)
+{
+  Ptr<Node> a = CreateObject<Node> ();
+  Ptr<Node> b = CreateObject<Node> ();
+  Ptr<PointToPointNetDevice> devA = CreateObject<PointToPointNetDevice> ();
+  Ptr<PointToPointNetDevice> devB = CreateObject<PointToPointNetDevice> ();
+  Ptr<PointToPointChannel> channel = CreateObject<PointToPointChannel> ();
+
+  // One byte per microsecond
+  devA->SetDataRate (DataRate ("8Mbps"));
+  devA->Attach (channel);
+  devA->SetAddress (Mac48Address::Allocate ());
+  devA->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+  devB->Attach (channel);
+  devB->SetAddress (Mac48Address::Allocate ());
+  devB->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+
+  a->AddDevice (devA);
+  b->AddDevice (devB);
+  devB->SetReceiveCallback (MakeCallback (&PointToPointSuperSegmentTest::Receive, this));
+
+  // Four segments of 250 bytes, with 40 bytes of headers, plus the 2 bytes
+  // of the PPP header
+  Ptr<Packet> p = Create<Packet> (1040);
+  p->AddPacketTag (SuperSegmentTag (4, 1000));
+  devA->Send (p, devB->GetAddress (), 0x800);
+
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_received, MicroSeconds (4 * 292), "Wrong transmission time of the train");
+
+  Simulator::Destroy ();
+}
+
 /**
  * \brief TestSuite for PointToPoint module
  */
@@ -110,6 +193,7 @@ PointToPointTestSuite::PointToPointTestSuite ()
   : TestSuite ("devices-point-to-point", UNIT)
 {
   AddTestCase (new PointToPointTest, TestCase::QUICK);
+  AddTestCase (new PointToPointSuperSegmentTest, TestCase::QUICK);
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
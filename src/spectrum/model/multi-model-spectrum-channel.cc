@@ -19,7 +19,9 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <utility>
 #include <ns3/object.h>
 #include <ns3/simulator.h>
@@ -29,6 +31,7 @@
 #include <ns3/net-device.h>
 #include <ns3/node.h>
 #include <ns3/double.h>
+#include <ns3/boolean.h>
 #include <ns3/mobility-model.h>
 #include <ns3/spectrum-phy.h>
 #include <ns3/spectrum-converter.h>
@@ -79,7 +82,13 @@ RxSpectrumModelInfo::RxSpectrumModelInfo (Ptr<const SpectrumModel> rxSpectrumMod
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel ()
-  : m_numDevices {0}
+  : m_numDevices {0},
+    m_maxRange (0),
+    m_minRxPowerDbm (-std::numeric_limits<double>::infinity ()),
+    m_batchDelivery (false),
+    m_nDelivered (0),
+    m_nCulled (0),
+    m_gridValid (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -90,6 +99,10 @@ MultiModelSpectrumChannel::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_txSpectrumModelInfoMap.clear ();
   m_rxSpectrumModelInfoMap.clear ();
+  m_grid.Clear ();
+  m_gridPhys.clear ();
+  m_unlocatedPhys.clear ();
+  m_gridValid = false;
   SpectrumChannel::DoDispose ();
 }
 
@@ -100,7 +113,49 @@ MultiModelSpectrumChannel::GetTypeId (void)
     .SetParent<SpectrumChannel> ()
     .SetGroupName ("Spectrum")
     .AddConstructor<MultiModelSpectrumChannel> ()
-
+    .AddAttribute ("MaxRange",
+                   "If positive, the maximum distance in meters at which "
+                   "transmissions are delivered.  The propagation loss and "
+                   "delay are then only computed for the receivers within "
+                   "this distance of the transmitter, which are found from "
+                   "a spatial index of their positions.  Receivers without "
+                   "a mobility model are always considered.  It must be "
+                   "larger than the interference range of the propagation "
+                   "loss models.  The default value of zero considers all "
+                   "receivers.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&MultiModelSpectrumChannel::m_maxRange),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("MinRxPowerDbm",
+                   "The minimum received power in dBm of the signals passed "
+                   "to the receiving PHY, typically some dB below its noise "
+                   "floor.  The received power is evaluated from the "
+                   "transmitted power in the band of the receiver, the "
+                   "antenna gains and the single-frequency "
+                   "PropagationLossModel, before the "
+                   "SpectrumPropagationLossModel is applied.  Weaker "
+                   "signals are not propagated to the receiver.  Note that "
+                   "the default value corresponds to considering all "
+                   "signals for reception.  Tune this value with care.",
+                   DoubleValue (-std::numeric_limits<double>::infinity ()),
+                   MakeDoubleAccessor (&MultiModelSpectrumChannel::m_minRxPowerDbm),
+                   MakeDoubleChecker<double> (-std::numeric_limits<double>::infinity ()))
+    .AddAttribute ("BatchDelivery",
+                   "If true, the signals of a transmission which reach the "
+                   "receivers of the same node after the same propagation "
+                   "delay are delivered by a single event, in the context of "
+                   "this node, instead of one event per receiver.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&MultiModelSpectrumChannel::m_batchDelivery),
+                   MakeBooleanChecker ())
+    .AddAttribute ("BatchResolution",
+                   "If BatchDelivery is true and this value is positive, "
+                   "the propagation delays are rounded up to a multiple of "
+                   "this value, so that the signals reaching the receivers of "
+                   "a node at slightly different times are delivered together.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&MultiModelSpectrumChannel::m_batchResolution),
+                   MakeTimeChecker (Seconds (0)))
   ;
   return tid;
 }
@@ -110,6 +165,7 @@ MultiModelSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
 {
   NS_LOG_FUNCTION (this << phy);
 
+  m_gridValid = false;
   Ptr<const SpectrumModel> rxSpectrumModel = phy->GetRxSpectrumModel ();
 
   NS_ASSERT_MSG ((0 != rxSpectrumModel), "phy->GetRxSpectrumModel () returned 0. Please check that the RxSpectrumModel is already set for the phy before calling MultiModelSpectrumChannel::AddRx (phy)");
@@ -213,6 +269,74 @@ MultiModelSpectrumChannel::FindAndEventuallyAddTxSpectrumModel (Ptr<const Spectr
   return txInfoIterator;
 }
 
+Ptr<SpectrumValue>
+MultiModelSpectrumChannel::ConvertTxPsd (TxSpectrumModelInfoMap_t::const_iterator txInfo,
+                                         Ptr<SpectrumValue> txPsd,
+                                         SpectrumModelUid_t rxSpectrumModelUid) const
+{
+  SpectrumModelUid_t txSpectrumModelUid = txPsd->GetSpectrumModelUid ();
+  if (txSpectrumModelUid == rxSpectrumModelUid)
+    {
+      NS_LOG_LOGIC ("no spectrum conversion needed");
+      return txPsd;
+    }
+  NS_LOG_LOGIC ("converting txPowerSpectrum SpectrumModelUids " << txSpectrumModelUid << " --> " << rxSpectrumModelUid);
+  SpectrumConverterMap_t::const_iterator rxConverterIterator = txInfo->second.m_spectrumConverterMap.find (rxSpectrumModelUid);
+  if (rxConverterIterator == txInfo->second.m_spectrumConverterMap.end ())
+    {
+      // No converter means TX SpectrumModel is orthogonal to RX SpectrumModel
+      return 0;
+    }
+  return rxConverterIterator->second.Convert (txPsd);
+}
+
+void
+MultiModelSpectrumChannel::UpdateGrid (void)
+{
+  if (m_gridValid)
+    {
+      // A receiver without a mobility model when the grid was built may
+      // have got one since
+      for (const auto &phy : m_unlocatedPhys)
+        {
+          if (phy->GetMobility ())
+            {
+              m_gridValid = false;
+              break;
+            }
+        }
+    }
+  if (m_gridValid && m_grid.GetCellSize () == m_maxRange)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  // The receivers are indexed lazily, since their mobility model is
+  // usually set after they are added to the channel.
+  m_grid.SetCellSize (m_maxRange);
+  m_gridPhys.clear ();
+  m_unlocatedPhys.clear ();
+  for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
+       rxInfoIterator != m_rxSpectrumModelInfoMap.end ();
+       ++rxInfoIterator)
+    {
+      for (const auto &phy : rxInfoIterator->second.m_rxPhys)
+        {
+          Ptr<MobilityModel> mobility = phy->GetMobility ();
+          if (mobility)
+            {
+              m_grid.Add (mobility);
+              m_gridPhys.push_back (phy);
+            }
+          else
+            {
+              m_unlocatedPhys.push_back (phy);
+            }
+        }
+    }
+  m_gridValid = true;
+}
+
 void
 MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
 {
@@ -235,117 +359,187 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
   NS_LOG_LOGIC ("converter map size: " << txInfoIteratorerator->second.m_spectrumConverterMap.size ());
   NS_LOG_LOGIC ("converter map first element: " << txInfoIteratorerator->second.m_spectrumConverterMap.begin ()->first);
 
-  for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
-       rxInfoIterator != m_rxSpectrumModelInfoMap.end ();
-       ++rxInfoIterator)
+  std::map<RxBatchKey, RxBatch> batches;
+  if (m_maxRange > 0 && txMobility)
     {
-      SpectrumModelUid_t rxSpectrumModelUid = rxInfoIterator->second.m_rxSpectrumModel->GetUid ();
-      NS_LOG_LOGIC ("rxSpectrumModelUids " << rxSpectrumModelUid);
-
-      Ptr <SpectrumValue> convertedTxPowerSpectrum;
-      if (txSpectrumModelUid == rxSpectrumModelUid)
+      UpdateGrid ();
+      m_grid.GetNeighbors (txMobility->GetPosition (), m_maxRange, m_candidates);
+      NS_LOG_LOGIC (m_candidates.size () << " candidate receivers out of " << m_gridPhys.size ());
+      m_nCulled += m_gridPhys.size () - m_candidates.size ();
+      // the converted PSD and its power, for each RX SpectrumModel
+      std::map<SpectrumModelUid_t, std::pair<Ptr<SpectrumValue>, double> > rxPsds;
+      std::size_t nCandidates = m_candidates.size ();
+      for (std::size_t i = 0; i < nCandidates + m_unlocatedPhys.size (); ++i)
         {
-          NS_LOG_LOGIC ("no spectrum conversion needed");
-          convertedTxPowerSpectrum = txParams->psd;
+          Ptr<SpectrumPhy> rxPhy = i < nCandidates ? m_gridPhys[m_candidates[i]] : m_unlocatedPhys[i - nCandidates];
+          SpectrumModelUid_t rxSpectrumModelUid = rxPhy->GetRxSpectrumModel ()->GetUid ();
+          auto rxPsdIterator = rxPsds.find (rxSpectrumModelUid);
+          if (rxPsdIterator == rxPsds.end ())
+            {
+              Ptr<SpectrumValue> rxPsd = ConvertTxPsd (txInfoIteratorerator, txParams->psd, rxSpectrumModelUid);
+              double txPowerDbm = rxPsd ? 10 * std::log10 (Integral (*rxPsd)) + 30 : 0;
+              rxPsdIterator = rxPsds.insert (std::make_pair (rxSpectrumModelUid, std::make_pair (rxPsd, txPowerDbm))).first;
+            }
+          if (rxPsdIterator->second.first)
+            {
+              PropagateToRx (txParams, rxPsdIterator->second.first, rxPsdIterator->second.second,
+                             rxPhy, batches);
+            }
         }
-      else
+    }
+  else
+    {
+      for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
+           rxInfoIterator != m_rxSpectrumModelInfoMap.end ();
+           ++rxInfoIterator)
         {
-          NS_LOG_LOGIC ("converting txPowerSpectrum SpectrumModelUids " << txSpectrumModelUid << " --> " << rxSpectrumModelUid);
-          SpectrumConverterMap_t::const_iterator rxConverterIterator = txInfoIteratorerator->second.m_spectrumConverterMap.find (rxSpectrumModelUid);
-          if (rxConverterIterator == txInfoIteratorerator->second.m_spectrumConverterMap.end ())
+          SpectrumModelUid_t rxSpectrumModelUid = rxInfoIterator->second.m_rxSpectrumModel->GetUid ();
+          NS_LOG_LOGIC ("rxSpectrumModelUids " << rxSpectrumModelUid);
+
+          Ptr <SpectrumValue> convertedTxPowerSpectrum = ConvertTxPsd (txInfoIteratorerator, txParams->psd, rxSpectrumModelUid);
+          if (!convertedTxPowerSpectrum)
             {
-              // No converter means TX SpectrumModel is orthogonal to RX SpectrumModel
               continue;
             }
-          convertedTxPowerSpectrum = rxConverterIterator->second.Convert (txParams->psd);
+          double txPowerDbm = 10 * std::log10 (Integral (*convertedTxPowerSpectrum)) + 30;
+
+          for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin ();
+               rxPhyIterator != rxInfoIterator->second.m_rxPhys.end ();
+               ++rxPhyIterator)
+            {
+              NS_ASSERT_MSG ((*rxPhyIterator)->GetRxSpectrumModel ()->GetUid () == rxSpectrumModelUid,
+                             "SpectrumModel change was not notified to MultiModelSpectrumChannel (i.e., AddRx should be called again after model is changed)");
+              PropagateToRx (txParams, convertedTxPowerSpectrum, txPowerDbm, *rxPhyIterator, batches);
+            }
         }
+    }
 
-      for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin ();
-           rxPhyIterator != rxInfoIterator->second.m_rxPhys.end ();
-           ++rxPhyIterator)
+  for (auto batchIterator = batches.begin (); batchIterator != batches.end (); ++batchIterator)
+    {
+      Time delay = batchIterator->first.first;
+      uint32_t dstNode = batchIterator->first.second;
+      NS_LOG_LOGIC ("delivering " << batchIterator->second.size () << " signals to node "
+                    << dstNode << " after " << delay);
+      if (dstNode != Simulator::NO_CONTEXT)
         {
-          NS_ASSERT_MSG ((*rxPhyIterator)->GetRxSpectrumModel ()->GetUid () == rxSpectrumModelUid,
-                         "SpectrumModel change was not notified to MultiModelSpectrumChannel (i.e., AddRx should be called again after model is changed)");
+          Simulator::ScheduleWithContext (dstNode, delay, &MultiModelSpectrumChannel::StartRxBatch,
+                                          this, batchIterator->second);
+        }
+      else
+        {
+          // the receivers are not attached to a node
+          Simulator::Schedule (delay, &MultiModelSpectrumChannel::StartRxBatch, this,
+                               batchIterator->second);
+        }
+    }
+}
 
-          if ((*rxPhyIterator) != txParams->txPhy)
-            {
-              NS_LOG_LOGIC ("copying signal parameters " << txParams);
-              Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
-              rxParams->psd = Copy<SpectrumValue> (convertedTxPowerSpectrum);
-              Time delay = MicroSeconds (0);
-
-              Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility ();
-
-              if (txMobility && receiverMobility)
-                {
-                  double txAntennaGain = 0;
-                  double rxAntennaGain = 0;
-                  double propagationGainDb = 0;
-                  double pathLossDb = 0;
-                  if (rxParams->txAntenna != 0)
-                    {
-                      Angles txAngles (receiverMobility->GetPosition (), txMobility->GetPosition ());
-                      txAntennaGain = rxParams->txAntenna->GetGainDb (txAngles);
-                      NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
-                      pathLossDb -= txAntennaGain;
-                    }
-                  Ptr<AntennaModel> rxAntenna = (*rxPhyIterator)->GetRxAntenna ();
-                  if (rxAntenna != 0)
-                    {
-                      Angles rxAngles (txMobility->GetPosition (), receiverMobility->GetPosition ());
-                      rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
-                      NS_LOG_LOGIC ("rxAntennaGain = " << rxAntennaGain << " dB");
-                      pathLossDb -= rxAntennaGain;
-                    }
-                  if (m_propagationLoss)
-                    {
-                      propagationGainDb = m_propagationLoss->CalcRxPower (0, txMobility, receiverMobility);
-                      NS_LOG_LOGIC ("propagationGainDb = " << propagationGainDb << " dB");
-                      pathLossDb -= propagationGainDb;
-                    }                    
-                  NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
-                  // Gain trace
-                  m_gainTrace (txMobility, receiverMobility, txAntennaGain, rxAntennaGain, propagationGainDb, pathLossDb);
-                  // Pathloss trace
-                  m_pathLossTrace (txParams->txPhy, *rxPhyIterator, pathLossDb);
-                  if (pathLossDb > m_maxLossDb)
-                    {
-                      // beyond range
-                      continue;
-                    }
-                  double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
-                  *(rxParams->psd) *= pathGainLinear;              
-
-                  if (m_spectrumPropagationLoss)
-                    {
-                      rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, txMobility, receiverMobility);
-                    }
-
-                  if (m_propagationDelay)
-                    {
-                      delay = m_propagationDelay->GetDelay (txMobility, receiverMobility);
-                    }
-                }
-
-              Ptr<NetDevice> netDev = (*rxPhyIterator)->GetDevice ();
-              if (netDev)
-                {
-                  // the receiver has a NetDevice, so we expect that it is attached to a Node
-                  uint32_t dstNode =  netDev->GetNode ()->GetId ();
-                  Simulator::ScheduleWithContext (dstNode, delay, &MultiModelSpectrumChannel::StartRx, this,
-                                                  rxParams, *rxPhyIterator);
-                }
-              else
-                {
-                  // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
-                  Simulator::Schedule (delay, &MultiModelSpectrumChannel::StartRx, this,
-                                       rxParams, *rxPhyIterator);
-                }
-            }
+void
+MultiModelSpectrumChannel::PropagateToRx (Ptr<SpectrumSignalParameters> txParams, Ptr<SpectrumValue> rxPsd,
+                                          double txPowerDbm, Ptr<SpectrumPhy> receiver,
+                                          std::map<RxBatchKey, RxBatch> &batches)
+{
+  if (receiver == txParams->txPhy)
+    {
+      return;
+    }
+
+  Ptr<MobilityModel> txMobility = txParams->txPhy->GetMobility ();
+  Ptr<MobilityModel> receiverMobility = receiver->GetMobility ();
+  double pathLossDb = 0;
+  if (txMobility && receiverMobility)
+    {
+      if (m_maxRange > 0 && txMobility->GetDistanceFrom (receiverMobility) > m_maxRange)
+        {
+          // beyond range
+          m_nCulled++;
+          return;
+        }
+      double txAntennaGain = 0;
+      double rxAntennaGain = 0;
+      double propagationGainDb = 0;
+      if (txParams->txAntenna != 0)
+        {
+          Angles txAngles (receiverMobility->GetPosition (), txMobility->GetPosition ());
+          txAntennaGain = txParams->txAntenna->GetGainDb (txAngles);
+          NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
+          pathLossDb -= txAntennaGain;
+        }
+      Ptr<AntennaModel> rxAntenna = receiver->GetRxAntenna ();
+      if (rxAntenna != 0)
+        {
+          Angles rxAngles (txMobility->GetPosition (), receiverMobility->GetPosition ());
+          rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
+          NS_LOG_LOGIC ("rxAntennaGain = " << rxAntennaGain << " dB");
+          pathLossDb -= rxAntennaGain;
+        }
+      if (m_propagationLoss)
+        {
+          propagationGainDb = m_propagationLoss->CalcRxPower (0, txMobility, receiverMobility);
+          NS_LOG_LOGIC ("propagationGainDb = " << propagationGainDb << " dB");
+          pathLossDb -= propagationGainDb;
         }
+      NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
+      // Gain trace
+      m_gainTrace (txMobility, receiverMobility, txAntennaGain, rxAntennaGain, propagationGainDb, pathLossDb);
+      // Pathloss trace
+      m_pathLossTrace (txParams->txPhy, receiver, pathLossDb);
+      if (pathLossDb > m_maxLossDb || txPowerDbm - pathLossDb < m_minRxPowerDbm)
+        {
+          // beyond range
+          m_nCulled++;
+          return;
+        }
+    }
 
+  NS_LOG_LOGIC ("copying signal parameters " << txParams);
+  Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
+  rxParams->psd = Copy<SpectrumValue> (rxPsd);
+  Time delay = MicroSeconds (0);
+  if (txMobility && receiverMobility)
+    {
+      double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
+      *(rxParams->psd) *= pathGainLinear;
+
+      if (m_spectrumPropagationLoss)
+        {
+          rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, txMobility, receiverMobility);
+        }
+
+      if (m_propagationDelay)
+        {
+          delay = m_propagationDelay->GetDelay (txMobility, receiverMobility);
+        }
     }
+  m_nDelivered++;
 
+  Ptr<NetDevice> netDev = receiver->GetDevice ();
+  if (m_batchDelivery)
+    {
+      if (m_batchResolution.IsStrictlyPositive ())
+        {
+          int64_t resolution = m_batchResolution.GetTimeStep ();
+          delay = TimeStep ((delay.GetTimeStep () + resolution - 1) / resolution * resolution);
+        }
+      // the signals are delivered in the context of their receiving node
+      uint32_t dstNode = netDev ? netDev->GetNode ()->GetId () : Simulator::NO_CONTEXT;
+      batches[std::make_pair (delay, dstNode)].push_back (std::make_pair (rxParams, receiver));
+      return;
+    }
+
+  if (netDev)
+    {
+      // the receiver has a NetDevice, so we expect that it is attached to a Node
+      uint32_t dstNode =  netDev->GetNode ()->GetId ();
+      Simulator::ScheduleWithContext (dstNode, delay, &MultiModelSpectrumChannel::StartRx, this,
+                                      rxParams, receiver);
+    }
+  else
+    {
+      // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
+      Simulator::Schedule (delay, &MultiModelSpectrumChannel::StartRx, this,
+                           rxParams, receiver);
+    }
 }
 
 void
@@ -355,6 +549,28 @@ MultiModelSpectrumChannel::StartRx (Ptr<SpectrumSignalParameters> params, Ptr<Sp
   receiver->StartRx (params);
 }
 
+void
+MultiModelSpectrumChannel::StartRxBatch (RxBatch batch)
+{
+  NS_LOG_FUNCTION (this << batch.size ());
+  for (auto it = batch.begin (); it != batch.end (); ++it)
+    {
+      StartRx (it->first, it->second);
+    }
+}
+
+uint64_t
+MultiModelSpectrumChannel::GetNDeliveredSignals (void) const
+{
+  return m_nDelivered;
+}
+
+uint64_t
+MultiModelSpectrumChannel::GetNCulledSignals (void) const
+{
+  return m_nCulled;
+}
+
 std::size_t
 MultiModelSpectrumChannel::GetNDevices (void) const
 {
@@ -27,8 +27,11 @@
 #include <ns3/spectrum-channel.h>
 #include <ns3/spectrum-propagation-loss-model.h>
 #include <ns3/propagation-delay-model.h>
+#include <ns3/spatial-grid.h>
+#include <ns3/nstime.h>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace ns3 {
 
@@ -102,6 +105,17 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * By default, every transmission is evaluated and delivered separately
+ * to every other SpectrumPhy.  In large scenarios, the \c MaxRange,
+ * \c MaxLossDb and \c MinRxPowerDbm attributes cull the signals which
+ * are too weak to matter before their SpectrumValue is copied, and
+ * \c BatchDelivery delivers the signals which reach the receivers of a
+ * node at the same time in a single event.
+ *
+ * With \c MaxRange, the receivers are indexed by their position when
+ * their mobility model is known.  A receiver whose mobility model is
+ * replaced by another one must be added again with AddRx.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -124,6 +138,18 @@ public:
   virtual std::size_t GetNDevices (void) const;
   virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
 
+  /**
+   * \return the number of signals delivered to a receiver since the
+   * creation of the channel
+   */
+  uint64_t GetNDeliveredSignals (void) const;
+  /**
+   * \return the number of signals not delivered to a receiver because
+   * of the \c MaxRange, \c MaxLossDb or \c MinRxPowerDbm attributes,
+   * since the creation of the channel
+   */
+  uint64_t GetNCulledSignals (void) const;
+
 
 protected:
   void DoDispose ();
@@ -149,6 +175,63 @@ private:
    */
   virtual void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+  /**
+   * Container: signal parameters and receiver of the signals delivered
+   * by the same event.
+   */
+  typedef std::vector<std::pair<Ptr<SpectrumSignalParameters>, Ptr<SpectrumPhy> > > RxBatch;
+
+  /**
+   * Key of a batch: propagation delay and receiving node, or
+   * Simulator::NO_CONTEXT for receivers not attached to a node.
+   */
+  typedef std::pair<Time, uint32_t> RxBatchKey;
+
+  /**
+   * Used internally to deliver the signals of a batch after the
+   * propagation delay.
+   *
+   * \param batch The signals and their receivers.
+   */
+  void StartRxBatch (RxBatch batch);
+
+  /**
+   * Convert the power spectral density of a transmission to the
+   * SpectrumModel of a receiver.
+   *
+   * \param txInfo The entry of the TX SpectrumModel in m_txSpectrumModelInfoMap.
+   * \param txPsd The transmitted power spectral density.
+   * \param rxSpectrumModelUid The RX SpectrumModel.
+   * \return The converted power spectral density, or 0 if the two
+   * SpectrumModels are orthogonal.
+   */
+  Ptr<SpectrumValue> ConvertTxPsd (TxSpectrumModelInfoMap_t::const_iterator txInfo,
+                                   Ptr<SpectrumValue> txPsd,
+                                   SpectrumModelUid_t rxSpectrumModelUid) const;
+
+  /**
+   * Compute the propagation of a transmission to a receiver, and
+   * schedule its reception unless it is culled.
+   *
+   * \param txParams The signal parameters of the transmission.
+   * \param rxPsd The transmitted power spectral density, converted to
+   * the SpectrumModel of the receiver.
+   * \param txPowerDbm The total power of \p rxPsd, in dBm.
+   * \param receiver The receiver SpectrumPhy.
+   * \param batches The signals to deliver per delay and receiving node,
+   * if BatchDelivery is set.
+   */
+  void PropagateToRx (Ptr<SpectrumSignalParameters> txParams, Ptr<SpectrumValue> rxPsd,
+                      double txPowerDbm, Ptr<SpectrumPhy> receiver,
+                      std::map<RxBatchKey, RxBatch> &batches);
+
+  /**
+   * Index the positions of the SpectrumPhy instances in m_grid, if
+   * they changed since the last call, or if a SpectrumPhy which had
+   * no mobility model has got one.
+   */
+  void UpdateGrid (void);
+
   /**
    * Data structure holding, for each TX SpectrumModel,  all the
    * converters to any RX SpectrumModel, and all the corresponding
@@ -169,6 +252,19 @@ private:
    */
   std::size_t m_numDevices;
 
+  double m_maxRange;        //!< Maximum distance of the receivers (m), or 0
+  double m_minRxPowerDbm;   //!< Minimum received power of the delivered signals (dBm)
+  bool m_batchDelivery;     //!< Whether to deliver signals with the same delay in one event
+  Time m_batchResolution;   //!< Delays are rounded up to a multiple of this value when batching
+  uint64_t m_nDelivered;    //!< Number of delivered signals
+  uint64_t m_nCulled;       //!< Number of culled signals
+
+  SpatialGrid m_grid;       //!< Positions of the receivers, if m_maxRange is set
+  bool m_gridValid;         //!< Whether m_grid indexes the current receivers
+  std::vector<Ptr<SpectrumPhy> > m_gridPhys;      //!< Receivers indexed in m_grid
+  std::vector<Ptr<SpectrumPhy> > m_unlocatedPhys; //!< Receivers without a mobility model
+  std::vector<uint32_t> m_candidates;             //!< Candidate receivers of the current transmission
+
 };
 
 
@@ -142,6 +142,8 @@ private:
   Ptr<SpectrumValue> m_allSignals;
 
   Ptr<const SpectrumValue> m_noise; //!< Noise spectral power density
+  SpectrumValue m_interference;     //!< Interference of the current chunk
+  SpectrumValue m_sinr;             //!< SINR of the current chunk
 
   Time m_lastChangeTime;     //!< the time of the last change in m_TotalPower
 
@@ -54,6 +54,15 @@ typedef std::vector<double> Values;
  * The intended use of this class is to represent frequency-dependent
  * things, such as power spectral densities, frequency-dependent
  * propagation losses, spectral masks, etc.
+ *
+ * The binary operators return a new SpectrumValue, but reuse the storage
+ * of their left hand side when it is a temporary, so that an expression
+ * such as a - b + c only allocates its result.  Code evaluated for every
+ * signal should rather use the compound assignment operators, AddScaled
+ * and ComputeSinr on SpectrumValue instances it keeps, which never
+ * allocate.  The element-wise loops are compiled for AVX2 in addition to
+ * the baseline instruction set when the compiler supports it, the
+ * best version being selected at run time.
  */
 class SpectrumValue : public SimpleRefCount<SpectrumValue>
 {
@@ -308,6 +317,96 @@ public:
    */
   friend SpectrumValue operator- (const SpectrumValue& rhs);
 
+  /**
+   * addition operator, reusing the storage of a temporary Left Hand Side
+   *
+   * @param lhs Left Hand Side of the operator
+   * @param rhs Right Hand Side of the operator
+   *
+   * @return the value of lhs + rhs
+   */
+  friend SpectrumValue operator+ (SpectrumValue&& lhs, const SpectrumValue& rhs);
+
+  /**
+   * addition operator, reusing the storage of a temporary Left Hand Side
+   *
+   * @param lhs Left Hand Side of the operator
+   * @param rhs Right Hand Side of the operator
+   *
+   * @return the value of lhs + rhs
+   */
+  friend SpectrumValue operator+ (SpectrumValue&& lhs, double rhs);
+
+  /**
+   * subtraction operator, reusing the storage of a temporary Left Hand Side
+   *
+   * @param lhs Left Hand Side of the operator
+   * @param rhs Right Hand Side of the operator
+   *
+   * @return the value of lhs - rhs
+   */
+  friend SpectrumValue operator- (SpectrumValue&& lhs, const SpectrumValue& rhs);
+
+  /**
+   * subtraction operator, reusing the storage of a temporary Left Hand Side
+   *
+   * @param lhs Left Hand Side of the operator
+   * @param rhs Right Hand Side of the operator
+   *
+   * @return the value of lhs - rhs
+   */
+  friend SpectrumValue operator- (SpectrumValue&& lhs, double rhs);
+
+  /**
+   * multiplication component-by-component (Schur product), reusing the
+   * storage of a temporary Left Hand Side
+   *
+   * @param lhs Left Hand Side of the operator
+   * @param rhs Right Hand Side of the operator
+   *
+   * @return the value of lhs * rhs
+   */
+  friend SpectrumValue operator* (SpectrumValue&& lhs, const SpectrumValue& rhs);
+
+  /**
+   * multiplication, reusing the storage of a temporary Left Hand Side
+   *
+   * @param lhs Left Hand Side of the operator
+   * @param rhs Right Hand Side of the operator
+   *
+   * @return the value of lhs * rhs
+   */
+  friend SpectrumValue operator* (SpectrumValue&& lhs, double rhs);
+
+  /**
+   * division component-by-component, reusing the storage of a temporary
+   * Left Hand Side
+   *
+   * @param lhs Left Hand Side of the operator
+   * @param rhs Right Hand Side of the operator
+   *
+   * @return the value of lhs / rhs
+   */
+  friend SpectrumValue operator/ (SpectrumValue&& lhs, const SpectrumValue& rhs);
+
+  /**
+   * division, reusing the storage of a temporary Left Hand Side
+   *
+   * @param lhs Left Hand Side of the operator
+   * @param rhs Right Hand Side of the operator
+   *
+   * @return the value of lhs / rhs
+   */
+  friend SpectrumValue operator/ (SpectrumValue&& lhs, double rhs);
+
+  /**
+   * unary minus operator, reusing the storage of a temporary argument
+   *
+   * @param rhs Right Hand Side of the operator
+   * @return the value of - rhs
+   */
+  friend SpectrumValue operator- (SpectrumValue&& rhs);
+
 
   /**
    * left shift operator
@@ -420,6 +519,32 @@ public:
    */
   SpectrumValue& operator= (double rhs);
 
+  /**
+   * Add a SpectrumValue multiplied by a scalar to *this, component by
+   * component, without creating a temporary SpectrumValue
+   *
+   * @param x the SpectrumValue to add
+   * @param s the factor applied to \p x
+   *
+   * @return a reference to *this
+   */
+  SpectrumValue& AddScaled (const SpectrumValue& x, double s);
+
+  /**
+   * Compute the signal to interference plus noise ratio of each
+   * component, i.e., signal / (interference + noise).  The result is
+   * stored in \p sinr, whose storage is reused, so that no memory is
+   * allocated when \p sinr already has the SpectrumModel of the
+   * arguments.
+   *
+   * @param signal the power spectral density of the signal
+   * @param interference the power spectral density of the interference
+   * @param noise the power spectral density of the noise
+   * @param sinr the resulting SINR
+   */
+  friend void ComputeSinr (const SpectrumValue& signal, const SpectrumValue& interference,
+                           const SpectrumValue& noise, SpectrumValue& sinr);
+
 
 
   /**
@@ -630,6 +755,8 @@ SpectrumValue Log10 (const SpectrumValue& arg);
 SpectrumValue Log2 (const SpectrumValue& arg);
 SpectrumValue Log (const SpectrumValue& arg);
 double Integral (const SpectrumValue& arg);
+void ComputeSinr (const SpectrumValue& signal, const SpectrumValue& interference,
+                  const SpectrumValue& noise, SpectrumValue& sinr);
 
 
 } // namespace ns3
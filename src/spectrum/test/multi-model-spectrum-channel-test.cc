@@ -0,0 +1,392 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/double.h>
+#include <ns3/boolean.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/net-device.h>
+#include <ns3/antenna-model.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/propagation-delay-model.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/node.h>
+#include <ns3/simple-net-device.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * A SpectrumPhy which records the signals it receives.
+ */
+class RecordingSpectrumPhy : public SpectrumPhy
+{
+public:
+  /**
+   * Constructor.
+   * \param model The RX spectrum model.
+   * \param mobility The mobility model, possibly 0.
+   */
+  RecordingSpectrumPhy (Ptr<const SpectrumModel> model, Ptr<MobilityModel> mobility)
+    : m_model (model),
+      m_mobility (mobility)
+  {}
+
+  // inherited from SpectrumPhy
+  virtual void SetDevice (Ptr<NetDevice> d)
+  {
+    m_device = d;
+  }
+  virtual Ptr<NetDevice> GetDevice () const
+  {
+    return m_device;
+  }
+  virtual void SetMobility (Ptr<MobilityModel> m)
+  {
+    m_mobility = m;
+  }
+  virtual Ptr<MobilityModel> GetMobility ()
+  {
+    return m_mobility;
+  }
+  virtual void SetChannel (Ptr<SpectrumChannel> c)
+  {}
+  virtual Ptr<const SpectrumModel> GetRxSpectrumModel () const
+  {
+    return m_model;
+  }
+  virtual Ptr<AntennaModel> GetRxAntenna ()
+  {
+    return 0;
+  }
+  virtual void StartRx (Ptr<SpectrumSignalParameters> params)
+  {
+    m_times.push_back (Simulator::Now ());
+    m_powersDbm.push_back (10 * std::log10 (Integral (*params->psd)) + 30);
+    m_contexts.push_back (Simulator::GetContext ());
+  }
+
+  std::vector<Time> m_times;         //!< Reception times.
+  std::vector<double> m_powersDbm;   //!< Received powers.
+  std::vector<uint32_t> m_contexts;  //!< Reception contexts.
+
+private:
+  Ptr<const SpectrumModel> m_model;  //!< RX spectrum model.
+  Ptr<MobilityModel> m_mobility;     //!< Mobility model.
+  Ptr<NetDevice> m_device;           //!< Device, possibly 0.
+};
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * Check the receiver culling and the batched delivery of
+ * MultiModelSpectrumChannel.
+ *
+ * A 0 dBm signal is transmitted to receivers at 10, 100, 200, 1000 and
+ * 3000 m, with a free-space path loss, and to a receiver without
+ * mobility model.
+ */
+class MultiModelSpectrumChannelCullingTestCase : public TestCase
+{
+public:
+  MultiModelSpectrumChannelCullingTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Transmit a signal once.
+   * \param maxRange The MaxRange attribute of the channel.
+   * \param minRxPowerDbm The MinRxPowerDbm attribute of the channel.
+   * \param batchResolution The BatchResolution attribute of the channel,
+   *        or a negative value to disable BatchDelivery.
+   * \param nDelivered The expected number of delivered signals.
+   * \param nCulled The expected number of culled signals.
+   */
+  void RunOne (double maxRange, double minRxPowerDbm, Time batchResolution,
+               uint64_t nDelivered, uint64_t nCulled);
+
+  std::vector<Ptr<RecordingSpectrumPhy> > m_rxPhys;  //!< The receivers.
+};
+
+MultiModelSpectrumChannelCullingTestCase::MultiModelSpectrumChannelCullingTestCase ()
+  : TestCase ("Check the culling and batched delivery of MultiModelSpectrumChannel")
+{}
+
+void
+MultiModelSpectrumChannelCullingTestCase::RunOne (double maxRange, double minRxPowerDbm,
+                                                  Time batchResolution,
+                                                  uint64_t nDelivered, uint64_t nCulled)
+{
+  BandInfo band;
+  band.fl = 2.4e9;
+  band.fc = 2.4005e9;
+  band.fh = 2.401e9;
+  Ptr<SpectrumModel> model = Create<SpectrumModel> (Bands (1, band));
+
+  Ptr<MultiModelSpectrumChannel> channel = CreateObject<MultiModelSpectrumChannel> ();
+  channel->SetAttribute ("MaxRange", DoubleValue (maxRange));
+  channel->SetAttribute ("MinRxPowerDbm", DoubleValue (minRxPowerDbm));
+  channel->SetAttribute ("BatchDelivery", BooleanValue (!batchResolution.IsStrictlyNegative ()));
+  if (!batchResolution.IsStrictlyNegative ())
+    {
+      channel->SetAttribute ("BatchResolution", TimeValue (batchResolution));
+    }
+  Ptr<LogDistancePropagationLossModel> loss = CreateObject<LogDistancePropagationLossModel> ();
+  loss->SetAttribute ("Exponent", DoubleValue (2));
+  channel->AddPropagationLossModel (loss);
+  channel->SetPropagationDelayModel (CreateObject<ConstantSpeedPropagationDelayModel> ());
+
+  Ptr<ConstantPositionMobilityModel> txMobility = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<RecordingSpectrumPhy> txPhy = Create<RecordingSpectrumPhy> (model, txMobility);
+  channel->AddRx (txPhy);
+  double distances[] = { 10, 100, 200, 1000, 3000 };
+  m_rxPhys.clear ();
+  for (uint32_t i = 0; i < 5; ++i)
+    {
+      Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (Vector (0, distances[i], 0));
+      m_rxPhys.push_back (Create<RecordingSpectrumPhy> (model, mobility));
+      channel->AddRx (m_rxPhys.back ());
+    }
+  m_rxPhys.push_back (Create<RecordingSpectrumPhy> (model, Ptr<MobilityModel> ()));
+  channel->AddRx (m_rxPhys.back ());
+
+  Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters> ();
+  params->txPhy = txPhy;
+  params->psd = Create<SpectrumValue> (model);
+  (*params->psd)[0] = 1e-9; // 0 dBm over 1 MHz
+  params->duration = MicroSeconds (100);
+  Simulator::Schedule (Seconds (1), &MultiModelSpectrumChannel::StartTx, channel, params);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (txPhy->m_times.size (), 0, "Signal delivered to the transmitter");
+  NS_TEST_EXPECT_MSG_EQ (channel->GetNDeliveredSignals (), nDelivered, "Wrong number of delivered signals");
+  NS_TEST_EXPECT_MSG_EQ (channel->GetNCulledSignals (), nCulled, "Wrong number of culled signals");
+  uint64_t nReceived = 0;
+  for (uint32_t i = 0; i < m_rxPhys.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_LT (m_rxPhys[i]->m_times.size (), 2, "Signal delivered twice");
+      nReceived += m_rxPhys[i]->m_times.size ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (nReceived, nDelivered, "Delivered signals not received");
+  // The closest receivers are never culled.
+  NS_TEST_ASSERT_MSG_EQ (m_rxPhys[1]->m_times.size (), 1, "Signal not received at 100 m");
+  NS_TEST_EXPECT_MSG_EQ_TOL (m_rxPhys[1]->m_powersDbm[0], -86.6777, 1e-3, "Wrong power at 100 m");
+  NS_TEST_ASSERT_MSG_EQ (m_rxPhys[5]->m_times.size (), 1, "Signal not received without mobility");
+  NS_TEST_EXPECT_MSG_EQ_TOL (m_rxPhys[5]->m_powersDbm[0], 0, 1e-9, "Wrong power without mobility");
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[5]->m_times[0], Seconds (1), "Wrong time without mobility");
+
+  channel->Dispose ();
+  Simulator::Destroy ();
+}
+
+void
+MultiModelSpectrumChannelCullingTestCase::DoRun (void)
+{
+  // No culling.
+  RunOne (0, -std::numeric_limits<double>::infinity (), Seconds (-1), 6, 0);
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[0]->m_times[0], Seconds (1) + NanoSeconds (33),
+                         "Wrong reception time at 10 m");
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[4]->m_times.size (), 1, "Signal not received at 3000 m");
+
+  // Receivers beyond 500 m culled.
+  RunOne (500, -std::numeric_limits<double>::infinity (), Seconds (-1), 4, 2);
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[2]->m_times.size (), 1, "Signal not received at 200 m");
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[3]->m_times.size (), 0, "Signal received at 1000 m");
+
+  // Signals weaker than -100 dBm culled: -92.7 dBm at 200 m, -106.7 dBm at 1000 m.
+  RunOne (0, -100, Seconds (-1), 4, 2);
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[2]->m_times.size (), 1, "Signal not received at 200 m");
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[3]->m_times.size (), 0, "Signal received at 1000 m");
+
+  // Both, with the delays rounded up to 1 us: 10, 100 and 200 m share a batch.
+  RunOne (150, -100, MicroSeconds (1), 3, 3);
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[0]->m_times[0], Seconds (1) + MicroSeconds (1),
+                         "Wrong batched reception time at 10 m");
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[1]->m_times[0], Seconds (1) + MicroSeconds (1),
+                         "Wrong batched reception time at 100 m");
+
+  // Batches without rounding keep the exact delays.
+  RunOne (0, -std::numeric_limits<double>::infinity (), Seconds (0), 6, 0);
+  NS_TEST_EXPECT_MSG_EQ (m_rxPhys[0]->m_times[0], Seconds (1) + NanoSeconds (33),
+                         "Wrong batched reception time at 10 m");
+  m_rxPhys.clear ();
+}
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * Check that the batched signals are delivered in the context of the
+ * receiving node, and that a receiver which gets its mobility model
+ * after the first transmission is culled by its position.
+ */
+class MultiModelSpectrumChannelBatchTestCase : public TestCase
+{
+public:
+  MultiModelSpectrumChannelBatchTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Create a receiver.
+   * \param model The RX spectrum model.
+   * \param node The node of the receiver device, or 0 for no device.
+   * \param distance The distance of the receiver, or a negative value for
+   *        no mobility model.
+   * \return The receiver.
+   */
+  Ptr<RecordingSpectrumPhy> CreatePhy (Ptr<const SpectrumModel> model, Ptr<Node> node,
+                                       double distance);
+};
+
+MultiModelSpectrumChannelBatchTestCase::MultiModelSpectrumChannelBatchTestCase ()
+  : TestCase ("Check the batch contexts and late mobility of MultiModelSpectrumChannel")
+{}
+
+Ptr<RecordingSpectrumPhy>
+MultiModelSpectrumChannelBatchTestCase::CreatePhy (Ptr<const SpectrumModel> model,
+                                                   Ptr<Node> node, double distance)
+{
+  Ptr<ConstantPositionMobilityModel> mobility;
+  if (distance >= 0)
+    {
+      mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (Vector (0, distance, 0));
+    }
+  Ptr<RecordingSpectrumPhy> phy = Create<RecordingSpectrumPhy> (model, mobility);
+  if (node)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      node->AddDevice (device);
+      phy->SetDevice (device);
+    }
+  return phy;
+}
+
+void
+MultiModelSpectrumChannelBatchTestCase::DoRun (void)
+{
+  BandInfo band;
+  band.fl = 2.4e9;
+  band.fc = 2.4005e9;
+  band.fh = 2.401e9;
+  Ptr<SpectrumModel> model = Create<SpectrumModel> (Bands (1, band));
+
+  Ptr<MultiModelSpectrumChannel> channel = CreateObject<MultiModelSpectrumChannel> ();
+  channel->SetAttribute ("MaxRange", DoubleValue (500));
+  channel->SetAttribute ("BatchDelivery", BooleanValue (true));
+  channel->SetAttribute ("BatchResolution", TimeValue (MicroSeconds (1)));
+  Ptr<LogDistancePropagationLossModel> loss = CreateObject<LogDistancePropagationLossModel> ();
+  loss->SetAttribute ("Exponent", DoubleValue (2));
+  channel->AddPropagationLossModel (loss);
+  channel->SetPropagationDelayModel (CreateObject<ConstantSpeedPropagationDelayModel> ());
+
+  Ptr<Node> txNode = CreateObject<Node> ();
+  Ptr<Node> rxNode1 = CreateObject<Node> ();
+  Ptr<Node> rxNode2 = CreateObject<Node> ();
+  Ptr<RecordingSpectrumPhy> txPhy = CreatePhy (model, txNode, 0);
+  channel->AddRx (txPhy);
+  // Two receivers on rxNode1 and one on rxNode2, all in the same batch
+  // period, and a receiver without device nor mobility model.
+  Ptr<RecordingSpectrumPhy> rxPhys[] = {
+    CreatePhy (model, rxNode1, 10),
+    CreatePhy (model, rxNode1, 100),
+    CreatePhy (model, rxNode2, 200),
+    CreatePhy (model, 0, -1)
+  };
+  for (uint32_t i = 0; i < 4; ++i)
+    {
+      channel->AddRx (rxPhys[i]);
+    }
+
+  Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters> ();
+  params->txPhy = txPhy;
+  params->psd = Create<SpectrumValue> (model);
+  (*params->psd)[0] = 1e-9; // 0 dBm over 1 MHz
+  params->duration = MicroSeconds (100);
+  Simulator::ScheduleWithContext (txNode->GetId (), Seconds (1),
+                                  &MultiModelSpectrumChannel::StartTx, channel, params);
+  Simulator::Run ();
+
+  // The receiver without device keeps the transmitter context.
+  uint32_t contexts[] = { rxNode1->GetId (), rxNode1->GetId (), rxNode2->GetId (), txNode->GetId () };
+  for (uint32_t i = 0; i < 4; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (rxPhys[i]->m_contexts.size (), 1, "Signal not received by receiver " << i);
+      NS_TEST_EXPECT_MSG_EQ (rxPhys[i]->m_contexts[0], contexts[i], "Wrong context of receiver " << i);
+    }
+  NS_TEST_EXPECT_MSG_EQ (rxPhys[2]->m_times[0], Seconds (1) + MicroSeconds (1),
+                         "Wrong batched reception time at 200 m");
+
+  // The receiver without mobility model gets one beyond MaxRange...
+  Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+  mobility->SetPosition (Vector (0, 1000, 0));
+  rxPhys[3]->SetMobility (mobility);
+  Simulator::ScheduleWithContext (txNode->GetId (), Seconds (1),
+                                  &MultiModelSpectrumChannel::StartTx, channel, params);
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (rxPhys[0]->m_times.size (), 2, "Signal not received at 10 m");
+  NS_TEST_EXPECT_MSG_EQ (rxPhys[3]->m_times.size (), 1, "Signal received at 1000 m");
+
+  // ... and then moves within MaxRange.
+  mobility->SetPosition (Vector (0, 100, 0));
+  Simulator::ScheduleWithContext (txNode->GetId (), Seconds (1),
+                                  &MultiModelSpectrumChannel::StartTx, channel, params);
+  Simulator::Run ();
+  NS_TEST_ASSERT_MSG_EQ (rxPhys[3]->m_times.size (), 2, "Signal not received at 100 m");
+  NS_TEST_EXPECT_MSG_EQ_TOL (rxPhys[3]->m_powersDbm[1], -86.6777, 1e-3, "Wrong power at 100 m");
+  NS_TEST_ASSERT_MSG_EQ (rxPhys[1]->m_times.size (), 3, "Signal not received at 100 m");
+  NS_TEST_EXPECT_MSG_EQ (rxPhys[3]->m_times[1], rxPhys[1]->m_times[2],
+                         "Wrong batched reception time at 100 m");
+
+  channel->Dispose ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup spectrum
+ * \ingroup tests
+ *
+ * MultiModelSpectrumChannel test suite.
+ */
+class MultiModelSpectrumChannelTestSuite : public TestSuite
+{
+public:
+  MultiModelSpectrumChannelTestSuite ();
+};
+
+MultiModelSpectrumChannelTestSuite::MultiModelSpectrumChannelTestSuite ()
+  : TestSuite ("multi-model-spectrum-channel", UNIT)
+{
+  AddTestCase (new MultiModelSpectrumChannelCullingTestCase, TestCase::QUICK);
+  AddTestCase (new MultiModelSpectrumChannelBatchTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static MultiModelSpectrumChannelTestSuite g_multiModelSpectrumChannelTestSuite;
@@ -241,6 +241,54 @@ SpectrumValueTestSuite::SpectrumValueTestSuite ()
   tv1rs3 = v1 >> 3;
   AddTestCase (new SpectrumValueTestCase (tv1rs3, v1rs3, "tv1rs3 = v1 >> 3"), TestCase::QUICK);
 
+  SpectrumValue tv3c (f), tv4c (f), tv5c (f), tv6c (f), tv9c (f);
+  tv3c = (v1 + v2) * v2 - v1 * v2 - v2 * v2 + v2;
+  tv4c = -(v2 - v1);
+  tv5c = (v1 - v2) * v2 + v2 * v2;
+  tv6c = (v1 + 0.0) / v2;
+  tv9c = (v1 + v2) * doubleValue - v2 * doubleValue;
+  AddTestCase (new SpectrumValueTestCase (tv3c, v2, "tv3c = (v1 + v2) * v2 - v1 * v2 - v2 * v2 + v2"), TestCase::QUICK);
+  AddTestCase (new SpectrumValueTestCase (tv4c, v4, "tv4c = -(v2 - v1)"), TestCase::QUICK);
+  AddTestCase (new SpectrumValueTestCase (tv5c, v5, "tv5c = (v1 - v2) * v2 + v2 * v2"), TestCase::QUICK);
+  AddTestCase (new SpectrumValueTestCase (tv6c, v6, "tv6c = (v1 + 0) div v2"), TestCase::QUICK);
+  AddTestCase (new SpectrumValueTestCase (tv9c, v9, "tv9c = (v1 + v2) * doubleValue - v2 * doubleValue"), TestCase::QUICK);
+
+  SpectrumValue tv3d (f), tv9d (f), tv6d;
+  tv3d = v1;
+  tv3d.AddScaled (v2, 1.0);
+  tv9d = v2;
+  tv9d *= -doubleValue;
+  tv9d.AddScaled (v1 + v2, doubleValue);
+  ComputeSinr (v1, v2 * 0.5, v2 * 0.5, tv6d);
+  AddTestCase (new SpectrumValueTestCase (tv3d, v3, "tv3d.AddScaled (v2, 1)"), TestCase::QUICK);
+  AddTestCase (new SpectrumValueTestCase (tv9d, v9, "tv9d.AddScaled (v1 + v2, doubleValue)"), TestCase::QUICK);
+  AddTestCase (new SpectrumValueTestCase (tv6d, v6, "ComputeSinr (v1, v2 div 2, v2 div 2, tv6d)"), TestCase::QUICK);
+
+  // More values than a vector register, with a remainder.
+  std::vector<double> freqs2;
+  for (int i = 1; i <= 103; i++)
+    {
+      freqs2.push_back (i);
+    }
+  Ptr<SpectrumModel> f2 = Create<SpectrumModel> (freqs2);
+  SpectrumValue w1 (f2), w2 (f2), w3 (f2), w4 (f2), w5 (f2), w6 (f2), tw (f2);
+  for (int i = 0; i < 103; i++)
+    {
+      w1[i] = 1.0 + i;
+      w2[i] = 0.5 * i - 7;
+      w3[i] = w1[i] + w2[i];
+      w4[i] = w1[i] + 3 * w2[i];
+      w5[i] = w1[i] / (w2[i] * w2[i] + 1 + w1[i]);
+      w6[i] = -w1[i] * w2[i] + 2;
+    }
+  AddTestCase (new SpectrumValueTestCase (w1 + w2, w3, "w1 + w2"), TestCase::QUICK);
+  tw = w1;
+  tw.AddScaled (w2, 3);
+  AddTestCase (new SpectrumValueTestCase (tw, w4, "w1.AddScaled (w2, 3)"), TestCase::QUICK);
+  ComputeSinr (w1, w2 * w2 + 1, w1, tw);
+  AddTestCase (new SpectrumValueTestCase (tw, w5, "ComputeSinr (w1, w2 * w2 + 1, w1)"), TestCase::QUICK);
+  AddTestCase (new SpectrumValueTestCase (-(w1 * w2) + 2, w6, "-(w1 * w2) + 2"), TestCase::QUICK);
+
 
 }
 
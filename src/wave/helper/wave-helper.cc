@@ -176,6 +176,8 @@ YansWavePhyHelper::EnableAsciiInternal (
   Ptr<NetDevice> nd,
   bool explicitFilename)
 {
+  NS_ABORT_MSG_IF (stream != 0 && stream->GetTraceFormat () != OutputStreamWrapper::TEXT,
+                   "YansWavePhyHelper::EnableAsciiInternal(): only text streams are supported");
   //
   // All of the ascii enable functions vector through here including the ones
   // that are wandering through all of devices on perhaps all of the nodes in
@@ -27,6 +27,7 @@
 #include "ns3/ampdu-subframe-header.h"
 #include "ns3/mobility-model.h"
 #include "ns3/log.h"
+#include "ns3/abort.h"
 #include "ns3/pointer.h"
 #include "ns3/radiotap-header.h"
 #include "ns3/config.h"
@@ -644,6 +645,8 @@ WifiPhyHelper::EnableAsciiInternal (
   Ptr<NetDevice> nd,
   bool explicitFilename)
 {
+  NS_ABORT_MSG_IF (stream != 0 && stream->GetTraceFormat () != OutputStreamWrapper::TEXT,
+                   "WifiPhyHelper::EnableAsciiInternal(): only text streams are supported");
   //All of the ASCII enable functions vector through here including the ones
   //that are wandering through all of devices on perhaps all of the nodes in
   //the system. We can only deal with devices of type WifiNetDevice.
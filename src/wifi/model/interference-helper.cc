@@ -35,6 +35,38 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("InterferenceHelper");
 
+namespace {
+
+/**
+ * Order a time and a NiChange by time, to search the NiChanges.
+ *
+ * \param moment the time
+ * \param change the NiChange and its time
+ * \return true if the time is before the time of the NiChange
+ */
+template <typename C>
+bool
+IsBeforeChange (const Time &moment, const C &change)
+{
+  return moment < change.first;
+}
+
+/**
+ * Order a NiChange and a time by time, to search the NiChanges.
+ *
+ * \param change the NiChange and its time
+ * \param moment the time
+ * \return true if the time of the NiChange is before the time
+ */
+template <typename C>
+bool
+IsChangeBefore (const C &change, const Time &moment)
+{
+  return change.first < moment;
+}
+
+} //anonymous namespace
+
 /****************************************************************
  *       PHY event class
  ****************************************************************/
@@ -154,8 +186,10 @@ InterferenceHelper::NiChange::GetEvent (void) const
 InterferenceHelper::InterferenceHelper ()
   : m_errorRateModel (0),
     m_numRxAntennas (1),
-    m_rxing (false)
+    m_rxing (false),
+    m_niVersion (0)
 {
+  m_niCache.version = 0;
 }
 
 InterferenceHelper::~InterferenceHelper ()
@@ -190,6 +224,7 @@ InterferenceHelper::RemoveBands(void)
   NS_LOG_FUNCTION (this);
   m_niChangesPerBand.clear();
   m_firstPowerPerBand.clear();
+  m_niVersion++;
 }
 
 void
@@ -202,6 +237,7 @@ InterferenceHelper::AddBand (WifiSpectrumBand band)
   // Always have a zero power noise event in the list
   AddNiChangeEvent (Time (0), NiChange (0.0, 0), band);
   m_firstPowerPerBand.insert ({band, 0.0});
+  m_niVersion++;
 }
 
 void
@@ -252,6 +288,7 @@ void
 InterferenceHelper::AppendEvent (Ptr<Event> event)
 {
   NS_LOG_FUNCTION (this);
+  m_niVersion++;
   RxPowerWattPerChannelBand rxPowerWattPerChannelBand = event->GetRxPowerWPerBand ();
   for (auto const& it : rxPowerWattPerChannelBand)
     {
@@ -268,9 +305,11 @@ InterferenceHelper::AppendEvent (Ptr<Event> event)
           // Always leave the first zero power noise event in the list
           ni_it->second.erase (++(ni_it->second.begin ()), GetNextPosition (event->GetStartTime (), band));
         }
-      auto first = AddNiChangeEvent (event->GetStartTime (), NiChange (previousPowerStart, event), band);
+      // Inserting into a deque invalidates the iterators
+      auto first = AddNiChangeEvent (event->GetStartTime (), NiChange (previousPowerStart, event), band)
+        - ni_it->second.begin ();
       auto last = AddNiChangeEvent (event->GetEndTime (), NiChange (previousPowerEnd, event), band);
-      for (auto i = first; i != last; ++i)
+      for (auto i = ni_it->second.begin () + first; i != last; ++i)
         {
           i->second.AddPower (it.second);
         }
@@ -301,7 +340,7 @@ InterferenceHelper::CalculateSnr (double signal, double noiseInterference, uint1
 }
 
 double
-InterferenceHelper::CalculateNoiseInterferenceW (Ptr<Event> event, NiChangesPerBand *nis, WifiSpectrumBand band) const
+InterferenceHelper::CalculateNoiseInterferenceW (Ptr<Event> event, WifiSpectrumBand band) const
 {
   NS_LOG_FUNCTION (this << band.first << band.second);
   auto firstPower_it = m_firstPowerPerBand.find (band);
@@ -309,26 +348,50 @@ InterferenceHelper::CalculateNoiseInterferenceW (Ptr<Event> event, NiChangesPerB
   double noiseInterferenceW = firstPower_it->second;
   auto ni_it = m_niChangesPerBand.find (band);
   NS_ASSERT (ni_it != m_niChangesPerBand.end ());
-  auto it = ni_it->second.find (event->GetStartTime ());
-  for (; it != ni_it->second.end () && it->first < Simulator::Now (); ++it)
-    {
-      noiseInterferenceW = it->second.GetPower () - event->GetRxPowerW (band);
-    }
-  it = ni_it->second.find (event->GetStartTime ());
-  NS_ASSERT (it != ni_it->second.end ());
-  for (; it != ni_it->second.end () && it->second.GetEvent () != event; ++it);
-  NiChanges ni;
-  ni.emplace (event->GetStartTime (), NiChange (0, event));
-  while (++it != ni_it->second.end () && it->second.GetEvent () != event)
+  const NiChanges &niChanges = ni_it->second;
+  auto it = std::lower_bound (niChanges.begin (), niChanges.end (), event->GetStartTime (),
+                              IsChangeBefore<NiChanges::value_type>);
+  NS_ASSERT (it != niChanges.end () && it->first == event->GetStartTime ());
+  // The last change since the start of the event and before now
+  auto last = std::lower_bound (it, niChanges.end (), Simulator::Now (),
+                                IsChangeBefore<NiChanges::value_type>);
+  if (last != it)
     {
-      ni.insert (*it);
+      noiseInterferenceW = (--last)->second.GetPower () - event->GetRxPowerW (band);
     }
-  ni.emplace (event->GetEndTime (), NiChange (0, event));
-  nis->insert ({band, ni});
   NS_ASSERT_MSG (noiseInterferenceW >= 0, "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
   return noiseInterferenceW;
 }
 
+const InterferenceHelper::EventNiChanges &
+InterferenceHelper::GetEventNiChanges (Ptr<Event> event, WifiSpectrumBand band) const
+{
+  NS_LOG_FUNCTION (this << band.first << band.second);
+  if (m_niCache.version == m_niVersion && m_niCache.event == event && m_niCache.band == band)
+    {
+      return m_niCache.changes;
+    }
+  auto ni_it = m_niChangesPerBand.find (band);
+  NS_ASSERT (ni_it != m_niChangesPerBand.end ());
+  const NiChanges &niChanges = ni_it->second;
+  auto it = std::lower_bound (niChanges.begin (), niChanges.end (), event->GetStartTime (),
+                              IsChangeBefore<NiChanges::value_type>);
+  for (; it != niChanges.end () && it->second.GetEvent () != event; ++it);
+  NS_ASSERT (it != niChanges.end ());
+  EventNiChanges &ni = m_niCache.changes;
+  ni.clear ();
+  ni.emplace_back (event->GetStartTime (), NiChange (0, event));
+  while (++it != niChanges.end () && it->second.GetEvent () != event)
+    {
+      ni.push_back (*it);
+    }
+  ni.emplace_back (event->GetEndTime (), NiChange (0, event));
+  m_niCache.event = event;
+  m_niCache.band = band;
+  m_niCache.version = m_niVersion;
+  return ni;
+}
+
 double
 InterferenceHelper::CalculateChunkSuccessRate (double snir, Time duration, WifiMode mode, WifiTxVector txVector) const
 {
@@ -359,14 +422,13 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate (double snir, Time duration
 
 double
 InterferenceHelper::CalculatePayloadPer (Ptr<const Event> event, uint16_t channelWidth,
-                                         NiChangesPerBand *nis, WifiSpectrumBand band,
+                                         const EventNiChanges &ni, WifiSpectrumBand band,
                                          uint16_t staId, std::pair<Time, Time> window) const
 {
   NS_LOG_FUNCTION (this << channelWidth << band.first << band.second << staId << window.first << window.second);
   const WifiTxVector txVector = event->GetTxVector ();
   double psr = 1.0; /* Packet Success Rate */
-  auto ni_it = nis->find (band)->second;
-  auto j = ni_it.begin ();
+  auto j = ni.begin ();
   Time previous = j->first;
   WifiMode payloadMode = txVector.GetMode (staId);
   WifiPreamble preamble = txVector.GetPreambleType ();
@@ -378,7 +440,17 @@ InterferenceHelper::CalculatePayloadPer (Ptr<const Event> event, uint16_t channe
   Time windowEnd = phyPayloadStart + window.second;
   double noiseInterferenceW = m_firstPowerPerBand.find (band)->second;
   double powerW = event->GetRxPowerW (band);
-  while (++j != ni_it.end ())
+  //The chunks ending before the window do not contribute: start from the last
+  //change before the window, so that the MPDUs of an A-MPDU are not evaluated
+  //from the start of the PPDU each time
+  auto k = std::lower_bound (ni.begin () + 1, ni.end (), windowStart, IsChangeBefore<EventNiChanges::value_type>);
+  if (k != ni.begin () + 1)
+    {
+      j = k - 1;
+      previous = j->first;
+      noiseInterferenceW = j->second.GetPower () - powerW;
+    }
+  while (++j != ni.end ())
     {
       Time current = j->first;
       NS_LOG_DEBUG ("previous= " << previous << ", current=" << current);
@@ -409,14 +481,13 @@ InterferenceHelper::CalculatePayloadPer (Ptr<const Event> event, uint16_t channe
 }
 
 double
-InterferenceHelper::CalculateNonHtPhyHeaderPer (Ptr<const Event> event, NiChangesPerBand *nis, WifiSpectrumBand band) const
+InterferenceHelper::CalculateNonHtPhyHeaderPer (Ptr<const Event> event, const EventNiChanges &ni, WifiSpectrumBand band) const
 {
   NS_LOG_FUNCTION (this << band.first << band.second);
   const WifiTxVector txVector = event->GetTxVector ();
   uint16_t channelWidth = txVector.GetChannelWidth () >= 40 ? 20 : txVector.GetChannelWidth (); //calculate PER on the 20 MHz primary channel for L-SIG
   double psr = 1.0; /* Packet Success Rate */
-  auto ni_it = nis->find (band)->second;
-  auto j = ni_it.begin ();
+  auto j = ni.begin ();
   Time previous = j->first;
   WifiPreamble preamble = txVector.GetPreambleType ();
   WifiMode headerMode = WifiPhy::GetPhyHeaderMode (txVector);
@@ -426,7 +497,7 @@ InterferenceHelper::CalculateNonHtPhyHeaderPer (Ptr<const Event> event, NiChange
   Time phyPayloadStart = phyTrainingSymbolsStart + WifiPhy::GetPhyTrainingSymbolDuration (txVector) + WifiPhy::GetPhySigBDuration (preamble); //PPDU start time + preamble + L-SIG + HT-SIG or SIG-A + Training + SIG-B
   double noiseInterferenceW = m_firstPowerPerBand.find (band)->second;
   double powerW = event->GetRxPowerW (band);
-  while (++j != ni_it.end ())
+  while (++j != ni.end ())
     {
       Time current = j->first;
       NS_LOG_DEBUG ("previous= " << previous << ", current=" << current);
@@ -524,14 +595,13 @@ InterferenceHelper::CalculateNonHtPhyHeaderPer (Ptr<const Event> event, NiChange
 }
 
 double
-InterferenceHelper::CalculateHtPhyHeaderPer (Ptr<const Event> event, NiChangesPerBand *nis, WifiSpectrumBand band) const
+InterferenceHelper::CalculateHtPhyHeaderPer (Ptr<const Event> event, const EventNiChanges &ni, WifiSpectrumBand band) const
 {
   NS_LOG_FUNCTION (this << band.first << band.second);
   const WifiTxVector txVector = event->GetTxVector ();
   uint16_t channelWidth = txVector.GetChannelWidth () >= 40 ? 20 : txVector.GetChannelWidth (); //calculate PER on the 20 MHz primary channel for PHY headers
   double psr = 1.0; /* Packet Success Rate */
-  auto ni_it = nis->find (band)->second;
-  auto j = ni_it.begin ();
+  auto j = ni.begin ();
   Time previous = j->first;
   WifiPreamble preamble = txVector.GetPreambleType ();
   WifiMode mcsHeaderMode;
@@ -557,7 +627,7 @@ InterferenceHelper::CalculateHtPhyHeaderPer (Ptr<const Event> event, NiChangesPe
   Time phyPayloadStart = phyTrainingSymbolsStart + WifiPhy::GetPhyTrainingSymbolDuration (txVector) + WifiPhy::GetPhySigBDuration (preamble); //PPDU start time + preamble + L-SIG + HT-SIG or SIG-A + Training + SIG-B
   double noiseInterferenceW = m_firstPowerPerBand.find (band)->second;
   double powerW = event->GetRxPowerW (band);
-  while (++j != ni_it.end ())
+  while (++j != ni.end ())
     {
       Time current = j->first;
       NS_LOG_DEBUG ("previous= " << previous << ", current=" << current);
@@ -796,8 +866,7 @@ InterferenceHelper::CalculatePayloadSnrPer (Ptr<Event> event, uint16_t channelWi
                                             uint16_t staId, std::pair<Time, Time> relativeMpduStartStop) const
 {
   NS_LOG_FUNCTION (this << channelWidth << band.first << band.second << staId << relativeMpduStartStop.first << relativeMpduStartStop.second);
-  NiChangesPerBand ni;
-  double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni, band);
+  double noiseInterferenceW = CalculateNoiseInterferenceW (event, band);
   double snr = CalculateSnr (event->GetRxPowerW (band),
                              noiseInterferenceW,
                              channelWidth,
@@ -806,7 +875,7 @@ InterferenceHelper::CalculatePayloadSnrPer (Ptr<Event> event, uint16_t channelWi
   /* calculate the SNIR at the start of the MPDU (located through windowing) and accumulate
    * all SNIR changes in the SNIR vector.
    */
-  double per = CalculatePayloadPer (event, channelWidth, &ni, band, staId, relativeMpduStartStop);
+  double per = CalculatePayloadPer (event, channelWidth, GetEventNiChanges (event, band), band, staId, relativeMpduStartStop);
 
   struct SnrPer snrPer;
   snrPer.snr = snr;
@@ -817,8 +886,7 @@ InterferenceHelper::CalculatePayloadSnrPer (Ptr<Event> event, uint16_t channelWi
 double
 InterferenceHelper::CalculateSnr (Ptr<Event> event, uint16_t channelWidth, uint8_t nss, WifiSpectrumBand band) const
 {
-  NiChangesPerBand ni;
-  double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni, band);
+  double noiseInterferenceW = CalculateNoiseInterferenceW (event, band);
   double snr = CalculateSnr (event->GetRxPowerW (band),
                              noiseInterferenceW,
                              channelWidth,
@@ -830,7 +898,6 @@ struct InterferenceHelper::SnrPer
 InterferenceHelper::CalculateNonHtPhyHeaderSnrPer (Ptr<Event> event, WifiSpectrumBand band) const
 {
   NS_LOG_FUNCTION (this << band.first << band.second);
-  NiChangesPerBand ni;
   uint16_t channelWidth;
   if (event->GetTxVector ().GetChannelWidth () >= 40)
     {
@@ -840,7 +907,7 @@ InterferenceHelper::CalculateNonHtPhyHeaderSnrPer (Ptr<Event> event, WifiSpectru
     {
       channelWidth = event->GetTxVector ().GetChannelWidth ();
     }
-  double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni, band);
+  double noiseInterferenceW = CalculateNoiseInterferenceW (event, band);
   double snr = CalculateSnr (event->GetRxPowerW (band),
                              noiseInterferenceW,
                              channelWidth,
@@ -849,7 +916,7 @@ InterferenceHelper::CalculateNonHtPhyHeaderSnrPer (Ptr<Event> event, WifiSpectru
   /* calculate the SNIR at the start of the PHY header and accumulate
    * all SNIR changes in the SNIR vector.
    */
-  double per = CalculateNonHtPhyHeaderPer (event, &ni, band);
+  double per = CalculateNonHtPhyHeaderPer (event, GetEventNiChanges (event, band), band);
 
   struct SnrPer snrPer;
   snrPer.snr = snr;
@@ -861,7 +928,6 @@ struct InterferenceHelper::SnrPer
 InterferenceHelper::CalculateHtPhyHeaderSnrPer (Ptr<Event> event, WifiSpectrumBand band) const
 {
   NS_LOG_FUNCTION (this << band.first << band.second);
-  NiChangesPerBand ni;
   uint16_t channelWidth;
   if (event->GetTxVector ().GetChannelWidth () >= 40)
     {
@@ -871,7 +937,7 @@ InterferenceHelper::CalculateHtPhyHeaderSnrPer (Ptr<Event> event, WifiSpectrumBa
     {
       channelWidth = event->GetTxVector ().GetChannelWidth ();
     }
-  double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni, band);
+  double noiseInterferenceW = CalculateNoiseInterferenceW (event, band);
   double snr = CalculateSnr (event->GetRxPowerW (band),
                              noiseInterferenceW,
                              channelWidth,
@@ -880,7 +946,7 @@ InterferenceHelper::CalculateHtPhyHeaderSnrPer (Ptr<Event> event, WifiSpectrumBa
   /* calculate the SNIR at the start of the PHY header and accumulate
    * all SNIR changes in the SNIR vector.
    */
-  double per = CalculateHtPhyHeaderPer (event, &ni, band);
+  double per = CalculateHtPhyHeaderPer (event, GetEventNiChanges (event, band), band);
   
   struct SnrPer snrPer;
   snrPer.snr = snr;
@@ -891,7 +957,8 @@ InterferenceHelper::CalculateHtPhyHeaderSnrPer (Ptr<Event> event, WifiSpectrumBa
 void
 InterferenceHelper::EraseEvents (void)
 {
-  for (auto it : m_niChangesPerBand)
+  m_niVersion++;
+  for (auto & it : m_niChangesPerBand)
     {
       it.second.clear ();
       // Always have a zero power noise event in the list
@@ -906,7 +973,8 @@ InterferenceHelper::GetNextPosition (Time moment, WifiSpectrumBand band) const
 {
   auto it = m_niChangesPerBand.find (band);
   NS_ASSERT (it != m_niChangesPerBand.end ());
-  return it->second.upper_bound (moment);
+  return std::upper_bound (it->second.begin (), it->second.end (), moment,
+                           IsBeforeChange<NiChanges::value_type>);
 }
 
 InterferenceHelper::NiChanges::const_iterator
@@ -939,8 +1007,9 @@ InterferenceHelper::NotifyRxEnd ()
 {
   NS_LOG_FUNCTION (this);
   m_rxing = false;
+  m_niVersion++;
   //Update m_firstPower for frame capture
-  for (auto ni : m_niChangesPerBand)
+  for (const auto & ni : m_niChangesPerBand)
     {
       NS_ASSERT (ni.second.size () > 1);
       auto it = GetPreviousPosition (Simulator::Now (), ni.first);
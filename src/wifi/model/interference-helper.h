@@ -25,6 +25,8 @@
 #include "ns3/wifi-spectrum-value-helper.h"
 #include "wifi-tx-vector.h"
 #include <map>
+#include <deque>
+#include <vector>
 
 namespace ns3 {
 
@@ -344,15 +346,37 @@ private:
   };
 
   /**
-   * typedef for a multimap of NiChange
+   * typedef for a time-ordered sequence of NiChange. Changes occurring at
+   * the same time are kept in the order they were added. The changes are
+   * added close to the end and pruned from the front, hence a deque.
    */
-  typedef std::multimap<Time, NiChange> NiChanges;
+  typedef std::deque<std::pair<Time, NiChange> > NiChanges;
 
   /**
    * Map of NiChanges per band
    */
   typedef std::map <WifiSpectrumBand, NiChanges> NiChangesPerBand;
 
+  /**
+   * The NiChanges which occur during an event, bracketed by a zero power
+   * change at the start and at the end of the event.
+   */
+  typedef std::vector<std::pair<Time, NiChange> > EventNiChanges;
+
+  /**
+   * The NiChanges of the last event for which they were requested. The
+   * PHY header and each MPDU of the payload of an event are evaluated
+   * separately, and the changes are only extracted again if an event
+   * was added or removed in the meantime.
+   */
+  struct EventNiChangesCache
+  {
+    Ptr<Event> event;           //!< the event
+    WifiSpectrumBand band;      //!< the band
+    uint64_t version;           //!< the value of m_niVersion
+    EventNiChanges changes;     //!< the NiChanges during the event
+  };
+
   /**
    * Append the given Event.
    *
@@ -363,12 +387,20 @@ private:
    * Calculate noise and interference power in W.
    *
    * \param event the event
-   * \param nis the NiChanges
    * \param band the band
    *
    * \return noise and interference power
    */
-  double CalculateNoiseInterferenceW (Ptr<Event> event, NiChangesPerBand *nis, WifiSpectrumBand band) const;
+  double CalculateNoiseInterferenceW (Ptr<Event> event, WifiSpectrumBand band) const;
+  /**
+   * Get the NiChanges which occur during an event.
+   *
+   * \param event the event
+   * \param band the band
+   *
+   * \return the NiChanges during the event
+   */
+  const EventNiChanges & GetEventNiChanges (Ptr<Event> event, WifiSpectrumBand band) const;
   /**
    * Calculate the success rate of the payload chunk given the SINR, duration, and Wi-Fi mode.
    * The duration and mode are used to calculate how many bits are present in the chunk.
@@ -388,37 +420,37 @@ private:
    *
    * \param event the event
    * \param channelWidth the channel width used to transmit the PSDU (in MHz)
-   * \param nis the NiChanges
+   * \param ni the NiChanges during the event
    * \param band identify the band used by the PSDU
    * \param staId the station ID of the PSDU (only used for MU)
    * \param window time window (pair of start and end times) of PHY payload to focus on
    *
    * \return the error rate of the payload
    */
-  double CalculatePayloadPer (Ptr<const Event> event, uint16_t channelWidth, NiChangesPerBand *nis, WifiSpectrumBand band,
+  double CalculatePayloadPer (Ptr<const Event> event, uint16_t channelWidth, const EventNiChanges &ni, WifiSpectrumBand band,
                               uint16_t staId, std::pair<Time, Time> window) const;
   /**
    * Calculate the error rate of the non-HT PHY header. The non-HT PHY header
    * can be divided into multiple chunks (e.g. due to interference from other transmissions).
    *
    * \param event the event
-   * \param nis the NiChanges
+   * \param ni the NiChanges during the event
    * \param band the band
    *
    * \return the error rate of the non-HT PHY header
    */
-  double CalculateNonHtPhyHeaderPer (Ptr<const Event> event, NiChangesPerBand *nis, WifiSpectrumBand band) const;
+  double CalculateNonHtPhyHeaderPer (Ptr<const Event> event, const EventNiChanges &ni, WifiSpectrumBand band) const;
   /**
    * Calculate the error rate of the HT PHY header. TheHT PHY header
    * can be divided into multiple chunks (e.g. due to interference from other transmissions).
    *
    * \param event the event
-   * \param nis the NiChanges
+   * \param ni the NiChanges during the event
    * \param band the band
    *
    * \return the error rate of the HT PHY header
    */
-  double CalculateHtPhyHeaderPer (Ptr<const Event> event, NiChangesPerBand *nis, WifiSpectrumBand band) const;
+  double CalculateHtPhyHeaderPer (Ptr<const Event> event, const EventNiChanges &ni, WifiSpectrumBand band) const;
 
   double m_noiseFigure;                                    //!< noise figure (linear)
   Ptr<ErrorRateModel> m_errorRateModel;                    //!< error rate model
@@ -426,6 +458,8 @@ private:
   NiChangesPerBand m_niChangesPerBand;                     //!< NI Changes for each band
   std::map <WifiSpectrumBand, double> m_firstPowerPerBand; //!< first power of each band in watts
   bool m_rxing;                                            //!< flag whether it is in receiving state
+  uint64_t m_niVersion;                                    //!< incremented whenever the NI changes are modified
+  mutable EventNiChangesCache m_niCache;                   //!< NI changes of the last evaluated event
 
   /**
    * Returns an iterator to the first NiChange that is later than moment
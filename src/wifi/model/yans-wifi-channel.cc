@@ -21,6 +21,7 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
+#include "ns3/double.h"
 #include "ns3/net-device.h"
 #include "ns3/node.h"
 #include "ns3/propagation-loss-model.h"
@@ -53,11 +54,37 @@ YansWifiChannel::GetTypeId (void)
                    PointerValue (),
                    MakePointerAccessor (&YansWifiChannel::m_delay),
                    MakePointerChecker<PropagationDelayModel> ())
+    .AddAttribute ("MaxRange",
+                   "If positive, the maximum distance in meters at which "
+                   "transmissions are delivered.  The propagation loss and "
+                   "delay are then only computed for the PHYs within this "
+                   "distance of the transmitter, which are found from a "
+                   "spatial index of their positions.  This parameter is to "
+                   "be used to reduce the computational load of large "
+                   "topologies.  It must be larger than the interference "
+                   "range of the propagation loss model, and also changes "
+                   "the random numbers drawn by random loss models.  The "
+                   "default value of zero delivers transmissions to all PHYs.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&YansWifiChannel::m_maxRange),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("MaxLossDb",
+                   "The maximum loss in dB for which transmissions will be "
+                   "passed to the receiving PHY.  Signals for which the "
+                   "PropagationLossModel returns a loss bigger than this value "
+                   "will not be propagated to the receiver.  Note that the "
+                   "default value corresponds to considering all signals "
+                   "for reception.  Tune this value with care.",
+                   DoubleValue (1.0e9),
+                   MakeDoubleAccessor (&YansWifiChannel::m_maxLossDb),
+                   MakeDoubleChecker<double> ())
   ;
   return tid;
 }
 
 YansWifiChannel::YansWifiChannel ()
+  : m_maxRange (0),
+    m_maxLossDb (1.0e9)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -68,6 +95,14 @@ YansWifiChannel::~YansWifiChannel ()
   m_phyList.clear ();
 }
 
+void
+YansWifiChannel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_grid.Clear ();
+  Channel::DoDispose ();
+}
+
 void
 YansWifiChannel::SetPropagationLossModel (const Ptr<PropagationLossModel> loss)
 {
@@ -82,14 +117,48 @@ YansWifiChannel::SetPropagationDelayModel (const Ptr<PropagationDelayModel> dela
   m_delay = delay;
 }
 
+const std::vector<uint32_t> &
+YansWifiChannel::GetCandidates (Ptr<YansWifiPhy> sender) const
+{
+  if (m_maxRange <= 0)
+    {
+      if (m_candidates.size () != m_phyList.size ())
+        {
+          m_candidates.resize (m_phyList.size ());
+          for (uint32_t i = 0; i < m_phyList.size (); i++)
+            {
+              m_candidates[i] = i;
+            }
+        }
+      return m_candidates;
+    }
+  if (m_grid.GetCellSize () != m_maxRange)
+    {
+      m_grid.SetCellSize (m_maxRange);
+    }
+  // The PHYs are indexed lazily, since their mobility model is usually
+  // set after they are added to the channel.
+  while (m_grid.GetNItems () < m_phyList.size ())
+    {
+      Ptr<MobilityModel> mobility = m_phyList[m_grid.GetNItems ()]->GetMobility ();
+      NS_ASSERT (mobility != 0);
+      m_grid.Add (mobility);
+    }
+  m_grid.GetNeighbors (sender->GetMobility ()->GetPosition (), m_maxRange, m_candidates);
+  NS_LOG_DEBUG (m_candidates.size () << " candidate receivers out of " << m_phyList.size ());
+  return m_candidates;
+}
+
 void
 YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const
 {
   NS_LOG_FUNCTION (this << sender << ppdu << txPowerDbm);
   Ptr<MobilityModel> senderMobility = sender->GetMobility ();
   NS_ASSERT (senderMobility != 0);
-  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++)
+  const std::vector<uint32_t> &candidates = GetCandidates (sender);
+  for (std::vector<uint32_t>::const_iterator j = candidates.begin (); j != candidates.end (); j++)
     {
+      PhyList::const_iterator i = m_phyList.begin () + *j;
       if (sender != (*i))
         {
           //For now don't account for inter channel interference nor channel bonding
@@ -99,10 +168,19 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
             }
 
           Ptr<MobilityModel> receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
+          if (m_maxRange > 0 && senderMobility->GetDistanceFrom (receiverMobility) > m_maxRange)
+            {
+              continue;
+            }
           Time delay = m_delay->GetDelay (senderMobility, receiverMobility);
           double rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility);
           NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, " <<
                         "distance=" << senderMobility->GetDistanceFrom (receiverMobility) << "m, delay=" << delay);
+          if (txPowerDbm - rxPowerDbm > m_maxLossDb)
+            {
+              // beyond range
+              continue;
+            }
           Ptr<WifiPpdu> copy = Copy (ppdu);
           Ptr<NetDevice> dstNetDevice = (*i)->GetDevice ();
           uint32_t dstNode;
@@ -22,6 +22,7 @@
 #define YANS_WIFI_CHANNEL_H
 
 #include "ns3/channel.h"
+#include "ns3/spatial-grid.h"
 
 namespace ns3 {
 
@@ -41,6 +42,13 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * By default, every transmission is delivered to all the other PHYs on
+ * the channel.  In large topologies, setting the \c MaxRange attribute
+ * restricts the propagation computations to the PHYs within this
+ * distance of the transmitter, found from a SpatialGrid of their
+ * positions, and \c MaxLossDb prevents scheduling the reception of
+ * signals too weak to matter.
  */
 class YansWifiChannel : public Channel
 {
@@ -98,6 +106,9 @@ public:
   int64_t AssignStreams (int64_t stream);
 
 
+protected:
+  virtual void DoDispose (void);
+
 private:
   /**
    * A vector of pointers to YansWifiPhy.
@@ -115,9 +126,21 @@ private:
    */
   static void Receive (Ptr<YansWifiPhy> receiver, Ptr<WifiPpdu> ppdu, double txPowerDbm);
 
+  /**
+   * Get the PHYs to which a transmission may be delivered.
+   *
+   * \param sender the PHY object from which the packet is originating
+   * \return the indexes of the candidate receivers in the PHY list
+   */
+  const std::vector<uint32_t> & GetCandidates (Ptr<YansWifiPhy> sender) const;
+
   PhyList m_phyList;                   //!< List of YansWifiPhys connected to this YansWifiChannel
   Ptr<PropagationLossModel> m_loss;    //!< Propagation loss model
   Ptr<PropagationDelayModel> m_delay;  //!< Propagation delay model
+  double m_maxRange;                   //!< Maximum distance of the receivers (m), or 0
+  double m_maxLossDb;                  //!< Maximum loss of the received signals (dB)
+  mutable SpatialGrid m_grid;          //!< Positions of the PHYs, if m_maxRange is set
+  mutable std::vector<uint32_t> m_candidates; //!< Candidate receivers of the current transmission
 };
 
 } //namespace ns3
@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/packet.h"
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/yans-wifi-helper.h"
+#include "ns3/yans-wifi-channel.h"
+#include <map>
+
+using namespace ns3;
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Make sure that YansWifiChannel only delivers transmissions within
+ * MaxRange, and whose loss does not exceed MaxLossDb.
+ *
+ * A node broadcasts a packet every second to a node 50 m away, a node
+ * 150 m away, and a node approaching at 50 m/s from 290 m away, which
+ * passes the transmitter at 5.8 s.  The propagation loss does not depend
+ * on the distance, so that all the nodes receive all the packets, unless
+ * the channel MaxRange is set to 100 m: then the first node receives all
+ * the packets, the second one none, and the moving node only the packets
+ * sent between 4 s and 7 s.  The loss is about 66 dB, so that no packet
+ * is received if MaxLossDb is set to 60 dB.
+ */
+class YansWifiChannelCullingTest : public TestCase
+{
+public:
+  YansWifiChannelCullingTest ();
+  virtual void DoRun (void);
+
+private:
+  /**
+   * Run the scenario.
+   * \param maxRange the MaxRange attribute of the channel, 0 for none
+   * \param maxLossDb the MaxLossDb attribute of the channel
+   * \param expected the number of packets expected by the three receivers
+   */
+  void RunOne (double maxRange, double maxLossDb, const uint32_t expected[3]);
+  /**
+   * Broadcast a packet.
+   * \param device the sending device
+   */
+  void SendOnePacket (Ptr<NetDevice> device);
+  /**
+   * Receive a packet.
+   * \param device the receiving device
+   * \param packet the packet
+   * \param protocol the protocol number
+   * \param sender the address of the sender
+   * \return true
+   */
+  bool Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &sender);
+
+  std::map<Ptr<NetDevice>, uint32_t> m_received; ///< number of packets received by each device
+};
+
+YansWifiChannelCullingTest::YansWifiChannelCullingTest ()
+  : TestCase ("Check the YansWifiChannel MaxRange and MaxLossDb attributes")
+{
+}
+
+void
+YansWifiChannelCullingTest::SendOnePacket (Ptr<NetDevice> device)
+{
+  device->Send (Create<Packet> (100), device->GetBroadcast (), 1);
+}
+
+bool
+YansWifiChannelCullingTest::Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &sender)
+{
+  m_received[device]++;
+  return true;
+}
+
+void
+YansWifiChannelCullingTest::RunOne (double maxRange, double maxLossDb, const uint32_t expected[3])
+{
+  m_received.clear ();
+  NodeContainer nodes;
+  nodes.Create (4);
+
+  YansWifiChannelHelper channelHelper;
+  channelHelper.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  channelHelper.AddPropagationLoss ("ns3::FixedRssLossModel", "Rss", DoubleValue (-50));
+  Ptr<YansWifiChannel> channel = channelHelper.Create ();
+  channel->SetAttribute ("MaxRange", DoubleValue (maxRange));
+  channel->SetAttribute ("MaxLossDb", DoubleValue (maxLossDb));
+  YansWifiPhyHelper phy;
+  phy.SetChannel (channel);
+
+  WifiHelper wifi;
+  wifi.SetStandard (WIFI_STANDARD_80211a);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager");
+  WifiMacHelper mac;
+  mac.SetType ("ns3::AdhocWifiMac");
+  NetDeviceContainer devices = wifi.Install (phy, mac, nodes);
+
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (50.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (0.0, 150.0, 0.0));
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (NodeContainer (nodes.Get (0), nodes.Get (1), nodes.Get (2)));
+  Ptr<ConstantVelocityMobilityModel> moving = CreateObject<ConstantVelocityMobilityModel> ();
+  moving->SetPosition (Vector (290.0, 0.0, 0.0));
+  moving->SetVelocity (Vector (-50.0, 0.0, 0.0));
+  nodes.Get (3)->AggregateObject (moving);
+
+  for (uint32_t i = 1; i < 4; i++)
+    {
+      devices.Get (i)->SetReceiveCallback (MakeCallback (&YansWifiChannelCullingTest::Receive, this));
+    }
+  for (uint32_t t = 1; t <= 8; t++)
+    {
+      Simulator::Schedule (Seconds (t), &YansWifiChannelCullingTest::SendOnePacket, this, devices.Get (0));
+    }
+  Simulator::Stop (Seconds (9));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_received[devices.Get (1)], expected[0], "Wrong number of packets received in range");
+  NS_TEST_EXPECT_MSG_EQ (m_received[devices.Get (2)], expected[1], "Wrong number of packets received out of range");
+  NS_TEST_EXPECT_MSG_EQ (m_received[devices.Get (3)], expected[2], "Wrong number of packets received while moving");
+}
+
+void
+YansWifiChannelCullingTest::DoRun (void)
+{
+  const uint32_t all[3] = {8, 8, 8};
+  const uint32_t inRange[3] = {8, 0, 4};
+  const uint32_t none[3] = {0, 0, 0};
+  RunOne (0, 1.0e9, all);
+  RunOne (100, 1.0e9, inRange);
+  RunOne (0, 70, all);
+  RunOne (0, 60, none);
+  RunOne (100, 60, none);
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief YansWifiChannel Test Suite
+ */
+class YansWifiChannelTestSuite : public TestSuite
+{
+public:
+  YansWifiChannelTestSuite ();
+};
+
+YansWifiChannelTestSuite::YansWifiChannelTestSuite ()
+  : TestSuite ("wifi-yans-channel", UNIT)
+{
+  AddTestCase (new YansWifiChannelCullingTest, TestCase::QUICK);
+}
+
+static YansWifiChannelTestSuite g_yansWifiChannelTestSuite; ///< the test suite
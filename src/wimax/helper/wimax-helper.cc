@@ -20,6 +20,7 @@
  */
 
 #include "wimax-helper.h"
+#include "ns3/abort.h"
 #include "ns3/simulator.h"
 #include "ns3/packet.h"
 #include "ns3/log.h"
@@ -448,6 +449,8 @@ WimaxHelper::EnableAsciiInternal (Ptr<OutputStreamWrapper> stream,
                                   Ptr<NetDevice> nd,
                                   bool explicitFilename)
 {
+  NS_ABORT_MSG_IF (stream != 0 && stream->GetTraceFormat () != OutputStreamWrapper::TEXT,
+                   "WimaxHelper::EnableAsciiInternal(): only text streams are supported");
   //
   // All of the ascii enable functions vector through here including the ones
   // that are wandering through all of devices on perhaps all of the nodes in
@@ -0,0 +1,12 @@
+set terminal post eps color enhanced
+set output "power-aparf.eps"
+set title "Average transmit power (AP to STA) vs time"
+set xlabel "Time (seconds)"
+set ylabel "Power (mW)"
+plot "-"  title "Average Transmit Power" with lines
+5 0.738136
+15 3.37723
+25 15.7338
+35 13.2129
+45 25.0129
+e
@@ -0,0 +1,12 @@
+set terminal post eps color enhanced
+set output "power-parf.eps"
+set title "Average transmit power (AP to STA) vs time"
+set xlabel "Time (seconds)"
+set ylabel "Power (mW)"
+plot "-"  title "Average Transmit Power" with lines
+5 1.09837
+15 3.22052
+25 14.6956
+35 31.1214
+45 36.9146
+e
@@ -0,0 +1,12 @@
+set terminal post eps color enhanced
+set output "power-rrpaa.eps"
+set title "Average transmit power (AP to STA) vs time"
+set xlabel "Time (seconds)"
+set ylabel "Power (mW)"
+plot "-"  title "Average Transmit Power" with lines
+5 7.27999
+15 3.41095
+25 17.2427
+35 29.9754
+45 33.8325
+e
@@ -0,0 +1,12 @@
+set terminal post eps color enhanced
+set output "throughput-aparf.eps"
+set title "Throughput (AP to STA) vs time"
+set xlabel "Time (seconds)"
+set ylabel "Throughput (Mb/s)"
+plot "-"  title "Throughput Mbits/s" with lines
+5 29.0362
+15 23.3107
+25 23.5834
+35 14.8702
+45 14.1318
+e
@@ -0,0 +1,12 @@
+set terminal post eps color enhanced
+set output "throughput-parf.eps"
+set title "Throughput (AP to STA) vs time"
+set xlabel "Time (seconds)"
+set ylabel "Throughput (Mb/s)"
+plot "-"  title "Throughput Mbits/s" with lines
+5 29.0362
+15 22.6746
+25 22.561
+35 20.3798
+45 15.779
+e
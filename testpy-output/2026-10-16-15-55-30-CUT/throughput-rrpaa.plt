@@ -0,0 +1,12 @@
+set terminal post eps color enhanced
+set output "throughput-rrpaa.eps"
+set title "Throughput (AP to STA) vs time"
+set xlabel "Time (seconds)"
+set ylabel "Throughput (Mb/s)"
+plot "-"  title "Throughput Mbits/s" with lines
+5 27.5934
+15 24.9125
+25 26.0258
+35 19.6301
+45 14.9043
+e
@@ -0,0 +1,2824 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "yans-frame-success-rate-n.eps"
+set xlabel "SNR(dB)"
+set ylabel "Frame Success Rate"
+set xrange [-5:30]
+set yrange [0:1.2]
+set style line 1 linewidth 5
+set style line 2 linewidth 5
+set style line 3 linewidth 5
+set style line 4 linewidth 5
+set style line 5 linewidth 5
+set style line 6 linewidth 5
+set style line 7 linewidth 5
+set style line 8 linewidth 5
+set style increment user
+plot "-"  title "HtMcs0" with lines, "-"  title "HtMcs1" with lines, "-"  title "HtMcs2" with lines, "-"  title "HtMcs3" with lines, "-"  title "HtMcs4" with lines, "-"  title "HtMcs5" with lines, "-"  title "HtMcs6" with lines, "-"  title "HtMcs7" with lines
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 2.23032e-314
+-4.4 2.68225e-288
+-4.3 5.67561e-264
+-4.2 2.57694e-241
+-4.1 3.04391e-220
+-4 1.12767e-200
+-3.9 1.57084e-182
+-3.8 9.8106e-166
+-3.7 3.25797e-150
+-3.6 6.78664e-136
+-3.5 1.04061e-122
+-3.4 1.37094e-110
+-3.3 1.80195e-99
+-3.2 2.72932e-89
+-3.1 5.47343e-80
+-3 1.66095e-71
+-2.9 8.67049e-64
+-2.8 8.80443e-57
+-2.7 1.95615e-50
+-2.6 1.0639e-44
+-2.5 1.57635e-39
+-2.4 7.04376e-35
+-2.3 1.04527e-30
+-2.2 5.64328e-27
+-2.1 1.20804e-23
+-2 1.11185e-20
+-1.9 4.74712e-18
+-1.8 1.00951e-15
+-1.7 1.14264e-13
+-1.6 7.32193e-12
+-1.5 2.81267e-10
+-1.4 6.82913e-09
+-1.3 1.10036e-07
+-1.2 1.23047e-06
+-1.1 9.94862e-06
+-1 6.03712e-05
+-0.9 0.000284455
+-0.8 0.00107314
+-0.7 0.00333265
+-0.6 0.00873426
+-0.5 0.0197532
+-0.4 0.0393228
+-0.3 0.0701291
+-0.2 0.113805
+-0.1 0.170368
+-1.02696e-15 0.238117
+0.1 0.313994
+0.2 0.39421
+0.3 0.474927
+0.4 0.552784
+0.5 0.625214
+0.6 0.690541
+0.7 0.747917
+0.8 0.797174
+0.9 0.838634
+1 0.87294
+1.1 0.900903
+1.2 0.923398
+1.3 0.94128
+1.4 0.955345
+1.5 0.9663
+1.6 0.974756
+1.7 0.981227
+1.8 0.986138
+1.9 0.989838
+2 0.992603
+2.1 0.994654
+2.2 0.996164
+2.3 0.997267
+2.4 0.998068
+2.5 0.998644
+2.6 0.999055
+2.7 0.999347
+2.8 0.999552
+2.9 0.999696
+3 0.999795
+3.1 0.999863
+3.2 0.999909
+3.3 0.99994
+3.4 0.999961
+3.5 0.999975
+3.6 0.999984
+3.7 0.99999
+3.8 0.999994
+3.9 0.999996
+4 0.999998
+4.1 0.999999
+4.2 0.999999
+4.3 0.999999
+4.4 1
+4.5 1
+4.6 1
+4.7 1
+4.8 1
+4.9 1
+5 1
+5.1 1
+5.2 1
+5.3 1
+5.4 1
+5.5 1
+5.6 1
+5.7 1
+5.8 1
+5.9 1
+6 1
+6.1 1
+6.2 1
+6.3 1
+6.4 1
+6.5 1
+6.6 1
+6.7 1
+6.8 1
+6.9 1
+7 1
+7.1 1
+7.2 1
+7.3 1
+7.4 1
+7.5 1
+7.6 1
+7.7 1
+7.8 1
+7.9 1
+8 1
+8.1 1
+8.2 1
+8.3 1
+8.4 1
+8.5 1
+8.6 1
+8.7 1
+8.8 1
+8.9 1
+9 1
+9.1 1
+9.2 1
+9.3 1
+9.4 1
+9.5 1
+9.6 1
+9.7 1
+9.8 1
+9.9 1
+10 1
+10.1 1
+10.2 1
+10.3 1
+10.4 1
+10.5 1
+10.6 1
+10.7 1
+10.8 1
+10.9 1
+11 1
+11.1 1
+11.2 1
+11.3 1
+11.4 1
+11.5 1
+11.6 1
+11.7 1
+11.8 1
+11.9 1
+12 1
+12.1 1
+12.2 1
+12.3 1
+12.4 1
+12.5 1
+12.6 1
+12.7 1
+12.8 1
+12.9 1
+13 1
+13.1 1
+13.2 1
+13.3 1
+13.4 1
+13.5 1
+13.6 1
+13.7 1
+13.8 1
+13.9 1
+14 1
+14.1 1
+14.2 1
+14.3 1
+14.4 1
+14.5 1
+14.6 1
+14.7 1
+14.8 1
+14.9 1
+15 1
+15.1 1
+15.2 1
+15.3 1
+15.4 1
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 4.92103e-302
+-1.8 1.35871e-280
+-1.7 2.67485e-260
+-1.6 4.0757e-241
+-1.5 5.21924e-223
+-1.4 6.10096e-206
+-1.3 7.07199e-190
+-1.2 8.83187e-175
+-1.1 1.29109e-160
+-1 2.40014e-147
+-0.9 6.16305e-135
+-0.8 2.37356e-123
+-0.7 1.48805e-112
+-0.6 1.6473e-102
+-0.5 3.49034e-93
+-0.4 1.53299e-84
+-0.3 1.51001e-76
+-0.2 3.6048e-69
+-0.1 2.25096e-62
+-1.02696e-15 3.9622e-56
+0.1 2.11536e-50
+0.2 3.67929e-45
+0.3 2.23516e-40
+0.4 5.07448e-36
+0.5 4.59692e-32
+0.6 1.77021e-28
+0.7 3.08001e-25
+0.8 2.56738e-22
+0.9 1.08445e-19
+1 2.44895e-17
+1.1 3.11137e-15
+1.2 2.33423e-13
+1.3 1.08251e-11
+1.4 3.24013e-10
+1.5 6.51826e-09
+1.6 9.15421e-08
+1.7 9.29829e-07
+1.8 7.05936e-06
+1.9 4.12987e-05
+2 0.000191479
+2.1 0.000721998
+2.2 0.00226695
+2.3 0.0060562
+2.4 0.014038
+2.5 0.0287367
+2.6 0.0527852
+2.7 0.088253
+2.8 0.136025
+2.9 0.195478
+3 0.26455
+3.1 0.340155
+3.2 0.418751
+3.3 0.496894
+3.4 0.571659
+3.5 0.640858
+3.6 0.703097
+3.7 0.757709
+3.8 0.80461
+3.9 0.844145
+4 0.876928
+4.1 0.903723
+4.2 0.925344
+4.3 0.942589
+4.4 0.956201
+4.5 0.96684
+4.6 0.975081
+4.7 0.981411
+4.8 0.986232
+4.9 0.989876
+5 0.992609
+5.1 0.994643
+5.2 0.996145
+5.3 0.997247
+5.4 0.998048
+5.5 0.998627
+5.6 0.999041
+5.7 0.999336
+5.8 0.999543
+5.9 0.999689
+6 0.99979
+6.1 0.999859
+6.2 0.999906
+6.3 0.999938
+6.4 0.99996
+6.5 0.999974
+6.6 0.999983
+6.7 0.999989
+6.8 0.999993
+6.9 0.999996
+7 0.999997
+7.1 0.999998
+7.2 0.999999
+7.3 0.999999
+7.4 1
+7.5 1
+7.6 1
+7.7 1
+7.8 1
+7.9 1
+8 1
+8.1 1
+8.2 1
+8.3 1
+8.4 1
+8.5 1
+8.6 1
+8.7 1
+8.8 1
+8.9 1
+9 1
+9.1 1
+9.2 1
+9.3 1
+9.4 1
+9.5 1
+9.6 1
+9.7 1
+9.8 1
+9.9 1
+10 1
+10.1 1
+10.2 1
+10.3 1
+10.4 1
+10.5 1
+10.6 1
+10.7 1
+10.8 1
+10.9 1
+11 1
+11.1 1
+11.2 1
+11.3 1
+11.4 1
+11.5 1
+11.6 1
+11.7 1
+11.8 1
+11.9 1
+12 1
+12.1 1
+12.2 1
+12.3 1
+12.4 1
+12.5 1
+12.6 1
+12.7 1
+12.8 1
+12.9 1
+13 1
+13.1 1
+13.2 1
+13.3 1
+13.4 1
+13.5 1
+13.6 1
+13.7 1
+13.8 1
+13.9 1
+14 1
+14.1 1
+14.2 1
+14.3 1
+14.4 1
+14.5 1
+14.6 1
+14.7 1
+14.8 1
+14.9 1
+15 1
+15.1 1
+15.2 1
+15.3 1
+15.4 1
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 4.91713e-296
+2.3 2.07038e-265
+2.4 1.79379e-237
+2.5 4.9376e-212
+2.6 6.51448e-189
+2.7 6.08049e-168
+2.8 5.80378e-149
+2.9 8.02711e-132
+3 2.23636e-116
+3.1 1.71287e-102
+3.2 4.83582e-90
+3.3 6.6327e-79
+3.4 5.7292e-69
+3.5 3.97571e-60
+3.6 2.78379e-52
+3.7 2.43339e-45
+3.8 3.23805e-39
+3.9 7.88692e-34
+4 4.1713e-29
+4.1 5.6096e-25
+4.2 2.21843e-21
+4.3 2.94856e-18
+4.4 1.48836e-15
+4.5 3.18979e-13
+4.6 3.21203e-11
+4.7 1.66576e-09
+4.8 4.83301e-08
+4.9 8.45096e-07
+5 9.51917e-06
+5.1 7.32957e-05
+5.2 0.00040666
+5.3 0.00170328
+5.4 0.00561109
+5.5 0.0150699
+5.6 0.0340469
+5.7 0.06649
+5.8 0.114907
+5.9 0.179314
+6 0.257076
+6.1 0.343614
+6.2 0.433559
+6.3 0.521847
+6.4 0.604464
+6.5 0.678744
+6.6 0.743329
+6.7 0.797927
+6.8 0.843001
+6.9 0.879468
+7 0.908467
+7.1 0.931182
+7.2 0.948742
+7.3 0.962157
+7.4 0.972297
+7.5 0.979886
+7.6 0.985512
+7.7 0.989648
+7.8 0.992661
+7.9 0.994838
+8 0.996398
+8.1 0.997507
+8.2 0.998288
+8.3 0.998835
+8.4 0.999213
+8.5 0.999473
+8.6 0.999651
+8.7 0.99977
+8.8 0.99985
+8.9 0.999903
+9 0.999938
+9.1 0.999961
+9.2 0.999976
+9.3 0.999985
+9.4 0.999991
+9.5 0.999994
+9.6 0.999997
+9.7 0.999998
+9.8 0.999999
+9.9 0.999999
+10 1
+10.1 1
+10.2 1
+10.3 1
+10.4 1
+10.5 1
+10.6 1
+10.7 1
+10.8 1
+10.9 1
+11 1
+11.1 1
+11.2 1
+11.3 1
+11.4 1
+11.5 1
+11.6 1
+11.7 1
+11.8 1
+11.9 1
+12 1
+12.1 1
+12.2 1
+12.3 1
+12.4 1
+12.5 1
+12.6 1
+12.7 1
+12.8 1
+12.9 1
+13 1
+13.1 1
+13.2 1
+13.3 1
+13.4 1
+13.5 1
+13.6 1
+13.7 1
+13.8 1
+13.9 1
+14 1
+14.1 1
+14.2 1
+14.3 1
+14.4 1
+14.5 1
+14.6 1
+14.7 1
+14.8 1
+14.9 1
+15 1
+15.1 1
+15.2 1
+15.3 1
+15.4 1
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 1.09189e-321
+2.1 6.1613e-310
+2.2 2.16164e-298
+2.3 4.6662e-287
+2.4 6.13895e-276
+2.5 4.87801e-265
+2.6 2.321e-254
+2.7 6.55934e-244
+2.8 1.09267e-233
+2.9 1.06532e-223
+3 6.03945e-214
+3.1 1.97901e-204
+3.2 3.72827e-195
+3.3 4.01902e-186
+3.4 2.46894e-177
+3.5 8.61374e-169
+3.6 1.70207e-160
+3.7 1.90102e-152
+3.8 1.19852e-144
+3.9 4.26288e-137
+4 8.5552e-130
+4.1 9.69672e-123
+4.2 6.2175e-116
+4.3 2.26082e-109
+4.4 4.67702e-103
+4.5 5.52658e-97
+4.6 3.74791e-91
+4.7 1.46676e-85
+4.8 3.33337e-80
+4.9 4.42999e-75
+5 3.46952e-70
+5.1 1.61488e-65
+5.2 4.5079e-61
+5.3 7.62102e-57
+5.4 7.88449e-53
+5.5 5.047e-49
+5.6 2.02216e-45
+5.7 5.13308e-42
+5.8 8.35963e-39
+5.9 8.84926e-36
+6 6.17132e-33
+6.1 2.87474e-30
+6.2 9.07191e-28
+6.3 1.96756e-25
+6.4 2.97594e-23
+6.5 3.18565e-21
+6.6 2.44966e-19
+6.7 1.3735e-17
+6.8 5.69973e-16
+6.9 1.77682e-14
+7 4.22297e-13
+7.1 7.76495e-12
+7.2 1.12067e-10
+7.3 1.28769e-09
+7.4 1.19448e-08
+7.5 9.06765e-08
+7.6 5.7083e-07
+7.7 3.01853e-06
+7.8 1.35754e-05
+7.9 5.25506e-05
+8 0.000177116
+8.1 0.000525494
+8.2 0.00138693
+8.3 0.00328885
+8.4 0.00707331
+8.5 0.0139203
+8.6 0.0252779
+8.7 0.0426868
+8.8 0.0675246
+8.9 0.100735
+9 0.142614
+9.1 0.192712
+9.2 0.249865
+9.3 0.312358
+9.4 0.378138
+9.5 0.445068
+9.6 0.511135
+9.7 0.574611
+9.8 0.634147
+9.9 0.688802
+10 0.738022
+10.1 0.781596
+10.2 0.819582
+10.3 0.852243
+10.4 0.879975
+10.5 0.903255
+10.6 0.922597
+10.7 0.938512
+10.8 0.95149
+10.9 0.961986
+11 0.970407
+11.1 0.977112
+11.2 0.982411
+11.3 0.98657
+11.4 0.989812
+11.5 0.99232
+11.6 0.994249
+11.7 0.995721
+11.8 0.996838
+11.9 0.997679
+12 0.998308
+12.1 0.998775
+12.2 0.999119
+12.3 0.999371
+12.4 0.999555
+12.5 0.999687
+12.6 0.999782
+12.7 0.999849
+12.8 0.999896
+12.9 0.999929
+13 0.999952
+13.1 0.999968
+13.2 0.999979
+13.3 0.999986
+13.4 0.999991
+13.5 0.999994
+13.6 0.999996
+13.7 0.999998
+13.8 0.999998
+13.9 0.999999
+14 0.999999
+14.1 1
+14.2 1
+14.3 1
+14.4 1
+14.5 1
+14.6 1
+14.7 1
+14.8 1
+14.9 1
+15 1
+15.1 1
+15.2 1
+15.3 1
+15.4 1
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 1.12018e-310
+8.3 1.15646e-284
+8.4 2.19585e-260
+8.5 9.21577e-238
+8.6 1.02368e-216
+8.7 3.59057e-197
+8.8 4.72699e-179
+8.9 2.76602e-162
+9 8.48658e-147
+9.1 1.60422e-132
+9.2 2.18642e-119
+9.3 2.50384e-107
+9.4 2.79557e-96
+9.5 3.51546e-86
+9.6 5.72534e-77
+9.7 1.3821e-68
+9.8 5.63248e-61
+9.9 4.39174e-54
+10 7.38756e-48
+10.1 3.00753e-42
+10.2 3.30687e-37
+10.3 1.09015e-32
+10.4 1.18981e-28
+10.5 4.72236e-25
+10.6 7.44714e-22
+10.7 5.0717e-19
+10.8 1.61279e-16
+10.9 2.57618e-14
+11 2.21247e-12
+11.1 1.08818e-10
+11.2 3.24937e-09
+11.3 6.21643e-08
+11.4 8.00533e-07
+11.5 7.26e-06
+11.6 4.83161e-05
+11.7 0.000244945
+11.8 0.000978437
+11.9 0.00317457
+12 0.00859719
+12.1 0.0199117
+12.2 0.0403021
+12.3 0.0726633
+12.4 0.118682
+12.5 0.178217
+12.6 0.249229
+12.7 0.328241
+12.8 0.411085
+12.9 0.493655
+13 0.572476
+13.1 0.645003
+13.2 0.709683
+13.3 0.765841
+13.4 0.813497
+13.5 0.853147
+13.6 0.885577
+13.7 0.911709
+13.8 0.932488
+13.9 0.948817
+14 0.961512
+14.1 0.971285
+14.2 0.978741
+14.3 0.984378
+14.4 0.988606
+14.5 0.991752
+14.6 0.994073
+14.7 0.995773
+14.8 0.997008
+14.9 0.997898
+15 0.998535
+15.1 0.998987
+15.2 0.999306
+15.3 0.999528
+15.4 0.999681
+15.5 0.999787
+15.6 0.999859
+15.7 0.999907
+15.8 0.99994
+15.9 0.999961
+16 0.999975
+16.1 0.999984
+16.2 0.99999
+16.3 0.999994
+16.4 0.999996
+16.5 0.999998
+16.6 0.999999
+16.7 0.999999
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 3.97179e-320
+9.2 1.91738e-309
+9.3 6.6202e-299
+9.4 1.61533e-288
+9.5 2.75296e-278
+9.6 3.2399e-268
+9.7 2.60403e-258
+9.8 1.41411e-248
+9.9 5.1351e-239
+10 1.2346e-229
+10.1 1.94666e-220
+10.2 1.99487e-211
+10.3 1.31733e-202
+10.4 5.56096e-194
+10.5 1.48948e-185
+10.6 2.51394e-177
+10.7 2.65693e-169
+10.8 1.74843e-161
+10.9 7.12811e-154
+11 1.79254e-146
+11.1 2.77034e-139
+11.2 2.62349e-132
+11.3 1.5189e-125
+11.4 5.36808e-119
+11.5 1.15721e-112
+11.6 1.52158e-106
+11.7 1.22118e-100
+11.8 5.9912e-95
+11.9 1.80083e-89
+12 3.32625e-84
+12.1 3.78961e-79
+12.2 2.67511e-74
+12.3 1.17616e-69
+12.4 3.24003e-65
+12.5 5.62953e-61
+12.6 6.21462e-57
+12.7 4.39377e-53
+12.8 2.00666e-49
+12.9 5.97467e-46
+13 1.1711e-42
+13.1 1.52679e-39
+13.2 1.33827e-36
+13.3 7.97552e-34
+13.4 3.26943e-31
+13.5 9.33007e-29
+13.6 1.87646e-26
+13.7 2.69333e-24
+13.8 2.79439e-22
+13.9 2.12305e-20
+14 1.19669e-18
+14.1 5.07067e-17
+14.2 1.63655e-15
+14.3 4.07643e-14
+14.4 7.93957e-13
+14.5 1.22492e-11
+14.6 1.51624e-10
+14.7 1.52492e-09
+14.8 1.26157e-08
+14.9 8.68963e-08
+15 5.04226e-07
+15.1 2.49311e-06
+15.2 1.06206e-05
+15.3 3.93977e-05
+15.4 0.000128575
+15.5 0.000372784
+15.6 0.000969263
+15.7 0.00228019
+15.8 0.0048945
+15.9 0.00966302
+16 0.0176783
+16.1 0.0301819
+16.2 0.0484042
+16.3 0.0733684
+16.4 0.105704
+16.5 0.145515
+16.6 0.192337
+16.7 0.245178
+16.8 0.302641
+16.9 0.363085
+17 0.424795
+17.1 0.48614
+17.2 0.545683
+17.3 0.602258
+17.4 0.654999
+17.5 0.703335
+17.6 0.746966
+17.7 0.785816
+17.8 0.819988
+17.9 0.849716
+18 0.875322
+18.1 0.897178
+18.2 0.915681
+18.3 0.931227
+18.4 0.944197
+18.5 0.954947
+18.6 0.963804
+18.7 0.971059
+18.8 0.976968
+18.9 0.981757
+19 0.985616
+19.1 0.988712
+19.2 0.991183
+19.3 0.993145
+19.4 0.994696
+19.5 0.995916
+19.6 0.99687
+19.7 0.997614
+19.8 0.99819
+19.9 0.998634
+20 0.998975
+20.1 0.999235
+20.2 0.999432
+20.3 0.999581
+20.4 0.999692
+20.5 0.999776
+20.6 0.999837
+20.7 0.999883
+20.8 0.999916
+20.9 0.99994
+21 0.999958
+21.1 0.999971
+21.2 0.999979
+21.3 0.999986
+21.4 0.99999
+21.5 0.999993
+21.6 0.999996
+21.7 0.999997
+21.8 0.999998
+21.9 0.999999
+22 0.999999
+22.1 0.999999
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 1.90054e-313
+13.5 1.80531e-292
+13.6 1.63226e-272
+13.7 1.4854e-253
+13.8 1.441e-235
+13.9 1.58071e-218
+14 2.08268e-202
+14.1 3.50556e-187
+14.2 8.02711e-173
+14.3 2.66557e-159
+14.4 1.36968e-146
+14.5 1.16293e-134
+14.6 1.74338e-123
+14.7 4.9332e-113
+14.8 2.81776e-103
+14.9 3.47476e-94
+15 9.89438e-86
+15.1 6.95685e-78
+15.2 1.29108e-70
+15.3 6.75664e-64
+15.4 1.06453e-57
+15.5 5.38604e-52
+15.6 9.32466e-47
+15.7 5.87894e-42
+15.8 1.43458e-37
+15.9 1.43786e-33
+16 6.27132e-30
+16.1 1.25887e-26
+16.2 1.22769e-23
+16.3 6.12815e-21
+16.4 1.64611e-18
+16.5 2.49629e-16
+16.6 2.23723e-14
+16.7 1.23765e-12
+16.8 4.40416e-11
+16.9 1.04815e-09
+17 1.7306e-08
+17.1 2.05169e-07
+17.2 1.80354e-06
+17.3 1.21123e-05
+17.4 6.38942e-05
+17.5 0.000271625
+17.6 0.000952794
+17.7 0.00281806
+17.8 0.00716811
+17.9 0.0159651
+18 0.0316463
+18.1 0.056655
+18.2 0.0928217
+18.3 0.140826
+18.4 0.199939
+18.5 0.26813
+18.6 0.342448
+18.7 0.419546
+18.8 0.496185
+18.9 0.569602
+19 0.637719
+19.1 0.699191
+19.2 0.753351
+19.3 0.800081
+19.4 0.839673
+19.5 0.872684
+19.6 0.899821
+19.7 0.921849
+19.8 0.939528
+19.9 0.953571
+20 0.964619
+20.1 0.973234
+20.2 0.979896
+20.3 0.985006
+20.4 0.988896
+20.5 0.991834
+20.6 0.994037
+20.7 0.995676
+20.8 0.996888
+20.9 0.997776
+21 0.998422
+21.1 0.998889
+21.2 0.999224
+21.3 0.999462
+21.4 0.99963
+21.5 0.999748
+21.6 0.999829
+21.7 0.999886
+21.8 0.999924
+21.9 0.99995
+22 0.999967
+22.1 0.999979
+22.2 0.999986
+22.3 0.999991
+22.4 0.999995
+22.5 0.999997
+22.6 0.999998
+22.7 0.999999
+22.8 0.999999
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 1.8905e-313
+15.5 2.98676e-288
+15.6 1.0164e-264
+15.7 8.99512e-243
+15.8 2.48631e-222
+15.9 2.56413e-203
+16 1.1725e-185
+16.1 2.8103e-169
+16.2 4.15216e-154
+16.3 4.424e-140
+16.4 3.9559e-127
+16.5 3.43676e-115
+16.6 3.34064e-104
+16.7 4.16196e-94
+16.8 7.57307e-85
+16.9 2.28129e-76
+17 1.2828e-68
+17.1 1.51033e-61
+17.2 4.15437e-55
+17.3 2.96345e-49
+17.4 6.05425e-44
+17.5 3.89227e-39
+17.6 8.60925e-35
+17.7 7.12784e-31
+17.8 2.39169e-27
+17.9 3.505e-24
+18 2.40662e-21
+18.1 8.26858e-19
+18.2 1.51167e-16
+18.3 1.55733e-14
+18.4 9.53583e-13
+18.5 3.64652e-11
+18.6 9.11654e-10
+18.7 1.55447e-08
+18.8 1.87953e-07
+18.9 1.67022e-06
+19 1.12717e-05
+19.1 5.95273e-05
+19.2 0.000252817
+19.3 0.000885186
+19.4 0.00261317
+19.5 0.00663788
+19.6 0.0147763
+19.7 0.0293034
+19.8 0.0525382
+19.9 0.0862862
+20 0.131338
+20.1 0.187206
+20.2 0.252176
+20.3 0.323622
+20.4 0.398468
+20.5 0.473638
+20.6 0.546428
+20.7 0.614716
+20.8 0.677043
+20.9 0.732588
+21 0.781069
+21.1 0.822623
+21.2 0.857674
+21.3 0.886824
+21.4 0.910762
+21.5 0.930199
+21.6 0.945818
+21.7 0.958251
+21.8 0.968061
+21.9 0.975736
+22 0.981694
+22.1 0.986283
+22.2 0.989792
+22.3 0.992456
+22.4 0.994463
+22.5 0.995965
+22.6 0.99708
+22.7 0.997902
+22.8 0.998504
+22.9 0.998941
+23 0.999256
+23.1 0.999482
+23.2 0.999642
+23.3 0.999754
+23.4 0.999833
+23.5 0.999887
+23.6 0.999925
+23.7 0.99995
+23.8 0.999967
+23.9 0.999979
+24 0.999986
+24.1 0.999991
+24.2 0.999994
+24.3 0.999997
+24.4 0.999998
+24.5 0.999999
+24.6 0.999999
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+e
@@ -328,6 +328,40 @@ benchByteTags (uint32_t n)
     }
 }
 
+static void
+benchAggregation (uint32_t n)
+{
+  BenchHeader<25> ipv4;
+  BenchHeader<20> tcp;
+  BenchHeader<26> mac;
+  BenchHeader<4> delimiter;
+  const uint32_t nMpdus = 64;
+
+  for (uint32_t i = 0; i < n; i++)
+    {
+      /* Build an A-MPDU of 64 MPDUs, each one preceded by its delimiter */
+      Ptr<Packet> ampdu = Create<Packet> ();
+      for (uint32_t j = 0; j < nMpdus; j++)
+        {
+          Ptr<Packet> mpdu = Create<Packet> (1400);
+          mpdu->AddHeader (tcp);
+          mpdu->AddHeader (ipv4);
+          mpdu->AddHeader (mac);
+          mpdu->AddHeader (delimiter);
+          ampdu->AddAtEnd (mpdu);
+        }
+
+      /* Extract the MPDUs again at the receiver */
+      uint32_t mpduSize = ampdu->GetSize () / nMpdus;
+      for (uint32_t j = 0; j < nMpdus; j++)
+        {
+          Ptr<Packet> mpdu = ampdu->CreateFragment (j * mpduSize, mpduSize);
+          mpdu->RemoveHeader (delimiter);
+          mpdu->RemoveHeader (mac);
+        }
+    }
+}
+
 static uint64_t
 runBenchOneIteration (void (*bench) (uint32_t), uint32_t n)
 {
@@ -385,6 +419,7 @@ int main (int argc, char *argv[])
   runBench (&benchD, n, minIterations, "Intermixed add/remove headers and tags");
   runBench (&benchFragment, n, minIterations, "Fragmentation and concatenation");
   runBench (&benchByteTags, n, minIterations, "Benchmark byte tags");
+  runBench (&benchAggregation, n, minIterations, "Aggregation of 64 MPDUs");
 
   return 0;
 }
@@ -18,9 +18,11 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <fstream>
+#include <utility>
 #include <vector>
 #include <string.h>
 
@@ -82,8 +84,11 @@ public:
     m_total = total;
   }
 
-  /// Run function
-  void RunBench (void);
+  /**
+   * Run function
+   * \return the simulation time per event, in seconds
+   */
+  double RunBench (void);
 private:
   /// callback function
   void Cb (void);
@@ -94,7 +99,7 @@ private:
   uint32_t m_count; ///< count
 };
 
-void
+double
 Bench::RunBench (void)
 {
   SystemWallClockMs time;
@@ -128,6 +133,7 @@ Bench::RunBench (void)
        std::setw (g_fwidth) << (m_count / simu) <<
        std::setw (g_fwidth) << (simu / m_count));
 
+  return simu / m_count;
 }
 
 void
@@ -200,20 +206,126 @@ GetRandomStream (std::string filename)
 
 
 
+/**
+ * Configure the scheduler factory from a short scheduler name.
+ *
+ * \param [in,out] factory The factory to configure.
+ * \param [in] name The scheduler name, as used on the command line.
+ * \param [in] calRev Reverse ordering in the CalendarScheduler.
+ */
+void
+SetSchedulerType (ObjectFactory &factory, std::string name, bool calRev)
+{
+  factory = ObjectFactory ();
+  if (name == "cal")
+    {
+      factory.SetTypeId ("ns3::CalendarScheduler");
+      factory.Set ("Reverse", BooleanValue (calRev));
+    }
+  else if (name == "heap")
+    {
+      factory.SetTypeId ("ns3::HeapScheduler");
+    }
+  else if (name == "ladder")
+    {
+      factory.SetTypeId ("ns3::LadderScheduler");
+    }
+  else if (name == "list")
+    {
+      factory.SetTypeId ("ns3::ListScheduler");
+    }
+  else if (name == "pri")
+    {
+      factory.SetTypeId ("ns3::PriorityQueueScheduler");
+    }
+  else
+    {
+      factory.SetTypeId ("ns3::MapScheduler");
+    }
+}
+
+/**
+ * Benchmark one scheduler.
+ *
+ * \param [in] bench The benchmark.
+ * \param [in] factory The scheduler factory.
+ * \param [in] order The insertion order description, if any.
+ * \param [in] pop The event population size.
+ * \param [in] total The total number of events to run.
+ * \param [in] runs The number of runs.
+ * \return The average simulation time per event, in seconds.
+ */
+double
+BenchScheduler (Bench *bench, ObjectFactory factory, std::string order,
+                uint32_t pop, uint32_t total, uint32_t runs)
+{
+  Simulator::SetScheduler (factory);
+
+  LOGME ("scheduler: " << factory.GetTypeId ().GetName () << order);
+  LOGME ("population: " << pop);
+  LOGME ("total events: " << total);
+  LOGME ("runs: " << runs);
+
+  // table header
+  LOG ("");
+  LOG (std::left << std::setw (g_fwidth) << "Run #" <<
+       std::left << std::setw (3 * g_fwidth) << "Initialization:" <<
+       std::left << std::setw (3 * g_fwidth) << "Simulation:");
+  LOG (std::left << std::setw (g_fwidth) << "" <<
+       std::left << std::setw (g_fwidth) << "Time (s)" <<
+       std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
+       std::left << std::setw (g_fwidth) << "Per (s/ev)" <<
+       std::left << std::setw (g_fwidth) << "Time (s)" <<
+       std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
+       std::left << std::setw (g_fwidth) << "Per (s/ev)" );
+  LOG (std::setfill ('-') <<
+       std::right << std::setw (g_fwidth) << " " <<
+       std::right << std::setw (g_fwidth) << " " <<
+       std::right << std::setw (g_fwidth) << " " <<
+       std::right << std::setw (g_fwidth) << " " <<
+       std::right << std::setw (g_fwidth) << " " <<
+       std::right << std::setw (g_fwidth) << " " <<
+       std::right << std::setw (g_fwidth) << " " <<
+       std::setfill (' ')
+       );
+
+  // prime
+  DEB ("priming");
+  std::cout << std::left << std::setw (g_fwidth) << "(prime)";
+  bench->RunBench ();
+
+  bench->SetPopulation (pop);
+  bench->SetTotal (total);
+  double per = 0;
+  for (uint32_t i = 0; i < runs; i++)
+    {
+      std::cout << std::setw (g_fwidth) << i;
+
+      per += bench->RunBench ();
+    }
+
+  LOG ("");
+  return per / std::max (runs, (uint32_t)1);
+}
+
+
 int main (int argc, char *argv[])
 {
 
   bool schedCal           = false;
   bool schedHeap          = false;
+  bool schedLadder        = false;
   bool schedList          = false;
   bool schedMap           = true;
   bool schedPriorityQueue = false;
+  bool schedAll           = false;
 
   uint32_t pop   =  100000;
   uint32_t total = 1000000;
   uint32_t runs  =       1;
   std::string filename = "";
   bool calRev = false;
+  bool pool = false;
 
   CommandLine cmd (__FILE__);
   cmd.Usage ("Benchmark the simulator scheduler.\n"
@@ -223,13 +335,19 @@ int main (int argc, char *argv[])
              "  an ascii file, given by the --file=\"<filename>\" argument,\n"
              "  or standard input, by the argument --file=\"-\"\n"
              "In the case of either --file form, the input is expected\n"
-             "to be ascii, giving the relative event times in ns.");
+             "to be ascii, giving the relative event times in ns.\n"
+             "\n"
+             "With --all, every scheduler except the ListScheduler is\n"
+             "benchmarked in turn, and the results are summarized at the end.");
   cmd.AddValue ("cal",   "use CalendarSheduler",          schedCal);
   cmd.AddValue ("calrev", "reverse ordering in the CalendarScheduler", calRev);
   cmd.AddValue ("heap",  "use HeapScheduler",             schedHeap);
+  cmd.AddValue ("ladder", "use LadderScheduler",          schedLadder);
   cmd.AddValue ("list",  "use ListSheduler",              schedList);
   cmd.AddValue ("map",   "use MapScheduler (default)",    schedMap);
   cmd.AddValue ("pri",   "use PriorityQueue",             schedPriorityQueue);
+  cmd.AddValue ("all",   "benchmark and compare all schedulers", schedAll);
+  cmd.AddValue ("pool",  "recycle events through the event pool", pool);
   cmd.AddValue ("debug", "enable debugging output",       g_debug);
   cmd.AddValue ("pop",   "event population size (default 1E5)",         pop);
   cmd.AddValue ("total", "total number of events to run (default 1E6)", total);
@@ -240,81 +358,81 @@ int main (int argc, char *argv[])
   g_me = cmd.GetName () + ": ";
   g_fwidth += 6;  // 5 extra chars in '2.000002e+07 ': . e+0 _
 
-  ObjectFactory factory ("ns3::MapScheduler");
-  if (schedCal)
+  std::vector<std::string> names;
+  if (schedAll)
     {
-      factory.SetTypeId ("ns3::CalendarScheduler");
-      factory.Set ("Reverse", BooleanValue (calRev));
+      names = { "map", "heap", "cal", "pri", "ladder" };
     }
-  if (schedHeap)
+  else if (schedPriorityQueue)
     {
-      factory.SetTypeId ("ns3::HeapScheduler");
+      names.push_back ("pri");
     }
-  if (schedList)
+  else if (schedList)
     {
-      factory.SetTypeId ("ns3::ListScheduler");
+      names.push_back ("list");
     }
-  if (schedPriorityQueue)
+  else if (schedLadder)
     {
-      factory.SetTypeId ("ns3::PriorityQueueScheduler");
+      names.push_back ("ladder");
+    }
+  else if (schedHeap)
+    {
+      names.push_back ("heap");
+    }
+  else if (schedCal)
+    {
+      names.push_back ("cal");
+    }
+  else
+    {
+      names.push_back ("map");
     }
-      
-  Simulator::SetScheduler (factory);
+
+  Config::SetGlobal ("EventPool", BooleanValue (pool));
 
   LOGME (std::setprecision (g_fwidth - 6));
   DEB ("debugging is ON");
 
-  std::string order;
-  if (schedCal)
-    {
-      order = ": insertion order: " + std::string (calRev ? "reverse" : "normal");
-    }
-  LOGME ("scheduler: " << factory.GetTypeId ().GetName () << order);
-  LOGME ("population: " << pop);
-  LOGME ("total events: " << total);
-  LOGME ("runs: " << runs);
-
   Bench *bench = new Bench (pop, total);
   bench->SetRandomStream (GetRandomStream (filename));
 
-  // table header
-  LOG ("");
-  LOG (std::left << std::setw (g_fwidth) << "Run #" <<
-       std::left << std::setw (3 * g_fwidth) << "Initialization:" <<
-       std::left << std::setw (3 * g_fwidth) << "Simulation:");
-  LOG (std::left << std::setw (g_fwidth) << "" <<
-       std::left << std::setw (g_fwidth) << "Time (s)" <<
-       std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
-       std::left << std::setw (g_fwidth) << "Per (s/ev)" <<
-       std::left << std::setw (g_fwidth) << "Time (s)" <<
-       std::left << std::setw (g_fwidth) << "Rate (ev/s)" <<
-       std::left << std::setw (g_fwidth) << "Per (s/ev)" );
-  LOG (std::setfill ('-') <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::right << std::setw (g_fwidth) << " " <<
-       std::setfill (' ')
-       );
-
-  // prime
-  DEB ("priming");
-  std::cout << std::left << std::setw (g_fwidth) << "(prime)";
-  bench->RunBench ();
+  std::vector<std::pair<std::string, double> > results;
+  for (std::vector<std::string>::const_iterator i = names.begin (); i != names.end (); ++i)
+    {
+      ObjectFactory factory;
+      SetSchedulerType (factory, *i, calRev);
+      std::string order;
+      if (*i == "cal")
+        {
+          order = ": insertion order: " + std::string (calRev ? "reverse" : "normal");
+        }
+      double per = BenchScheduler (bench, factory, order, pop, total, runs);
+      results.push_back (std::make_pair (factory.GetTypeId ().GetName (), per));
+    }
 
-  bench->SetPopulation (pop);
-  bench->SetTotal (total);
-  for (uint32_t i = 0; i < runs; i++)
+  if (results.size () > 1)
     {
-      std::cout << std::setw (g_fwidth) << i;
+      // results: simulation cost per event, relative to the first scheduler
+      LOG ("Results:");
+      LOG (std::left << std::setw (3 * g_fwidth) << "Scheduler" <<
+           std::left << std::setw (g_fwidth) << "Per (s/ev)" <<
+           std::left << std::setw (g_fwidth) << "Relative");
+      for (std::vector<std::pair<std::string, double> >::const_iterator i = results.begin ();
+           i != results.end (); ++i)
+        {
+          LOG (std::left << std::setw (3 * g_fwidth) << i->first <<
+               std::left << std::setw (g_fwidth) << i->second <<
+               std::left << std::setw (g_fwidth) << (i->second / results.front ().second));
+        }
+      LOG ("");
+    }
 
-      bench->RunBench ();
+  if (pool)
+    {
+      LOGME ("events allocated: " << Simulator::GetAllocatedEventCount ());
+      LOGME ("events recycled: " << Simulator::GetRecycledEventCount ());
     }
 
-  LOG ("");
   Simulator::Destroy ();
   delete bench;
   return 0;
@@ -0,0 +1,235 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the scoreboard of TcpTxBuffer,
+// by driving it with a lossy flow with a large window, as a high
+// bandwidth-delay product flow would have.  The receiver is emulated: it
+// acknowledges, with SACK blocks, each segment which is not dropped.
+// Sample usage:  ./waf --run 'bench-tcp-tx-buffer --window=20000 --loss=0.01'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/packet.h"
+#include "ns3/tcp-tx-buffer.h"
+#include <iostream>
+#include <limits>
+#include <map>
+#include <vector>
+
+using namespace ns3;
+
+/// The receiver window, always open
+static uint32_t
+GetRWnd (void)
+{
+  return std::numeric_limits<uint32_t>::max () / 2;
+}
+
+/// The receiver side of the flow
+class BenchReceiver
+{
+public:
+  /**
+   * Constructor.
+   * \param head the first sequence number
+   */
+  BenchReceiver (SequenceNumber32 head);
+  /**
+   * Receive a segment.
+   * \param start the sequence number of the first byte
+   * \param end the sequence number of the last byte plus one
+   */
+  void Receive (SequenceNumber32 start, SequenceNumber32 end);
+  /**
+   * \returns the cumulative acknowledgment number
+   */
+  SequenceNumber32 GetAck (void) const;
+  /**
+   * \returns the SACK blocks: the last block updated, and the highest ones
+   */
+  TcpOptionSack::SackList GetSackList (void) const;
+
+private:
+  SequenceNumber32 m_next;  //!< The next expected sequence number
+  std::map<SequenceNumber32, SequenceNumber32> m_blocks; //!< The out of order blocks
+  SequenceNumber32 m_last;  //!< The start of the last block updated
+};
+
+BenchReceiver::BenchReceiver (SequenceNumber32 head)
+  : m_next (head)
+{}
+
+void
+BenchReceiver::Receive (SequenceNumber32 start, SequenceNumber32 end)
+{
+  if (end <= m_next)
+    {
+      return;
+    }
+  if (start <= m_next)
+    {
+      m_next = end;
+      while (!m_blocks.empty () && m_blocks.begin ()->first <= m_next)
+        {
+          m_next = std::max (m_next, m_blocks.begin ()->second);
+          m_blocks.erase (m_blocks.begin ());
+        }
+      return;
+    }
+  // Merge with the block before, and with the blocks after
+  std::map<SequenceNumber32, SequenceNumber32>::iterator it = m_blocks.upper_bound (start);
+  if (it != m_blocks.begin ())
+    {
+      std::map<SequenceNumber32, SequenceNumber32>::iterator previous = it;
+      previous--;
+      if (previous->second >= start)
+        {
+          start = previous->first;
+          end = std::max (end, previous->second);
+          m_blocks.erase (previous);
+        }
+    }
+  while (it != m_blocks.end () && it->first <= end)
+    {
+      end = std::max (end, it->second);
+      it = m_blocks.erase (it);
+    }
+  m_blocks[start] = end;
+  m_last = start;
+}
+
+SequenceNumber32
+BenchReceiver::GetAck (void) const
+{
+  return m_next;
+}
+
+TcpOptionSack::SackList
+BenchReceiver::GetSackList (void) const
+{
+  TcpOptionSack::SackList list;
+  std::map<SequenceNumber32, SequenceNumber32>::const_iterator last = m_blocks.find (m_last);
+  if (last != m_blocks.end ())
+    {
+      list.push_back (*last);
+    }
+  std::map<SequenceNumber32, SequenceNumber32>::const_reverse_iterator it;
+  for (it = m_blocks.rbegin (); it != m_blocks.rend () && list.size () < 3; it++)
+    {
+      if (it->first != m_last)
+        {
+          list.push_back (*it);
+        }
+    }
+  return list;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t window = 10000;
+  uint32_t segmentSize = 1448;
+  double loss = 0.01;
+  uint32_t windows = 10;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Benchmark the TcpTxBuffer scoreboard");
+  cmd.AddValue ("window", "the window, in segments", window);
+  cmd.AddValue ("segmentSize", "the segment size, in bytes", segmentSize);
+  cmd.AddValue ("loss", "the probability to drop a segment", loss);
+  cmd.AddValue ("windows", "the amount of data to send, in windows", windows);
+  cmd.Parse (argc, argv);
+
+  SequenceNumber32 head (1);
+  uint64_t total = static_cast<uint64_t> (window) * segmentSize * windows;
+  SequenceNumber32 tail = head + SequenceNumber32 (total);
+  Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer> ();
+  txBuf->SetRWndCallback (MakeCallback (&GetRWnd));
+  txBuf->SetHeadSequence (head);
+  txBuf->SetSegmentSize (segmentSize);
+  txBuf->SetDupAckThresh (3);
+  txBuf->SetMaxBufferSize (2 * window * segmentSize);
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  BenchReceiver receiver (head);
+
+  std::cout << "Running bench-tcp-tx-buffer with a window of " << window
+            << " segments and a loss of " << loss << std::endl;
+
+  uint64_t added = 0;
+  uint64_t segments = 0;
+  uint64_t retransmissions = 0;
+  uint64_t timeouts = 0;
+  SystemWallClockMs clock;
+  clock.Start ();
+  while (txBuf->HeadSequence () < tail)
+    {
+      while (added < total && txBuf->Available () >= segmentSize)
+        {
+          txBuf->Add (Create<Packet> (segmentSize));
+          added += segmentSize;
+        }
+
+      // Send a window, and keep the segments which are not dropped
+      std::vector<std::pair<SequenceNumber32, SequenceNumber32> > received;
+      SequenceNumber32 seq;
+      SequenceNumber32 seqHigh;
+      bool isRecovery = txBuf->GetSacked () > 0;
+      while (txBuf->BytesInFlight () < window * segmentSize
+             && txBuf->NextSeg (&seq, &seqHigh, isRecovery))
+        {
+          uint32_t size = std::min<uint32_t> (segmentSize, seqHigh - seq);
+          TcpTxItem *item = txBuf->CopyFromSequence (size, seq);
+          if (item == nullptr)
+            {
+              break;
+            }
+          segments++;
+          if (item->IsRetrans ())
+            {
+              retransmissions++;
+            }
+          if (random->GetValue () >= loss)
+            {
+              received.push_back (std::make_pair (seq, seq + item->GetSeqSize ()));
+            }
+        }
+
+      // Acknowledge them
+      for (uint32_t i = 0; i < received.size (); i++)
+        {
+          receiver.Receive (received[i].first, received[i].second);
+          txBuf->DiscardUpTo (receiver.GetAck ());
+          TcpOptionSack::SackList list = receiver.GetSackList ();
+          if (!list.empty ())
+            {
+              txBuf->Update (list);
+            }
+        }
+      if (received.empty ())
+        {
+          // Nothing left to send, or all lost: emulate a retransmission timeout
+          txBuf->SetSentListLost ();
+          timeouts++;
+        }
+    }
+  int64_t elapsed = clock.End ();
+
+  std::cout << segments << " segments sent (" << retransmissions << " retransmissions, "
+            << timeouts << " timeouts) in " << elapsed << " ms" << std::endl;
+  return 0;
+}
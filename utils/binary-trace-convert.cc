@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program reads a binary trace, as written by the default trace sinks
+// of AsciiTraceHelper to the streams of CreateBinaryFileStream, and writes
+// its records as comma separated values, or as text lines.
+// Sample usage:  ./waf --run 'binary-trace-convert --input=trace.bin --format=csv'
+
+#include "ns3/command-line.h"
+#include "ns3/binary-trace.h"
+#include "ns3/ipv4-address.h"
+#include <fstream>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Write a record as comma separated values.
+ * \param os the output stream
+ * \param record the record
+ * \param flows whether the records have the flow columns
+ */
+static void
+WriteCsv (std::ostream &os, const BinaryTrace::Record &record, bool flows)
+{
+  os << record.time << "," << static_cast<char> (record.event) << ",";
+  if (record.node != BinaryTrace::UNKNOWN_ID)
+    {
+      os << record.node;
+    }
+  os << ",";
+  if (record.device != BinaryTrace::UNKNOWN_ID)
+    {
+      os << record.device;
+    }
+  os << "," << record.uid << "," << record.size;
+  if (flows)
+    {
+      os << "," << Ipv4Address (record.source) << "," << Ipv4Address (record.destination)
+         << "," << record.sourcePort << "," << record.destinationPort
+         << "," << static_cast<uint32_t> (record.protocol);
+    }
+  os << "\n";
+}
+
+/**
+ * Write a record as a text line, in the spirit of the text traces.
+ * \param os the output stream
+ * \param record the record
+ * \param flows whether the records have the flow columns
+ */
+static void
+WriteText (std::ostream &os, const BinaryTrace::Record &record, bool flows)
+{
+  os << static_cast<char> (record.event) << " " << record.time / 1e9;
+  if (record.node != BinaryTrace::UNKNOWN_ID)
+    {
+      os << " /NodeList/" << record.node;
+    }
+  if (record.device != BinaryTrace::UNKNOWN_ID)
+    {
+      os << "/DeviceList/" << record.device;
+    }
+  os << " uid=" << record.uid << " size=" << record.size;
+  if (flows && record.protocol != 0)
+    {
+      os << " " << Ipv4Address (record.source) << ":" << record.sourcePort
+         << " > " << Ipv4Address (record.destination) << ":" << record.destinationPort
+         << " protocol=" << static_cast<uint32_t> (record.protocol);
+    }
+  os << "\n";
+}
+
+int main (int argc, char *argv[])
+{
+  std::string input;
+  std::string format = "csv";
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Convert a binary trace to comma separated values or to text");
+  cmd.AddValue ("input", "the binary trace file", input);
+  cmd.AddValue ("format", "the output format, csv or text", format);
+  cmd.Parse (argc, argv);
+
+  if (format != "csv" && format != "text")
+    {
+      std::cerr << "Unknown format " << format << std::endl;
+      return 1;
+    }
+  std::ifstream is (input.c_str (), std::ios::in | std::ios::binary);
+  bool flows;
+  if (!is.is_open () || !BinaryTrace::ReadHeader (is, flows))
+    {
+      std::cerr << "Unable to read the binary trace " << input << std::endl;
+      return 1;
+    }
+
+  if (format == "csv")
+    {
+      std::cout << "time,event,node,device,uid,size";
+      if (flows)
+        {
+          std::cout << ",source,destination,sourcePort,destinationPort,protocol";
+        }
+      std::cout << "\n";
+    }
+  BinaryTrace::Record record;
+  while (BinaryTrace::Read (is, record, flows))
+    {
+      if (format == "csv")
+        {
+          WriteCsv (std::cout, record, flows);
+        }
+      else
+        {
+          WriteText (std::cout, record, flows);
+        }
+    }
+  return 0;
+}